@@ -59,21 +59,29 @@ namespace netmeld::core::utils {
 
   std::string
   cmdExecOut(const std::string& _cmd)
+  {
+    int exitStatus;
+    return cmdExecOut(_cmd, exitStatus);
+  }
+
+  std::string
+  cmdExecOut(const std::string& _cmd, int& _exitStatus)
   {
     LOG_DEBUG << _cmd << '\n';
 
-    std::unique_ptr<FILE, decltype(&pclose)>
-        pipe(popen(_cmd.c_str(), "r"), pclose);
-    if (!pipe) {
+    _exitStatus = -1;
+    FILE* pipe {popen(_cmd.c_str(), "r")};
+    if (nullptr == pipe) {
       LOG_ERROR << "Failure: " << _cmd << '\n';
       return "";
     }
 
     std::array<char, 128> buffer;
     std::ostringstream oss;
-    while (fgets(buffer.data(), buffer.size(), pipe.get()) != nullptr) {
+    while (fgets(buffer.data(), buffer.size(), pipe) != nullptr) {
       oss << buffer.data();
     }
+    _exitStatus = pclose(pipe);
 
     return oss.str();
   }
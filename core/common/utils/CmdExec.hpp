@@ -36,6 +36,7 @@ namespace netmeld::core::utils {
   int cmdExecOrExit(const std::string&);
   int cmdExec(const std::string&);
   std::string cmdExecOut(const std::string&);
+  std::string cmdExecOut(const std::string&, int&);
 
 }
 
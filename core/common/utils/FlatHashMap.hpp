@@ -0,0 +1,166 @@
+// =============================================================================
+// Copyright 2023 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+// =============================================================================
+
+#ifndef FLAT_HASH_MAP_HPP
+#define FLAT_HASH_MAP_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace netmeld::core::utils {
+
+  /* Open-addressing (linear probing) hash map for aggregation tables.
+
+     Keys and values live inline in one contiguous slot array, so lookups of
+     existing keys neither allocate nor chase pointers.  Intended for small,
+     trivially copyable keys (e.g., IpKey, MacKey) and insert/update heavy
+     use; there is no erase.  K and V must be default constructible.
+     Iteration order is unspecified.
+  */
+  template<typename K, typename V, typename Hash = std::hash<K>>
+  class FlatHashMap {
+    // =========================================================================
+    // Variables
+    // =========================================================================
+    private: // Variables will probably rarely appear at this scope
+      // Grow once more than 7/8 of the slots are in use
+      static constexpr size_t MAX_LOAD_NUM {7};
+      static constexpr size_t MAX_LOAD_DEN {8};
+
+      std::vector<std::pair<K, V>> slots;
+      std::vector<uint8_t>         used;
+      size_t                       numUsed {0};
+      Hash                         hasher;
+
+    protected: // Variables intended for internal/subclass API
+    public: // Variables should rarely appear at this scope
+
+    // =========================================================================
+    // Iterators
+    // =========================================================================
+    private:
+      template<bool IsConst>
+      class Iterator {
+        private:
+          using Map  = std::conditional_t<IsConst,
+                                          const FlatHashMap, FlatHashMap>;
+          using Slot = std::conditional_t<IsConst,
+                                          const std::pair<K, V>,
+                                          std::pair<K, V>>;
+
+          Map*   map   {nullptr};
+          size_t index {0};
+
+          void skipUnused()
+          {
+            while (index < map->used.size() && !map->used[index]) {
+              ++index;
+            }
+          }
+
+        public:
+          using iterator_category = std::forward_iterator_tag;
+          using value_type        = std::pair<K, V>;
+          using difference_type   = std::ptrdiff_t;
+          using pointer           = Slot*;
+          using reference         = Slot&;
+
+          Iterator() = default;
+          Iterator(Map* _map, size_t _index) : map(_map), index(_index)
+          { skipUnused(); }
+
+          reference operator*() const { return map->slots[index]; }
+          pointer operator->() const { return &map->slots[index]; }
+
+          Iterator& operator++()
+          {
+            ++index;
+            skipUnused();
+            return *this;
+          }
+          Iterator operator++(int)
+          {
+            auto tmp {*this};
+            ++(*this);
+            return tmp;
+          }
+
+          bool operator==(const Iterator& rhs) const
+          { return map == rhs.map && index == rhs.index; }
+      };
+
+    public:
+      using iterator       = Iterator<false>;
+      using const_iterator = Iterator<true>;
+
+    // =========================================================================
+    // Constructors
+    // =========================================================================
+    private: // Constructors which should be hidden from API users
+    protected: // Constructors part of subclass API
+    public: // Constructors part of public API
+      FlatHashMap() = default;
+      explicit FlatHashMap(size_t);
+
+    // =========================================================================
+    // Methods
+    // =========================================================================
+    private: // Methods which should be hidden from API users
+      size_t findSlot(const K&) const;
+      void   rehash(size_t);
+
+    protected: // Methods part of subclass API
+    public: // Methods part of public API
+      [[nodiscard]] bool empty() const;
+      size_t size() const;
+      size_t capacity() const;
+
+      void clear();
+      void reserve(size_t);
+
+      // Insert a default constructed value if the key is absent
+      V& operator[](const K&);
+      // True if inserted; value is only moved from when inserted
+      std::pair<iterator, bool> tryEmplace(const K&, V&&);
+
+      iterator find(const K&);
+      const_iterator find(const K&) const;
+      size_t count(const K&) const;
+
+      iterator begin();
+      iterator end();
+      const_iterator begin() const;
+      const_iterator end() const;
+  };
+}
+#include "FlatHashMap.ipp"
+
+#endif // FLAT_HASH_MAP_HPP
@@ -0,0 +1,211 @@
+// =============================================================================
+// Copyright 2023 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+// =============================================================================
+
+// NOTE This implementation is included in the header (at the end) since it
+//      leverages templating.
+
+
+namespace netmeld::core::utils {
+
+  // ===========================================================================
+  // Constructors
+  // ===========================================================================
+  template<typename K, typename V, typename H>
+  FlatHashMap<K,V,H>::FlatHashMap(size_t _count)
+  {
+    reserve(_count);
+  }
+
+
+  // ===========================================================================
+  // Methods
+  // ===========================================================================
+  template<typename K, typename V, typename H>
+  typename FlatHashMap<K,V,H>::iterator
+  FlatHashMap<K,V,H>::begin()
+  {
+    return iterator(this, 0);
+  }
+
+  template<typename K, typename V, typename H>
+  typename FlatHashMap<K,V,H>::const_iterator
+  FlatHashMap<K,V,H>::begin() const
+  {
+    return const_iterator(this, 0);
+  }
+
+  template<typename K, typename V, typename H>
+  size_t
+  FlatHashMap<K,V,H>::capacity() const
+  {
+    return slots.size();
+  }
+
+  template<typename K, typename V, typename H>
+  void
+  FlatHashMap<K,V,H>::clear()
+  {
+    slots.clear();
+    used.clear();
+    numUsed = 0;
+  }
+
+  template<typename K, typename V, typename H>
+  size_t
+  FlatHashMap<K,V,H>::count(const K& key) const
+  {
+    return (end() == find(key)) ? 0 : 1;
+  }
+
+  template<typename K, typename V, typename H>
+  [[nodiscard]] bool
+  FlatHashMap<K,V,H>::empty() const
+  {
+    return 0 == numUsed;
+  }
+
+  template<typename K, typename V, typename H>
+  typename FlatHashMap<K,V,H>::iterator
+  FlatHashMap<K,V,H>::end()
+  {
+    return iterator(this, slots.size());
+  }
+
+  template<typename K, typename V, typename H>
+  typename FlatHashMap<K,V,H>::const_iterator
+  FlatHashMap<K,V,H>::end() const
+  {
+    return const_iterator(this, slots.size());
+  }
+
+  template<typename K, typename V, typename H>
+  typename FlatHashMap<K,V,H>::iterator
+  FlatHashMap<K,V,H>::find(const K& key)
+  {
+    if (slots.empty()) {
+      return end();
+    }
+    const auto index {findSlot(key)};
+    return used[index] ? iterator(this, index) : end();
+  }
+
+  template<typename K, typename V, typename H>
+  typename FlatHashMap<K,V,H>::const_iterator
+  FlatHashMap<K,V,H>::find(const K& key) const
+  {
+    if (slots.empty()) {
+      return end();
+    }
+    const auto index {findSlot(key)};
+    return used[index] ? const_iterator(this, index) : end();
+  }
+
+  // Index of the key's slot, or of the empty slot it would be placed in
+  template<typename K, typename V, typename H>
+  size_t
+  FlatHashMap<K,V,H>::findSlot(const K& key) const
+  {
+    const size_t mask {slots.size() - 1};
+    size_t index {hasher(key) & mask};
+    while (used[index] && !(slots[index].first == key)) {
+      index = (index + 1) & mask;
+    }
+    return index;
+  }
+
+  template<typename K, typename V, typename H>
+  V&
+  FlatHashMap<K,V,H>::operator[](const K& key)
+  {
+    if (auto it {find(key)}; end() != it) {
+      return it->second;
+    }
+    return tryEmplace(key, V()).first->second;
+  }
+
+  template<typename K, typename V, typename H>
+  void
+  FlatHashMap<K,V,H>::rehash(size_t _capacity)
+  {
+    std::vector<std::pair<K, V>> oldSlots(_capacity);
+    std::vector<uint8_t>         oldUsed(_capacity, 0);
+    oldSlots.swap(slots);
+    oldUsed.swap(used);
+
+    for (size_t i {0}; i < oldSlots.size(); ++i) {
+      if (oldUsed[i]) {
+        const auto index {findSlot(oldSlots[i].first)};
+        slots[index] = std::move(oldSlots[i]);
+        used[index]  = 1;
+      }
+    }
+  }
+
+  template<typename K, typename V, typename H>
+  void
+  FlatHashMap<K,V,H>::reserve(size_t _count)
+  {
+    size_t needed {8};
+    while (needed * MAX_LOAD_NUM < _count * MAX_LOAD_DEN) {
+      needed <<= 1;
+    }
+    if (needed > slots.size()) {
+      rehash(needed);
+    }
+  }
+
+  template<typename K, typename V, typename H>
+  size_t
+  FlatHashMap<K,V,H>::size() const
+  {
+    return numUsed;
+  }
+
+  template<typename K, typename V, typename H>
+  std::pair<typename FlatHashMap<K,V,H>::iterator, bool>
+  FlatHashMap<K,V,H>::tryEmplace(const K& key, V&& value)
+  {
+    if ((numUsed + 1) * MAX_LOAD_DEN > slots.size() * MAX_LOAD_NUM) {
+      reserve(numUsed + 1);
+    }
+
+    const auto index {findSlot(key)};
+    if (used[index]) {
+      return {iterator(this, index), false};
+    }
+
+    slots[index].first  = key;
+    slots[index].second = std::move(value);
+    used[index] = 1;
+    ++numUsed;
+    return {iterator(this, index), true};
+  }
+
+
+  // ===========================================================================
+  // Friends
+  // ===========================================================================
+}
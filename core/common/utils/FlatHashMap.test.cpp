@@ -0,0 +1,144 @@
+// =============================================================================
+// Copyright 2023 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+// =============================================================================
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+
+#include <map>
+#include <string>
+
+#include <boost/test/unit_test.hpp>
+
+#include <netmeld/core/utils/FlatHashMap.hpp>
+
+namespace nmcu = netmeld::core::utils;
+
+
+// Forces every key into the same probe chain
+struct CollidingHash {
+  size_t operator()(int) const { return 0; }
+};
+
+BOOST_AUTO_TEST_CASE(testConstructors)
+{
+  {
+    nmcu::FlatHashMap<int, int> fhm;
+    BOOST_TEST(fhm.empty());
+    BOOST_TEST(0 == fhm.size());
+    BOOST_TEST(0 == fhm.capacity());
+    BOOST_TEST((fhm.begin() == fhm.end()));
+    BOOST_TEST((fhm.end() == fhm.find(1)));
+    BOOST_TEST(0 == fhm.count(1));
+  }
+
+  {
+    nmcu::FlatHashMap<int, int> fhm {100};
+    BOOST_TEST(fhm.empty());
+    BOOST_TEST(128 <= fhm.capacity());
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testInsertFind)
+{
+  {
+    nmcu::FlatHashMap<int, std::string> fhm;
+    fhm[1] = "one";
+    fhm[2] = "two";
+    BOOST_TEST(2 == fhm.size());
+    BOOST_TEST("one" == fhm[1]);
+    BOOST_TEST(2 == fhm.size());
+
+    auto [it, inserted] {fhm.tryEmplace(1, "uno")};
+    BOOST_TEST(!inserted);
+    BOOST_TEST("one" == it->second);
+
+    std::string three {"three"};
+    std::tie(it, inserted) = fhm.tryEmplace(3, std::move(three));
+    BOOST_TEST(inserted);
+    BOOST_TEST("three" == it->second);
+
+    BOOST_TEST(1 == fhm.count(2));
+    BOOST_TEST(0 == fhm.count(4));
+    BOOST_TEST("two" == fhm.find(2)->second);
+
+    const auto& cfhm {fhm};
+    BOOST_TEST("three" == cfhm.find(3)->second);
+    BOOST_TEST((cfhm.end() == cfhm.find(4)));
+  }
+
+  { // value untouched when not inserted
+    nmcu::FlatHashMap<int, std::string> fhm;
+    fhm[1] = "one";
+    std::string value {"uno"};
+    fhm.tryEmplace(1, std::move(value));
+    BOOST_TEST("uno" == value);
+  }
+
+  { // collisions and growth
+    nmcu::FlatHashMap<int, int, CollidingHash> fhm;
+    for (int i {0}; i < 100; ++i) {
+      fhm[i] = i * 2;
+    }
+    BOOST_TEST(100 == fhm.size());
+    for (int i {0}; i < 100; ++i) {
+      BOOST_TEST(i * 2 == fhm.find(i)->second);
+    }
+    BOOST_TEST((fhm.end() == fhm.find(100)));
+  }
+
+  {
+    nmcu::FlatHashMap<int, int> fhm;
+    fhm[1] = 1;
+    fhm.clear();
+    BOOST_TEST(fhm.empty());
+    BOOST_TEST(0 == fhm.count(1));
+    fhm[2] = 2;
+    BOOST_TEST(1 == fhm.size());
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testIteration)
+{
+  nmcu::FlatHashMap<int, int> fhm;
+  std::map<int, int> expected;
+  for (int i {0}; i < 1000; i += 3) {
+    fhm[i] = -i;
+    expected[i] = -i;
+  }
+
+  std::map<int, int> seen;
+  for (const auto& [key, value] : fhm) {
+    seen[key] = value;
+  }
+  BOOST_TEST((expected == seen));
+
+  for (auto& [key, value] : fhm) {
+    value = key;
+  }
+  for (const auto& [key, value] : std::as_const(fhm)) {
+    BOOST_TEST(key == value);
+  }
+}
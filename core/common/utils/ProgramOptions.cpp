@@ -24,6 +24,8 @@
 // Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
 // =============================================================================
 
+#include <typeinfo>
+
 #include <boost/algorithm/string/join.hpp>
 
 #include <netmeld/core/utils/ProgramOptions.hpp>
@@ -186,11 +188,16 @@ namespace netmeld::core::utils {
   ProgramOptions::getValues(const std::string& key) const
   {
     try {
-      if (varMap.count(key)) {
-        return varMap.at(key).as<std::vector<std::string>>();
-      } else {
+      if (!varMap.count(key)) {
         return std::vector<std::string>();
       }
+      // Options declared with a single value are treated as a list of one
+      const auto& value {varMap.at(key)};
+      if (typeid(std::string) == value.value().type()) {
+        return {value.as<std::string>()};
+      } else {
+        return value.as<std::vector<std::string>>();
+      }
     } catch (std::exception& e) {
       LOG_ERROR << "ProgramOptions::getValues(): "
                 << e.what()
@@ -303,14 +310,20 @@ namespace netmeld::core::utils {
     po::notify(varMap);
 
     if (varMap.count("data-path") && optionsMaps[REQUIRED].count("data-path")) {
-      sfs::path const dataFile {varMap.at("data-path").as<std::string>()};
+      const auto& dataFiles {getValues("data-path")};
       if (varMap.count("pipe")) {
-        nmfm.pipedInputFile(dataFile);
+        if (1 != dataFiles.size()) {
+          LOG_ERROR << "Option --pipe requires exactly one DATA_PATH\n";
+          std::exit(Exit::FAILURE);
+        }
+        nmfm.pipedInputFile(dataFiles.front());
       }
-      if (!sfs::exists(dataFile)) {
-        LOG_ERROR << "Specified DATA_PATH does not exist: "
-                  << dataFile.string() << '\n';
-        std::exit(Exit::FAILURE);
+      for (const auto& dataFile : dataFiles) {
+        if (!sfs::exists(dataFile)) {
+          LOG_ERROR << "Specified DATA_PATH does not exist: "
+                    << dataFile << '\n';
+          std::exit(Exit::FAILURE);
+        }
       }
     }
 
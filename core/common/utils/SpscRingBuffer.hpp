@@ -0,0 +1,95 @@
+// =============================================================================
+// Copyright 2023 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+// =============================================================================
+
+#ifndef SPSC_RING_BUFFER_HPP
+#define SPSC_RING_BUFFER_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <vector>
+
+namespace netmeld::core::utils {
+
+  /* Lock-free, fixed capacity FIFO for exactly one producer thread and one
+     consumer thread.
+
+     Neither side ever blocks; tryPush fails when full and tryPop fails when
+     empty, so callers decide whether to spin, yield, or fall back to a
+     ThreadSafeQueue.  Capacity is rounded up to a power of two.  T must be
+     default constructible and move assignable as slots are reused.
+  */
+  template<typename T>
+  class SpscRingBuffer {
+    // =========================================================================
+    // Variables
+    // =========================================================================
+    private: // Variables will probably rarely appear at this scope
+      // Keep producer and consumer indices on separate cache lines
+      static constexpr size_t CACHE_LINE {64};
+
+      std::vector<T> slots;
+      const size_t   mask;
+
+      alignas(CACHE_LINE) std::atomic<size_t> head {0}; // consumer reads
+      alignas(CACHE_LINE) std::atomic<size_t> tail {0}; // producer writes
+
+    protected: // Variables intended for internal/subclass API
+    public: // Variables should rarely appear at this scope
+
+    // =========================================================================
+    // Constructors
+    // =========================================================================
+    private: // Constructors which should be hidden from API users
+    protected: // Constructors part of subclass API
+    public: // Constructors part of public API
+      explicit SpscRingBuffer(size_t);
+      SpscRingBuffer(const SpscRingBuffer<T>&) = delete;
+      SpscRingBuffer& operator=(const SpscRingBuffer<T>&) = delete;
+
+    // =========================================================================
+    // Methods
+    // =========================================================================
+    private: // Methods which should be hidden from API users
+      static size_t roundCapacity(size_t);
+
+    protected: // Methods part of subclass API
+    public: // Methods part of public API
+      // Approximate unless called from the producer or consumer thread
+      [[nodiscard]] bool isEmpty() const;
+      size_t size() const;
+      size_t getCapacity() const;
+
+      // Producer thread only
+      bool tryPush(const T&);
+      bool tryPush(T&&);
+
+      // Consumer thread only
+      bool tryPop(T&);
+  };
+}
+#include "SpscRingBuffer.ipp"
+
+#endif // SPSC_RING_BUFFER_HPP
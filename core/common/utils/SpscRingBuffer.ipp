@@ -0,0 +1,118 @@
+// =============================================================================
+// Copyright 2023 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+// =============================================================================
+
+// NOTE This implementation is included in the header (at the end) since it
+//      leverages templating.
+
+
+namespace netmeld::core::utils {
+
+  // ===========================================================================
+  // Constructors
+  // ===========================================================================
+  template<typename T>
+  SpscRingBuffer<T>::SpscRingBuffer(size_t _capacity) :
+    slots(roundCapacity(_capacity)),
+    mask(slots.size() - 1)
+  {}
+
+
+  // ===========================================================================
+  // Methods
+  // ===========================================================================
+  template<typename T>
+  size_t
+  SpscRingBuffer<T>::getCapacity() const
+  {
+    return slots.size();
+  }
+
+  template<typename T>
+  [[nodiscard]] bool
+  SpscRingBuffer<T>::isEmpty() const
+  {
+    return 0 == size();
+  }
+
+  template<typename T>
+  size_t
+  SpscRingBuffer<T>::roundCapacity(size_t _capacity)
+  {
+    size_t rounded {1};
+    while (rounded < _capacity) {
+      rounded <<= 1;
+    }
+    return rounded;
+  }
+
+  template<typename T>
+  size_t
+  SpscRingBuffer<T>::size() const
+  {
+    // Head first, so a concurrent pop can not make tail appear behind head
+    const auto h {head.load(std::memory_order_acquire)};
+    const auto t {tail.load(std::memory_order_acquire)};
+    return std::min(t - h, slots.size());
+  }
+
+  template<typename T>
+  bool
+  SpscRingBuffer<T>::tryPop(T& value)
+  {
+    const auto h {head.load(std::memory_order_relaxed)};
+    if (h == tail.load(std::memory_order_acquire)) {
+      return false;
+    }
+    value = std::move(slots[h & mask]);
+    head.store(h + 1, std::memory_order_release);
+    return true;
+  }
+
+  template<typename T>
+  bool
+  SpscRingBuffer<T>::tryPush(const T& value)
+  {
+    return tryPush(T(value));
+  }
+
+  template<typename T>
+  bool
+  SpscRingBuffer<T>::tryPush(T&& value)
+  {
+    const auto t {tail.load(std::memory_order_relaxed)};
+    if (t - head.load(std::memory_order_acquire) == slots.size()) {
+      return false;
+    }
+    slots[t & mask] = std::move(value);
+    tail.store(t + 1, std::memory_order_release);
+    return true;
+  }
+
+
+  // ===========================================================================
+  // Friends
+  // ===========================================================================
+}
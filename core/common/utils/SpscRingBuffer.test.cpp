@@ -0,0 +1,121 @@
+// =============================================================================
+// Copyright 2023 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+// =============================================================================
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+
+#include <memory>
+#include <thread>
+
+#include <boost/test/unit_test.hpp>
+
+#include <netmeld/core/utils/SpscRingBuffer.hpp>
+
+namespace nmcu = netmeld::core::utils;
+
+
+BOOST_AUTO_TEST_CASE(testConstructors)
+{
+  {
+    nmcu::SpscRingBuffer<int> srb {4};
+    BOOST_TEST(4 == srb.getCapacity());
+    BOOST_TEST(srb.isEmpty());
+    BOOST_TEST(0 == srb.size());
+  }
+
+  { // rounded to a power of two
+    nmcu::SpscRingBuffer<int> srb {5};
+    BOOST_TEST(8 == srb.getCapacity());
+  }
+  {
+    nmcu::SpscRingBuffer<int> srb {0};
+    BOOST_TEST(1 == srb.getCapacity());
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testPushPop)
+{
+  {
+    nmcu::SpscRingBuffer<int> srb {4};
+    int value {0};
+    BOOST_TEST(!srb.tryPop(value));
+
+    for (int i {0}; i < 4; ++i) {
+      BOOST_TEST(srb.tryPush(i));
+    }
+    BOOST_TEST(4 == srb.size());
+    BOOST_TEST(!srb.tryPush(4));
+
+    // wrap around several times, preserving order
+    for (int i {0}; i < 20; ++i) {
+      BOOST_TEST(srb.tryPop(value));
+      BOOST_TEST(i == value);
+      const int next {i + 4};
+      BOOST_TEST(srb.tryPush(next));
+    }
+    BOOST_TEST(4 == srb.size());
+    for (int i {20}; i < 24; ++i) {
+      BOOST_TEST(srb.tryPop(value));
+      BOOST_TEST(i == value);
+    }
+    BOOST_TEST(srb.isEmpty());
+  }
+
+  { // move-only values
+    nmcu::SpscRingBuffer<std::unique_ptr<int>> srb {2};
+    BOOST_TEST(srb.tryPush(std::make_unique<int>(1)));
+    std::unique_ptr<int> value;
+    BOOST_TEST(srb.tryPop(value));
+    BOOST_TEST(1 == *value);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testContention)
+{
+  // Small capacity, so the indexes wrap many times while both sides run
+  const size_t numValues {100000};
+  nmcu::SpscRingBuffer<size_t> srb {16};
+
+  std::thread producer([&srb, numValues]() {
+      for (size_t i {0}; i < numValues; ++i) {
+        while (!srb.tryPush(i)) {
+          std::this_thread::yield();
+        }
+      }
+    });
+  bool ordered {true};
+  size_t value {0};
+  for (size_t i {0}; i < numValues; ++i) {
+    while (!srb.tryPop(value)) {
+      std::this_thread::yield();
+    }
+    ordered = ordered && (i == value);
+  }
+  producer.join();
+
+  BOOST_TEST(ordered);
+  BOOST_TEST(srb.isEmpty());
+}
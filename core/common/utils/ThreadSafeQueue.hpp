@@ -27,11 +27,29 @@
 #ifndef THREAD_SAFE_QUEUE_HPP
 #define THREAD_SAFE_QUEUE_HPP
 
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
 #include <mutex>
 #include <queue>
+#include <vector>
 
 namespace netmeld::core::utils {
 
+  // Behavior of push/emplace on a bounded queue which is at capacity
+  enum class QueueFullPolicy {
+    BLOCK = 0,    // wait for space (i.e., backpressure)
+    DROP_NEWEST,  // discard the value being added
+    DROP_OLDEST,  // discard the value at the front to make room
+  };
+
+  /* Multi-producer/multi-consumer FIFO guarded by a single mutex.
+
+     Consumers block on a condition variable (waitPop) or take whatever is
+     ready (tryPop, drainTo) instead of polling.  Once closed, adds fail and
+     waiting consumers are woken; values already queued can still be taken.
+     See SpscRingBuffer for the lock-free single producer/consumer case.
+  */
   template<typename T>
   class ThreadSafeQueue {
     // =========================================================================
@@ -40,6 +58,13 @@ namespace netmeld::core::utils {
     private: // Variables will probably rarely appear at this scope
       std::queue<T> queue;
       mutable std::mutex queueMutex;
+      std::condition_variable notEmpty;
+      std::condition_variable notFull;
+
+      size_t          capacity {0}; // 0 is unbounded
+      QueueFullPolicy policy   {QueueFullPolicy::BLOCK};
+      size_t          dropped  {0};
+      bool            closed   {false};
 
     protected: // Variables intended for internal/subclass API
     public: // Variables should rarely appear at this scope
@@ -51,6 +76,8 @@ namespace netmeld::core::utils {
     protected: // Constructors part of subclass API
     public: // Constructors part of public API
       ThreadSafeQueue() = default;
+      explicit ThreadSafeQueue(size_t,
+                               QueueFullPolicy=QueueFullPolicy::BLOCK);
       ThreadSafeQueue(const ThreadSafeQueue<T>&) = delete;
       ThreadSafeQueue& operator=(const ThreadSafeQueue<T>&) = delete;
 
@@ -58,14 +85,40 @@ namespace netmeld::core::utils {
     // Methods
     // =========================================================================
     private: // Methods which should be hidden from API users
+      template<typename... Args>
+      bool add(Args&&...);
+
     protected: // Methods part of subclass API
     public: // Methods part of public API
       [[nodiscard]] bool isEmpty() const;
+      [[nodiscard]] bool isClosed() const;
       size_t size() const;
+      size_t getCapacity() const;
+      size_t getDroppedCount() const;
 
-      const T& front() const;
+      void setCapacity(size_t, QueueFullPolicy=QueueFullPolicy::BLOCK);
+      void close();
+
+      // Copy, as a reference would escape the lock
+      T front() const;
       void pop();
-      void push(const T&);
+
+      // False if the value was not queued (closed or dropped)
+      bool push(const T&);
+      bool push(T&&);
+      template<typename... Args>
+      bool emplace(Args&&...);
+
+      // True if a value was moved into the argument
+      bool tryPop(T&);
+      // Block until a value is available or the queue is closed and empty
+      bool waitPop(T&);
+      // As above, but also return once the timeout elapses
+      bool waitPop(T&, const std::chrono::milliseconds&);
+
+      // Move up to max ready values to the end of the vector, without
+      // blocking; returns the number moved
+      size_t drainTo(std::vector<T>&, size_t=SIZE_MAX);
   };
 }
 #include "ThreadSafeQueue.ipp"
@@ -33,19 +33,114 @@ namespace netmeld::core::utils {
   // ===========================================================================
   // Constructors
   // ===========================================================================
+  template<typename T>
+  ThreadSafeQueue<T>::ThreadSafeQueue(size_t _capacity,
+                                      QueueFullPolicy _policy) :
+    capacity(_capacity),
+    policy(_policy)
+  {}
 
 
   // ===========================================================================
   // Methods
   // ===========================================================================
   template<typename T>
-  const T&
+  template<typename... Args>
+  bool
+  ThreadSafeQueue<T>::add(Args&&... args)
+  {
+    {
+      std::unique_lock<std::mutex> lock(queueMutex);
+      if (QueueFullPolicy::BLOCK == policy) {
+        notFull.wait(lock, [this]
+            { return closed || 0 == capacity || queue.size() < capacity; });
+      }
+      if (closed) {
+        return false;
+      }
+      if (0 != capacity && queue.size() >= capacity) {
+        ++dropped;
+        if (QueueFullPolicy::DROP_NEWEST == policy) {
+          return false;
+        }
+        queue.pop(); // DROP_OLDEST
+      }
+      queue.emplace(std::forward<Args>(args)...);
+    }
+    notEmpty.notify_one();
+    return true;
+  }
+
+  template<typename T>
+  void
+  ThreadSafeQueue<T>::close()
+  {
+    {
+      std::lock_guard<std::mutex> lock(queueMutex);
+      closed = true;
+    }
+    notEmpty.notify_all();
+    notFull.notify_all();
+  }
+
+  template<typename T>
+  size_t
+  ThreadSafeQueue<T>::drainTo(std::vector<T>& values, size_t max)
+  {
+    size_t count {0};
+    {
+      std::lock_guard<std::mutex> lock(queueMutex);
+      for (; count < max && !queue.empty(); ++count) {
+        values.push_back(std::move(queue.front()));
+        queue.pop();
+      }
+    }
+    if (0 < count) {
+      notFull.notify_all();
+    }
+    return count;
+  }
+
+  template<typename T>
+  template<typename... Args>
+  bool
+  ThreadSafeQueue<T>::emplace(Args&&... args)
+  {
+    return add(std::forward<Args>(args)...);
+  }
+
+  template<typename T>
+  T
   ThreadSafeQueue<T>::front() const
   {
     std::lock_guard<std::mutex> lock(queueMutex);
     return queue.front();
   }
 
+  template<typename T>
+  size_t
+  ThreadSafeQueue<T>::getCapacity() const
+  {
+    std::lock_guard<std::mutex> lock(queueMutex);
+    return capacity;
+  }
+
+  template<typename T>
+  size_t
+  ThreadSafeQueue<T>::getDroppedCount() const
+  {
+    std::lock_guard<std::mutex> lock(queueMutex);
+    return dropped;
+  }
+
+  template<typename T>
+  [[nodiscard]] bool
+  ThreadSafeQueue<T>::isClosed() const
+  {
+    std::lock_guard<std::mutex> lock(queueMutex);
+    return closed;
+  }
+
   template<typename T>
   [[nodiscard]] bool
   ThreadSafeQueue<T>::isEmpty() const
@@ -58,19 +153,40 @@ namespace netmeld::core::utils {
   void
   ThreadSafeQueue<T>::pop()
   {
-    std::lock_guard<std::mutex> lock(queueMutex);
-    if (queue.empty()) {
-      return;
+    {
+      std::lock_guard<std::mutex> lock(queueMutex);
+      if (queue.empty()) {
+        return;
+      }
+      queue.pop();
     }
-    queue.pop();
+    notFull.notify_one();
   }
 
   template<typename T>
-  void
+  bool
   ThreadSafeQueue<T>::push(const T& value)
   {
-    std::lock_guard<std::mutex> lock(queueMutex);
-    queue.push(value);
+    return add(value);
+  }
+
+  template<typename T>
+  bool
+  ThreadSafeQueue<T>::push(T&& value)
+  {
+    return add(std::move(value));
+  }
+
+  template<typename T>
+  void
+  ThreadSafeQueue<T>::setCapacity(size_t _capacity, QueueFullPolicy _policy)
+  {
+    {
+      std::lock_guard<std::mutex> lock(queueMutex);
+      capacity = _capacity;
+      policy   = _policy;
+    }
+    notFull.notify_all();
   }
 
   template<typename T>
@@ -81,6 +197,59 @@ namespace netmeld::core::utils {
     return queue.size();
   }
 
+  template<typename T>
+  bool
+  ThreadSafeQueue<T>::tryPop(T& value)
+  {
+    {
+      std::lock_guard<std::mutex> lock(queueMutex);
+      if (queue.empty()) {
+        return false;
+      }
+      value = std::move(queue.front());
+      queue.pop();
+    }
+    notFull.notify_one();
+    return true;
+  }
+
+  template<typename T>
+  bool
+  ThreadSafeQueue<T>::waitPop(T& value)
+  {
+    {
+      std::unique_lock<std::mutex> lock(queueMutex);
+      notEmpty.wait(lock, [this] { return closed || !queue.empty(); });
+      if (queue.empty()) {
+        return false;
+      }
+      value = std::move(queue.front());
+      queue.pop();
+    }
+    notFull.notify_one();
+    return true;
+  }
+
+  template<typename T>
+  bool
+  ThreadSafeQueue<T>::waitPop(T& value,
+                              const std::chrono::milliseconds& timeout)
+  {
+    {
+      std::unique_lock<std::mutex> lock(queueMutex);
+      if (!notEmpty.wait_for(lock, timeout, [this]
+            { return closed || !queue.empty(); })
+          || queue.empty())
+      {
+        return false;
+      }
+      value = std::move(queue.front());
+      queue.pop();
+    }
+    notFull.notify_one();
+    return true;
+  }
+
 
   // ===========================================================================
   // Friends
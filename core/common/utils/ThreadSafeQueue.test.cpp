@@ -0,0 +1,285 @@
+// =============================================================================
+// Copyright 2023 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+// =============================================================================
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <numeric>
+#include <thread>
+
+#include <boost/test/unit_test.hpp>
+
+#include <netmeld/core/utils/ThreadSafeQueue.hpp>
+
+namespace nmcu = netmeld::core::utils;
+
+using namespace std::chrono_literals;
+
+
+BOOST_AUTO_TEST_CASE(testPushPop)
+{
+  {
+    nmcu::ThreadSafeQueue<int> tsq;
+    BOOST_TEST(tsq.isEmpty());
+    BOOST_TEST(0 == tsq.size());
+    BOOST_TEST(0 == tsq.getCapacity());
+
+    BOOST_TEST(tsq.push(1));
+    const int two {2};
+    BOOST_TEST(tsq.push(two));
+    BOOST_TEST(tsq.emplace(3));
+    BOOST_TEST(!tsq.isEmpty());
+    BOOST_TEST(3 == tsq.size());
+
+    BOOST_TEST(1 == tsq.front());
+    tsq.pop();
+    BOOST_TEST(2 == tsq.front());
+    tsq.pop();
+    BOOST_TEST(3 == tsq.front());
+    tsq.pop();
+    BOOST_TEST(tsq.isEmpty());
+
+    tsq.pop(); // no-op when empty
+    BOOST_TEST(tsq.isEmpty());
+  }
+
+  { // move-only values
+    nmcu::ThreadSafeQueue<std::unique_ptr<int>> tsq;
+    BOOST_TEST(tsq.push(std::make_unique<int>(1)));
+    BOOST_TEST(tsq.emplace(new int(2)));
+
+    std::unique_ptr<int> value;
+    BOOST_TEST(tsq.tryPop(value));
+    BOOST_TEST(1 == *value);
+    BOOST_TEST(tsq.waitPop(value));
+    BOOST_TEST(2 == *value);
+    BOOST_TEST(!tsq.tryPop(value));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testDrainTo)
+{
+  nmcu::ThreadSafeQueue<int> tsq;
+  for (int i {0}; i < 10; ++i) {
+    tsq.push(i);
+  }
+
+  std::vector<int> values {-1};
+  BOOST_TEST(4 == tsq.drainTo(values, 4));
+  BOOST_TEST((std::vector<int> {-1, 0, 1, 2, 3}) == values);
+  BOOST_TEST(6 == tsq.size());
+
+  BOOST_TEST(6 == tsq.drainTo(values));
+  BOOST_TEST(11 == values.size());
+  BOOST_TEST(9 == values.back());
+  BOOST_TEST(tsq.isEmpty());
+
+  BOOST_TEST(0 == tsq.drainTo(values));
+  BOOST_TEST(11 == values.size());
+}
+
+BOOST_AUTO_TEST_CASE(testWaitPop)
+{
+  { // timeout
+    nmcu::ThreadSafeQueue<int> tsq;
+    int value {0};
+    const auto start {std::chrono::steady_clock::now()};
+    BOOST_TEST(!tsq.waitPop(value, 20ms));
+    BOOST_TEST((std::chrono::steady_clock::now() - start >= 20ms));
+  }
+
+  { // woken by a push
+    nmcu::ThreadSafeQueue<int> tsq;
+    std::thread producer([&tsq]() {
+        std::this_thread::sleep_for(10ms);
+        tsq.push(42);
+      });
+    int value {0};
+    BOOST_TEST(tsq.waitPop(value));
+    BOOST_TEST(42 == value);
+    producer.join();
+  }
+
+  { // woken by close
+    nmcu::ThreadSafeQueue<int> tsq;
+    std::thread closer([&tsq]() {
+        std::this_thread::sleep_for(10ms);
+        tsq.close();
+      });
+    int value {0};
+    BOOST_TEST(!tsq.waitPop(value));
+    BOOST_TEST(!tsq.waitPop(value, 1000ms));
+    closer.join();
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testClose)
+{
+  nmcu::ThreadSafeQueue<int> tsq;
+  tsq.push(1);
+  tsq.push(2);
+  BOOST_TEST(!tsq.isClosed());
+
+  tsq.close();
+  BOOST_TEST(tsq.isClosed());
+  BOOST_TEST(!tsq.push(3));
+  BOOST_TEST(!tsq.emplace(4));
+  BOOST_TEST(2 == tsq.size());
+
+  // queued values remain available
+  int value {0};
+  BOOST_TEST(tsq.waitPop(value));
+  BOOST_TEST(1 == value);
+  BOOST_TEST(tsq.tryPop(value));
+  BOOST_TEST(2 == value);
+  BOOST_TEST(!tsq.waitPop(value));
+}
+
+BOOST_AUTO_TEST_CASE(testCapacity)
+{
+  { // block
+    nmcu::ThreadSafeQueue<int> tsq {2};
+    BOOST_TEST(2 == tsq.getCapacity());
+
+    std::atomic<int> pushed {0};
+    std::thread producer([&tsq, &pushed]() {
+        for (int i {0}; i < 5; ++i) {
+          tsq.push(i);
+          ++pushed;
+        }
+      });
+    std::this_thread::sleep_for(20ms);
+    BOOST_TEST(2 == pushed);
+    BOOST_TEST(2 == tsq.size());
+
+    int value {0};
+    for (int i {0}; i < 5; ++i) {
+      BOOST_TEST(tsq.waitPop(value, 1000ms));
+      BOOST_TEST(i == value);
+    }
+    producer.join();
+    BOOST_TEST(5 == pushed);
+    BOOST_TEST(0 == tsq.getDroppedCount());
+  }
+
+  { // close releases a blocked producer
+    nmcu::ThreadSafeQueue<int> tsq {1};
+    tsq.push(0);
+    std::atomic<bool> result {true};
+    std::thread producer([&tsq, &result]() { result = tsq.push(1); });
+    std::this_thread::sleep_for(10ms);
+    tsq.close();
+    producer.join();
+    BOOST_TEST(!result);
+    BOOST_TEST(1 == tsq.size());
+  }
+
+  { // drop newest
+    nmcu::ThreadSafeQueue<int> tsq {2, nmcu::QueueFullPolicy::DROP_NEWEST};
+    BOOST_TEST(tsq.push(0));
+    BOOST_TEST(tsq.push(1));
+    BOOST_TEST(!tsq.push(2));
+    BOOST_TEST(!tsq.emplace(3));
+    BOOST_TEST(2 == tsq.getDroppedCount());
+
+    std::vector<int> values;
+    tsq.drainTo(values);
+    BOOST_TEST((std::vector<int> {0, 1}) == values);
+  }
+
+  { // drop oldest
+    nmcu::ThreadSafeQueue<int> tsq;
+    tsq.setCapacity(2, nmcu::QueueFullPolicy::DROP_OLDEST);
+    for (int i {0}; i < 5; ++i) {
+      BOOST_TEST(tsq.push(i));
+    }
+    BOOST_TEST(3 == tsq.getDroppedCount());
+
+    std::vector<int> values;
+    tsq.drainTo(values);
+    BOOST_TEST((std::vector<int> {3, 4}) == values);
+  }
+
+  { // raising capacity releases a blocked producer
+    nmcu::ThreadSafeQueue<int> tsq {1};
+    tsq.push(0);
+    std::thread producer([&tsq]() { tsq.push(1); });
+    std::this_thread::sleep_for(10ms);
+    BOOST_TEST(1 == tsq.size());
+    tsq.setCapacity(0);
+    producer.join();
+    BOOST_TEST(2 == tsq.size());
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testContention)
+{
+  // Every value pushed is popped exactly once, bounded or not
+  const size_t numThreads {4};
+  const size_t numValues {10000};
+
+  for (const size_t capacity : {size_t {0}, size_t {64}}) {
+    nmcu::ThreadSafeQueue<size_t> tsq {capacity};
+    std::atomic<size_t> total {0};
+    std::atomic<size_t> count {0};
+
+    std::vector<std::thread> consumers;
+    for (size_t i {0}; i < numThreads; ++i) {
+      consumers.emplace_back([&tsq, &total, &count]() {
+          std::vector<size_t> values;
+          size_t value {0};
+          while (tsq.waitPop(value)) {
+            values.push_back(value);
+            tsq.drainTo(values, 63);
+            total += std::accumulate(values.begin(), values.end(), 0UL);
+            count += values.size();
+            values.clear();
+          }
+        });
+    }
+    std::vector<std::thread> producers;
+    for (size_t i {0}; i < numThreads; ++i) {
+      producers.emplace_back([&tsq, numValues]() {
+          for (size_t j {1}; j <= numValues; ++j) {
+            tsq.push(j);
+          }
+        });
+    }
+    for (auto& producer : producers) {
+      producer.join();
+    }
+    tsq.close();
+    for (auto& consumer : consumers) {
+      consumer.join();
+    }
+
+    BOOST_TEST(numThreads * numValues == count);
+    BOOST_TEST(numThreads * (numValues * (numValues + 1) / 2) == total);
+  }
+}
@@ -91,13 +91,49 @@ namespace netmeld::datalake::handlers {
     return true;
   }
 
-  void
-  Git::setIngestToolData(nmdlo::DataEntry& _de, const std::string& _path)
+  std::map<std::string, std::string>
+  Git::getLastCommitMessages()
   {
+    // One pass over history (newest first) instead of a `git log -n 1`
+    // per file; each commit is `RS message US` followed by its file list
+    const char RS {'\x1e'};
+    const char US {'\x1f'};
+
     std::ostringstream oss;
-    oss << "git log -n 1 --pretty=format:\"%B\" -- " << _path;
+    oss << "git -c core.quotepath=off log --name-only"
+        << " --pretty=format:\"%x1e%B%x1f\" HEAD";
+    const auto& log {nmcu::cmdExecOut(oss.str())};
+
+    std::map<std::string, std::string> messages;
+    size_t pos {log.find(RS)};
+    while (std::string::npos != pos) {
+      const auto end  {log.find(RS, pos + 1)};
+      const auto sep  {log.find(US, pos + 1)};
+      if (std::string::npos == sep || (std::string::npos != end && sep > end)) {
+        pos = end;
+        continue;
+      }
 
-    std::istringstream iss(nmcu::cmdExecOut(oss.str()));
+      const auto& message {log.substr(pos + 1, sep - pos - 1)};
+      std::istringstream iss
+        {log.substr(sep + 1, (std::string::npos == end ? log.size() : end)
+                             - sep - 1)};
+      for (std::string line; std::getline(iss, line);) {
+        if (!line.empty()) {
+          // Only the newest commit touching a path counts
+          messages.emplace(line, message);
+        }
+      }
+      pos = end;
+    }
+
+    return messages;
+  }
+
+  void
+  Git::setIngestToolData(nmdlo::DataEntry& _de, const std::string& _message)
+  {
+    std::istringstream iss(_message);
 
     std::regex toolRegex('^' + INGEST_TOOL_PREFIX + "(.*)$");
     std::regex argsRegex('^' + TOOL_ARGS_PREFIX + "(.*)$");
@@ -194,6 +230,8 @@ namespace netmeld::datalake::handlers {
     std::vector<nmdlo::DataEntry> vde;
     if (!(changeDirToRepo() && alignRepo(_dts))) { return vde; }
 
+    const auto& messages {getLastCommitMessages()};
+
     std::string deviceId;
     for (auto i = sfs::recursive_directory_iterator(this->dataLakePath);
          i != sfs::recursive_directory_iterator();
@@ -217,7 +255,12 @@ namespace netmeld::datalake::handlers {
 
         data.setDeviceId(deviceId);
         data.setDataPath(filePath);
-        setIngestToolData(data, filePath);
+
+        const auto& relPath
+          {i->path().lexically_relative(this->dataLakePath).string()};
+        if (const auto& it {messages.find(relPath)}; messages.end() != it) {
+          setIngestToolData(data, it->second);
+        }
 
         vde.push_back(data);
       }
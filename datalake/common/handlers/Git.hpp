@@ -27,6 +27,8 @@
 #ifndef HANDLER_GIT_HPP
 #define HANDLER_GIT_HPP
 
+#include <map>
+
 #include <netmeld/datalake/objects/DataEntry.hpp>
 #include <netmeld/datalake/handlers/AbstractHandler.hpp>
 
@@ -63,6 +65,7 @@ namespace netmeld::datalake::handlers {
     // =========================================================================
     private: // Methods which should be hidden from API users
       void setIngestToolData(nmdlo::DataEntry&, const std::string&);
+      std::map<std::string, std::string> getLastCommitMessages();
 
       bool alignRepo(const nmco::Time& = nmco::Time("infinity"));
       bool changeDirToRepo();
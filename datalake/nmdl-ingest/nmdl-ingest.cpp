@@ -0,0 +1,382 @@
+// =============================================================================
+// Copyright 2023 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+// =============================================================================
+
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <iomanip>
+#include <map>
+#include <mutex>
+#include <set>
+#include <thread>
+
+#include <netmeld/core/utils/CmdExec.hpp>
+#include <netmeld/core/utils/ThreadSafeQueue.hpp>
+#include <netmeld/datalake/tools/AbstractDatalakeTool.hpp>
+
+namespace nmdlt = netmeld::datalake::tools;
+namespace sfs   = std::filesystem;
+
+
+// =============================================================================
+// Data containers
+// =============================================================================
+struct IngestJob
+{
+  nmdlo::DataEntry entry;
+  std::string      cmd;
+  uintmax_t        bytes        {0};
+  bool             isDeviceInfo {false};
+};
+
+struct ToolStats
+{
+  size_t    entries  {0};
+  size_t    failures {0};
+  uintmax_t bytes    {0};
+  double    seconds  {0};
+};
+
+
+// =============================================================================
+// Tool definition
+// =============================================================================
+class Tool : public nmdlt::AbstractDatalakeTool
+{
+  // ===========================================================================
+  // Variables
+  // ===========================================================================
+  private: // Variables should generally be private
+    // Ingest tools whose data other imports for the same device build on;
+    // these run, per device, before any of that device's other entries
+    const std::set<std::string> DEVICE_INFO_TOOLS {
+      "nmdb-insert-device",
+      "nmdb-insert-device-hardware",
+    };
+
+    std::vector<IngestJob> jobs;
+    nmcu::ThreadSafeQueue<size_t> ready; // indexes into jobs
+    size_t retries {0};
+
+    // Guards all of the following
+    std::mutex stateMutex;
+    std::map<std::string, size_t>               pendingDeviceInfo;
+    std::map<std::string, std::vector<size_t>>  deferred;
+    std::map<std::string, ToolStats>            toolStats;
+    std::vector<size_t>                         failed;
+    size_t                                      remaining {0};
+
+  protected: // Variables intended for internal/subclass API
+  public: // Variables should rarely appear at this scope
+
+
+  // ===========================================================================
+  // Constructors
+  // ===========================================================================
+  private: // Constructors should rarely appear at this scope
+  protected: // Constructors intended for internal/subclass API
+  public: // Constructors should generally be public
+    Tool() : nmdlt::AbstractDatalakeTool
+      (
+       "ingest data lake content into the data store",  // printHelp() message
+       PROGRAM_NAME,    // program name (set in CMakeLists.txt)
+       PROGRAM_VERSION  // program version (set in CMakeLists.txt)
+      )
+    {}
+
+
+  // ===========================================================================
+  // Methods
+  // ===========================================================================
+  private: // Methods part of internal API
+    // Overriden from AbstractTool
+    void
+    addToolOptions() override
+    {
+      opts.addOptionalOption("db-name", std::make_tuple(
+            "db-name",
+            po::value<std::string>()->default_value("site"),
+            "Database to ingest into.")
+          );
+      opts.addOptionalOption("db-args", std::make_tuple(
+            "db-args",
+            po::value<std::string>()->default_value(""),
+            "Additional database connection args.")
+          );
+      opts.addOptionalOption("jobs", std::make_tuple(
+            "jobs,j",
+            po::value<size_t>()->default_value(0),
+            "Ingest commands to run concurrently; 0 uses all available cores.")
+          );
+      opts.addOptionalOption("retries", std::make_tuple(
+            "retries",
+            po::value<size_t>()->default_value(1),
+            "Times to re-run a failed ingest command.")
+          );
+      opts.addOptionalOption("dry-run", std::make_tuple(
+            "dry-run",
+            NULL_SEMANTIC,
+            "List the ingest commands, in dependency order, and exit.")
+          );
+      opts.addOptionalOption("before", std::make_tuple(
+            "before",
+            po::value<nmco::Time>()->default_value(nmco::Time()),
+            "Use data timestamped before this date.  Default of now.")
+          );
+    }
+
+    // Build the jobs and queue those without unmet dependencies
+    void
+    plan(const std::vector<nmdlo::DataEntry>& _dataEntries)
+    {
+      for (const auto& de : _dataEntries) {
+        if (de.getIngestTool().empty()) {
+          continue;
+        }
+
+        IngestJob job;
+        job.entry        = de;
+        job.cmd          = de.getIngestCmd();
+        job.isDeviceInfo = DEVICE_INFO_TOOLS.contains(de.getIngestTool());
+
+        std::error_code ec;
+        const auto size {sfs::file_size(de.getDataPath(), ec)};
+        job.bytes = ec ? 0 : size;
+
+        if (job.isDeviceInfo) {
+          ++pendingDeviceInfo[de.getDeviceId()];
+        }
+        jobs.push_back(job);
+      }
+
+      std::vector<size_t> initial;
+      for (size_t i {0}; i < jobs.size(); ++i) {
+        if (jobs[i].isDeviceInfo) {
+          initial.push_back(i);
+        }
+      }
+      for (size_t i {0}; i < jobs.size(); ++i) {
+        const auto& job {jobs[i]};
+        if (job.isDeviceInfo) {
+          continue;
+        }
+        if (pendingDeviceInfo.contains(job.entry.getDeviceId())) {
+          deferred[job.entry.getDeviceId()].push_back(i);
+        } else {
+          initial.push_back(i);
+        }
+      }
+
+      remaining = jobs.size();
+      for (const auto i : initial) {
+        ready.push(i);
+      }
+      if (0 == remaining) {
+        ready.close();
+      }
+    }
+
+    void
+    displayPlan()
+    {
+      LOG_INFO << "# Ingest order: 'device_id: command'\n";
+      std::set<std::string> shown;
+      size_t i;
+      while (ready.tryPop(i)) {
+        const auto& job {jobs[i]};
+        const auto& deviceId {job.entry.getDeviceId()};
+        LOG_INFO << deviceId << ": " << job.cmd << '\n';
+
+        // Dependents follow once all of a device's device info is listed
+        if (job.isDeviceInfo && 0 == --pendingDeviceInfo[deviceId]) {
+          for (const auto j : deferred[deviceId]) {
+            ready.push(j);
+          }
+        }
+      }
+    }
+
+    void
+    worker()
+    {
+      size_t i;
+      while (ready.waitPop(i)) {
+        const auto& job {jobs[i]};
+        const auto start {std::chrono::steady_clock::now()};
+
+        std::string output;
+        bool succeeded {false};
+        for (size_t attempt {0}; attempt <= retries; ++attempt) {
+          int exitStatus;
+          output = nmcu::cmdExecOut(job.cmd + " 2>&1", exitStatus);
+          succeeded = (0 == exitStatus);
+          if (succeeded) {
+            break;
+          }
+          if (attempt < retries) {
+            LOG_WARN << "Retrying (" << (attempt + 1) << '/' << retries
+                     << "): " << job.cmd << '\n';
+          }
+        }
+
+        const std::chrono::duration<double> elapsed
+          {std::chrono::steady_clock::now() - start};
+        finish(i, succeeded, output, elapsed.count());
+      }
+    }
+
+    void
+    finish(size_t _i, bool _succeeded, const std::string& _output,
+           double _seconds)
+    {
+      std::lock_guard<std::mutex> lock {stateMutex};
+
+      const auto& job {jobs[_i]};
+      const auto& deviceId {job.entry.getDeviceId()};
+
+      auto& stats {toolStats[job.entry.getIngestTool()]};
+      ++stats.entries;
+      stats.bytes   += job.bytes;
+      stats.seconds += _seconds;
+
+      if (_succeeded) {
+        LOG_INFO << "# Done (" << _seconds << "s): " << job.cmd << '\n';
+        LOG_DEBUG << _output;
+      } else {
+        ++stats.failures;
+        failed.push_back(_i);
+        LOG_ERROR << "# Failed (" << _seconds << "s): " << job.cmd << '\n'
+                  << _output;
+      }
+
+      // Release the device's other entries, even if its device info failed;
+      // they are no worse off than in a sequential ingest
+      if (job.isDeviceInfo && 0 == --pendingDeviceInfo[deviceId]) {
+        for (const auto j : deferred[deviceId]) {
+          ready.push(j);
+        }
+        deferred.erase(deviceId);
+      }
+
+      if (0 == --remaining) {
+        ready.close();
+      }
+    }
+
+    void
+    displaySummary(double _seconds, size_t _numJobs) const
+    {
+      LOG_INFO << "\n# Ingested " << jobs.size() << " entries in "
+               << _seconds << "s using " << _numJobs << " job(s), "
+               << failed.size() << " failed\n"
+               << "# Per tool: 'tool: entries (failed), busy time,"
+               << " entries/s, MiB/s'\n";
+      for (const auto& [tool, stats] : toolStats) {
+        const auto busy {std::max(stats.seconds, 0.001)};
+        LOG_INFO << std::fixed << std::setprecision(2)
+                 << tool << ": " << stats.entries
+                 << " (" << stats.failures << "), "
+                 << stats.seconds << "s, "
+                 << (static_cast<double>(stats.entries) / busy) << ", "
+                 << (static_cast<double>(stats.bytes) / busy / (1024*1024))
+                 << '\n'
+                 << std::defaultfloat;
+      }
+
+      // As a script, to re-run just the failures
+      if (!failed.empty()) {
+        std::ostringstream oss;
+        oss << "\n# Failed ingest commands"
+            << "\nDB_NAME=\"" << opts.getValue("db-name") << "\";"
+            << "\nDB_ARGS=\"" << opts.getValue("db-args") << "\";"
+            << '\n';
+        for (const auto i : failed) {
+          oss << jobs[i].cmd << ";\n";
+        }
+        LOG_ERROR << oss.str();
+      }
+    }
+
+  protected: // Methods part of subclass API
+    // Inherited from AbstractTool at this scope
+      // std::string const getDbName() const;
+      // virtual void printHelp() const;
+      // virtual void printVersion() const;
+    int
+    runTool() override
+    {
+      const auto& dataLake     {getDatalakeHandler()};
+      const auto& time         {opts.getValueAs<nmco::Time>("before")};
+      const auto& dataEntries  {dataLake->getDataEntries(time)};
+
+      plan(dataEntries);
+
+      if (opts.exists("dry-run")) {
+        displayPlan();
+        return nmcu::Exit::SUCCESS;
+      }
+
+      // Ingest commands reference these, as in an `nmdl-list` ingest script
+      ::setenv("DB_NAME", opts.getValue("db-name").c_str(), 1);
+      ::setenv("DB_ARGS", opts.getValue("db-args").c_str(), 1);
+
+      retries = opts.getValueAs<size_t>("retries");
+      auto numJobs {opts.getValueAs<size_t>("jobs")};
+      if (0 == numJobs) {
+        numJobs = std::max(1U, std::thread::hardware_concurrency());
+      }
+      numJobs = std::max(size_t {1}, std::min(numJobs, jobs.size()));
+
+      const auto start {std::chrono::steady_clock::now()};
+      std::vector<std::thread> workers;
+      for (size_t i {0}; i < numJobs; ++i) {
+        workers.emplace_back(&Tool::worker, this);
+      }
+      for (auto& worker : workers) {
+        worker.join();
+      }
+      const std::chrono::duration<double> elapsed
+        {std::chrono::steady_clock::now() - start};
+
+      displaySummary(elapsed.count(), numJobs);
+
+      return failed.empty() ? nmcu::Exit::SUCCESS : nmcu::Exit::FAILURE;
+    }
+
+  public: // Methods part of public API
+    // Inherited from AbstractTool, don't override as primary tool entry point
+      // int start(int, char**) noexcept;
+};
+
+
+// =============================================================================
+// Program entry point
+// =============================================================================
+int main(int argc, char** argv)
+{
+  Tool tool;
+  return tool.start(argc, argv);
+}
@@ -0,0 +1,132 @@
+// =============================================================================
+// Copyright 2023 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+// =============================================================================
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <chrono>
+
+#include <netmeld/datastore/objects/AcNetworkBook.hpp>
+#include <netmeld/datastore/utils/AcBookUtilities.hpp>
+
+namespace nmdo = netmeld::datastore::objects;
+namespace nmdu = netmeld::datastore::utils;
+
+using Books = std::map<std::string, std::map<std::string, nmdo::AcNetworkBook>>;
+
+
+BOOST_AUTO_TEST_SUITE(AcBookUtilities)
+
+namespace {
+  void
+  addBook(Books& _books, const std::string& _set, const std::string& _name,
+          const std::set<std::string>& _data)
+  {
+    auto& book {_books[_set][_name]};
+    book.setName(_name);
+    book.addData(_data);
+  }
+
+  // Prior recursive, per-referrer expansion; acyclic input only
+  bool
+  legacyExpanded(Books& _books, const std::string& _set,
+                 const std::string& _name)
+  {
+    if (!_books.count(_set)) { return false; }
+    if (!_books[_set].count(_name)) { return false; }
+    const auto set {_books[_set][_name].getData()};
+    if (set.empty()) { return false; }
+
+    for (const auto& data : set) {
+      if (_name == data) { continue; }
+      if (legacyExpanded(_books, _set, data)) {
+        _books[_set][_name].removeData(data);
+        _books[_set][_name].addData(_books[_set][data].getData());
+      }
+    }
+    return true;
+  }
+}
+
+BOOST_AUTO_TEST_CASE(benchmarkExpandAll)
+{
+  // Run with `--log_level=message` to see timings
+
+  // Layered groups, each referring to a few groups in the layer below
+  const size_t numLayers {8};
+  const size_t groupsPerLayer {150};
+  const size_t refsPerGroup {3};
+  const size_t hostsPerGroup {5};
+
+  Books books;
+  for (size_t layer {0}; layer < numLayers; ++layer) {
+    for (size_t g {0}; g < groupsPerLayer; ++g) {
+      std::set<std::string> data;
+      for (size_t h {0}; h < hostsPerGroup; ++h) {
+        data.emplace("10." + std::to_string(layer) + "."
+                     + std::to_string(g) + "." + std::to_string(h));
+      }
+      for (size_t r {0}; layer && r < refsPerGroup; ++r) {
+        const auto target {(g * 7 + r * 13) % groupsPerLayer};
+        data.emplace("grp-" + std::to_string(layer - 1) + "-"
+                     + std::to_string(target));
+      }
+      addBook(books, "global",
+              "grp-" + std::to_string(layer) + "-" + std::to_string(g), data);
+    }
+  }
+  auto legacyBooks {books};
+
+  auto time = [](auto&& _fn) {
+      const auto start {std::chrono::steady_clock::now()};
+      _fn();
+      const std::chrono::duration<double, std::milli> elapsed {
+        std::chrono::steady_clock::now() - start};
+      return elapsed.count();
+    };
+
+  const auto engineTime {time([&]() {
+      BOOST_TEST(nmdu::expandAll(books).empty());
+    })};
+  const auto legacyTime {time([&]() {
+      for (const auto& [name, _] : legacyBooks["global"]) {
+        legacyExpanded(legacyBooks, "global", name);
+      }
+    })};
+
+  size_t totalMembers {0};
+  for (const auto& [name, book] : books["global"]) {
+    BOOST_TEST(legacyBooks["global"][name].getData() == book.getData());
+    totalMembers += book.getData().size();
+  }
+
+  BOOST_TEST_MESSAGE(numLayers * groupsPerLayer << " nested groups ("
+                     << totalMembers << " flattened members): "
+                     << "AcBookExpander " << engineTime << "ms, "
+                     << "recursive expansion " << legacyTime << "ms");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
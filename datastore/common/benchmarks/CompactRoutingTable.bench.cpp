@@ -0,0 +1,118 @@
+// =============================================================================
+// Copyright 2023 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+// =============================================================================
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <chrono>
+
+#include <netmeld/datastore/objects/CompactRoutingTable.hpp>
+
+#include "HeapTracker.hpp"
+
+namespace nmdo = netmeld::datastore::objects;
+
+
+BOOST_AUTO_TEST_SUITE(CompactRoutingTable)
+
+// Route i of a synthetic full table: a unique /24 via one of 32 peers
+nmdo::Route
+makeRoute(size_t i)
+{
+  nmdo::IpAddress dstIpNet;
+  dstIpNet.setAddress(std::to_string(1 + ((i >> 16) & 0xdf)) + "."
+                      + std::to_string((i >> 8) & 0xff) + "."
+                      + std::to_string(i & 0xff) + ".0");
+  dstIpNet.setPrefix(24);
+
+  nmdo::IpAddress nextHop;
+  nextHop.setAddress("192.0.2." + std::to_string(1 + (i % 32)));
+
+  nmdo::Route route;
+  route.setVrfId("default");
+  route.setDstIpNet(dstIpNet);
+  route.setNextHopIpAddr(nextHop);
+  route.setIfaceName("Ethernet" + std::to_string(i % 4));
+  route.setProtocol("BGP");
+  route.setAdminDistance(20);
+  route.setMetric(i % 100);
+
+  return route;
+}
+
+BOOST_AUTO_TEST_CASE(benchmarkFullTable)
+{
+  // Run with `--log_level=message` to see timings
+  const size_t numRoutes {1000000};
+
+  auto time = [](auto&& _fn) {
+      const auto start {std::chrono::steady_clock::now()};
+      _fn();
+      const std::chrono::duration<double, std::milli> elapsed {
+        std::chrono::steady_clock::now() - start};
+      return elapsed.count();
+    };
+
+  // One Route object per route, as the importers did
+  const HeapTracker vectorHeap;
+  size_t vectorSize {0};
+  const auto vectorTime {time([&]() {
+      std::vector<nmdo::Route> routes;
+      for (size_t i {0}; i < numRoutes; ++i) {
+        routes.push_back(makeRoute(i));
+      }
+      vectorSize = routes.size();
+    })};
+  const size_t vectorPeak {vectorHeap.peak()};
+
+  // Column oriented
+  const HeapTracker tableHeap;
+  size_t tableSize {0};
+  size_t tableNextHops {0};
+  const auto tableTime {time([&]() {
+      nmdo::CompactRoutingTable table;
+      for (size_t i {0}; i < numRoutes; ++i) {
+        table.push_back(makeRoute(i));
+      }
+      tableSize = table.size();
+      tableNextHops = table.nextHopCount();
+    })};
+  const size_t tablePeak {tableHeap.peak()};
+
+  BOOST_TEST(numRoutes == vectorSize);
+  BOOST_TEST(numRoutes == tableSize);
+  BOOST_TEST(32 == tableNextHops);
+  BOOST_TEST(tablePeak < vectorPeak);
+
+  BOOST_TEST_MESSAGE("Routes: " << numRoutes);
+  BOOST_TEST_MESSAGE("  vector: " << (vectorPeak >> 20) << " MiB peak, "
+                     << vectorTime << " ms");
+  BOOST_TEST_MESSAGE("  table:  " << (tablePeak >> 20) << " MiB peak, "
+                     << tableTime << " ms, "
+                     << tableNextHops << " next hops to save");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
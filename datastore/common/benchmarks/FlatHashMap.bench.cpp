@@ -0,0 +1,75 @@
+// =============================================================================
+// Copyright 2023 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+// =============================================================================
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <chrono>
+#include <map>
+#include <unordered_map>
+
+#include <netmeld/core/utils/FlatHashMap.hpp>
+
+namespace nmcu = netmeld::core::utils;
+
+
+BOOST_AUTO_TEST_SUITE(FlatHashMap)
+
+BOOST_AUTO_TEST_CASE(benchmarkLookups)
+{
+  // Run with `--log_level=message` to see timings
+  const size_t numLookups {2000000};
+  const size_t numKeys {4096};
+
+  auto time = [&](auto& map) {
+      const auto start {std::chrono::steady_clock::now()};
+      size_t sum {0};
+      for (size_t i {0}; i < numLookups; ++i) {
+        auto& value {map[(i * 2654435761U) % numKeys]};
+        ++value;
+        sum += value;
+      }
+      const std::chrono::duration<double, std::milli> elapsed {
+        std::chrono::steady_clock::now() - start};
+      BOOST_TEST(0 < sum);
+      return elapsed.count();
+    };
+
+  nmcu::FlatHashMap<size_t, size_t> fhm;
+  std::unordered_map<size_t, size_t> um;
+  std::map<size_t, size_t> m;
+  const auto fhmTime {time(fhm)};
+  const auto umTime {time(um)};
+  const auto mTime {time(m)};
+  BOOST_TEST(fhm.size() == um.size());
+
+  BOOST_TEST_MESSAGE(numLookups << " lookups over " << numKeys << " keys: "
+                     << "FlatHashMap " << fhmTime << "ms, "
+                     << "std::unordered_map " << umTime << "ms, "
+                     << "std::map " << mTime << "ms");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
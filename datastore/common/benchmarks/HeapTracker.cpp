@@ -0,0 +1,85 @@
+// =============================================================================
+// Copyright 2023 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+// =============================================================================
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+#include "HeapTracker.hpp"
+
+
+namespace {
+  std::atomic<size_t> heapLive {0};
+  std::atomic<size_t> heapPeak {0};
+
+  constexpr size_t HEADER {alignof(std::max_align_t)};
+}
+
+void*
+operator new(size_t size)
+{
+  auto* p {static_cast<char*>(std::malloc(size + HEADER))};
+  if (nullptr == p) {
+    throw std::bad_alloc();
+  }
+  *reinterpret_cast<size_t*>(p) = size;
+
+  const size_t live {heapLive += size};
+  size_t peak {heapPeak};
+  while (peak < live && !heapPeak.compare_exchange_weak(peak, live)) {}
+
+  return p + HEADER;
+}
+
+void
+operator delete(void* ptr) noexcept
+{
+  if (nullptr == ptr) {
+    return;
+  }
+  auto* p {static_cast<char*>(ptr) - HEADER};
+  heapLive -= *reinterpret_cast<size_t*>(p);
+  std::free(p);
+}
+
+void
+operator delete(void* ptr, size_t) noexcept
+{
+  operator delete(ptr);
+}
+
+
+HeapTracker::HeapTracker() :
+  base {heapLive}
+{
+  heapPeak = base;
+}
+
+size_t
+HeapTracker::peak() const
+{
+  return heapPeak - base;
+}
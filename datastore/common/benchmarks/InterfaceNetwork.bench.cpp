@@ -0,0 +1,104 @@
+// =============================================================================
+// Copyright 2023 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+// =============================================================================
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <chrono>
+#include <set>
+
+#include <netmeld/datastore/objects/InterfaceNetwork.hpp>
+#include <netmeld/datastore/objects/Vlan.hpp>
+
+#include "HeapTracker.hpp"
+
+namespace nmdo = netmeld::datastore::objects;
+
+
+BOOST_AUTO_TEST_SUITE(InterfaceNetwork)
+
+BOOST_AUTO_TEST_CASE(benchmarkVlans)
+{
+  // Run with `--log_level=message` to see timings
+  const size_t numPorts {400};
+  const uint16_t firstVlan {1};
+  const uint16_t lastVlan {4094};
+
+  auto time = [](auto&& _fn) {
+      const auto start {std::chrono::steady_clock::now()};
+      _fn();
+      const std::chrono::duration<double, std::milli> elapsed {
+        std::chrono::steady_clock::now() - start};
+      return elapsed.count();
+    };
+
+  // One Vlan object per allowed VLAN, as interfaces previously held
+  const HeapTracker setHeap;
+  size_t setSize {0};
+  const auto setTime {time([&]() {
+      std::vector<std::set<nmdo::Vlan>> ports(numPorts);
+      for (auto& vlans : ports) {
+        for (auto id {firstVlan}; id <= lastVlan; ++id) {
+          vlans.emplace(id);
+        }
+        setSize += vlans.size();
+      }
+    })};
+  const size_t setPeak {setHeap.peak()};
+
+  // A 400 port switch trunking every VLAN on every port
+  const HeapTracker ifaceHeap;
+  size_t ifaceSize {0};
+  size_t ifaceRanges {0};
+  const auto ifaceTime {time([&]() {
+      std::vector<nmdo::InterfaceNetwork> ports;
+      for (size_t i {0}; i < numPorts; ++i) {
+        ports.emplace_back("GigabitEthernet1/0/" + std::to_string(i));
+        ports.back().setSwitchportMode("l2 trunk");
+        ports.back().addVlanRange(firstVlan, lastVlan);
+      }
+      for (const auto& port : ports) {
+        ifaceSize   += port.getVlans().size();
+        ifaceRanges += port.getVlans().getRanges().size();
+      }
+    })};
+  const size_t ifacePeak {ifaceHeap.peak()};
+
+  BOOST_TEST(numPorts * lastVlan == setSize);
+  BOOST_TEST(numPorts * lastVlan == ifaceSize);
+  BOOST_TEST(numPorts == ifaceRanges);
+  BOOST_TEST(ifacePeak < setPeak);
+
+  BOOST_TEST_MESSAGE("Ports: " << numPorts << ", VLANs "
+                     << firstVlan << "-" << lastVlan << " each");
+  BOOST_TEST_MESSAGE("  std::set<Vlan>: " << (setPeak >> 10) << " KiB peak, "
+                     << setTime << " ms");
+  BOOST_TEST_MESSAGE("  InterfaceNetwork: " << (ifacePeak >> 10)
+                     << " KiB peak, " << ifaceTime << " ms, "
+                     << ifaceRanges << " range inserts to save");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
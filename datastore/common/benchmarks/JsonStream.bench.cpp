@@ -0,0 +1,116 @@
+// =============================================================================
+// Copyright 2023 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+// =============================================================================
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <chrono>
+#include <sstream>
+
+#include <netmeld/datastore/utils/JsonStream.hpp>
+
+#include "HeapTracker.hpp"
+
+namespace nmdu = netmeld::datastore::utils;
+
+using json = nlohmann::json;
+
+
+BOOST_AUTO_TEST_SUITE(JsonStream)
+
+BOOST_AUTO_TEST_CASE(benchmarkForEachJsonElement)
+{
+  // Run with `--log_level=message` to see timings
+  const size_t numReservations {20000};
+
+  std::ostringstream oss;
+  oss << R"({ "Reservations": [)";
+  for (size_t i {0}; i < numReservations; ++i) {
+    oss << (i ? "," : "")
+        << R"({ "ReservationId": "r-)" << i << R"(", "Instances": [)"
+        << R"({ "InstanceId": "i-)" << i << R"(", "InstanceType": "t2.micro")"
+        << R"(, "State": {"Code": 16, "Name": "running"})"
+        << R"(, "Placement": {"AvailabilityZone": "us-east-1a"})"
+        << R"(, "NetworkInterfaces": [)"
+        << R"({ "NetworkInterfaceId": "eni-)" << i << R"(")"
+        << R"(, "MacAddress": "00:11:22:33:44:55")"
+        << R"(, "Groups": [{"GroupId": "sg-1", "GroupName": "default"}])"
+        << R"(, "PrivateIpAddresses": [{"PrivateIpAddress": "10.0.0.1")"
+        << R"(, "Primary": true}])"
+        << R"(}]}]})";
+  }
+  oss << R"(], "NextToken": "abc" })";
+  const std::string text {oss.str()};
+
+  auto time = [](auto&& _fn) {
+      const auto start {std::chrono::steady_clock::now()};
+      _fn();
+      const std::chrono::duration<double, std::milli> elapsed {
+        std::chrono::steady_clock::now() - start};
+      return elapsed.count();
+    };
+
+  auto countInstances = [](size_t& count, const json& reservation) {
+      count += reservation.at("Instances").size();
+    };
+
+  // Whole document, as the importers did
+  size_t domCount {0};
+  const HeapTracker domHeap;
+  const auto domTime {time([&]() {
+      std::istringstream iss {text};
+      const auto& data {json::parse(iss)};
+      for (const auto& reservation : data.at("Reservations")) {
+        countInstances(domCount, reservation);
+      }
+    })};
+  const size_t domPeak {domHeap.peak()};
+
+  // One element at a time
+  size_t streamCount {0};
+  const HeapTracker streamHeap;
+  const auto streamTime {time([&]() {
+      std::istringstream iss {text};
+      nmdu::forEachJsonElement(iss, {"Reservations"},
+          [&](const std::string&, const json& reservation) {
+            countInstances(streamCount, reservation);
+          });
+    })};
+  const size_t streamPeak {streamHeap.peak()};
+
+  BOOST_TEST(numReservations == domCount);
+  BOOST_TEST(numReservations == streamCount);
+  // Both copy the input into an istringstream, the DOM is on top of that
+  BOOST_TEST(streamPeak < domPeak);
+
+  BOOST_TEST_MESSAGE(numReservations << " reservations ("
+                     << text.size() / 1024 << " KiB): whole document "
+                     << domTime << "ms, " << domPeak / 1024 << " KiB peak; "
+                     << "streamed " << streamTime << "ms, "
+                     << streamPeak / 1024 << " KiB peak");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,139 @@
+// =============================================================================
+// Copyright 2023 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+// =============================================================================
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <chrono>
+
+#include <netmeld/datastore/parsers/ParserHelper.hpp>
+
+namespace nmdp = netmeld::datastore::parsers;
+
+namespace sfs = std::filesystem;
+
+
+BOOST_AUTO_TEST_SUITE(ParserHelper)
+
+typedef std::vector<std::vector<std::string>> Result;
+
+// Simplified "show ip route" style grammar, usable with either iterator type
+template<typename Iter>
+class Parser :
+  public qi::grammar<Iter, Result(), qi::ascii::blank_type>
+{
+  public:
+    Parser() : Parser::base_type(start)
+    {
+      start =
+        *(line >> qi::eol)
+        ;
+
+      line =
+        *token
+        ;
+
+      token =
+        +qi::ascii::graph
+        ;
+    }
+
+    qi::rule<Iter, Result(), qi::ascii::blank_type>
+      start;
+
+    qi::rule<Iter, std::vector<std::string>(), qi::ascii::blank_type>
+      line;
+
+    qi::rule<Iter, std::string()>
+      token;
+};
+
+// Prior fromFilePath behavior, parsing via boost::spirit::istream_iterator
+Result
+fromFilePathStream(const std::string& path)
+{
+  Result result;
+  std::ifstream dataStream {path};
+  dataStream.unsetf(std::ios::skipws);
+
+  nmdp::IstreamIter i {dataStream};
+  nmdp::IstreamIter e;
+
+  bool const success {
+    qi::phrase_parse(i, e, Parser<nmdp::IstreamIter>(), qi::ascii::blank,
+                     result)
+  };
+  BOOST_REQUIRE(success);
+  BOOST_REQUIRE(i == e);
+
+  return result;
+}
+
+std::string
+makeRoutes(size_t count)
+{
+  std::ostringstream oss;
+  for (size_t n {0}; n < count; ++n) {
+    oss << "S    10." << (n >> 8) % 256 << '.' << n % 256
+        << ".0/24 [1/0] via 192.168." << n % 256 << ".1,"
+        << " GigabitEthernet0/" << n % 48 << '\n';
+  }
+  return oss.str();
+}
+
+// Timings vary by host; reported for comparison only
+BOOST_AUTO_TEST_CASE(benchmarkFromFilePath)
+{
+  const auto path {sfs::temp_directory_path() / "nmdp-bench-routes"};
+  {
+    std::ofstream f {path, std::ios::binary};
+    f << makeRoutes(100000);
+  }
+
+  const auto streamStart {std::chrono::steady_clock::now()};
+  const auto streamResult {fromFilePathStream(path.string())};
+  const auto streamStop {std::chrono::steady_clock::now()};
+
+  const auto bufferStart {std::chrono::steady_clock::now()};
+  const auto bufferResult {
+    nmdp::fromFilePath<Parser<nmdp::ConstIter>, Result>(path.string())
+  };
+  const auto bufferStop {std::chrono::steady_clock::now()};
+
+  BOOST_TEST(streamResult == bufferResult);
+
+  const auto toMs = [](const auto& duration) {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(duration)
+           .count();
+  };
+  BOOST_TEST_MESSAGE("fromFilePath " << sfs::file_size(path) << " bytes: "
+                     << "istream_iterator " << toMs(streamStop - streamStart)
+                     << "ms, mmap " << toMs(bufferStop - bufferStart) << "ms");
+
+  sfs::remove(path);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
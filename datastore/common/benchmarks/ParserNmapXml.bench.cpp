@@ -0,0 +1,131 @@
+// =============================================================================
+// Copyright 2023 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+// =============================================================================
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <chrono>
+
+#include <pugixml.hpp>
+
+#include "ParserNmapXml.hpp"
+
+namespace nmdsin = netmeld::datastore::importers::nmap;
+
+
+BOOST_AUTO_TEST_SUITE(ParserNmapXml)
+
+BOOST_AUTO_TEST_CASE(benchmarkExtractHosts)
+{
+  // Run with `--log_level=message` to see timings
+  const size_t numHosts {100000};
+
+  std::string xml {"<nmaprun><scaninfo protocol=\"tcp\"/>"};
+  for (size_t i {0}; i < numHosts; ++i) {
+    const auto& ip {"10." + std::to_string((i >> 16) & 0xff) + "."
+                    + std::to_string((i >> 8) & 0xff) + "."
+                    + std::to_string(i & 0xff)};
+    xml += "<host><status state=\"up\" reason=\"arp-response\"/>"
+           "<address addr=\"" + ip + "\" addrtype=\"ipv4\"/>"
+           "<address addr=\"00:11:22:33:44:55\" addrtype=\"mac\"/>"
+           "<hostnames><hostname name=\"h" + std::to_string(i)
+           + "\" type=\"PTR\"/></hostnames>"
+           "<ports><extraports state=\"closed\">"
+           "<extrareasons reason=\"resets\"/></extraports>"
+           "<port protocol=\"tcp\" portid=\"22\">"
+           "<state state=\"open\" reason=\"syn-ack\"/>"
+           "<service name=\"ssh\" method=\"probed\"/>"
+           "<script id=\"ssh2-enum-algos\" output=\"\">"
+           "<table key=\"kex_algorithms\"><elem>curve25519-sha256</elem>"
+           "</table></script></port>"
+           "<port protocol=\"tcp\" portid=\"80\">"
+           "<state state=\"open\" reason=\"syn-ack\"/>"
+           "<service name=\"http\" method=\"table\"/></port></ports>"
+           "<os><osmatch><osclass vendor=\"Linux\" osfamily=\"Linux\""
+           " accuracy=\"95\"/></osmatch></os>"
+           "<trace><hop ttl=\"1\" ipaddr=\"10.255.255.1\"/></trace>"
+           "</host>";
+  }
+  xml += "</nmaprun>";
+
+  pugi::xml_document doc;
+  BOOST_TEST(doc.load_string(xml.c_str()));
+  const pugi::xml_node nmapNode {doc.document_element()};
+
+  auto time = [](auto&& _fn) {
+      const auto start {std::chrono::steady_clock::now()};
+      _fn();
+      const std::chrono::duration<double, std::milli> elapsed {
+        std::chrono::steady_clock::now() - start};
+      return elapsed.count();
+    };
+
+  nmdsin::ParserNmapXml tnxp;
+
+  nmdsin::Data perKind;
+  const auto perKindTime {time([&]() {
+      tnxp.extractMacAndIpAddrs(nmapNode, perKind);
+      tnxp.extractHostnames(nmapNode, perKind);
+      tnxp.extractOperatingSystems(nmapNode, perKind);
+      tnxp.extractTraceRoutes(nmapNode, perKind);
+      tnxp.extractPortsAndServices(nmapNode, perKind);
+      tnxp.extractNseAndSsh(nmapNode, perKind);
+    })};
+
+  nmdsin::Data single;
+  const auto singleTime {time([&]() {
+      tnxp.extractHosts(nmapNode, single);
+    })};
+
+  BOOST_TEST(numHosts == single.macAddrs.size());
+  BOOST_TEST(3 * numHosts == single.ports.size());
+  BOOST_TEST(perKind.ports.size() == single.ports.size());
+  BOOST_TEST(perKind.sshAlgorithms.size() == single.sshAlgorithms.size());
+
+  // Per host lookups, as the parser did before queries were compiled once
+  size_t found {0};
+  const auto stringTime {time([&]() {
+      for (const auto& nodeHost : nmapNode.children("host")) {
+        found += !nodeHost.select_node("address[@addrtype='mac']")
+                          .node().empty();
+      }
+    })};
+  const auto compiledTime {time([&]() {
+      for (const auto& nodeHost : nmapNode.children("host")) {
+        found += !nodeHost.select_node(
+            nmdu::xpathQuery("address[@addrtype='mac']")).node().empty();
+      }
+    })};
+  BOOST_TEST(2 * numHosts == found);
+
+  BOOST_TEST_MESSAGE(numHosts << " hosts (" << xml.size() / (1024 * 1024)
+                     << " MiB): one pass per host " << singleTime << "ms, "
+                     << "one pass per kind of data " << perKindTime << "ms; "
+                     << "per host XPath compiled once " << compiledTime
+                     << "ms, compiled per call " << stringTime << "ms");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,112 @@
+// =============================================================================
+// Copyright 2023 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+// =============================================================================
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <chrono>
+#include <random>
+
+#include <netmeld/datastore/utils/RouteTracer.hpp>
+
+namespace nmdu = netmeld::datastore::utils;
+
+
+BOOST_AUTO_TEST_SUITE(RouteTracer)
+
+nmdu::RouteTracerRoute
+makeRoute(const std::string& _deviceId, const std::string& _dstIpNet,
+          const std::string& _nextHopIpAddr)
+{
+  nmdu::RouteTracerRoute route;
+  route.deviceId          = _deviceId;
+  route.dstIpNet          = _dstIpNet;
+  route.nextHopIpAddr     = _nextHopIpAddr;
+  route.protocol          = "static";
+  route.adminDistance     = 1;
+  return route;
+}
+
+BOOST_AUTO_TEST_CASE(benchmarkTraceLargeTables)
+{
+  // Run with `--log_level=message` to see timings
+
+  // A chain of routers each holding the same full table toward the next
+  const size_t numDevices {20};
+  const size_t numRoutes  {50000};
+
+  std::mt19937 gen {42};
+  std::uniform_int_distribution<uint32_t> octet {1, 223};
+  std::uniform_int_distribution<uint32_t> prefix {8, 24};
+
+  std::vector<std::string> nets;
+  for (size_t i {0}; i < numRoutes; ++i) {
+    nets.push_back(std::to_string(octet(gen)) + "." + std::to_string(octet(gen))
+                   + "." + std::to_string(octet(gen)) + ".0/"
+                   + std::to_string(prefix(gen)));
+  }
+
+  nmdu::RouteTracer tracer;
+  for (size_t d {0}; d < numDevices; ++d) {
+    const auto device {"r" + std::to_string(d)};
+    const auto link {"10.255." + std::to_string(d) + "."};
+    tracer.addInterfaceAddress(device, "", "up", link + "2/30");
+    tracer.addInterfaceAddress(device, "", "down", link + "5/30");
+
+    const auto nextHop {"10.255." + std::to_string(d + 1) + ".2"};
+    for (const auto& net : nets) {
+      tracer.addRoute(makeRoute(device, net, nextHop));
+    }
+  }
+
+  std::vector<nmdu::IpKey> dsts;
+  for (size_t i {0}; i < 10000; ++i) {
+    dsts.push_back(nmdu::IpKey::fromString(
+          std::to_string(octet(gen)) + "." + std::to_string(octet(gen))
+          + "." + std::to_string(octet(gen)) + ".1"));
+  }
+  const auto src {nmdu::IpKey::fromString("10.255.0.2")};
+
+  size_t exited {0};
+  const auto start {std::chrono::steady_clock::now()};
+  for (const auto& dst : dsts) {
+    const auto result {tracer.trace(src, dst)};
+    if (nmdu::RouteTraceResult::EXITED == result.result) {
+      BOOST_TEST(numDevices == result.hops.size());
+      ++exited;
+    }
+  }
+  const std::chrono::duration<double, std::micro> elapsed {
+    std::chrono::steady_clock::now() - start};
+  BOOST_TEST(0 < exited);
+
+  BOOST_TEST_MESSAGE(dsts.size() << " traces over " << numDevices
+                     << " devices of " << numRoutes << " routes: "
+                     << elapsed.count() / static_cast<double>(dsts.size())
+                     << "us per trace");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,100 @@
+// =============================================================================
+// Copyright 2023 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+// =============================================================================
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <chrono>
+#include <thread>
+
+#include <netmeld/core/utils/SpscRingBuffer.hpp>
+#include <netmeld/core/utils/ThreadSafeQueue.hpp>
+
+namespace nmcu = netmeld::core::utils;
+
+
+BOOST_AUTO_TEST_SUITE(SpscRingBuffer)
+
+BOOST_AUTO_TEST_CASE(benchmarkContention)
+{
+  // Run with `--log_level=message` to see timings
+  const size_t numValues {1000000};
+
+  {
+    nmcu::SpscRingBuffer<size_t> srb {1024};
+
+    const auto start {std::chrono::steady_clock::now()};
+    std::thread producer([&srb, numValues]() {
+        for (size_t i {0}; i < numValues; ++i) {
+          while (!srb.tryPush(i)) {
+            std::this_thread::yield();
+          }
+        }
+      });
+    bool ordered {true};
+    size_t value {0};
+    for (size_t i {0}; i < numValues; ++i) {
+      while (!srb.tryPop(value)) {
+        std::this_thread::yield();
+      }
+      ordered = ordered && (i == value);
+    }
+    producer.join();
+    const std::chrono::duration<double, std::milli> elapsed {
+      std::chrono::steady_clock::now() - start};
+
+    BOOST_TEST(ordered);
+    BOOST_TEST(srb.isEmpty());
+    BOOST_TEST_MESSAGE("SpscRingBuffer: " << numValues << " values in "
+                       << elapsed.count() << "ms");
+  }
+
+  { // baseline for comparison
+    nmcu::ThreadSafeQueue<size_t> tsq {1024};
+
+    const auto start {std::chrono::steady_clock::now()};
+    std::thread producer([&tsq, numValues]() {
+        for (size_t i {0}; i < numValues; ++i) {
+          tsq.push(i);
+        }
+      });
+    bool ordered {true};
+    size_t value {0};
+    for (size_t i {0}; i < numValues; ++i) {
+      tsq.waitPop(value);
+      ordered = ordered && (i == value);
+    }
+    producer.join();
+    const std::chrono::duration<double, std::milli> elapsed {
+      std::chrono::steady_clock::now() - start};
+
+    BOOST_TEST(ordered);
+    BOOST_TEST_MESSAGE("ThreadSafeQueue: " << numValues << " values in "
+                       << elapsed.count() << "ms");
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
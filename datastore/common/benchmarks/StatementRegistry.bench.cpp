@@ -0,0 +1,106 @@
+// =============================================================================
+// Copyright 2023 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+// =============================================================================
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <chrono>
+#include <cstdlib>
+
+#include <netmeld/datastore/utils/QueriesCommon.hpp>
+#include <netmeld/datastore/utils/StatementRegistry.hpp>
+
+namespace nmdu = netmeld::datastore::utils;
+
+
+BOOST_AUTO_TEST_SUITE(StatementRegistry)
+
+// Run with `--log_level=message` to see timings.  Set NETMELD_TEST_DB to a
+// libpqxx connection string (of a database with the Netmeld schema) to also
+// time connecting and preparing statements eagerly versus on demand.
+BOOST_AUTO_TEST_CASE(benchmarkPrepare)
+{
+  auto time = [](auto&& _fn) {
+      const auto start {std::chrono::steady_clock::now()};
+      _fn();
+      const std::chrono::duration<double, std::milli> elapsed {
+        std::chrono::steady_clock::now() - start};
+      return elapsed.count();
+    };
+
+  // Previously every connection re-declared every statement
+  const size_t numConnections {100};
+  const auto declareTime {time([&]() {
+      for (size_t i {0}; i < numConnections; ++i) {
+        nmdu::StatementRegistry registry;
+        for (const auto& name : nmdu::commonStatements().getNames()) {
+          registry.declare(name, *nmdu::commonStatements().find(name));
+        }
+        BOOST_TEST(nmdu::commonStatements().size() == registry.size());
+      }
+    })};
+  BOOST_TEST_MESSAGE(numConnections << " connections declaring "
+                     << nmdu::commonStatements().size() << " statements: "
+                     << declareTime << "ms");
+
+  const char* connectString {std::getenv("NETMELD_TEST_DB")};
+  if (nullptr == connectString) {
+    BOOST_TEST_MESSAGE("NETMELD_TEST_DB not set, skipping connect timings");
+    return;
+  }
+
+  // What a small importer (e.g., nmdb-import-ping) actually executes
+  const std::vector<std::string> used {
+    "insert_tool_run", "insert_raw_ip_addr", "insert_raw_mac_addr_ip_addr"
+  };
+  const size_t numRuns {10};
+  size_t numEager {0};
+  size_t numLazy {0};
+
+  const auto eagerTime {time([&]() {
+      for (size_t i {0}; i < numRuns; ++i) {
+        pqxx::connection db {connectString};
+        nmdu::dbPrepareCommon(db);
+        nmdu::prewarmStatements(db);
+        numEager = nmdu::preparedStatementCount(db);
+      }
+    })};
+  const auto lazyTime {time([&]() {
+      for (size_t i {0}; i < numRuns; ++i) {
+        pqxx::connection db {connectString};
+        nmdu::dbPrepareCommon(db);
+        nmdu::prewarmStatements(db, used);
+        numLazy = nmdu::preparedStatementCount(db);
+      }
+    })};
+  BOOST_TEST(numLazy < numEager);
+
+  BOOST_TEST_MESSAGE("Per connection: all " << numEager << " statements "
+                     << eagerTime / numRuns << "ms, on demand " << numLazy
+                     << " statements " << lazyTime / numRuns << "ms");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
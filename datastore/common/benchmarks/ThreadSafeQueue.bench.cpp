@@ -0,0 +1,94 @@
+// =============================================================================
+// Copyright 2023 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+// =============================================================================
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <numeric>
+#include <thread>
+
+#include <netmeld/core/utils/ThreadSafeQueue.hpp>
+
+namespace nmcu = netmeld::core::utils;
+
+
+BOOST_AUTO_TEST_SUITE(ThreadSafeQueue)
+
+BOOST_AUTO_TEST_CASE(benchmarkContention)
+{
+  // Run with `--log_level=message` to see timings
+  const size_t numThreads {4};
+  const size_t numValues {100000};
+
+  for (const size_t capacity : {size_t {0}, size_t {64}}) {
+    nmcu::ThreadSafeQueue<size_t> tsq {capacity};
+    std::atomic<size_t> total {0};
+    std::atomic<size_t> count {0};
+
+    const auto start {std::chrono::steady_clock::now()};
+    std::vector<std::thread> consumers;
+    for (size_t i {0}; i < numThreads; ++i) {
+      consumers.emplace_back([&tsq, &total, &count]() {
+          std::vector<size_t> values;
+          size_t value {0};
+          while (tsq.waitPop(value)) {
+            values.push_back(value);
+            tsq.drainTo(values, 63);
+            total += std::accumulate(values.begin(), values.end(), 0UL);
+            count += values.size();
+            values.clear();
+          }
+        });
+    }
+    std::vector<std::thread> producers;
+    for (size_t i {0}; i < numThreads; ++i) {
+      producers.emplace_back([&tsq, numValues]() {
+          for (size_t j {1}; j <= numValues; ++j) {
+            tsq.push(j);
+          }
+        });
+    }
+    for (auto& producer : producers) {
+      producer.join();
+    }
+    tsq.close();
+    for (auto& consumer : consumers) {
+      consumer.join();
+    }
+    const std::chrono::duration<double, std::milli> elapsed {
+      std::chrono::steady_clock::now() - start};
+
+    BOOST_TEST(numThreads * numValues == count);
+    BOOST_TEST(numThreads * (numValues * (numValues + 1) / 2) == total);
+    BOOST_TEST_MESSAGE("ThreadSafeQueue capacity " << capacity << ": "
+                       << numThreads << "x" << numThreads << " threads, "
+                       << count << " values in " << elapsed.count() << "ms");
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
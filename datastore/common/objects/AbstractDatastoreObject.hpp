@@ -30,10 +30,12 @@
 #include <netmeld/core/objects/AbstractObject.hpp>
 #include <netmeld/core/objects/Uuid.hpp>
 #include <netmeld/core/utils/LoggerSingleton.hpp>
+#include <netmeld/datastore/utils/BulkRowSink.hpp>
 #include <netmeld/datastore/utils/QueriesCommon.hpp>
 
 namespace nmco = netmeld::core::objects;
 namespace nmcu = netmeld::core::utils;
+namespace nmdu = netmeld::datastore::utils;
 
 namespace netmeld::datastore::objects {
 
@@ -55,14 +55,14 @@ namespace netmeld::datastore::objects {
     }
 
     if (0 == data.size()) {
-      t.exec_prepared("insert_raw_device_ac_service",
+      nmdu::execPrepared(t, "insert_raw_device_ac_service",
         toolRunId,
         _deviceId,
         name,
         nullptr);
     } else {
       for (const auto& entry : data) {
-        t.exec_prepared("insert_raw_device_ac_service",
+        nmdu::execPrepared(t, "insert_raw_device_ac_service",
           toolRunId,
           _deviceId,
           name,
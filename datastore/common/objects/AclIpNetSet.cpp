@@ -82,7 +82,7 @@ namespace netmeld::datastore::objects {
       return; // Always short circuit if invalid object
     }
 
-    t.exec_prepared("insert_raw_device_acl_ip_net_base",
+    nmdu::execPrepared(t, "insert_raw_device_acl_ip_net_base",
         toolRunId,
         deviceId,
         ns,
@@ -90,7 +90,7 @@ namespace netmeld::datastore::objects {
         );
 
     for (const auto& ipNet : ipNets) {
-      t.exec_prepared("insert_raw_device_acl_ip_net_ip_net",
+      nmdu::execPrepared(t, "insert_raw_device_acl_ip_net_ip_net",
           toolRunId,
           deviceId,
           ns,
@@ -100,12 +100,12 @@ namespace netmeld::datastore::objects {
     }
 
     for (const auto& hostname : hostnames) {
-      t.exec_prepared("insert_raw_device_dns_reference",
+      nmdu::execPrepared(t, "insert_raw_device_dns_reference",
           toolRunId,
           deviceId,
           hostname
           );
-      t.exec_prepared("insert_raw_device_acl_ip_net_hostname",
+      nmdu::execPrepared(t, "insert_raw_device_acl_ip_net_hostname",
           toolRunId,
           deviceId,
           ns,
@@ -115,7 +115,7 @@ namespace netmeld::datastore::objects {
     }
 
     for (const auto& includedId : includedIds) {
-      t.exec_prepared("insert_raw_device_acl_ip_net_include",
+      nmdu::execPrepared(t, "insert_raw_device_acl_ip_net_include",
           toolRunId,
           deviceId,
           ns,
@@ -68,7 +68,7 @@ namespace netmeld::datastore::objects {
       const nmco::Uuid& toolRunId, const std::string& deviceId)
   {
     AclRule::save(t, toolRunId, deviceId);
-    t.exec_prepared("insert_raw_device_acl_rule_port",
+    nmdu::execPrepared(t, "insert_raw_device_acl_rule_port",
         toolRunId,
         deviceId,
         priority,
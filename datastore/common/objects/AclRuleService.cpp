@@ -52,7 +52,7 @@ namespace netmeld::datastore::objects {
       const nmco::Uuid& toolRunId, const std::string& deviceId)
   {
     AclRule::save(t, toolRunId, deviceId);
-    t.exec_prepared("insert_raw_device_acl_rule_service",
+    nmdu::execPrepared(t, "insert_raw_device_acl_rule_service",
         toolRunId,
         deviceId,
         priority,
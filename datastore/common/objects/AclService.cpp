@@ -87,14 +87,14 @@ namespace netmeld::datastore::objects {
       return; // Always short circuit if invalid object
     }
 
-    t.exec_prepared("insert_raw_device_acl_service_base",
+    nmdu::execPrepared(t, "insert_raw_device_acl_service_base",
         toolRunId,
         deviceId,
         id
         );
 
     if (!protocol.empty()) {
-      t.exec_prepared("insert_raw_device_acl_service_protocol",
+      nmdu::execPrepared(t, "insert_raw_device_acl_service_protocol",
           toolRunId,
           deviceId,
           id,
@@ -103,7 +103,7 @@ namespace netmeld::datastore::objects {
 
       for (const auto& srcPortRange : srcPortRanges) {
         for (const auto& dstPortRange : dstPortRanges) {
-          t.exec_prepared("insert_raw_device_acl_service_port",
+          nmdu::execPrepared(t, "insert_raw_device_acl_service_port",
               toolRunId,
               deviceId,
               id,
@@ -116,7 +116,7 @@ namespace netmeld::datastore::objects {
     }
 
     for (const auto& includedId : includedIds) {
-      t.exec_prepared("insert_raw_device_acl_service_include",
+      nmdu::execPrepared(t, "insert_raw_device_acl_service_include",
           toolRunId,
           deviceId,
           id,
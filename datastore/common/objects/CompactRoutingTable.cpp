@@ -0,0 +1,291 @@
+// =============================================================================
+// Copyright 2023 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+// =============================================================================
+
+#include <algorithm>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+
+#include <netmeld/datastore/objects/CompactRoutingTable.hpp>
+
+
+namespace netmeld::datastore::objects {
+  // ===========================================================================
+  // Constructors
+  // ===========================================================================
+  CompactRoutingTable::CompactRoutingTable()
+  {}
+
+
+  // ===========================================================================
+  // Methods
+  // ===========================================================================
+  uint32_t
+  CompactRoutingTable::intern(const std::string& value)
+  {
+    const auto& [it, isNew]
+      {stringIds.try_emplace(value, static_cast<uint32_t>(strings.size()))};
+    if (isNew) {
+      strings.push_back(value);
+    }
+    return it->second;
+  }
+
+  uint32_t
+  CompactRoutingTable::internNextHop(const IpAddress& nextHop)
+  {
+    const auto& [it, isNew]
+      {nextHopIds.try_emplace(nextHop, static_cast<uint32_t>(nextHops.size()))};
+    if (isNew) {
+      nextHops.push_back(nextHop);
+    }
+    return it->second;
+  }
+
+  void
+  CompactRoutingTable::push_back(const Route& route)
+  {
+    if (std::numeric_limits<uint32_t>::max() <= dstIpNets.size()) {
+      throw std::length_error("CompactRoutingTable is full");
+    }
+
+    dstIpNets.push_back(route.dstIpNet);
+    nextHopIdxs.push_back(internNextHop(route.nextHopIpAddr));
+    vrfIds.push_back(intern(route.vrfId));
+    tableIds.push_back(intern(route.tableId));
+    nextVrfIds.push_back(intern(route.nextVrfId));
+    nextTableIds.push_back(intern(route.nextTableId));
+    ifaceNames.push_back(intern(route.ifaceName));
+    protocols.push_back(intern(route.protocol));
+    descriptions.push_back(intern(route.description));
+    adminDistances.push_back(static_cast<uint32_t>(route.adminDistance));
+    metrics.push_back(static_cast<uint32_t>(route.metric));
+    actives.push_back(route.isActive);
+    nullRoutes.push_back(route.isNullRoute);
+  }
+
+  CompactRoutingTable::iterator
+  CompactRoutingTable::insert(const_iterator pos, const Route& route)
+  {
+    if (end() != pos) {
+      throw std::logic_error("CompactRoutingTable only supports appending");
+    }
+    push_back(route);
+    return {this, size() - 1};
+  }
+
+  void
+  CompactRoutingTable::clear()
+  {
+    *this = CompactRoutingTable();
+  }
+
+  void
+  CompactRoutingTable::reserve(size_t count)
+  {
+    dstIpNets.reserve(count);
+    nextHopIdxs.reserve(count);
+    vrfIds.reserve(count);
+    tableIds.reserve(count);
+    nextVrfIds.reserve(count);
+    nextTableIds.reserve(count);
+    ifaceNames.reserve(count);
+    protocols.reserve(count);
+    descriptions.reserve(count);
+    adminDistances.reserve(count);
+    metrics.reserve(count);
+    actives.reserve(count);
+    nullRoutes.reserve(count);
+  }
+
+  Route
+  CompactRoutingTable::at(size_t i) const
+  {
+    Route route;
+    route.vrfId         = strings[vrfIds.at(i)];
+    route.tableId       = strings[tableIds[i]];
+    route.dstIpNet      = dstIpNets[i];
+    route.nextVrfId     = strings[nextVrfIds[i]];
+    route.nextTableId   = strings[nextTableIds[i]];
+    route.nextHopIpAddr = nextHops[nextHopIdxs[i]];
+    route.ifaceName     = strings[ifaceNames[i]];
+    route.protocol      = strings[protocols[i]];
+    route.description   = strings[descriptions[i]];
+    route.adminDistance = adminDistances[i];
+    route.metric        = metrics[i];
+    route.isActive      = actives[i];
+    route.isNullRoute   = nullRoutes[i];
+
+    return route;
+  }
+
+  size_t
+  CompactRoutingTable::size() const
+  {
+    return dstIpNets.size();
+  }
+
+  bool
+  CompactRoutingTable::empty() const
+  {
+    return dstIpNets.empty();
+  }
+
+  size_t
+  CompactRoutingTable::nextHopCount() const
+  {
+    return nextHops.size();
+  }
+
+  CompactRoutingTable::const_iterator
+  CompactRoutingTable::begin() const
+  {
+    return {this, 0};
+  }
+
+  CompactRoutingTable::const_iterator
+  CompactRoutingTable::end() const
+  {
+    return {this, size()};
+  }
+
+  void
+  CompactRoutingTable::setVrfId(const std::string& _vrfId)
+  {
+    const auto id {intern(_vrfId)};  // preserve case.
+    std::fill(vrfIds.begin(), vrfIds.end(), id);
+  }
+
+  // Each distinct next hop is saved only once and a destination is not
+  // saved again for consecutive (e.g., ECMP) routes
+  void
+  CompactRoutingTable::forEachSaved(const std::string& deviceId,
+      const std::function<void(size_t, bool, bool)>& visit) const
+  {
+    std::vector<bool> isNextHopSaved(nextHops.size(), false);
+
+    const IpNetwork* prevDstIpNet {nullptr};
+    for (size_t i {0}; i < size(); ++i) {
+      const auto nextHopIdx {nextHopIdxs[i]};
+      const auto& nextHop   {nextHops[nextHopIdx]};
+      const auto& dstIpNet  {dstIpNets[i]};
+
+      if (nextHop.isDefault() && dstIpNet.isDefault() && !deviceId.empty()) {
+        LOG_DEBUG << "Route object is not saving: " << at(i).toDebugString()
+                  << std::endl;
+        continue;
+      }
+
+      const bool saveDstIpNet {
+        nullptr == prevDstIpNet || !(*prevDstIpNet == dstIpNet)
+      };
+      if (saveDstIpNet) {
+        prevDstIpNet = &dstIpNet;
+      }
+      const bool saveNextHop {!isNextHopSaved[nextHopIdx]};
+      isNextHopSaved[nextHopIdx] = true;
+
+      visit(i, saveDstIpNet, saveNextHop);
+    }
+  }
+
+  // Mirrors Route::save, see forEachSaved for what is skipped
+  void
+  CompactRoutingTable::save(pqxx::transaction_base& t,
+                            const nmco::Uuid& toolRunId,
+                            const std::string& deviceId)
+  {
+    std::vector<std::string> nextHopStrings;
+    nextHopStrings.reserve(nextHops.size());
+    for (const auto& nextHop : nextHops) {
+      nextHopStrings.push_back(nextHop.toString());
+    }
+
+    forEachSaved(deviceId,
+        [&](size_t i, bool saveDstIpNet, bool saveNextHop)
+        {
+          const auto nextHopIdx {nextHopIdxs[i]};
+
+          if (saveDstIpNet) {
+            dstIpNets[i].save(t, toolRunId, deviceId);
+          }
+          if (saveNextHop) {
+            nextHops[nextHopIdx].save(t, toolRunId, deviceId);
+          }
+
+          nmdu::execPrepared(t, "insert_raw_device_ip_route"
+            , toolRunId
+            , deviceId // insert converts to lower
+            , strings[vrfIds[i]]
+            , strings[tableIds[i]]
+            , static_cast<bool>(actives[i])
+            , dstIpNets[i].toString()
+            , strings[nextVrfIds[i]] // insert converts '' to null
+            , strings[nextTableIds[i]] // insert converts '' to null
+            , nullRoutes[i] ? strings[0] : nextHopStrings[nextHopIdx]
+            , strings[ifaceNames[i]] // insert converts '' to null
+            , strings[protocols[i]] // insert converts to lower and '' to null
+            , adminDistances[i]
+            , metrics[i]
+            , strings[descriptions[i]] // insert converts '' to null
+            );
+        });
+  }
+
+  void
+  CompactRoutingTable::saveAsMetadata(pqxx::transaction_base& t,
+                                      const nmco::Uuid& toolRunId)
+  {
+    for (size_t i {0}; i < size(); ++i) {
+      const auto& nextHop  {nextHops[nextHopIdxs[i]]};
+      const auto& dstIpNet {dstIpNets[i]};
+
+      if (nextHop.isDefault() && dstIpNet.isDefault()) {
+        LOG_DEBUG << "Route object is not saving as metadata: "
+                  << at(i).toDebugString()
+                  << std::endl;
+        continue;
+      }
+
+      nmdu::execPrepared(t, "insert_tool_run_ip_route"
+        , toolRunId
+        , strings[ifaceNames[i]]
+        , dstIpNet.toString()
+        , nullRoutes[i] ? strings[0] : nextHop.toString()
+        );
+    }
+  }
+
+  std::string
+  CompactRoutingTable::toDebugString() const
+  {
+    std::ostringstream oss;
+
+    oss << "[" << size() << " routes, " << nextHopCount() << " next hops]";
+
+    return oss.str();
+  }
+}
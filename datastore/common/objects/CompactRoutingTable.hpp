@@ -0,0 +1,174 @@
+// =============================================================================
+// Copyright 2023 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+// =============================================================================
+
+#ifndef COMPACT_ROUTING_TABLE_HPP
+#define COMPACT_ROUTING_TABLE_HPP
+
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <netmeld/datastore/objects/Route.hpp>
+
+namespace netmeld::datastore::objects {
+
+  /* Column oriented store of Routes for full (e.g., Internet) routing tables.
+
+     Each route field is held in its own column.  Strings (VRF, table,
+     interface, protocol, description) and next hops repeat heavily across a
+     table, so each is stored once and referenced by index.  Saving issues
+     each distinct next hop's inserts once per table, rather than once per
+     route.
+
+     Behaves as an append-only sequence of Route: routes are added with
+     push_back (or insert at end(), so it can be a parser attribute) and read
+     back as Route values.
+  */
+  class CompactRoutingTable : public AbstractDatastoreObject {
+    // =========================================================================
+    // Iterators
+    // =========================================================================
+    private:
+      class Iterator {
+        private:
+          const CompactRoutingTable* table {nullptr};
+          size_t index {0};
+
+        public:
+          using iterator_category = std::input_iterator_tag;
+          using value_type        = Route;
+          using difference_type   = std::ptrdiff_t;
+          using pointer           = void;
+          using reference         = Route;
+
+          Iterator() = default;
+          Iterator(const CompactRoutingTable* _table, size_t _index) :
+            table(_table), index(_index)
+          {}
+
+          reference operator*() const { return table->at(index); }
+
+          Iterator& operator++()
+          {
+            ++index;
+            return *this;
+          }
+          Iterator operator++(int)
+          {
+            auto tmp {*this};
+            ++(*this);
+            return tmp;
+          }
+
+          bool operator==(const Iterator&) const = default;
+      };
+
+    public:
+      using value_type     = Route;
+      using reference      = Route;
+      using const_iterator = Iterator;
+      using iterator       = Iterator;
+      using size_type      = size_t;
+
+    // =========================================================================
+    // Variables
+    // =========================================================================
+    private: // Variables will probably rarely appear at this scope
+      std::vector<std::string>                  strings {""};
+      std::unordered_map<std::string, uint32_t> stringIds {{"", 0}};
+
+      std::vector<IpAddress>                    nextHops;
+      std::map<IpAddress, uint32_t>             nextHopIds;
+
+      // Columns, each indexed by route
+      std::vector<IpNetwork> dstIpNets;
+      std::vector<uint32_t>  nextHopIdxs;
+      std::vector<uint32_t>  vrfIds;
+      std::vector<uint32_t>  tableIds;
+      std::vector<uint32_t>  nextVrfIds;
+      std::vector<uint32_t>  nextTableIds;
+      std::vector<uint32_t>  ifaceNames;
+      std::vector<uint32_t>  protocols;
+      std::vector<uint32_t>  descriptions;
+      std::vector<uint32_t>  adminDistances;
+      std::vector<uint32_t>  metrics;
+      std::vector<bool>      actives;
+      std::vector<bool>      nullRoutes;
+
+    protected: // Variables intended for internal/subclass API
+    public: // Variables should rarely appear at this scope
+
+    // =========================================================================
+    // Constructors
+    // =========================================================================
+    private: // Constructors which should be hidden from API users
+    protected: // Constructors part of subclass API
+    public: // Constructors part of public API
+      CompactRoutingTable();
+
+    // =========================================================================
+    // Methods
+    // =========================================================================
+    private: // Methods which should be hidden from API users
+      uint32_t intern(const std::string&);
+      uint32_t internNextHop(const IpAddress&);
+
+    protected: // Methods part of subclass API
+    public: // Methods part of public API
+      void push_back(const Route&);
+      iterator insert(const_iterator, const Route&);
+      void clear();
+      void reserve(size_t);
+
+      Route at(size_t) const;
+      size_t size() const;
+      bool empty() const;
+      size_t nextHopCount() const;
+
+      const_iterator begin() const;
+      const_iterator end() const;
+
+      // Sets the VRF of every route held
+      void setVrfId(const std::string&);
+
+      // Calls back, in order, with each route save() inserts for the device
+      // and whether its destination and next hop are also saved before it
+      void forEachSaved(const std::string&,
+                        const std::function<void(size_t, bool, bool)>&) const;
+
+      void save(pqxx::transaction_base&,
+                const nmco::Uuid&, const std::string&) override;
+      void saveAsMetadata(pqxx::transaction_base&,
+                          const nmco::Uuid&) override;
+
+      std::string toDebugString() const override;
+  };
+}
+#endif // COMPACT_ROUTING_TABLE_HPP
@@ -0,0 +1,189 @@
+// =============================================================================
+// Copyright 2023 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+// =============================================================================
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+#include <boost/test/unit_test.hpp>
+
+#include <stdexcept>
+#include <tuple>
+
+#include <netmeld/datastore/objects/CompactRoutingTable.hpp>
+
+namespace nmdo = netmeld::datastore::objects;
+
+
+// Route i of a synthetic full table: a unique /24 via one of 32 peers
+nmdo::Route
+makeRoute(size_t i)
+{
+  nmdo::IpAddress dstIpNet;
+  dstIpNet.setAddress(std::to_string(1 + ((i >> 16) & 0xdf)) + "."
+                      + std::to_string((i >> 8) & 0xff) + "."
+                      + std::to_string(i & 0xff) + ".0");
+  dstIpNet.setPrefix(24);
+
+  nmdo::IpAddress nextHop;
+  nextHop.setAddress("192.0.2." + std::to_string(1 + (i % 32)));
+
+  nmdo::Route route;
+  route.setVrfId("default");
+  route.setDstIpNet(dstIpNet);
+  route.setNextHopIpAddr(nextHop);
+  route.setIfaceName("Ethernet" + std::to_string(i % 4));
+  route.setProtocol("BGP");
+  route.setAdminDistance(20);
+  route.setMetric(i % 100);
+
+  return route;
+}
+
+BOOST_AUTO_TEST_CASE(testPushBackAt)
+{
+  nmdo::CompactRoutingTable table;
+  BOOST_TEST(table.empty());
+  BOOST_TEST(0 == table.size());
+  BOOST_TEST(0 == table.nextHopCount());
+  BOOST_CHECK(table.begin() == table.end());
+
+  std::vector<nmdo::Route> routes;
+  for (size_t i {0}; i < 64; ++i) {
+    routes.push_back(makeRoute(i));
+  }
+  {
+    nmdo::Route route;
+    route.setVrfId("Mgmt");
+    route.setTableId("t1");
+    route.setDstIpNet(nmdo::IpAddress("2001:db8::/32"));
+    route.setNextVrfId("other");
+    route.setNextTableId("t2");
+    route.setIfaceName("Null0");
+    route.setDescription("blackhole");
+    route.setActive(false);
+    route.setNullRoute(true);
+    routes.push_back(route);
+  }
+
+  for (const auto& route : routes) {
+    table.push_back(route);
+  }
+
+  BOOST_TEST(!table.empty());
+  BOOST_TEST(routes.size() == table.size());
+  // 32 peers plus the IPv6 default the null route is given
+  BOOST_TEST(33 == table.nextHopCount());
+
+  for (size_t i {0}; i < routes.size(); ++i) {
+    BOOST_TEST(routes[i] == table.at(i));
+  }
+  size_t i {0};
+  for (const auto& route : table) {
+    BOOST_TEST(routes.at(i) == route);
+    ++i;
+  }
+  BOOST_TEST(routes.size() == i);
+
+  BOOST_CHECK_THROW(table.at(routes.size()), std::out_of_range);
+  BOOST_CHECK_THROW(table.insert(table.begin(), routes[0]), std::logic_error);
+
+  table.insert(table.end(), routes[0]);
+  BOOST_TEST(routes.size() + 1 == table.size());
+  BOOST_TEST(routes[0] == table.at(routes.size()));
+
+  table.clear();
+  BOOST_TEST(table.empty());
+  BOOST_TEST(0 == table.nextHopCount());
+}
+
+BOOST_AUTO_TEST_CASE(testSetVrfId)
+{
+  nmdo::CompactRoutingTable table;
+  for (size_t i {0}; i < 4; ++i) {
+    table.push_back(makeRoute(i));
+  }
+
+  table.setVrfId("Customer-A");
+  for (size_t i {0}; i < table.size(); ++i) {
+    auto route {makeRoute(i)};
+    route.setVrfId("Customer-A");
+    BOOST_TEST(route == table.at(i));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testForEachSaved)
+{
+  auto route = [](const std::string& _dstIpNet, const std::string& _nextHop)
+    {
+      nmdo::Route route;
+      route.setDstIpNet(nmdo::IpAddress(_dstIpNet));
+      route.setNextHopIpAddr(nmdo::IpAddress(_nextHop));
+      return route;
+    };
+
+  nmdo::CompactRoutingTable table;
+  table.push_back(route("10.0.0.0/24", "192.0.2.1"));
+  table.push_back(route("10.0.0.0/24", "192.0.2.2"));  // ECMP
+  table.push_back(route("10.0.1.0/24", "192.0.2.1"));
+  table.push_back(nmdo::Route());                      // default, no hop
+  table.push_back(route("10.0.0.0/24", "192.0.2.1"));  // not consecutive
+  table.push_back(route("10.0.2.0/24", "192.0.2.3"));
+
+  typedef std::tuple<size_t, bool, bool> Saved;
+  auto saved = [&table](const std::string& _deviceId)
+    {
+      std::vector<Saved> result;
+      table.forEachSaved(_deviceId,
+          [&result](size_t i, bool saveDstIpNet, bool saveNextHop)
+          {
+            result.emplace_back(i, saveDstIpNet, saveNextHop);
+          });
+      return result;
+    };
+
+  {
+    const std::vector<Saved> expected {
+        {0, true, true},
+        {1, false, true},
+        {2, true, false},
+        {4, true, false},
+        {5, true, true},
+      };
+    BOOST_CHECK(expected == saved("device"));
+  }
+
+  {
+    // Only skipped for a device
+    const std::vector<Saved> expected {
+        {0, true, true},
+        {1, false, true},
+        {2, true, false},
+        {3, true, true},
+        {4, true, false},
+        {5, true, true},
+      };
+    BOOST_CHECK(expected == saved(""));
+  }
+}
@@ -92,7 +92,7 @@ namespace netmeld::datastore::objects {
 
     port.save(t, toolRunId, _deviceId);
 
-    t.exec_prepared("insert_raw_nessus_result_cve",
+    nmdu::execPrepared(t, "insert_raw_nessus_result_cve",
       toolRunId,
       port.getIpAddress().toString(),
       port.getProtocol(),
@@ -117,7 +117,7 @@ namespace netmeld::datastore::objects {
       return;
     }
 
-    t.exec_prepared("insert_raw_device",
+    nmdu::execPrepared(t, "insert_raw_device",
       toolRunId,
       deviceId);
 
@@ -129,7 +129,7 @@ namespace netmeld::datastore::objects {
         || !description.empty()
        )
     {
-      t.exec_prepared("insert_raw_device_hardware_information",
+      nmdu::execPrepared(t, "insert_raw_device_hardware_information",
         toolRunId,
         deviceId,
         deviceType, // query converts empty to NULL
@@ -141,7 +141,7 @@ namespace netmeld::datastore::objects {
     }
 
     if (!deviceColor.empty()) {
-      t.exec_prepared("insert_device_color",
+      nmdu::execPrepared(t, "insert_device_color",
         deviceId,
         deviceColor);
     }
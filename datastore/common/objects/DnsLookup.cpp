@@ -71,7 +71,7 @@ namespace netmeld::datastore::objects {
 	{
     for (auto& [sectionName, responses] : responseSections) {
       for (auto& response : responses) {
-        t.exec_prepared("insert_raw_dns_lookup",
+        nmdu::execPrepared(t, "insert_raw_dns_lookup",
             toolRunId,
             resolver.getIpAddress().toString(),
             resolver.getPort(),
@@ -82,7 +82,7 @@ namespace netmeld::datastore::objects {
   DnsResolver::save(pqxx::transaction_base& t,
             const nmco::Uuid& toolRunId, const std::string& deviceId)
   {
-    t.exec_prepared("insert_raw_device_dns_resolver",
+    nmdu::execPrepared(t, "insert_raw_device_dns_resolver",
         toolRunId,
         deviceId,
         ifaceName,
@@ -119,7 +119,7 @@ namespace netmeld::datastore::objects {
     }
 
     //LOG_DEBUG << "Inserting interface" << std::endl;
-    t.exec_prepared("insert_raw_device_interface",
+    nmdu::execPrepared(t, "insert_raw_device_interface",
       toolRunId,
       deviceId,
       name,
@@ -132,7 +132,7 @@ namespace netmeld::datastore::objects {
 
     // Tie interface to MAC
     if (macAddr.isValid()) {
-      t.exec_prepared("insert_raw_device_mac_addr",
+      nmdu::execPrepared(t, "insert_raw_device_mac_addr",
         toolRunId,
         deviceId,
         name,
@@ -147,7 +147,7 @@ namespace netmeld::datastore::objects {
     for (const auto& ipAddr : macAddr.getIpAddresses()) {
       if (!ipAddr.isValid()) { continue; }
 
-      t.exec_prepared("insert_raw_device_ip_addr",
+      nmdu::execPrepared(t, "insert_raw_device_ip_addr",
         toolRunId,
         deviceId,
         name,
@@ -165,14 +165,14 @@ namespace netmeld::datastore::objects {
       return;
     }
 
-    t.exec_prepared("insert_tool_run_interface",
+    nmdu::execPrepared(t, "insert_tool_run_interface",
       toolRunId,
       name,
       mediaType,
       isUp);
 
     if (macAddr.isValid()) {
-      t.exec_prepared("insert_tool_run_mac_addr",
+      nmdu::execPrepared(t, "insert_tool_run_mac_addr",
         toolRunId,
         name,
         macAddr.toString());
@@ -181,7 +181,7 @@ namespace netmeld::datastore::objects {
     for (const auto& ipAddr : macAddr.getIpAddresses()) {
       if (!ipAddr.isValid()) { continue; }
 
-      t.exec_prepared("insert_tool_run_ip_addr",
+      nmdu::execPrepared(t, "insert_tool_run_ip_addr",
         toolRunId,
         name,
         ipAddr.toString());
@@ -67,15 +67,31 @@ namespace netmeld::datastore::objects {
   void
   InterfaceNetwork::addVlan(const uint16_t _vlan)
   {
-    vlans.emplace(_vlan);
+    vlans.add(_vlan);
   }
 
   void
   InterfaceNetwork::addVlanRange(const uint16_t first, const uint16_t last)
   {
-    for (auto i {first}; i <= last; ++i) {
-      addVlan(i);
-    }
+    vlans.addRange(first, last);
+  }
+
+  void
+  InterfaceNetwork::addVlans(const VlanSet& _vlans)
+  {
+    vlans |= _vlans;
+  }
+
+  void
+  InterfaceNetwork::removeVlans(const VlanSet& _vlans)
+  {
+    vlans -= _vlans;
+  }
+
+  void
+  InterfaceNetwork::setVlans(const VlanSet& _vlans)
+  {
+    vlans = _vlans;
   }
 
   void
@@ -185,7 +201,7 @@ namespace netmeld::datastore::objects {
     return macAddr.getIpAddresses();
   }
 
-  const std::set<Vlan>&
+  const VlanSet&
   InterfaceNetwork::getVlans() const
   {
     return vlans;
@@ -211,7 +227,7 @@ namespace netmeld::datastore::objects {
       return;
     }
 
-    t.exec_prepared("insert_raw_device_interface",
+    nmdu::execPrepared(t, "insert_raw_device_interface",
       toolRunId,
       deviceId,
       name,
@@ -220,32 +236,32 @@ namespace netmeld::datastore::objects {
       description);
 
     if (!isPartial) {
-      t.exec_prepared("insert_raw_device_interfaces_cdp",
+      nmdu::execPrepared(t, "insert_raw_device_interfaces_cdp",
         toolRunId,
         deviceId,
         name,
         isDiscoveryProtocolEnabled);
 
-      t.exec_prepared("insert_raw_device_interfaces_bpdu",
+      nmdu::execPrepared(t, "insert_raw_device_interfaces_bpdu",
         toolRunId,
         deviceId,
         name,
         isBpduGuardEnabled,
         isBpduFilterEnabled);
 
-      t.exec_prepared("insert_raw_device_interfaces_portfast",
+      nmdu::execPrepared(t, "insert_raw_device_interfaces_portfast",
         toolRunId,
         deviceId,
         name,
         isPortfastEnabled);
 
-      t.exec_prepared("insert_raw_device_interfaces_mode",
+      nmdu::execPrepared(t, "insert_raw_device_interfaces_mode",
         toolRunId,
         deviceId,
         name,
         mode);
 
-      t.exec_prepared("insert_raw_device_interfaces_port_security",
+      nmdu::execPrepared(t, "insert_raw_device_interfaces_port_security",
         toolRunId,
         deviceId,
         name,
@@ -260,13 +276,13 @@ namespace netmeld::datastore::objects {
 
       if (!mac.isValid()) { continue; }
 
-      t.exec_prepared("insert_raw_device_link_connection",
+      nmdu::execPrepared(t, "insert_raw_device_link_connection",
         toolRunId,
         deviceId,
         name,
         mac.toString());
 
-      t.exec_prepared("insert_raw_device_interfaces_port_security_mac_addr",
+      nmdu::execPrepared(t, "insert_raw_device_interfaces_port_security_mac_addr",
         toolRunId,
         deviceId,
         name,
@@ -278,7 +294,7 @@ namespace netmeld::datastore::objects {
 
       if (!mac.isValid()) { continue; }
 
-      t.exec_prepared("insert_raw_device_link_connection",
+      nmdu::execPrepared(t, "insert_raw_device_link_connection",
         toolRunId,
         deviceId,
         name,
@@ -289,7 +305,7 @@ namespace netmeld::datastore::objects {
     macAddr.save(t, toolRunId, deviceId);
 
     if (macAddr.isValid()) {
-      t.exec_prepared("insert_raw_device_mac_addr",
+      nmdu::execPrepared(t, "insert_raw_device_mac_addr",
         toolRunId,
         deviceId,
         name,
@@ -298,23 +314,27 @@ namespace netmeld::datastore::objects {
 
     for (const auto& ipAddr : macAddr.getIpAddresses()) {
       if (!ipAddr.isValid()) { continue; }
-      t.exec_prepared("insert_raw_device_ip_addr",
+      nmdu::execPrepared(t, "insert_raw_device_ip_addr",
         toolRunId,
         deviceId,
         name,
         ipAddr.toString());
     }
 
-    for (auto vlan : vlans) {
-      vlan.save(t, toolRunId, deviceId);
+    // One round trip per run of VLANs, not per VLAN
+    for (const auto& [first, last] : vlans.getRanges()) {
+      nmdu::execPrepared(t, "insert_raw_device_vlan_range",
+        toolRunId,
+        deviceId,
+        first,
+        last);
 
-      if (vlan.isValid()) {
-        t.exec_prepared("insert_raw_device_interfaces_vlan",
-          toolRunId,
-          deviceId,
-          name,
-          vlan.getVlanId());
-      }
+      nmdu::execPrepared(t, "insert_raw_device_interfaces_vlan_range",
+        toolRunId,
+        deviceId,
+        name,
+        first,
+        last);
     }
   }
 
@@ -359,11 +379,7 @@ namespace netmeld::datastore::objects {
         << " ]"
         ;
 
-    oss << ", VLANs: [";
-    for (const auto& vlan : vlans) {
-      oss << vlan.toDebugString() << ", ";
-    }
-    oss << "]";
+    oss << ", VLANs: [" << vlans.toString() << "]";
 
     oss << "]"; // closing bracket
 
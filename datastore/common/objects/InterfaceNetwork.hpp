@@ -32,7 +32,7 @@
 #include <netmeld/datastore/objects/AbstractDatastoreObject.hpp>
 #include <netmeld/datastore/objects/IpAddress.hpp>
 #include <netmeld/datastore/objects/MacAddress.hpp>
-#include <netmeld/datastore/objects/Vlan.hpp>
+#include <netmeld/datastore/objects/VlanSet.hpp>
 
 
 namespace netmeld::datastore::objects {
@@ -63,7 +63,7 @@ namespace netmeld::datastore::objects {
       bool                  isPortSecurityStickyMac {false};
       std::set<MacAddress>  learnedMacAddrs;
       std::set<MacAddress>  reachableMacAddrs;
-      std::set<Vlan>        vlans;
+      VlanSet               vlans;
 
       // Default spanning-tree settings
       bool isBpduGuardEnabled   {false};
@@ -93,6 +93,9 @@ namespace netmeld::datastore::objects {
       void addReachableMac(const MacAddress&);
       void addVlan(const uint16_t);
       void addVlanRange(const uint16_t, const uint16_t);
+      void addVlans(const VlanSet&);
+      void removeVlans(const VlanSet&);
+      void setVlans(const VlanSet&);
       void setDiscoveryProtocol(bool);
       void setDescription(const std::string&);
       void setMacAddress(const MacAddress&);
@@ -112,7 +115,7 @@ namespace netmeld::datastore::objects {
       std::string getName() const;
       bool getState() const;
       const std::set<IpAddress>& getIpAddresses() const;
-      const std::set<Vlan>& getVlans() const;
+      const VlanSet& getVlans() const;
 
       // Always overriden from AbstractDatastoreObject
       bool isValid() const override;
@@ -28,7 +28,11 @@
 #define BOOST_TEST_MAIN
 #include <boost/test/unit_test.hpp>
 
+#include <set>
+#include <stdexcept>
+
 #include <netmeld/datastore/objects/InterfaceNetwork.hpp>
+#include <netmeld/datastore/objects/Vlan.hpp>
 #include <netmeld/core/utils/StringUtilities.hpp>
 
 namespace nmdo = netmeld::datastore::objects;
@@ -82,7 +86,7 @@ class TestInterfaceNetwork : public nmdo::InterfaceNetwork {
     bool getIsPartial() const
     { return isPartial; }
 
-    std::set<nmdo::Vlan> getVlans() const
+    nmdo::VlanSet getVlans() const
     { return vlans; }
 };
 
@@ -139,13 +143,39 @@ BOOST_AUTO_TEST_CASE(testSetters)
     uint16_t vlanId {0};
     interface.addVlan(vlanId);
     interface.addVlan(vlanId);
-    vlanId = UINT16_MAX;
+    vlanId = 4095;
     interface.addVlan(vlanId);
+    // Outside the 12 bit VLAN ID space, so ignored
+    interface.addVlan(UINT16_MAX);
 
     auto vlans {interface.getVlans()};
     BOOST_CHECK_EQUAL(2, vlans.size());
-    BOOST_CHECK_EQUAL(1, vlans.count(nmdo::Vlan(vlanId)));
-    BOOST_CHECK_EQUAL(1, vlans.count(nmdo::Vlan(vlanId)));
+    BOOST_CHECK(vlans.contains(0));
+    BOOST_CHECK(vlans.contains(vlanId));
+    BOOST_CHECK(!vlans.contains(UINT16_MAX));
+  }
+
+  {
+    TestInterfaceNetwork interface;
+    interface.addVlanRange(1, 4094);
+    interface.addVlanRange(100, 200);
+
+    nmdo::VlanSet removed;
+    removed.addRange(10, 19);
+    interface.removeVlans(removed);
+
+    nmdo::VlanSet added;
+    added.add(15);
+    interface.addVlans(added);
+
+    auto vlans {interface.getVlans()};
+    BOOST_CHECK_EQUAL(4085, vlans.size());
+    BOOST_CHECK_EQUAL("1-9,15,20-4094", vlans.toString());
+
+    nmdo::VlanSet replaced;
+    replaced.addRange(30, 31);
+    interface.setVlans(replaced);
+    BOOST_CHECK_EQUAL("30-31", interface.getVlans().toString());
   }
 
   {
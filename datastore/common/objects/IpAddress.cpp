@@ -128,13 +128,13 @@ namespace netmeld::datastore::objects {
       fullReason = deviceId + "'s " + fullReason;
     }
 
-    t.exec_prepared("insert_raw_ip_addr",
+    nmdu::execPrepared(t, "insert_raw_ip_addr",
       toolRunId,
       toString(),
       isResponding);
 
     for (const auto& alias : aliases) {
-      t.exec_prepared("insert_raw_hostname",
+      nmdu::execPrepared(t, "insert_raw_hostname",
         toolRunId,
         toString(),
         alias,
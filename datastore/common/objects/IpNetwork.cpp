@@ -25,6 +25,8 @@
 // =============================================================================
 
 
+#include <iomanip>
+
 #include <netmeld/datastore/objects/IpNetwork.hpp>
 #include <netmeld/datastore/parsers/ParserHelper.hpp>
 #include <netmeld/datastore/parsers/ParserIpAddress.hpp>
@@ -65,7 +67,9 @@ namespace netmeld::datastore::objects {
     } else if (16 == size) {
       oss << std::hex;
       for (size_t i {0}; i < size; i+=2) {
+        // Low byte must keep its leading zero (e.g., 01:06 is 106, not 16)
         oss << static_cast<uint16_t>(_addr.at(i))
+            << std::setw(2) << std::setfill('0')
             << static_cast<uint16_t>(_addr.at(i+1));
         if (size > (i+2)) { oss << ":"; }
       }
@@ -341,13 +345,13 @@ namespace netmeld::datastore::objects {
       fullReason = deviceId + "'s " + fullReason;
     }
 
-    t.exec_prepared("insert_raw_ip_net",
+    nmdu::execPrepared(t, "insert_raw_ip_net",
       toolRunId,
       toString(),
       fullReason); // insert converts '' to null
 
     if (0.0 < extraWeight) {
-      t.exec_prepared("insert_ip_net_extra_weight",
+      nmdu::execPrepared(t, "insert_ip_net_extra_weight",
         toString(),
         extraWeight);
     }
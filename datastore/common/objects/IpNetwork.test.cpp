@@ -42,6 +42,8 @@ class TestIpNetwork : public nmdo::IpNetwork {
     TestIpNetwork() : IpNetwork() {};
     TestIpNetwork(const std::string& _ip, const std::string& _desc) :
         IpNetwork(_ip, _desc) {};
+    explicit TestIpNetwork(const std::vector<uint8_t>& _ip) :
+        IpNetwork(_ip) {};
 
   public:
     IpAddr getAddress() const
@@ -80,6 +82,21 @@ BOOST_AUTO_TEST_CASE(testConstructors)
     BOOST_TEST("Some Description" == ipNet.getReason());
     BOOST_TEST(0.0 == ipNet.getExtraWeight());
   }
+
+  {
+    TestIpNetwork ipNet {std::vector<uint8_t>{10, 0, 0, 1}};
+
+    BOOST_TEST(IpAddr::from_string("10.0.0.1") == ipNet.getAddress());
+    BOOST_TEST(32 == ipNet.getPrefix());
+  }
+
+  {
+    TestIpNetwork ipNet {std::vector<uint8_t>{
+        0xfe, 0x80, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x0a, 0x01, 0x06}};
+
+    BOOST_TEST(IpAddr::from_string("fe80::a:106") == ipNet.getAddress());
+    BOOST_TEST(128 == ipNet.getPrefix());
+  }
 }
 
 BOOST_AUTO_TEST_CASE(testSettersSimple)
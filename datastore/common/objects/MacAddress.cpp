@@ -95,7 +95,7 @@ namespace netmeld::datastore::objects {
                    const nmco::Uuid& toolRunId, const std::string& deviceId)
   {
     if (isValid()) {
-      t.exec_prepared("insert_raw_mac_addr",
+      nmdu::execPrepared(t, "insert_raw_mac_addr",
         toolRunId,
         toString(),
         isResponding);
@@ -112,7 +112,7 @@ namespace netmeld::datastore::objects {
       if (!ipAddr.isValid()) { continue; }
 
       if (isValid()) {
-        t.exec_prepared("insert_raw_mac_addr_ip_addr",
+        nmdu::execPrepared(t, "insert_raw_mac_addr_ip_addr",
           toolRunId,
           toString(),
           ipAddr.toString());
@@ -95,7 +95,7 @@ namespace netmeld::datastore::objects {
 
     ipAddr.save(t, toolRunId, deviceId);
 
-    t.exec_prepared("insert_raw_operating_system",
+    nmdu::execPrepared(t, "insert_raw_operating_system",
         toolRunId,
         ipAddr.toString(),
         vendorName,
@@ -110,7 +110,7 @@ namespace netmeld::datastore::objects
         return;
         }
 
-        t.exec_prepared("insert_raw_packages",
+        nmdu::execPrepared(t, "insert_raw_packages",
             toolRunId,
             state,
             name,
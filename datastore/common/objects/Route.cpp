@@ -174,7 +174,7 @@ namespace netmeld::datastore::objects {
     dstIpNet.save(t, toolRunId, deviceId);
     nextHopIpAddr.save(t, toolRunId, deviceId);
 
-    t.exec_prepared("insert_raw_device_ip_route"
+    nmdu::execPrepared(t, "insert_raw_device_ip_route"
       , toolRunId
       , deviceId // insert converts to lower
       , vrfId
@@ -201,7 +201,7 @@ namespace netmeld::datastore::objects {
       return;
     }
 
-    t.exec_prepared("insert_tool_run_ip_route"
+    nmdu::execPrepared(t, "insert_tool_run_ip_route"
       , toolRunId
       , ifaceName
       , dstIpNet.toString()
@@ -38,7 +38,12 @@
 
 namespace netmeld::datastore::objects {
 
+  class CompactRoutingTable;
+
   class Route : public AbstractDatastoreObject {
+    // Stores routes column-wise, so needs direct access to the fields
+    friend class CompactRoutingTable;
+
     // =========================================================================
     // Variables
     // =========================================================================
@@ -166,7 +166,7 @@ namespace netmeld::datastore::objects {
                         const std::string& deviceId)
   {
     if (dstPorts.empty()) {
-      t.exec_prepared("insert_raw_device_ip_server",
+      nmdu::execPrepared(t, "insert_raw_device_ip_server",
           toolRunId,
           deviceId,
           interfaceName,
@@ -177,7 +177,7 @@ namespace netmeld::datastore::objects {
           serviceDescription); // insert converts '' to null
     } else {
       for (const auto& dstPort : dstPorts) {
-        t.exec_prepared("insert_raw_device_ip_server",
+        nmdu::execPrepared(t, "insert_raw_device_ip_server",
             toolRunId,
             deviceId,
             interfaceName,
@@ -205,7 +205,7 @@ namespace netmeld::datastore::objects {
       port.setPort(std::stoi(dstPort));
       port.save(t, toolRunId, "");
 
-      t.exec_prepared("insert_raw_network_service",
+      nmdu::execPrepared(t, "insert_raw_network_service",
           toolRunId,
           dstAddress.toString(),
           protocol,
@@ -60,6 +60,14 @@ namespace netmeld::datastore::objects {
             );
   }
 
+  void
+  ToolObservations::merge(const ToolObservations& other)
+  {
+    notables.insert(other.notables.begin(), other.notables.end());
+    unsupportedFeatures.insert(other.unsupportedFeatures.begin(),
+                               other.unsupportedFeatures.end());
+  }
+
   void
   ToolObservations::saveQuiet(pqxx::transaction_base& t,
                               const nmco::Uuid& toolRunId,
@@ -93,7 +101,7 @@ namespace netmeld::datastore::objects {
       if (!quiet) {
         LOG_INFO << nmcu::toUpper(category) << ": " << observation << '\n';
       }
-      t.exec_prepared("insert_raw_tool_observation",
+      nmdu::execPrepared(t, "insert_raw_tool_observation",
           toolRunId,
           category,
           observation);
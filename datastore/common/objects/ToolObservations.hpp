@@ -65,6 +65,7 @@ namespace netmeld::datastore::objects {
     public: // Methods part of public API
       void addNotable(const std::string&);
       void addUnsupportedFeature(const std::string&);
+      void merge(const ToolObservations&);
 
       bool isValid() const override;
       void save(pqxx::transaction_base&,
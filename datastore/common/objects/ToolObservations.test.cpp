@@ -86,3 +86,27 @@ BOOST_AUTO_TEST_CASE(testSetters)
     BOOST_TEST(values == tto.getUnsupportedFeatures());
   }
 }
+
+BOOST_AUTO_TEST_CASE(testMerge)
+{
+  {
+    TestToolObservations tto1;
+    tto1.addNotable("first data");
+    tto1.addUnsupportedFeature("some data");
+
+    TestToolObservations tto2;
+    tto2.addNotable("first data");
+    tto2.addNotable("more data");
+    tto2.addUnsupportedFeature("other data");
+
+    tto1.merge(tto2);
+    std::set<std::string> notables {"first data", "more data"};
+    BOOST_TEST(notables == tto1.getNotables());
+    std::set<std::string> features {"some data", "other data"};
+    BOOST_TEST(features == tto1.getUnsupportedFeatures());
+
+    // other side untouched
+    BOOST_TEST(2 == tto2.getNotables().size());
+    BOOST_TEST(1 == tto2.getUnsupportedFeatures().size());
+  }
+}
@@ -69,7 +69,7 @@ namespace netmeld::datastore::objects {
     hopIpAddr.save(t, toolRunId, deviceId);
     dstIpAddr.save(t, toolRunId, deviceId);
 
-    t.exec_prepared("insert_raw_ip_traceroute",
+    nmdu::execPrepared(t, "insert_raw_ip_traceroute",
         toolRunId,
         hopCount,
         hopIpAddr.toString(),
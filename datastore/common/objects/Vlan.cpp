@@ -89,7 +89,7 @@ namespace netmeld::datastore::objects {
     }
 
     if (deviceId.empty()) {
-      t.exec_prepared("insert_raw_vlan",
+      nmdu::execPrepared(t, "insert_raw_vlan",
           toolRunId,
           vlanId,
           description);
@@ -97,13 +97,13 @@ namespace netmeld::datastore::objects {
       // Associate VLAN to network
       ipNet.save(t, toolRunId, deviceId);
       if (ipNet.isValid()) {
-        t.exec_prepared("insert_raw_vlan_ip_net",
+        nmdu::execPrepared(t, "insert_raw_vlan_ip_net",
             toolRunId,
             vlanId,
             ipNet.toString());
       }
     } else {
-      t.exec_prepared("insert_raw_device_vlan",
+      nmdu::execPrepared(t, "insert_raw_device_vlan",
           toolRunId,
           deviceId,
           vlanId,
@@ -112,7 +112,7 @@ namespace netmeld::datastore::objects {
       // Associate VLAN to network
       ipNet.save(t, toolRunId, deviceId);
       if (ipNet.isValid()) {
-        t.exec_prepared("insert_raw_device_vlan_ip_net",
+        nmdu::execPrepared(t, "insert_raw_device_vlan_ip_net",
             toolRunId,
             deviceId,
             vlanId,
@@ -0,0 +1,248 @@
+// =============================================================================
+// Copyright 2023 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+// =============================================================================
+
+#include <algorithm>
+#include <bit>
+#include <sstream>
+
+#include <netmeld/datastore/objects/VlanSet.hpp>
+
+
+namespace netmeld::datastore::objects {
+
+  // ===========================================================================
+  // Methods
+  // ===========================================================================
+  size_t
+  VlanSet::nextSet(size_t _id) const
+  {
+    if (_id >= NUM_IDS) {
+      return NUM_IDS;
+    }
+
+    size_t index {_id / 64};
+    uint64_t word {words[index] & (~uint64_t {0} << (_id % 64))};
+    while (0 == word) {
+      if (++index == NUM_WORDS) {
+        return NUM_IDS;
+      }
+      word = words[index];
+    }
+    return index * 64 + static_cast<size_t>(std::countr_zero(word));
+  }
+
+  size_t
+  VlanSet::nextClear(size_t _id) const
+  {
+    if (_id >= NUM_IDS) {
+      return NUM_IDS;
+    }
+
+    size_t index {_id / 64};
+    uint64_t word {~words[index] & (~uint64_t {0} << (_id % 64))};
+    while (0 == word) {
+      if (++index == NUM_WORDS) {
+        return NUM_IDS;
+      }
+      word = ~words[index];
+    }
+    return index * 64 + static_cast<size_t>(std::countr_zero(word));
+  }
+
+  void
+  VlanSet::fill(size_t _first, size_t _last, bool _state)
+  {
+    for (size_t index {_first / 64}; index <= _last / 64; ++index) {
+      const size_t lo {(index == _first / 64) ? _first % 64 : 0};
+      const size_t hi {(index == _last / 64) ? _last % 64 : 63};
+      const uint64_t mask {
+        (~uint64_t {0} >> (63 - hi)) & (~uint64_t {0} << lo)
+      };
+      if (_state) {
+        words[index] |= mask;
+      } else {
+        words[index] &= ~mask;
+      }
+    }
+  }
+
+  bool
+  VlanSet::add(uint16_t _id)
+  {
+    if (_id > MAX_ID) {
+      return false;
+    }
+    words[_id / 64] |= uint64_t {1} << (_id % 64);
+    return true;
+  }
+
+  bool
+  VlanSet::addRange(uint16_t _first, uint16_t _last)
+  {
+    if (_first > _last || _first > MAX_ID) {
+      return false;
+    }
+    fill(_first, std::min(_last, MAX_ID), true);
+    return _last <= MAX_ID;
+  }
+
+  void
+  VlanSet::remove(uint16_t _id)
+  {
+    if (_id <= MAX_ID) {
+      words[_id / 64] &= ~(uint64_t {1} << (_id % 64));
+    }
+  }
+
+  void
+  VlanSet::removeRange(uint16_t _first, uint16_t _last)
+  {
+    if (_first <= _last && _first <= MAX_ID) {
+      fill(_first, std::min(_last, MAX_ID), false);
+    }
+  }
+
+  void
+  VlanSet::clear()
+  {
+    words.fill(0);
+  }
+
+  bool
+  VlanSet::contains(uint16_t _id) const
+  {
+    return _id <= MAX_ID && ((words[_id / 64] >> (_id % 64)) & 1U);
+  }
+
+  size_t
+  VlanSet::size() const
+  {
+    size_t count {0};
+    for (const auto word : words) {
+      count += static_cast<size_t>(std::popcount(word));
+    }
+    return count;
+  }
+
+  bool
+  VlanSet::empty() const
+  {
+    return std::all_of(words.cbegin(), words.cend(),
+                       [](uint64_t word){ return 0 == word; });
+  }
+
+  std::vector<std::pair<uint16_t, uint16_t>>
+  VlanSet::getRanges() const
+  {
+    std::vector<std::pair<uint16_t, uint16_t>> ranges;
+    for (auto first {nextSet(0)}; first < NUM_IDS;) {
+      const auto last {nextClear(first)};
+      ranges.emplace_back(static_cast<uint16_t>(first),
+                          static_cast<uint16_t>(last - 1));
+      first = nextSet(last);
+    }
+    return ranges;
+  }
+
+  VlanSet::Iterator
+  VlanSet::begin() const
+  {
+    return Iterator(this, nextSet(0));
+  }
+
+  VlanSet::Iterator
+  VlanSet::end() const
+  {
+    return Iterator(this, NUM_IDS);
+  }
+
+  VlanSet&
+  VlanSet::operator|=(const VlanSet& rhs)
+  {
+    for (size_t i {0}; i < NUM_WORDS; ++i) {
+      words[i] |= rhs.words[i];
+    }
+    return *this;
+  }
+
+  VlanSet&
+  VlanSet::operator&=(const VlanSet& rhs)
+  {
+    for (size_t i {0}; i < NUM_WORDS; ++i) {
+      words[i] &= rhs.words[i];
+    }
+    return *this;
+  }
+
+  VlanSet&
+  VlanSet::operator-=(const VlanSet& rhs)
+  {
+    for (size_t i {0}; i < NUM_WORDS; ++i) {
+      words[i] &= ~rhs.words[i];
+    }
+    return *this;
+  }
+
+  std::string
+  VlanSet::toString() const
+  {
+    std::ostringstream oss;
+    bool first {true};
+    for (const auto& [lo, hi] : getRanges()) {
+      if (!first) {
+        oss << ',';
+      }
+      first = false;
+
+      oss << lo;
+      if (lo != hi) {
+        oss << '-' << hi;
+      }
+    }
+    return oss.str();
+  }
+
+  // ===========================================================================
+  // Friends
+  // ===========================================================================
+  VlanSet
+  operator|(VlanSet lhs, const VlanSet& rhs)
+  {
+    return lhs |= rhs;
+  }
+
+  VlanSet
+  operator&(VlanSet lhs, const VlanSet& rhs)
+  {
+    return lhs &= rhs;
+  }
+
+  VlanSet
+  operator-(VlanSet lhs, const VlanSet& rhs)
+  {
+    return lhs -= rhs;
+  }
+}
@@ -0,0 +1,162 @@
+// =============================================================================
+// Copyright 2023 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+// =============================================================================
+
+#ifndef VLAN_SET_HPP
+#define VLAN_SET_HPP
+
+#include <array>
+#include <cstdint>
+#include <iterator>
+#include <string>
+#include <utility>
+#include <vector>
+
+
+namespace netmeld::datastore::objects {
+
+  /* Set of VLAN IDs (0-4095) held as a fixed 4096 bit bitset.
+
+     Adding or removing a range touches one word per 64 IDs, so a trunk
+     allowing every VLAN costs the same 512 bytes as one allowing a single
+     VLAN.  Iteration yields IDs in ascending order; getRanges() yields the
+     maximal runs of consecutive IDs, which is how the set is saved.
+  */
+  class VlanSet {
+    // =========================================================================
+    // Iterators
+    // =========================================================================
+    private:
+      class Iterator {
+        private:
+          const VlanSet* set {nullptr};
+          size_t         id  {0};
+
+        public:
+          using iterator_category = std::forward_iterator_tag;
+          using value_type        = uint16_t;
+          using difference_type   = std::ptrdiff_t;
+          using pointer           = void;
+          using reference         = uint16_t;
+
+          Iterator() = default;
+          Iterator(const VlanSet* _set, size_t _id) :
+            set(_set), id(_id)
+          {}
+
+          reference operator*() const { return static_cast<uint16_t>(id); }
+
+          Iterator& operator++()
+          {
+            id = set->nextSet(id + 1);
+            return *this;
+          }
+          Iterator operator++(int)
+          {
+            auto tmp {*this};
+            ++(*this);
+            return tmp;
+          }
+
+          bool operator==(const Iterator&) const = default;
+      };
+
+    public:
+      using value_type     = uint16_t;
+      using const_iterator = Iterator;
+      using iterator       = Iterator;
+      using size_type      = size_t;
+
+      static constexpr uint16_t MAX_ID {4095};
+
+    // =========================================================================
+    // Variables
+    // =========================================================================
+    private: // Variables will probably rarely appear at this scope
+      static constexpr size_t NUM_IDS   {MAX_ID + 1};
+      static constexpr size_t NUM_WORDS {NUM_IDS / 64};
+
+      std::array<uint64_t, NUM_WORDS> words {};
+
+    protected: // Variables intended for internal/subclass API
+    public: // Variables should rarely appear at this scope
+
+    // =========================================================================
+    // Constructors
+    // =========================================================================
+    private: // Constructors which should be hidden from API users
+    protected: // Constructors part of subclass API
+    public: // Constructors part of public API
+      VlanSet() = default;
+
+    // =========================================================================
+    // Methods
+    // =========================================================================
+    private: // Methods which should be hidden from API users
+      // First ID, at or after the given, which is (not) in the set;
+      // NUM_IDS if none
+      size_t nextSet(size_t) const;
+      size_t nextClear(size_t) const;
+
+      // Sets or clears the (inclusive, valid) range
+      void fill(size_t, size_t, bool);
+
+    protected: // Methods part of subclass API
+    public: // Methods part of public API
+      // False, and nothing changed, if the ID is above MAX_ID
+      bool add(uint16_t);
+      // Inclusive; IDs above MAX_ID are ignored, false if any were or the
+      // range is empty
+      bool addRange(uint16_t, uint16_t);
+      void remove(uint16_t);
+      void removeRange(uint16_t, uint16_t);
+      void clear();
+
+      bool contains(uint16_t) const;
+      size_t size() const;
+      bool empty() const;
+
+      // Maximal runs of consecutive IDs as inclusive (first, last), ascending
+      std::vector<std::pair<uint16_t, uint16_t>> getRanges() const;
+
+      Iterator begin() const;
+      Iterator end() const;
+
+      // Union, intersection, and difference
+      VlanSet& operator|=(const VlanSet&);
+      VlanSet& operator&=(const VlanSet&);
+      VlanSet& operator-=(const VlanSet&);
+
+      // Ranges, e.g., "1-3,7"
+      std::string toString() const;
+
+      bool operator==(const VlanSet&) const = default;
+
+      friend VlanSet operator|(VlanSet, const VlanSet&);
+      friend VlanSet operator&(VlanSet, const VlanSet&);
+      friend VlanSet operator-(VlanSet, const VlanSet&);
+  };
+}
+#endif // VLAN_SET_HPP
@@ -0,0 +1,128 @@
+// =============================================================================
+// Copyright 2023 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+// =============================================================================
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+#include <boost/test/unit_test.hpp>
+
+#include <netmeld/datastore/objects/VlanSet.hpp>
+
+namespace nmdo = netmeld::datastore::objects;
+
+using Ranges = std::vector<std::pair<uint16_t, uint16_t>>;
+
+
+BOOST_AUTO_TEST_CASE(testConstructors)
+{
+  nmdo::VlanSet vlans;
+
+  BOOST_TEST(vlans.empty());
+  BOOST_TEST(0 == vlans.size());
+  BOOST_TEST(vlans.getRanges().empty());
+  BOOST_CHECK(vlans.begin() == vlans.end());
+  BOOST_TEST("" == vlans.toString());
+}
+
+BOOST_AUTO_TEST_CASE(testSetters)
+{
+  {
+    nmdo::VlanSet vlans;
+
+    BOOST_TEST(vlans.add(0));
+    BOOST_TEST(vlans.add(0));
+    BOOST_TEST(vlans.add(nmdo::VlanSet::MAX_ID));
+    BOOST_TEST(!vlans.add(nmdo::VlanSet::MAX_ID + 1));
+    BOOST_TEST(!vlans.add(UINT16_MAX));
+
+    BOOST_TEST(2 == vlans.size());
+    BOOST_TEST(vlans.contains(0));
+    BOOST_TEST(vlans.contains(4095));
+    BOOST_TEST(!vlans.contains(UINT16_MAX));
+
+    vlans.remove(0);
+    vlans.remove(UINT16_MAX);
+    BOOST_TEST(1 == vlans.size());
+    BOOST_TEST(!vlans.contains(0));
+
+    vlans.clear();
+    BOOST_TEST(vlans.empty());
+  }
+
+  {
+    nmdo::VlanSet vlans;
+
+    // Spanning partial and whole words
+    BOOST_TEST(vlans.addRange(60, 200));
+    BOOST_TEST(141 == vlans.size());
+    BOOST_TEST((Ranges{{60, 200}} == vlans.getRanges()));
+
+    vlans.removeRange(64, 127);
+    BOOST_TEST((Ranges{{60, 63}, {128, 200}} == vlans.getRanges()));
+
+    BOOST_TEST(!vlans.addRange(10, 5));
+    BOOST_TEST(!vlans.addRange(4090, UINT16_MAX));
+    BOOST_TEST(vlans.contains(4095));
+    BOOST_TEST("60-63,128-200,4090-4095" == vlans.toString());
+
+    BOOST_TEST(vlans.addRange(0, 4095));
+    BOOST_TEST(4096 == vlans.size());
+    BOOST_TEST((Ranges{{0, 4095}} == vlans.getRanges()));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testIteration)
+{
+  nmdo::VlanSet vlans;
+  for (const auto id : std::vector<uint16_t>{1, 63, 64, 65, 1000, 4095}) {
+    vlans.add(id);
+  }
+
+  std::vector<uint16_t> ids {vlans.begin(), vlans.end()};
+  BOOST_TEST((std::vector<uint16_t>{1, 63, 64, 65, 1000, 4095} == ids));
+  BOOST_TEST((Ranges{{1, 1}, {63, 65}, {1000, 1000}, {4095, 4095}}
+              == vlans.getRanges()));
+  BOOST_TEST("1,63-65,1000,4095" == vlans.toString());
+}
+
+BOOST_AUTO_TEST_CASE(testSetAlgebra)
+{
+  nmdo::VlanSet lhs;
+  lhs.addRange(1, 100);
+  nmdo::VlanSet rhs;
+  rhs.addRange(50, 150);
+
+  BOOST_TEST("1-150" == (lhs | rhs).toString());
+  BOOST_TEST("50-100" == (lhs & rhs).toString());
+  BOOST_TEST("1-49" == (lhs - rhs).toString());
+  BOOST_TEST("101-150" == (rhs - lhs).toString());
+
+  auto copy {lhs};
+  BOOST_TEST((copy == lhs));
+  copy -= rhs;
+  copy |= (lhs & rhs);
+  BOOST_TEST((copy == lhs));
+  BOOST_TEST(!(copy == rhs));
+}
@@ -91,14 +91,14 @@ namespace netmeld::datastore::objects {
   Vrf::save(pqxx::transaction_base& t,
             const nmco::Uuid& toolRunId, const std::string& deviceId)
   {
-    t.exec_prepared("insert_raw_device_vrf",
+    nmdu::execPrepared(t, "insert_raw_device_vrf",
         toolRunId,
         deviceId,
         vrfId
         );
 
     for (const auto& iface : ifaces) {
-      t.exec_prepared("insert_raw_device_vrf_interface",
+      nmdu::execPrepared(t, "insert_raw_device_vrf_interface",
           toolRunId,
           deviceId,
           vrfId,
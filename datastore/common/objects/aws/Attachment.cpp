@@ -70,7 +70,7 @@ namespace netmeld::datastore::objects::aws {
       return;
     }
 
-    t.exec_prepared("insert_raw_aws_network_interface_attachment"
+    nmdu::execPrepared(t, "insert_raw_aws_network_interface_attachment"
         , toolRunId
         , deviceId
         , attachmentId
@@ -85,7 +85,7 @@ namespace netmeld::datastore::objects::aws {
       return;
     }
 
-    t.exec_prepared("insert_raw_aws_cidr_block"
+    nmdu::execPrepared(t, "insert_raw_aws_cidr_block"
         , toolRunId
         , cidrBlock
       );
@@ -105,7 +105,7 @@ namespace netmeld::datastore::objects::aws {
         !(state.empty())
       };
     if (hasDetails) {
-      t.exec_prepared("insert_raw_aws_cidr_block_detail"
+      nmdu::execPrepared(t, "insert_raw_aws_cidr_block_detail"
           , toolRunId
           , cidrBlock
           , state
@@ -114,7 +114,7 @@ namespace netmeld::datastore::objects::aws {
     }
 
     for (const auto& alias : aliases) {
-      t.exec_prepared("insert_raw_aws_cidr_block_fqdn"
+      nmdu::execPrepared(t, "insert_raw_aws_cidr_block_fqdn"
           , toolRunId
           , cidrBlock
           , alias
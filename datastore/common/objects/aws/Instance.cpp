@@ -100,12 +100,12 @@ namespace netmeld::datastore::objects::aws {
       return;
     }
 
-    t.exec_prepared("insert_raw_aws_instance"
+    nmdu::execPrepared(t, "insert_raw_aws_instance"
         , toolRunId
         , instanceId
       );
 
-    t.exec_prepared("insert_raw_aws_instance_detail"
+    nmdu::execPrepared(t, "insert_raw_aws_instance_detail"
         , toolRunId
         , instanceId
         , type
@@ -72,7 +72,7 @@ namespace netmeld::datastore::objects::aws {
       return;
     }
 
-    t.exec_prepared("insert_raw_aws_network_acl"
+    nmdu::execPrepared(t, "insert_raw_aws_network_acl"
         , toolRunId
         , naclId
       );
@@ -82,12 +82,12 @@ namespace netmeld::datastore::objects::aws {
     }
 
     if (!vpcId.empty()) {
-      t.exec_prepared("insert_raw_aws_vpc"
+      nmdu::execPrepared(t, "insert_raw_aws_vpc"
           , toolRunId
           , vpcId
         );
 
-      t.exec_prepared("insert_raw_aws_vpc_network_acl"
+      nmdu::execPrepared(t, "insert_raw_aws_vpc_network_acl"
           , toolRunId
           , vpcId
           , naclId
@@ -95,12 +95,12 @@ namespace netmeld::datastore::objects::aws {
     }
 
     for (const auto& subnetId : subnetIds) {
-      t.exec_prepared("insert_raw_aws_subnet"
+      nmdu::execPrepared(t, "insert_raw_aws_subnet"
           , toolRunId
           , subnetId
         );
 
-      t.exec_prepared("insert_raw_aws_network_acl_subnet"
+      nmdu::execPrepared(t, "insert_raw_aws_network_acl_subnet"
           , toolRunId
           , naclId
           , subnetId
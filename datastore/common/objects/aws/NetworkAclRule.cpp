@@ -106,7 +106,7 @@ namespace netmeld::datastore::objects::aws {
 
     for (auto ip : cidrBlocks) {
       ip.save(t, toolRunId, deviceId);
-      t.exec_prepared("insert_raw_aws_network_acl_rule"
+      nmdu::execPrepared(t, "insert_raw_aws_network_acl_rule"
           , toolRunId
           , deviceId
           , egress
@@ -123,7 +123,7 @@ namespace netmeld::datastore::objects::aws {
     }
 
     if (portRange) {
-      t.exec_prepared("insert_raw_aws_network_acl_rules_port"
+      nmdu::execPrepared(t, "insert_raw_aws_network_acl_rules_port"
           , toolRunId
           , deviceId
           , egress
@@ -134,7 +134,7 @@ namespace netmeld::datastore::objects::aws {
     }
 
     if (typeCode) {
-      t.exec_prepared("insert_raw_aws_network_acl_rules_type_code"
+      nmdu::execPrepared(t, "insert_raw_aws_network_acl_rules_type_code"
           , toolRunId
           , deviceId
           , egress
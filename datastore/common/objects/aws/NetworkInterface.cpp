@@ -123,7 +123,7 @@ namespace netmeld::datastore::objects::aws {
       return;
     }
 
-    t.exec_prepared("insert_raw_aws_network_interface"
+    nmdu::execPrepared(t, "insert_raw_aws_network_interface"
         , toolRunId
         , interfaceId
       );
@@ -133,7 +133,7 @@ namespace netmeld::datastore::objects::aws {
       };
 
     if (hasDetails) {
-      t.exec_prepared("insert_raw_aws_network_interface_detail"
+      nmdu::execPrepared(t, "insert_raw_aws_network_interface_detail"
           , toolRunId
           , interfaceId
           , type
@@ -146,7 +146,7 @@ namespace netmeld::datastore::objects::aws {
     attachment.save(t, toolRunId, interfaceId);
 
     if (!macAddr.empty()) {
-      t.exec_prepared("insert_raw_aws_network_interface_mac"
+      nmdu::execPrepared(t, "insert_raw_aws_network_interface_mac"
           , toolRunId
           , interfaceId
           , macAddr
@@ -155,7 +155,7 @@ namespace netmeld::datastore::objects::aws {
 
     for (auto cb : cidrBlocks) {
       cb.save(t, toolRunId, interfaceId);
-      t.exec_prepared("insert_raw_aws_network_interface_ip"
+      nmdu::execPrepared(t, "insert_raw_aws_network_interface_ip"
           , toolRunId
           , interfaceId
           , cb.getCidrBlock()
@@ -163,21 +163,21 @@ namespace netmeld::datastore::objects::aws {
     }
 
     if (!subnetId.empty()) {
-      t.exec_prepared("insert_raw_aws_subnet"
+      nmdu::execPrepared(t, "insert_raw_aws_subnet"
           , toolRunId
           , subnetId
         );
     }
 
     if (!vpcId.empty()) {
-      t.exec_prepared("insert_raw_aws_vpc"
+      nmdu::execPrepared(t, "insert_raw_aws_vpc"
           , toolRunId
           , vpcId
         );
     }
 
     if (!(subnetId.empty() || vpcId.empty())) {
-      t.exec_prepared("insert_raw_aws_network_interface_vpc_subnet"
+      nmdu::execPrepared(t, "insert_raw_aws_network_interface_vpc_subnet"
           , toolRunId
           , interfaceId
           , vpcId
@@ -186,12 +186,12 @@ namespace netmeld::datastore::objects::aws {
     }
 
     for (const auto& sg : securityGroups) {
-      t.exec_prepared("insert_raw_aws_security_group"
+      nmdu::execPrepared(t, "insert_raw_aws_security_group"
           , toolRunId
           , sg
         );
 
-      t.exec_prepared("insert_raw_aws_network_interface_security_group"
+      nmdu::execPrepared(t, "insert_raw_aws_network_interface_security_group"
           , toolRunId
           , interfaceId
           , sg
@@ -199,7 +199,7 @@ namespace netmeld::datastore::objects::aws {
     }
 
     if (!deviceId.empty()) {
-      t.exec_prepared("insert_raw_aws_instance_network_interface"
+      nmdu::execPrepared(t, "insert_raw_aws_instance_network_interface"
           , toolRunId
           , deviceId
           , interfaceId
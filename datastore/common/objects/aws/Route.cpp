@@ -76,7 +76,7 @@ namespace netmeld::datastore::objects::aws {
     for (auto ip : cidrBlocks) {
       ip.save(t, toolRunId, deviceId);
 
-      t.exec_prepared("insert_raw_aws_route_table_route_cidr"
+      nmdu::execPrepared(t, "insert_raw_aws_route_table_route_cidr"
           , toolRunId
           , deviceId
           , typeId
@@ -85,7 +85,7 @@ namespace netmeld::datastore::objects::aws {
         );
     }
     for (auto dest : nonCidrBlocks) {
-      t.exec_prepared("insert_raw_aws_route_table_route_non_cidr"
+      nmdu::execPrepared(t, "insert_raw_aws_route_table_route_non_cidr"
           , toolRunId
           , deviceId
           , typeId
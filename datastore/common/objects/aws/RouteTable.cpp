@@ -78,13 +78,13 @@ namespace netmeld::datastore::objects::aws {
       return;
     }
 
-    t.exec_prepared("insert_raw_aws_route_table"
+    nmdu::execPrepared(t, "insert_raw_aws_route_table"
         , toolRunId
         , routeTableId
       );
 
     for (const auto& association : associations) {
-      t.exec_prepared("insert_raw_aws_route_table_association"
+      nmdu::execPrepared(t, "insert_raw_aws_route_table_association"
           , toolRunId
           , routeTableId
           , association
@@ -96,12 +96,12 @@ namespace netmeld::datastore::objects::aws {
     }
 
     if (!vpcId.empty()) {
-      t.exec_prepared("insert_raw_aws_vpc"
+      nmdu::execPrepared(t, "insert_raw_aws_vpc"
           , toolRunId
           , vpcId
         );
 
-      t.exec_prepared("insert_raw_aws_vpc_route_table"
+      nmdu::execPrepared(t, "insert_raw_aws_vpc_route_table"
           , toolRunId
           , vpcId
           , routeTableId
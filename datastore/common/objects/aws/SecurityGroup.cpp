@@ -78,7 +78,7 @@ namespace netmeld::datastore::objects::aws {
       return;
     }
 
-    t.exec_prepared("insert_raw_aws_security_group"
+    nmdu::execPrepared(t, "insert_raw_aws_security_group"
         , toolRunId
         , sgId
       );
@@ -88,7 +88,7 @@ namespace netmeld::datastore::objects::aws {
       };
 
     if (hasDetails) {
-      t.exec_prepared("insert_raw_aws_security_group_detail"
+      nmdu::execPrepared(t, "insert_raw_aws_security_group_detail"
           , toolRunId
           , sgId
           , name
@@ -101,12 +101,12 @@ namespace netmeld::datastore::objects::aws {
     }
 
     if (!vpcId.empty()) {
-      t.exec_prepared("insert_raw_aws_vpc"
+      nmdu::execPrepared(t, "insert_raw_aws_vpc"
           , toolRunId
           , vpcId
         );
 
-      t.exec_prepared("insert_raw_aws_vpc_security_group"
+      nmdu::execPrepared(t, "insert_raw_aws_vpc_security_group"
           , toolRunId
           , vpcId
           , sgId
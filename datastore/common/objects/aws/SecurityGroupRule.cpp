@@ -106,7 +106,7 @@ namespace netmeld::datastore::objects::aws {
     for (auto ip : cidrBlocks) {
       ip.save(t, toolRunId, deviceId);
       if (protocol == icmp || protocol == any) {
-        t.exec_prepared("insert_raw_aws_security_group_rules_type_code"
+        nmdu::execPrepared(t, "insert_raw_aws_security_group_rules_type_code"
             , toolRunId
             , deviceId
             , egress
@@ -117,7 +117,7 @@ namespace netmeld::datastore::objects::aws {
           );
       }
       if (protocol != icmp || protocol == any) {
-        t.exec_prepared("insert_raw_aws_security_group_rules_port"
+        nmdu::execPrepared(t, "insert_raw_aws_security_group_rules_port"
             , toolRunId
             , deviceId
             , egress
@@ -131,7 +131,7 @@ namespace netmeld::datastore::objects::aws {
 
     for (const auto& target : nonCidrs) {
       if (protocol == icmp || protocol == any) {
-        t.exec_prepared("insert_raw_aws_security_group_rules_non_ip_type_code"
+        nmdu::execPrepared(t, "insert_raw_aws_security_group_rules_non_ip_type_code"
             , toolRunId
             , deviceId
             , egress
@@ -142,7 +142,7 @@ namespace netmeld::datastore::objects::aws {
           );
       }
       if (protocol != icmp || protocol == any) {
-        t.exec_prepared("insert_raw_aws_security_group_rules_non_ip_port"
+        nmdu::execPrepared(t, "insert_raw_aws_security_group_rules_non_ip_port"
             , toolRunId
             , deviceId
             , egress
@@ -155,7 +155,7 @@ namespace netmeld::datastore::objects::aws {
     }
 
     for (const auto& detail : details) {
-      t.exec_prepared("insert_raw_aws_security_group_rules_non_ip_detail"
+      nmdu::execPrepared(t, "insert_raw_aws_security_group_rules_non_ip_detail"
           , toolRunId
           , deviceId
           , egress
@@ -83,7 +83,7 @@ namespace netmeld::datastore::objects::aws {
       return;
     }
 
-    t.exec_prepared("insert_raw_aws_subnet"
+    nmdu::execPrepared(t, "insert_raw_aws_subnet"
         , toolRunId
         , subnetId
       );
@@ -93,7 +93,7 @@ namespace netmeld::datastore::objects::aws {
       };
 
     if (hasDetails) {
-      t.exec_prepared("insert_raw_aws_subnet_detail"
+      nmdu::execPrepared(t, "insert_raw_aws_subnet_detail"
           , toolRunId
           , subnetId
           , availabilityZone
@@ -104,7 +104,7 @@ namespace netmeld::datastore::objects::aws {
     for (auto cb : cidrBlocks) {
       cb.save(t, toolRunId, subnetId);
 
-      t.exec_prepared("insert_raw_aws_subnet_cidr_block"
+      nmdu::execPrepared(t, "insert_raw_aws_subnet_cidr_block"
           , toolRunId
           , subnetId
           , cb.toString()
@@ -112,12 +112,12 @@ namespace netmeld::datastore::objects::aws {
     }
 
     if (!vpcId.empty()) {
-      t.exec_prepared("insert_raw_aws_vpc"
+      nmdu::execPrepared(t, "insert_raw_aws_vpc"
           , toolRunId
           , vpcId
         );
 
-      t.exec_prepared("insert_raw_aws_vpc_subnet"
+      nmdu::execPrepared(t, "insert_raw_aws_vpc_subnet"
           , toolRunId
           , vpcId
           , subnetId
@@ -93,12 +93,12 @@ namespace netmeld::datastore::objects::aws {
       return;
     }
 
-    t.exec_prepared("insert_raw_aws_transit_gateway"
+    nmdu::execPrepared(t, "insert_raw_aws_transit_gateway"
         , toolRunId
         , tgwId
       );
 
-    t.exec_prepared("insert_raw_aws_transit_gateway_attachment"
+    nmdu::execPrepared(t, "insert_raw_aws_transit_gateway_attachment"
         , toolRunId
         , tgwId
         , tgwAttachmentId
@@ -106,7 +106,7 @@ namespace netmeld::datastore::objects::aws {
       );
 
     if (!tgwOwnerId.empty()) {
-      t.exec_prepared("insert_raw_aws_transit_gateway_owner"
+      nmdu::execPrepared(t, "insert_raw_aws_transit_gateway_owner"
           , toolRunId
           , tgwId
           , tgwOwnerId
@@ -121,7 +121,7 @@ namespace netmeld::datastore::objects::aws {
          )
       };
     if (hasDetails) {
-      t.exec_prepared("insert_raw_aws_transit_gateway_attachment_detail"
+      nmdu::execPrepared(t, "insert_raw_aws_transit_gateway_attachment_detail"
           , toolRunId
           , tgwId
           , tgwAttachmentId
@@ -84,19 +84,19 @@ namespace netmeld::datastore::objects::aws {
       return;
     }
 
-    t.exec_prepared("insert_raw_aws_vpc"
+    nmdu::execPrepared(t, "insert_raw_aws_vpc"
         , toolRunId
         , vpcId
       );
 
-    t.exec_prepared("insert_raw_aws_vpc_owner"
+    nmdu::execPrepared(t, "insert_raw_aws_vpc_owner"
         , toolRunId
         , vpcId
         , ownerId
       );
 
     if (!state.empty()) {
-      t.exec_prepared("insert_raw_aws_vpc_detail"
+      nmdu::execPrepared(t, "insert_raw_aws_vpc_detail"
           , toolRunId
           , vpcId
           , state
@@ -106,7 +106,7 @@ namespace netmeld::datastore::objects::aws {
     for (auto cidr : cidrBlocks) {
       cidr.save(t, toolRunId, vpcId);
 
-      t.exec_prepared("insert_raw_aws_vpc_cidr_block"
+      nmdu::execPrepared(t, "insert_raw_aws_vpc_cidr_block"
           , toolRunId
           , vpcId
           , cidr.toString()
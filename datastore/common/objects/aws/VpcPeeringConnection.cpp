@@ -76,12 +76,12 @@ namespace netmeld::datastore::objects::aws {
       return;
     }
 
-    t.exec_prepared("insert_raw_aws_vpc_peering_connection"
+    nmdu::execPrepared(t, "insert_raw_aws_vpc_peering_connection"
         , toolRunId
         , pcxId
       );
 
-    t.exec_prepared("insert_raw_aws_vpc_peering_connection_peer"
+    nmdu::execPrepared(t, "insert_raw_aws_vpc_peering_connection_peer"
         , toolRunId
         , pcxId
         , accepter.getId()
@@ -91,7 +91,7 @@ namespace netmeld::datastore::objects::aws {
       );
 
     if (!statusCode.empty()) {
-      t.exec_prepared("insert_raw_aws_vpc_peering_connection_status"
+      nmdu::execPrepared(t, "insert_raw_aws_vpc_peering_connection_status"
           , toolRunId
           , pcxId
           , statusCode
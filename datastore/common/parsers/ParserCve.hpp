@@ -36,7 +36,7 @@ namespace nmdo = netmeld::datastore::objects;
 namespace netmeld::datastore::parsers {
 
   class ParserCve :
-    public qi::grammar<IstreamIter, nmdo::Cve()>
+    public qi::grammar<ConstIter, nmdo::Cve()>
   {
     public:
       ParserCve() : ParserCve::base_type(start)
@@ -51,7 +51,7 @@ namespace netmeld::datastore::parsers {
         BOOST_SPIRIT_DEBUG_NODES((start))
       }
 
-      qi::rule<IstreamIter, nmdo::Cve()>   start;
+      qi::rule<ConstIter, nmdo::Cve()>   start;
   };
 }
 #endif // PARSER_CVE_HPP
@@ -83,9 +83,8 @@ BOOST_AUTO_TEST_CASE(testMalformed)
     };
     for (const auto& cve : cves) {
       nmdo::Cve result;
-      std::istringstream dataStream {cve};
-      dataStream.unsetf(std::ios::skipws);
-      nmdp::IstreamIter i {dataStream}, e;
+      nmdp::ConstIter i {cve.data()};
+      nmdp::ConstIter e {cve.data() + cve.size()};
       bool const success = qi::parse(i, e, nmdp::ParserCve(), result);
 
       BOOST_CHECK(!success);
@@ -107,9 +106,8 @@ BOOST_AUTO_TEST_CASE(testMalformed)
     };
     for (const auto& cve : cves) {
       nmdo::Cve result;
-      std::istringstream dataStream {cve};
-      dataStream.unsetf(std::ios::skipws);
-      nmdp::IstreamIter i {dataStream}, e;
+      nmdp::ConstIter i {cve.data()};
+      nmdp::ConstIter e {cve.data() + cve.size()};
       bool const success = qi::parse(i, e, nmdp::ParserCve(), result);
 
       BOOST_CHECK(!success);
@@ -33,7 +33,7 @@
 namespace netmeld::datastore::parsers {
 
   class ParserDomainName :
-    public qi::grammar<IstreamIter, std::string()>
+    public qi::grammar<ConstIter, std::string()>
   {
     public:
       ParserDomainName() : ParserDomainName::base_type(start)
@@ -61,7 +61,7 @@ namespace netmeld::datastore::parsers {
         BOOST_SPIRIT_DEBUG_NODES((start)(label));
       }
 
-      qi::rule<IstreamIter, std::string()>
+      qi::rule<ConstIter, std::string()>
         start, label;
   };
 }
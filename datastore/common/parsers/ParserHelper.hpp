@@ -27,8 +27,13 @@
 #ifndef PARSER_HELPER_HPP
 #define PARSER_HELPER_HPP
 
-#include <iostream>
+#include <algorithm>
+#include <filesystem>
 #include <fstream>
+#include <iostream>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
 
 #include <netmeld/core/utils/LoggerSingleton.hpp>
 
@@ -58,115 +63,156 @@ namespace netmeld::datastore::parsers {
   typedef boost::spirit::istream_iterator  IstreamIter;
   typedef const char*                      ConstIter;
 
-  inline void
-  testFileStream(std::ifstream& dataStream)
+  // Returns the number of leading bytes to skip over (i.e., a BOM)
+  inline size_t
+  testBuffer(ConstIter i, ConstIter e)
   {
-    int a {dataStream.get()};
-    int b {dataStream.get()};
-    int c {dataStream.get()};
+    const size_t size {static_cast<size_t>(e - i)};
+    const int a {(0 < size) ? static_cast<unsigned char>(i[0]) : -1};
+    const int b {(1 < size) ? static_cast<unsigned char>(i[1]) : -1};
+    const int c {(2 < size) ? static_cast<unsigned char>(i[2]) : -1};
 
     if ((a == 0xFE && b == 0xFF) || (a == 0xFF && b == 0xFE)) {
       LOG_ERROR << "Expected input to be ASCII encoded."
                 << " Probable UTF-16 encoding detected."
                 << " Parsing will most likely fail (maybe silently)."
                 << std::endl;
+      return std::min(size, size_t {3});
     } else if (a == 0xEF && b == 0xBB && c == 0xBF) {
       LOG_WARN << "Expected input to be ASCII encoded."
                << " Probable UTF-8 encoding detected."
                << " Parsing may fail."
                << std::endl;
-    } else {
-      dataStream.seekg(0);
+      return 3;
     }
+
+    return 0;
   }
 
-  template<class P, class R>
-  R fromStdIn()
+  // Up to the next 20 characters of input, to locate a parse failure
+  template<typename Iter>
+  std::string
+  parseFailureContext(Iter i, const Iter& e)
   {
-    std::ios::sync_with_stdio(false);
-    std::cin.tie(nullptr);
+    std::ostringstream oss;
+    for (size_t count {0}; (count < 20) && (i != e); ++count, ++i) {
+      oss << *i;
+    }
+    return oss.str();
+  }
 
+  template<typename Iter>
+  void
+  logParseFailure(Iter i, const Iter& e)
+  {
+    LOG_ERROR << "Parser failed around:\n";
+    LOG_ERROR << parseFailureContext(i, e) << std::endl;
+  }
+
+  // Thrown, instead of exiting, by the tryFrom* parse functions
+  class ParseFailure : public std::runtime_error
+  {
+    public:
+      using std::runtime_error::runtime_error;
+  };
+
+  /* Parses a contiguous, in memory, range of characters.  This is the path
+     all file, string, and (non-streaming) STDIN parsing goes through as
+     pointer iteration avoids the per-character buffering overhead of
+     boost::spirit::istream_iterator (a multi_pass iterator).
+  */
+  template<class P, class R>
+  R fromBuffer(ConstIter i, ConstIter e)
+  {
     R result;
-    IstreamIter i {std::cin >> std::noskipws};
-    IstreamIter e;
 
     bool const success {qi::phrase_parse(i, e, P(), qi::ascii::blank, result)};
-    std::ios::sync_with_stdio(true);
 
     if ((!success) || (i != e)) {
-      LOG_ERROR << "Parser failed around:\n";
-      std::ostringstream oss;
-      for (size_t count {0}; (count < 20) && (i != e); ++count, ++i) {
-        oss << *i;
-      }
-      LOG_ERROR << oss.str() << std::endl;
+      logParseFailure(i, e);
       std::exit(nmcu::Exit::FAILURE);
     }
 
     return result;
   }
 
+  /* As fromBuffer(), but throws a ParseFailure instead of exiting so that
+     callers parsing several inputs in-process can carry on.
+  */
   template<class P, class R>
-  bool matchString(const std::string& data)
+  R tryFromBuffer(ConstIter i, ConstIter e)
   {
-    R temp;
-    std::istringstream dataStream {data};
-    dataStream.unsetf(std::ios::skipws); // disable skipping whitespace
+    R result;
 
-    IstreamIter i {dataStream};
-    IstreamIter e;
+    bool const success {qi::phrase_parse(i, e, P(), qi::ascii::blank, result)};
 
-    bool const success {qi::parse(i, e, P(), temp)};
+    if ((!success) || (i != e)) {
+      throw ParseFailure("Parser failed around: " + parseFailureContext(i, e));
+    }
 
-    return ((success) && (i == e));
+    return result;
   }
 
+  /* Reads all of STDIN into memory then parses it.  Parsers which must
+     consume a live stream (e.g., one which never ends) should instead be
+     defined over IstreamIter, which this detects and incrementally parses.
+  */
   template<class P, class R>
-  R fromString(const std::string& data)
+  R fromStdIn()
   {
-    R result;
-    std::istringstream dataStream {data};
-    dataStream.unsetf(std::ios::skipws); // disable skipping whitespace
+    std::ios::sync_with_stdio(false);
+    std::cin.tie(nullptr);
 
-    IstreamIter i {dataStream};
-    IstreamIter e;
+    if constexpr (std::is_same_v<typename P::iterator_type, IstreamIter>) {
+      R result;
+      IstreamIter i {std::cin >> std::noskipws};
+      IstreamIter e;
 
-    bool const success {qi::parse(i, e, P(), result)};
+      bool const success {
+        qi::phrase_parse(i, e, P(), qi::ascii::blank, result)
+      };
+      std::ios::sync_with_stdio(true);
 
-    if ((!success) || (i != e)) {
-      LOG_ERROR << "Parser failed around:\n";
-      std::ostringstream oss;
-      for (size_t count {0}; (count < 20) && (i != e); ++count, ++i) {
-        oss << *i;
+      if ((!success) || (i != e)) {
+        logParseFailure(i, e);
+        std::exit(nmcu::Exit::FAILURE);
       }
-      LOG_ERROR << oss.str() << std::endl;
-      std::exit(nmcu::Exit::FAILURE);
+
+      return result;
+    } else {
+      const std::string data {std::istreambuf_iterator<char>(std::cin),
+                              std::istreambuf_iterator<char>()};
+      std::ios::sync_with_stdio(true);
+
+      return fromBuffer<P,R>(data.data(), data.data() + data.size());
     }
+  }
 
-    return result;
+  template<class P, class R>
+  bool matchString(const std::string& data)
+  {
+    R temp;
+
+    ConstIter i {data.data()};
+    ConstIter e {data.data() + data.size()};
+
+    bool const success {qi::parse(i, e, P(), temp)};
+
+    return ((success) && (i == e));
   }
 
   template<class P, class R>
-  R fromFilePath(const std::string& data)
+  R fromString(const std::string& data)
   {
     R result;
-    std::ifstream dataStream {data};
-    testFileStream(dataStream);
-
-    dataStream.unsetf(std::ios::skipws); // disable skipping whitespace
 
-    IstreamIter i {dataStream};
-    IstreamIter e;
+    ConstIter i {data.data()};
+    ConstIter e {data.data() + data.size()};
 
-    bool const success {qi::phrase_parse(i, e, P(), qi::ascii::blank, result)};
+    bool const success {qi::parse(i, e, P(), result)};
 
     if ((!success) || (i != e)) {
-      LOG_ERROR << "Parser failed around:\n";
-      std::ostringstream oss;
-      for (size_t count {0}; (count < 20) && (i != e); ++count, ++i) {
-        oss << *i;
-      }
-      LOG_ERROR << oss.str() << std::endl;
+      logParseFailure(i, e);
       std::exit(nmcu::Exit::FAILURE);
     }
 
@@ -176,29 +222,61 @@ namespace netmeld::datastore::parsers {
   template<class P, class R>
   R fromFilePathMM(const std::string& data)
   {
-    R result;
     boost::iostreams::mapped_file_source mmap {data};
 
-    auto i {mmap.begin()};
-    auto e {mmap.end()};
+    ConstIter i {mmap.begin()};
+    ConstIter e {mmap.end()};
+    i += testBuffer(i, e);
 
-    bool const success {qi::phrase_parse(i, e, P(), qi::ascii::blank, result)};
+    return fromBuffer<P,R>(i, e);
+  }
 
-    if ((!success) || (i != e)) {
-      LOG_ERROR << "Parser failed around:\n";
-      std::ostringstream oss;
-      for (size_t count {0}; (count < 20) && (i != e); ++count, ++i) {
-        oss << *i;
-      }
-      LOG_ERROR << oss.str() << std::endl;
-      std::exit(nmcu::Exit::FAILURE);
+  /* Memory maps the file and parses it in place, via parseBuffer.  Files
+     which cannot be mapped (e.g., empty files, pipes, or devices) are instead
+     read into a single contiguous buffer.
+  */
+  template<class R, typename F>
+  R fromFileContents(const std::string& data, F&& parseBuffer)
+  {
+    std::error_code ec;
+    if (std::filesystem::is_regular_file(data, ec)
+        && 0 < std::filesystem::file_size(data, ec))
+    {
+      boost::iostreams::mapped_file_source mmap {data};
+
+      ConstIter i {mmap.begin()};
+      ConstIter e {mmap.end()};
+      i += testBuffer(i, e);
+
+      return parseBuffer(i, e);
     }
 
-    return result;
+    std::ifstream dataStream {data, std::ios::binary};
+    const std::string buffer {std::istreambuf_iterator<char>(dataStream),
+                              std::istreambuf_iterator<char>()};
+
+    ConstIter i {buffer.data()};
+    ConstIter e {buffer.data() + buffer.size()};
+    i += testBuffer(i, e);
+
+    return parseBuffer(i, e);
+  }
+
+  template<class P, class R>
+  R fromFilePath(const std::string& data)
+  {
+    return fromFileContents<R>(data, fromBuffer<P,R>);
+  }
+
+  // As fromFilePath(), but throws a ParseFailure instead of exiting
+  template<class P, class R>
+  R tryFromFilePath(const std::string& data)
+  {
+    return fromFileContents<R>(data, tryFromBuffer<P,R>);
   }
 
   class DummyParser :
-    public qi::grammar<IstreamIter>
+    public qi::grammar<ConstIter>
   {
     public:
       DummyParser() : DummyParser::base_type(start)
@@ -211,7 +289,7 @@ namespace netmeld::datastore::parsers {
         BOOST_SPIRIT_DEBUG_NODES((start));
       }
 
-      qi::rule<IstreamIter>
+      qi::rule<ConstIter>
         start;
   };
 }
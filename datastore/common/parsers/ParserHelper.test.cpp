@@ -0,0 +1,172 @@
+// =============================================================================
+// Copyright 2023 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+// =============================================================================
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+#include <boost/test/unit_test.hpp>
+
+#include <netmeld/datastore/parsers/ParserHelper.hpp>
+
+namespace nmdp = netmeld::datastore::parsers;
+
+namespace sfs = std::filesystem;
+
+
+typedef std::vector<std::vector<std::string>> Result;
+
+// Simplified "show ip route" style grammar, usable with either iterator type
+template<typename Iter>
+class Parser :
+  public qi::grammar<Iter, Result(), qi::ascii::blank_type>
+{
+  public:
+    Parser() : Parser::base_type(start)
+    {
+      start =
+        *(line >> qi::eol)
+        ;
+
+      line =
+        *token
+        ;
+
+      token =
+        +qi::ascii::graph
+        ;
+    }
+
+    qi::rule<Iter, Result(), qi::ascii::blank_type>
+      start;
+
+    qi::rule<Iter, std::vector<std::string>(), qi::ascii::blank_type>
+      line;
+
+    qi::rule<Iter, std::string()>
+      token;
+};
+
+// Prior fromFilePath behavior, parsing via boost::spirit::istream_iterator
+Result
+fromFilePathStream(const std::string& path)
+{
+  Result result;
+  std::ifstream dataStream {path};
+  dataStream.unsetf(std::ios::skipws);
+
+  nmdp::IstreamIter i {dataStream};
+  nmdp::IstreamIter e;
+
+  bool const success {
+    qi::phrase_parse(i, e, Parser<nmdp::IstreamIter>(), qi::ascii::blank,
+                     result)
+  };
+  BOOST_REQUIRE(success);
+  BOOST_REQUIRE(i == e);
+
+  return result;
+}
+
+sfs::path
+writeTempFile(const std::string& name, const std::string& contents)
+{
+  const auto path {sfs::temp_directory_path() / name};
+  std::ofstream f {path, std::ios::binary};
+  f << contents;
+  return path;
+}
+
+std::string
+makeRoutes(size_t count)
+{
+  std::ostringstream oss;
+  for (size_t n {0}; n < count; ++n) {
+    oss << "S    10." << (n >> 8) % 256 << '.' << n % 256
+        << ".0/24 [1/0] via 192.168." << n % 256 << ".1,"
+        << " GigabitEthernet0/" << n % 48 << '\n';
+  }
+  return oss.str();
+}
+
+BOOST_AUTO_TEST_CASE(testFromFilePath)
+{
+  {
+    const auto path {writeTempFile("nmdp-test-routes", makeRoutes(100))};
+    const auto result {nmdp::fromFilePath<Parser<nmdp::ConstIter>, Result>
+                        (path.string())};
+
+    BOOST_TEST(100 == result.size());
+    BOOST_TEST(fromFilePathStream(path.string()) == result);
+    BOOST_TEST("10.0.99.0/24" == result[99][1]);
+    BOOST_TEST("GigabitEthernet0/3" == result[99][5]);
+
+    sfs::remove(path);
+  }
+
+  { // empty files cannot be memory mapped
+    const auto path {writeTempFile("nmdp-test-empty", "")};
+    const auto result {nmdp::fromFilePath<Parser<nmdp::ConstIter>, Result>
+                        (path.string())};
+
+    BOOST_TEST(result.empty());
+
+    sfs::remove(path);
+  }
+
+  { // UTF-8 BOM is skipped
+    const auto path {writeTempFile("nmdp-test-bom", "\xEF\xBB\xBF" "a b\n")};
+    const auto result {nmdp::fromFilePath<Parser<nmdp::ConstIter>, Result>
+                        (path.string())};
+
+    BOOST_TEST(1 == result.size());
+    BOOST_TEST((std::vector<std::string> {"a", "b"}) == result[0]);
+
+    sfs::remove(path);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testTryFromFilePath)
+{
+  {
+    const auto path {writeTempFile("nmdp-test-try", makeRoutes(10))};
+    const auto result {nmdp::tryFromFilePath<Parser<nmdp::ConstIter>, Result>
+                        (path.string())};
+
+    BOOST_TEST(10 == result.size());
+
+    sfs::remove(path);
+  }
+
+  { // unparsed input throws instead of exiting
+    const auto path {writeTempFile("nmdp-test-try-bad", "a b\nc d")};
+
+    BOOST_CHECK_THROW(
+        (nmdp::tryFromFilePath<Parser<nmdp::ConstIter>, Result>
+          (path.string())),
+        nmdp::ParseFailure);
+
+    sfs::remove(path);
+  }
+}
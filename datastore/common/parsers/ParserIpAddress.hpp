@@ -36,7 +36,7 @@ namespace nmdo = netmeld::datastore::objects;
 namespace netmeld::datastore::parsers {
 
   class ParserIpv4Address :
-    public qi::grammar<IstreamIter, nmdo::IpAddress()>
+    public qi::grammar<ConstIter, nmdo::IpAddress()>
   {
     public:
       ParserIpv4Address() : ParserIpv4Address::base_type(start)
@@ -68,20 +68,20 @@ namespace netmeld::datastore::parsers {
         BOOST_SPIRIT_DEBUG_NODES((start)(ipv4)(prefix));
       }
 
-      qi::rule<IstreamIter, nmdo::IpAddress()>
+      qi::rule<ConstIter, nmdo::IpAddress()>
         start;
 
-      qi::rule<IstreamIter, std::string()>
+      qi::rule<ConstIter, std::string()>
         ipv4,
         octet;
 
-      qi::rule<IstreamIter, unsigned int>
+      qi::rule<ConstIter, unsigned int>
         prefix;
   };
 
 
   class ParserIpv6Address :
-    public qi::grammar<IstreamIter, nmdo::IpAddress()>
+    public qi::grammar<ConstIter, nmdo::IpAddress()>
   {
     public:
       ParserIpv6Address() : ParserIpv6Address::base_type(start)
@@ -126,20 +126,20 @@ namespace netmeld::datastore::parsers {
         BOOST_SPIRIT_DEBUG_NODES((start)(ipv6)(prefix)(h16));
       }
 
-      qi::rule<IstreamIter, nmdo::IpAddress()>
+      qi::rule<ConstIter, nmdo::IpAddress()>
         start;
 
-      qi::rule<IstreamIter, std::string()>
+      qi::rule<ConstIter, std::string()>
         ipv6,
         h16;
 
-      qi::rule<IstreamIter, unsigned int>
+      qi::rule<ConstIter, unsigned int>
         prefix;
   };
 
 
   class ParserIpAddress :
-    public qi::grammar<IstreamIter, nmdo::IpAddress()>
+    public qi::grammar<ConstIter, nmdo::IpAddress()>
   {
     public:
       ParserIpAddress() : ParserIpAddress::base_type(start)
@@ -150,7 +150,7 @@ namespace netmeld::datastore::parsers {
         BOOST_SPIRIT_DEBUG_NODES((start));
       }
 
-      qi::rule<IstreamIter, nmdo::IpAddress()>
+      qi::rule<ConstIter, nmdo::IpAddress()>
         start;
 
       ParserIpv4Address
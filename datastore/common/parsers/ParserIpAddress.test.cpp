@@ -117,9 +117,8 @@ BOOST_AUTO_TEST_CASE(testMalformedNotFullyParsed)
 
   for (const auto& ip : ips) {
     nmdo::IpAddress result;
-    std::istringstream dataStream(ip);
-    dataStream.unsetf(std::ios::skipws); // disable skipping whitespace
-    nmdp::IstreamIter i(dataStream), e;
+    nmdp::ConstIter i {ip.data()};
+    nmdp::ConstIter e {ip.data() + ip.size()};
     bool const success = qi::parse(i, e, nmdp::ParserIpAddress(), result);
 
     BOOST_CHECK(success);
@@ -139,9 +138,8 @@ BOOST_AUTO_TEST_CASE(testMalformedParseFail)
 
   for (const auto& ip : ips) {
     nmdo::IpAddress result;
-    std::istringstream dataStream(ip);
-    dataStream.unsetf(std::ios::skipws); // disable skipping whitespace
-    nmdp::IstreamIter i(dataStream), e;
+    nmdp::ConstIter i {ip.data()};
+    nmdp::ConstIter e {ip.data() + ip.size()};
     bool const success = qi::parse(i, e, nmdp::ParserIpAddress(), result);
 
     BOOST_CHECK(!success);
@@ -36,7 +36,7 @@ namespace nmdo = netmeld::datastore::objects;
 namespace netmeld::datastore::parsers {
 
   class ParserMacAddress :
-    public qi::grammar<IstreamIter, nmdo::MacAddress()>
+    public qi::grammar<ConstIter, nmdo::MacAddress()>
   {
     public:
       ParserMacAddress() : ParserMacAddress::base_type(start)
@@ -63,10 +63,10 @@ namespace netmeld::datastore::parsers {
         BOOST_SPIRIT_DEBUG_NODES((start)(macAddr6)(macAddr8));
       }
 
-      qi::rule<IstreamIter, nmdo::MacAddress()>
+      qi::rule<ConstIter, nmdo::MacAddress()>
         start;
 
-      qi::rule<IstreamIter, std::vector<uint8_t>>
+      qi::rule<ConstIter, std::vector<uint8_t>>
         macAddr6, macAddr8;
 
       qi::uint_parser<uint8_t, 16, 2, 2>
@@ -108,9 +108,8 @@ BOOST_AUTO_TEST_CASE(testWellFormed)
     };
     for (const auto& ma : mas) {
       nmdo::MacAddress result;
-      std::istringstream dataStream {ma};
-      dataStream.unsetf(std::ios::skipws);
-      nmdp::IstreamIter i {dataStream}, e;
+      nmdp::ConstIter i {ma.data()};
+      nmdp::ConstIter e {ma.data() + ma.size()};
       bool const success = qi::parse(i, e, nmdp::ParserMacAddress(), result);
 
       BOOST_CHECK(success);
@@ -128,9 +127,8 @@ BOOST_AUTO_TEST_CASE(testMalformed)
     };
     for (const auto& ma : mas) {
       nmdo::MacAddress result;
-      std::istringstream dataStream {ma};
-      dataStream.unsetf(std::ios::skipws);
-      nmdp::IstreamIter i {dataStream}, e;
+      nmdp::ConstIter i {ma.data()};
+      nmdp::ConstIter e {ma.data() + ma.size()};
       bool const success = qi::parse(i, e, nmdp::ParserMacAddress(), result);
 
       BOOST_CHECK(!success);
@@ -151,9 +149,8 @@ BOOST_AUTO_TEST_CASE(testMalformed)
     };
     for (const auto& ma : mas) {
       nmdo::MacAddress result;
-      std::istringstream dataStream {ma};
-      dataStream.unsetf(std::ios::skipws);
-      nmdp::IstreamIter i {dataStream}, e;
+      nmdp::ConstIter i {ma.data()};
+      nmdp::ConstIter e {ma.data() + ma.size()};
       bool const success = qi::parse(i, e, nmdp::ParserMacAddress(), result);
 
       BOOST_CHECK(!success);
@@ -173,9 +170,8 @@ BOOST_AUTO_TEST_CASE(testMalformed)
     };
     for (const auto& ma : mas) {
       nmdo::MacAddress result;
-      std::istringstream dataStream {ma};
-      dataStream.unsetf(std::ios::skipws);
-      nmdp::IstreamIter i {dataStream}, e;
+      nmdp::ConstIter i {ma.data()};
+      nmdp::ConstIter e {ma.data() + ma.size()};
       bool const success = qi::parse(i, e, nmdp::ParserMacAddress(), result);
 
       BOOST_CHECK(success);
@@ -37,9 +37,9 @@ namespace netmeld::datastore::parsers {
   {
     try {
       qi::what(p);
-      std::istringstream dataStream(in);
-      dataStream.unsetf(std::ios::skipws);
-      IstreamIter i(dataStream), e;
+      const std::string data(in);
+      ConstIter i {data.data()};
+      ConstIter e {data.data() + data.size()};
       return qi::parse(i, e, p)
         && (!fullMatch || (i == e));
     } catch (const std::exception& e) {
@@ -53,9 +53,9 @@ namespace netmeld::datastore::parsers {
   {
     try {
       qi::what(p);
-      std::istringstream dataStream(in);
-      dataStream.unsetf(std::ios::skipws);
-      IstreamIter i(dataStream), e;
+      const std::string data(in);
+      ConstIter i {data.data()};
+      ConstIter e {data.data() + data.size()};
       return qi::phrase_parse(i, e, p, s)
         && (!fullMatch || (i == e));
     } catch (const std::exception& e) {
@@ -69,9 +69,9 @@ namespace netmeld::datastore::parsers {
   {
     try {
       qi::what(p);
-      std::istringstream dataStream(in);
-      dataStream.unsetf(std::ios::skipws);
-      IstreamIter i(dataStream), e;
+      const std::string data(in);
+      ConstIter i {data.data()};
+      ConstIter e {data.data() + data.size()};
       return qi::parse(i, e, p, a)
         && (!fullMatch || (i == e));
     } catch (const std::exception& e) {
@@ -85,9 +85,9 @@ namespace netmeld::datastore::parsers {
   {
     try {
       qi::what(p);
-      std::istringstream dataStream(in);
-      dataStream.unsetf(std::ios::skipws);
-      IstreamIter i(dataStream), e;
+      const std::string data(in);
+      ConstIter i {data.data()};
+      ConstIter e {data.data() + data.size()};
       return qi::phrase_parse(i, e, p, s, a)
         && (!fullMatch || (i == e));
     } catch (const std::exception& e) {
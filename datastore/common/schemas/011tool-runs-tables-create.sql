@@ -180,6 +180,10 @@ ON tool_run_ip_routes(interface_name);
 CREATE INDEX tool_run_ip_routes_idx_dst_ip_net
 ON tool_run_ip_routes(dst_ip_net);
 
+CREATE INDEX tool_run_ip_routes_idx_gist_dst_ip_net
+ON tool_run_ip_routes
+USING GIST (dst_ip_net inet_ops);
+
 CREATE INDEX tool_run_ip_routes_idx_next_hop_ip_addr
 ON tool_run_ip_routes(next_hop_ip_addr);
 
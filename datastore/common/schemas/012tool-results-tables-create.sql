@@ -280,6 +280,12 @@ ON raw_ip_nets(tool_run_id);
 CREATE INDEX raw_ip_nets_idx_ip_net
 ON raw_ip_nets(ip_net);
 
+-- Serves containment (<<, <<=, >>, >>=) and overlap (&&) joins, which the
+-- B-tree index above cannot.
+CREATE INDEX raw_ip_nets_idx_gist_ip_net
+ON raw_ip_nets
+USING GIST (ip_net inet_ops);
+
 
 -- ----------------------------------------------------------------------
 
@@ -424,6 +430,11 @@ ON raw_ports(tool_run_id);
 CREATE INDEX raw_ports_idx_ip_addr
 ON raw_ports(ip_addr);
 
+-- For the *_network_ports views, which select ports within networks
+CREATE INDEX raw_ports_idx_gist_ip_addr
+ON raw_ports
+USING GIST (ip_addr inet_ops);
+
 CREATE INDEX raw_ports_idx_protocol
 ON raw_ports(protocol);
 
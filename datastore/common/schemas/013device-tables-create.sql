@@ -320,6 +320,11 @@ ON raw_device_ip_addrs(ip_addr);
 CREATE INDEX raw_device_ip_addrs_idx_ip_net
 ON raw_device_ip_addrs(ip_net);
 
+-- For next hop and overlapping network lookups
+CREATE INDEX raw_device_ip_addrs_idx_gist_ip_net
+ON raw_device_ip_addrs
+USING GIST (ip_net inet_ops);
+
 CREATE INDEX raw_device_ip_addrs_idx_device_id_interface_name
 ON raw_device_ip_addrs(device_id, interface_name);
 
@@ -0,0 +1,403 @@
+-- =============================================================================
+-- Copyright 2023 National Technology & Engineering Solutions of Sandia, LLC
+-- (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+-- Government retains certain rights in this software.
+--
+-- Permission is hereby granted, free of charge, to any person obtaining a copy
+-- of this software and associated documentation files (the "Software"), to deal
+-- in the Software without restriction, including without limitation the rights
+-- to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+-- copies of the Software, and to permit persons to whom the Software is
+-- furnished to do so, subject to the following conditions:
+--
+-- The above copyright notice and this permission notice shall be included in
+-- all copies or substantial portions of the Software.
+--
+-- THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+-- IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+-- FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+-- AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+-- LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+-- OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+-- SOFTWARE.
+-- =============================================================================
+-- Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+-- =============================================================================
+
+BEGIN TRANSACTION;
+
+-- ----------------------------------------------------------------------
+-- Optional partitioning of the large result tables by tool run.
+--
+-- Loaded after the tables but before any views, so a database initialized
+-- with `nmdb-initialize --partitioned` (which sets
+-- `netmeld.partition_by_tool_run`) has the tables recreated as LIST
+-- partitioned by tool_run_id.  A new tool run gets its own partition of
+-- each table when it is imported (see `tool_run_partitions_create()`) and
+-- removing it detaches and drops them (see `tool_run_partitions_drop()`)
+-- rather than deleting its rows one by one.  Rows of tool runs without
+-- their own partitions land in a DEFAULT partition.
+--
+-- Both take their locks without waiting, as a waiting request would queue
+-- every later use of the tables behind in-flight imports.  When the tables
+-- are busy they report so and the caller carries on without partitions:
+-- the tool run's rows land in the DEFAULT partitions, or are removed by the
+-- `ON DELETE CASCADE` of its `tool_runs` row.
+--
+-- Data stores initialized before these functions existed lack them, so
+-- clients check for them (e.g., `to_regproc()`) before calling them.
+-- ----------------------------------------------------------------------
+
+-- ----------------------------------------------------------------------
+-- Tables partitioned by tool run, deepest referencing tables first; a
+-- partition is detached before the partitions it references.
+-- ----------------------------------------------------------------------
+
+CREATE VIEW tool_run_partitioned_tables AS
+WITH RECURSIVE partitioned AS (
+    SELECT pt.partrelid                 AS table_oid
+    FROM pg_catalog.pg_partitioned_table AS pt
+    JOIN pg_catalog.pg_attribute AS a
+      ON (a.attrelid = pt.partrelid) AND (a.attnum = pt.partattrs[0])
+    JOIN pg_catalog.pg_class AS c
+      ON (c.oid = pt.partrelid)
+    WHERE (pt.partstrat = 'l') AND
+          (pt.partnatts = 1) AND
+          (a.attname = 'tool_run_id') AND
+          (NOT c.relispartition) AND
+          (pg_catalog.pg_table_is_visible(c.oid))
+), referencing(table_oid, depth) AS (
+    SELECT table_oid, 0
+    FROM partitioned
+    UNION ALL
+    SELECT con.conrelid, r.depth + 1
+    FROM referencing AS r
+    JOIN pg_catalog.pg_constraint AS con
+      ON (con.confrelid = r.table_oid) AND
+         (con.contype = 'f') AND
+         (con.conrelid != con.confrelid)
+    JOIN partitioned AS p
+      ON (p.table_oid = con.conrelid)
+)
+SELECT
+    table_oid::REGCLASS                 AS table_name,
+    max(depth)                          AS depth
+FROM referencing
+GROUP BY table_oid
+;
+
+
+-- ----------------------------------------------------------------------
+-- Partitions holding the rows of a single tool run, with the table each
+-- belongs to.  Tool runs no longer in `tool_runs` have had their rows
+-- removed by cascade while the tables were busy.
+-- ----------------------------------------------------------------------
+
+CREATE VIEW tool_run_partitions AS
+SELECT
+    trpt.table_name                     AS table_name,
+    trpt.depth                          AS depth,
+    i.inhrelid::REGCLASS                AS partition_name,
+    substring(pg_catalog.pg_get_expr(c.relpartbound, c.oid)
+              FROM '^FOR VALUES IN \(''(.*)''\)$')::UUID
+                                        AS tool_run_id
+FROM tool_run_partitioned_tables AS trpt
+JOIN pg_catalog.pg_inherits AS i
+  ON (i.inhparent = trpt.table_name)
+JOIN pg_catalog.pg_class AS c
+  ON (c.oid = i.inhrelid)
+WHERE (pg_catalog.pg_get_expr(c.relpartbound, c.oid) != 'DEFAULT')
+;
+
+
+-- ----------------------------------------------------------------------
+-- Takes all locks needed to add or remove partitions at once, failing with
+-- `lock_not_available` rather than waiting.  Beyond the partitioned tables
+-- (but not their partitions, of which there are many) and their DEFAULT
+-- partitions, the tables at the other end of their foreign keys are locked
+-- since those constraints are cloned or checked.
+-- ----------------------------------------------------------------------
+
+CREATE FUNCTION tool_run_partitions_lock()
+RETURNS VOID
+AS $$
+DECLARE
+    v_tables    TEXT;
+BEGIN
+    SELECT string_agg('ONLY ' || t.table_oid::REGCLASS::TEXT, ', '
+                      ORDER BY t.table_oid)
+    INTO v_tables
+    FROM (
+        SELECT table_name::OID AS table_oid
+        FROM tool_run_partitioned_tables
+        UNION
+        SELECT i.inhrelid
+        FROM tool_run_partitioned_tables AS trpt
+        JOIN pg_catalog.pg_inherits AS i
+          ON (i.inhparent = trpt.table_name)
+        JOIN pg_catalog.pg_class AS c
+          ON (c.oid = i.inhrelid)
+        WHERE (pg_catalog.pg_get_expr(c.relpartbound, c.oid) = 'DEFAULT')
+        UNION
+        SELECT CASE WHEN (con.conrelid = trpt.table_name)
+                    THEN con.confrelid
+                    ELSE con.conrelid
+               END
+        FROM tool_run_partitioned_tables AS trpt
+        JOIN pg_catalog.pg_constraint AS con
+          ON (con.contype = 'f') AND
+             ((con.conrelid = trpt.table_name) OR
+              (con.confrelid = trpt.table_name))
+    ) AS t
+    JOIN pg_catalog.pg_class AS c
+      ON (c.oid = t.table_oid)
+    WHERE (NOT c.relispartition) OR
+          (pg_catalog.pg_get_expr(c.relpartbound, c.oid) = 'DEFAULT');
+
+    IF (v_tables IS NOT NULL) THEN
+        EXECUTE format('LOCK TABLE %s IN ACCESS EXCLUSIVE MODE NOWAIT',
+                       v_tables);
+    END IF;
+END;
+$$ LANGUAGE plpgsql;
+
+
+-- ----------------------------------------------------------------------
+-- Gives a new tool run its own partitions, returning whether it has them.
+-- A tool run which already has rows (e.g., the shared `human` run) keeps
+-- them in the DEFAULT partitions, as do all when the tables are busy.
+-- Creating partitions locks their tables, so an import creates them in a
+-- transaction of its own before loading any data.
+-- ----------------------------------------------------------------------
+
+CREATE FUNCTION tool_run_partitions_create(p_tool_run_id UUID)
+RETURNS BOOLEAN
+AS $$
+DECLARE
+    v_table     REGCLASS;
+BEGIN
+    IF EXISTS (SELECT 1 FROM tool_runs WHERE (id = p_tool_run_id)) THEN
+        RETURN EXISTS (SELECT 1
+                       FROM tool_run_partitions
+                       WHERE (tool_run_id = p_tool_run_id));
+    END IF;
+    IF NOT EXISTS (SELECT 1 FROM tool_run_partitioned_tables) THEN
+        RETURN false;
+    END IF;
+
+    BEGIN
+        PERFORM tool_run_partitions_lock();
+
+        FOR v_table IN
+            SELECT trpt.table_name
+            FROM tool_run_partitioned_tables AS trpt
+            WHERE NOT EXISTS (SELECT 1
+                              FROM tool_run_partitions AS trp
+                              WHERE (trp.table_name = trpt.table_name) AND
+                                    (trp.tool_run_id = p_tool_run_id))
+            ORDER BY trpt.depth, trpt.table_name::OID
+        LOOP
+            EXECUTE format('CREATE TABLE %I PARTITION OF %s'
+                           ' FOR VALUES IN (%L)',
+                           left((SELECT relname
+                                 FROM pg_catalog.pg_class
+                                 WHERE (oid = v_table)), 30)
+                             || '_' || replace(p_tool_run_id::TEXT, '-', ''),
+                           v_table, p_tool_run_id);
+        END LOOP;
+    EXCEPTION WHEN lock_not_available THEN
+        RETURN false;
+    END;
+
+    RETURN true;
+END;
+$$ LANGUAGE plpgsql
+-- Bounds any wait on locks beyond those taken up front
+SET lock_timeout = '1s';
+
+
+-- ----------------------------------------------------------------------
+-- Detaches and drops the partitions of a tool run, along with any left
+-- behind by tool runs already removed, returning whether it had them.  The
+-- rest of its rows are left to the `ON DELETE CASCADE` of its `tool_runs`
+-- row, which also removes those in its partitions when the tables are
+-- busy.  Rows of unpartitioned tables referencing the partitions would
+-- block detaching them, so those are deleted first.
+-- ----------------------------------------------------------------------
+
+CREATE FUNCTION tool_run_partitions_drop(p_tool_run_id UUID)
+RETURNS BOOLEAN
+AS $$
+DECLARE
+    v_table     REGCLASS;
+    v_partition REGCLASS;
+    v_had       BOOLEAN;
+BEGIN
+    v_had := EXISTS (SELECT 1
+                     FROM tool_run_partitions
+                     WHERE (tool_run_id = p_tool_run_id));
+    IF (NOT v_had) AND
+       NOT EXISTS (SELECT 1
+                   FROM tool_run_partitions AS trp
+                   WHERE NOT EXISTS (SELECT 1
+                                     FROM tool_runs AS tr
+                                     WHERE (tr.id = trp.tool_run_id)))
+    THEN
+        RETURN false;
+    END IF;
+
+    BEGIN
+        PERFORM tool_run_partitions_lock();
+
+        FOR v_table IN
+            SELECT DISTINCT con.conrelid::REGCLASS
+            FROM pg_catalog.pg_constraint AS con
+            JOIN pg_catalog.pg_class AS c
+              ON (c.oid = con.conrelid)
+            WHERE (con.contype = 'f') AND
+                  (con.confrelid IN (SELECT table_name
+                                     FROM tool_run_partitioned_tables)) AND
+                  (c.relkind = 'r') AND
+                  (NOT c.relispartition)
+        LOOP
+            EXECUTE format('DELETE FROM %s WHERE (tool_run_id = $1)',
+                           v_table)
+            USING p_tool_run_id;
+        END LOOP;
+
+        FOR v_table, v_partition IN
+            SELECT trp.table_name, trp.partition_name
+            FROM tool_run_partitions AS trp
+            WHERE (trp.tool_run_id = p_tool_run_id) OR
+                  NOT EXISTS (SELECT 1
+                              FROM tool_runs AS tr
+                              WHERE (tr.id = trp.tool_run_id))
+            ORDER BY trp.depth DESC, trp.table_name::OID DESC
+        LOOP
+            EXECUTE format('ALTER TABLE %s DETACH PARTITION %s',
+                           v_table, v_partition);
+            EXECUTE format('DROP TABLE %s', v_partition);
+        END LOOP;
+    EXCEPTION WHEN lock_not_available THEN
+        RETURN false;
+    END;
+
+    RETURN v_had;
+END;
+$$ LANGUAGE plpgsql
+SET lock_timeout = '1s';
+
+
+-- ----------------------------------------------------------------------
+-- Recreates the large result tables, and those (transitively) referencing
+-- them, as partitioned by tool run.  Only valid while the tables are empty
+-- and no views depend on them, hence run from here during initialization.
+-- Tables with a unique index lacking tool_run_id as a column cannot be
+-- partitioned by it and are left as they are.
+-- ----------------------------------------------------------------------
+
+CREATE FUNCTION tool_run_partitions_enable()
+RETURNS VOID
+AS $$
+DECLARE
+    v_table     REGCLASS;
+    v_name      TEXT;
+    v_ddl       TEXT[];
+    v_stmt      TEXT;
+BEGIN
+    IF (current_setting('server_version_num')::INT < 120000) THEN
+        RAISE EXCEPTION 'Partitioning by tool run requires PostgreSQL 12+';
+    END IF;
+
+    FOR v_table IN
+        WITH RECURSIVE candidates(table_oid) AS (
+            SELECT oid
+            FROM pg_catalog.pg_class
+            WHERE (oid IN ('raw_mac_addrs'::REGCLASS,
+                           'raw_ip_addrs'::REGCLASS,
+                           'raw_ip_nets'::REGCLASS,
+                           'raw_dns_lookups'::REGCLASS))
+            UNION
+            SELECT con.conrelid
+            FROM candidates AS cand
+            JOIN pg_catalog.pg_constraint AS con
+              ON (con.confrelid = cand.table_oid) AND (con.contype = 'f')
+        )
+        SELECT cand.table_oid::REGCLASS
+        FROM candidates AS cand
+        JOIN pg_catalog.pg_attribute AS a
+          ON (a.attrelid = cand.table_oid) AND (a.attname = 'tool_run_id')
+        WHERE NOT EXISTS (
+            SELECT 1
+            FROM pg_catalog.pg_index AS i
+            WHERE (i.indrelid = cand.table_oid) AND
+                  (i.indisunique) AND
+                  ((i.indexprs IS NOT NULL) OR
+                   (NOT a.attnum = ANY (i.indkey::INT2[]))))
+        -- Creation order, so referenced tables are recreated first
+        ORDER BY cand.table_oid
+    LOOP
+        SELECT relname INTO v_name
+        FROM pg_catalog.pg_class
+        WHERE (oid = v_table);
+
+        -- Constraints (primary key first) and indexes of the table, then
+        -- the foreign keys of other tables referencing it
+        SELECT array_agg(format('ALTER TABLE %s ADD CONSTRAINT %I %s',
+                                con.conrelid::REGCLASS, con.conname,
+                                pg_catalog.pg_get_constraintdef(con.oid))
+                         ORDER BY (con.conrelid != v_table),
+                                  (con.contype != 'p'), con.oid)
+        INTO v_ddl
+        FROM pg_catalog.pg_constraint AS con
+        WHERE (con.conparentid = 0) AND
+              (((con.conrelid = v_table) AND
+                (con.contype IN ('p', 'u', 'c', 'f'))) OR
+               ((con.confrelid = v_table) AND
+                (con.conrelid != v_table) AND
+                (con.contype = 'f')));
+
+        v_ddl := v_ddl || ARRAY(
+            SELECT pg_catalog.pg_get_indexdef(i.indexrelid)
+            FROM pg_catalog.pg_index AS i
+            WHERE (i.indrelid = v_table) AND
+                  NOT EXISTS (SELECT 1
+                              FROM pg_catalog.pg_constraint AS con
+                              WHERE (con.conrelid = v_table) AND
+                                    (con.conindid = i.indexrelid))
+            ORDER BY i.indexrelid);
+
+        EXECUTE format('ALTER TABLE %s RENAME TO tool_run_unpartitioned',
+                       v_table);
+        EXECUTE format('CREATE TABLE %I'
+                       ' (LIKE tool_run_unpartitioned INCLUDING DEFAULTS)'
+                       ' PARTITION BY LIST (tool_run_id)',
+                       v_name);
+        -- Also drops the foreign keys referencing it, recreated below
+        DROP TABLE tool_run_unpartitioned CASCADE;
+        EXECUTE format('CREATE TABLE %I PARTITION OF %I DEFAULT',
+                       left(v_name, 55) || '_default', v_name);
+
+        FOREACH v_stmt IN ARRAY v_ddl
+        LOOP
+            EXECUTE v_stmt;
+        END LOOP;
+    END LOOP;
+END;
+$$ LANGUAGE plpgsql
+-- Quiet the notices for the expected foreign key drops above
+SET client_min_messages = warning;
+
+
+DO $$
+BEGIN
+    IF (current_setting('netmeld.partition_by_tool_run', true) = 'on') THEN
+        PERFORM tool_run_partitions_enable();
+    END IF;
+END;
+$$;
+
+
+-- ----------------------------------------------------------------------
+
+COMMIT TRANSACTION;
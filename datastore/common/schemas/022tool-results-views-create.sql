@@ -286,13 +286,15 @@ WHERE (((family(ip_net) = 4) AND (masklen(ip_net) <  32)) OR
 
 -- ----------------------------------------------------------------------
 
+-- Each distinct larger network probes raw_ip_nets_idx_gist_ip_net once,
+-- rather than the networks being compared pairwise per tool run.
 CREATE VIEW ip_nets_overlapping AS
 SELECT DISTINCT
     ip_nets_0.ip_net            AS ip_net_larger,
     ip_nets_1.ip_net            AS ip_net_smaller
-FROM raw_ip_nets AS ip_nets_0
+FROM (SELECT DISTINCT ip_net FROM raw_ip_nets) AS ip_nets_0
 JOIN raw_ip_nets AS ip_nets_1
-ON (ip_nets_0.ip_net >> ip_nets_1.ip_net)
+ON (ip_nets_1.ip_net << ip_nets_0.ip_net)
 ;
 
 
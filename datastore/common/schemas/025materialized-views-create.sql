@@ -0,0 +1,514 @@
+-- =============================================================================
+-- Copyright 2023 National Technology & Engineering Solutions of Sandia, LLC
+-- (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+-- Government retains certain rights in this software.
+--
+-- Permission is hereby granted, free of charge, to any person obtaining a copy
+-- of this software and associated documentation files (the "Software"), to deal
+-- in the Software without restriction, including without limitation the rights
+-- to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+-- copies of the Software, and to permit persons to whom the Software is
+-- furnished to do so, subject to the following conditions:
+--
+-- The above copyright notice and this permission notice shall be included in
+-- all copies or substantial portions of the Software.
+--
+-- THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+-- IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+-- FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+-- AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+-- LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+-- OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+-- SOFTWARE.
+-- =============================================================================
+-- Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+-- =============================================================================
+
+BEGIN TRANSACTION;
+
+-- ----------------------------------------------------------------------
+-- Optional materialized copies of the heavy derived views.
+--
+-- The copies live in their own schema under the same names as the views
+-- they replace, so a client opts in by putting the schema first on its
+-- search_path (e.g., `--materialized-views` on graph/export tools).
+-- Nothing reads them otherwise; `refresh_materialized_views()` brings
+-- them up to date with the current tool runs.
+-- ----------------------------------------------------------------------
+
+CREATE SCHEMA materialized_views;
+
+
+-- ----------------------------------------------------------------------
+-- Refresh bookkeeping.
+-- Copies keyed by tool_run_id record which runs (at which execute time and
+-- change count) they hold; removed runs cascade out with their rows.
+-- Copies rebuilt in full record a digest of the same at their last refresh.
+-- ----------------------------------------------------------------------
+
+-- Bumped, at most once per transaction, whenever rows a copy is built from
+-- change for the run (e.g., rows added to an existing or the "human" run).
+-- Changes to source tables without a tool_run_id bump every run.
+CREATE TABLE materialized_views.tool_run_changes (
+    tool_run_id                 UUID            NOT NULL,
+    change_count                BIGINT          NOT NULL,
+    change_txid                 BIGINT          NOT NULL,
+    PRIMARY KEY (tool_run_id),
+    FOREIGN KEY (tool_run_id)
+        REFERENCES tool_runs(id)
+        ON DELETE CASCADE
+        ON UPDATE CASCADE
+);
+
+CREATE TABLE materialized_views.refreshed_tool_runs (
+    view_name                   TEXT            NOT NULL,
+    tool_run_id                 UUID            NOT NULL,
+    execute_time                TSRANGE         NOT NULL,
+    change_count                BIGINT          NOT NULL,
+    PRIMARY KEY (view_name, tool_run_id),
+    FOREIGN KEY (tool_run_id)
+        REFERENCES tool_runs(id)
+        ON DELETE CASCADE
+        ON UPDATE CASCADE
+);
+
+CREATE TABLE materialized_views.refresh_states (
+    view_name                   TEXT            NOT NULL,
+    tool_runs_digest            TEXT            NOT NULL,
+    refresh_time                TIMESTAMP       NOT NULL,
+    PRIMARY KEY (view_name)
+);
+
+
+-- ----------------------------------------------------------------------
+-- Incrementally refreshed (per tool run) copies
+-- ----------------------------------------------------------------------
+
+CREATE TABLE materialized_views.raw_intra_network_ports AS
+SELECT * FROM public.raw_intra_network_ports
+WITH NO DATA;
+
+ALTER TABLE materialized_views.raw_intra_network_ports
+ADD FOREIGN KEY (tool_run_id)
+    REFERENCES tool_runs(id)
+    ON DELETE CASCADE
+    ON UPDATE CASCADE;
+
+-- Partial indexes
+CREATE INDEX raw_intra_network_ports_idx_tool_run_id
+ON materialized_views.raw_intra_network_ports(tool_run_id);
+
+CREATE INDEX raw_intra_network_ports_idx_src_ip_addr
+ON materialized_views.raw_intra_network_ports(src_ip_addr);
+
+CREATE INDEX raw_intra_network_ports_idx_gist_dst_ip_addr
+ON materialized_views.raw_intra_network_ports
+USING GIST (dst_ip_addr inet_ops);
+
+
+CREATE VIEW materialized_views.intra_network_ports AS
+SELECT DISTINCT
+    src_ip_addr                 AS src_ip_addr,
+    dst_ip_addr                 AS dst_ip_addr,
+    protocol                    AS protocol,
+    port                        AS port,
+    port_state                  AS port_state,
+    port_reason                 AS port_reason
+FROM materialized_views.raw_intra_network_ports
+;
+
+
+-- ----------------------------------------------------------------------
+
+CREATE TABLE materialized_views.raw_inter_network_ports AS
+SELECT * FROM public.raw_inter_network_ports
+WITH NO DATA;
+
+ALTER TABLE materialized_views.raw_inter_network_ports
+ADD FOREIGN KEY (tool_run_id)
+    REFERENCES tool_runs(id)
+    ON DELETE CASCADE
+    ON UPDATE CASCADE;
+
+-- Partial indexes
+CREATE INDEX raw_inter_network_ports_idx_tool_run_id
+ON materialized_views.raw_inter_network_ports(tool_run_id);
+
+CREATE INDEX raw_inter_network_ports_idx_src_ip_addr
+ON materialized_views.raw_inter_network_ports(src_ip_addr);
+
+CREATE INDEX raw_inter_network_ports_idx_gist_next_hop_ip_addr
+ON materialized_views.raw_inter_network_ports
+USING GIST (next_hop_ip_addr inet_ops);
+
+CREATE INDEX raw_inter_network_ports_idx_gist_dst_ip_addr
+ON materialized_views.raw_inter_network_ports
+USING GIST (dst_ip_addr inet_ops);
+
+
+CREATE VIEW materialized_views.inter_network_ports AS
+SELECT DISTINCT
+    src_ip_addr                 AS src_ip_addr,
+    next_hop_ip_addr            AS next_hop_ip_addr,
+    dst_ip_addr                 AS dst_ip_addr,
+    protocol                    AS protocol,
+    port                        AS port,
+    port_state                  AS port_state,
+    port_reason                 AS port_reason
+FROM materialized_views.raw_inter_network_ports
+;
+
+
+-- ----------------------------------------------------------------------
+
+CREATE TABLE materialized_views.raw_mac_addrs_vendors AS
+SELECT * FROM public.raw_mac_addrs_vendors
+WITH NO DATA;
+
+ALTER TABLE materialized_views.raw_mac_addrs_vendors
+ADD FOREIGN KEY (tool_run_id)
+    REFERENCES tool_runs(id)
+    ON DELETE CASCADE
+    ON UPDATE CASCADE;
+
+-- Partial indexes
+CREATE INDEX raw_mac_addrs_vendors_idx_tool_run_id
+ON materialized_views.raw_mac_addrs_vendors(tool_run_id);
+
+CREATE INDEX raw_mac_addrs_vendors_idx_mac_addr
+ON materialized_views.raw_mac_addrs_vendors(mac_addr);
+
+
+CREATE VIEW materialized_views.mac_addrs_vendors AS
+SELECT DISTINCT
+    mac_addr                    AS mac_addr,
+    vendor_name                 AS vendor_name
+FROM materialized_views.raw_mac_addrs_vendors
+;
+
+
+-- ----------------------------------------------------------------------
+-- Fully refreshed copies (rows are not attributable to one tool run)
+-- ----------------------------------------------------------------------
+
+CREATE MATERIALIZED VIEW materialized_views.ip_nets_overlapping AS
+SELECT * FROM public.ip_nets_overlapping
+;
+
+-- Partial indexes
+CREATE INDEX ip_nets_overlapping_idx_gist_ip_net_larger
+ON materialized_views.ip_nets_overlapping
+USING GIST (ip_net_larger inet_ops);
+
+CREATE INDEX ip_nets_overlapping_idx_gist_ip_net_smaller
+ON materialized_views.ip_nets_overlapping
+USING GIST (ip_net_smaller inet_ops);
+
+
+-- ----------------------------------------------------------------------
+
+CREATE MATERIALIZED VIEW materialized_views.device_ip_route_connections AS
+SELECT * FROM public.device_ip_route_connections
+;
+
+-- Partial indexes
+CREATE INDEX device_ip_route_connections_idx_device_id
+ON materialized_views.device_ip_route_connections(device_id);
+
+CREATE INDEX device_ip_route_connections_idx_next_hop_device_id
+ON materialized_views.device_ip_route_connections(next_hop_device_id);
+
+CREATE INDEX device_ip_route_connections_idx_gist_dst_ip_net
+ON materialized_views.device_ip_route_connections
+USING GIST (dst_ip_net inet_ops);
+
+CREATE INDEX device_ip_route_connections_idx_gist_incoming_ip_net
+ON materialized_views.device_ip_route_connections
+USING GIST (incoming_ip_net inet_ops);
+
+
+-- ----------------------------------------------------------------------
+-- Change tracking of the tables the copies are built from
+-- ----------------------------------------------------------------------
+
+CREATE FUNCTION materialized_views.note_tool_run_changes()
+RETURNS TRIGGER AS $$
+BEGIN
+    -- Runs being removed are skipped, their bookkeeping cascades out
+    INSERT INTO materialized_views.tool_run_changes AS trc
+        (tool_run_id, change_count, change_txid)
+    SELECT tr.id, 1, txid_current()
+    FROM tool_runs AS tr
+    WHERE (tr.id IN (SELECT cr.tool_run_id FROM changed_rows AS cr))
+    ON CONFLICT (tool_run_id) DO UPDATE
+    SET change_count = trc.change_count + 1,
+        change_txid  = EXCLUDED.change_txid
+    WHERE (trc.change_txid != EXCLUDED.change_txid);
+
+    RETURN NULL;
+END;
+$$ LANGUAGE plpgsql;
+
+CREATE FUNCTION materialized_views.note_all_tool_run_changes()
+RETURNS TRIGGER AS $$
+BEGIN
+    INSERT INTO materialized_views.tool_run_changes AS trc
+        (tool_run_id, change_count, change_txid)
+    SELECT tr.id, 1, txid_current()
+    FROM tool_runs AS tr
+    ON CONFLICT (tool_run_id) DO UPDATE
+    SET change_count = trc.change_count + 1,
+        change_txid  = EXCLUDED.change_txid
+    WHERE (trc.change_txid != EXCLUDED.change_txid);
+
+    RETURN NULL;
+END;
+$$ LANGUAGE plpgsql;
+
+
+-- ----------------------------------------------------------------------
+-- Adds the change tracking triggers to each table (transitively) read by
+-- the copied views which lacks them.  Run by the first refresh, so data
+-- stores not using the copies pay nothing on import.
+-- ----------------------------------------------------------------------
+
+CREATE FUNCTION materialized_views.track_source_changes()
+RETURNS VOID AS $$
+DECLARE
+    v_table         REGCLASS;
+    v_has_run_id    BOOLEAN;
+BEGIN
+    FOR v_table, v_has_run_id IN
+        WITH RECURSIVE sources(table_oid) AS (
+            SELECT c.oid
+            FROM pg_catalog.pg_class AS c
+            WHERE (c.oid IN ('public.raw_intra_network_ports'::REGCLASS,
+                             'public.raw_inter_network_ports'::REGCLASS,
+                             'public.raw_mac_addrs_vendors'::REGCLASS,
+                             'public.ip_nets_overlapping'::REGCLASS,
+                             'public.device_ip_route_connections'::REGCLASS))
+            UNION
+            SELECT d.refobjid
+            FROM sources AS s
+            JOIN pg_catalog.pg_rewrite AS rw
+              ON (rw.ev_class = s.table_oid)
+            JOIN pg_catalog.pg_depend AS d
+              ON (d.classid = 'pg_catalog.pg_rewrite'::REGCLASS) AND
+                 (d.objid = rw.oid) AND
+                 (d.refclassid = 'pg_catalog.pg_class'::REGCLASS) AND
+                 (d.refobjid != s.table_oid)
+        )
+        SELECT c.oid::REGCLASS,
+               EXISTS (SELECT 1
+                       FROM pg_catalog.pg_attribute AS a
+                       WHERE (a.attrelid = c.oid) AND
+                             (a.attname = 'tool_run_id') AND
+                             (NOT a.attisdropped))
+        FROM sources AS s
+        JOIN pg_catalog.pg_class AS c
+          ON (c.oid = s.table_oid)
+        WHERE (c.relkind IN ('r', 'p')) AND
+              NOT EXISTS (SELECT 1
+                          FROM pg_catalog.pg_trigger AS t
+                          WHERE (t.tgrelid = c.oid) AND
+                                (t.tgname = 'materialized_views_truncates'))
+    LOOP
+        IF (v_has_run_id) THEN
+            EXECUTE format(
+                'CREATE TRIGGER materialized_views_inserts'
+                ' AFTER INSERT ON %s'
+                ' REFERENCING NEW TABLE AS changed_rows'
+                ' FOR EACH STATEMENT'
+                ' EXECUTE FUNCTION materialized_views.note_tool_run_changes()',
+                v_table);
+            EXECUTE format(
+                'CREATE TRIGGER materialized_views_updates'
+                ' AFTER UPDATE ON %s'
+                ' REFERENCING NEW TABLE AS changed_rows'
+                ' FOR EACH STATEMENT'
+                ' EXECUTE FUNCTION materialized_views.note_tool_run_changes()',
+                v_table);
+            EXECUTE format(
+                'CREATE TRIGGER materialized_views_deletes'
+                ' AFTER DELETE ON %s'
+                ' REFERENCING OLD TABLE AS changed_rows'
+                ' FOR EACH STATEMENT'
+                ' EXECUTE FUNCTION materialized_views.note_tool_run_changes()',
+                v_table);
+        ELSE
+            EXECUTE format(
+                'CREATE TRIGGER materialized_views_changes'
+                ' AFTER INSERT OR UPDATE OR DELETE ON %s'
+                ' FOR EACH STATEMENT'
+                ' EXECUTE FUNCTION'
+                ' materialized_views.note_all_tool_run_changes()',
+                v_table);
+        END IF;
+        -- Added last, as it marks the table as tracked
+        EXECUTE format(
+            'CREATE TRIGGER materialized_views_truncates'
+            ' AFTER TRUNCATE ON %s'
+            ' FOR EACH STATEMENT'
+            ' EXECUTE FUNCTION materialized_views.note_all_tool_run_changes()',
+            v_table);
+    END LOOP;
+END;
+$$ LANGUAGE plpgsql;
+
+
+-- ----------------------------------------------------------------------
+-- Digest of the tool runs (their execute times and change counts) a
+-- refresh covered
+-- ----------------------------------------------------------------------
+
+CREATE FUNCTION materialized_views.tool_runs_digest()
+RETURNS TEXT AS $$
+    SELECT md5(COALESCE(string_agg(tr.id::TEXT || tr.execute_time::TEXT
+                                     || ':'
+                                     || COALESCE(trc.change_count, 0)::TEXT,
+                                   ',' ORDER BY tr.id),
+                        ''))
+    FROM tool_runs AS tr
+    LEFT OUTER JOIN materialized_views.tool_run_changes AS trc
+    ON (trc.tool_run_id = tr.id);
+$$ LANGUAGE sql STABLE;
+
+
+-- ----------------------------------------------------------------------
+-- REFRESH_MATERIALIZED_VIEWS()
+--
+-- Brings every copy in `materialized_views` up to date.  Per tool run
+-- copies only (re)load runs which are new, or whose execute_time or source
+-- rows changed since they were loaded; the remaining copies are rebuilt
+-- only when any of those changed since their last refresh.  Returns, per
+-- copy, the number of tool runs its refresh covered (0 when already
+-- current).
+-- ----------------------------------------------------------------------
+
+CREATE FUNCTION refresh_materialized_views()
+RETURNS TABLE (
+    view_name               TEXT,
+    tool_runs_refreshed     BIGINT
+) AS $$
+#variable_conflict use_column
+DECLARE
+    v_name      TEXT;
+    v_stale     UUID[];
+    v_times     TSRANGE[];
+    v_counts    BIGINT[];
+    v_digest    TEXT;
+BEGIN
+    PERFORM materialized_views.track_source_changes();
+
+    FOREACH v_name IN ARRAY ARRAY[
+        'raw_intra_network_ports',
+        'raw_inter_network_ports',
+        'raw_mac_addrs_vendors'
+    ]
+    LOOP
+        -- What is recorded is read before copying, so a change landing
+        -- in between is picked up again by the next refresh
+        SELECT COALESCE(array_agg(tr.id), '{}'),
+               COALESCE(array_agg(tr.execute_time), '{}'),
+               COALESCE(array_agg(COALESCE(trc.change_count, 0)), '{}')
+        INTO v_stale, v_times, v_counts
+        FROM tool_runs AS tr
+        LEFT OUTER JOIN materialized_views.tool_run_changes AS trc
+        ON (trc.tool_run_id = tr.id)
+        LEFT OUTER JOIN materialized_views.refreshed_tool_runs AS rtr
+        ON (rtr.view_name = v_name) AND
+           (rtr.tool_run_id = tr.id)
+        WHERE (rtr.execute_time IS DISTINCT FROM tr.execute_time) OR
+              (rtr.change_count IS DISTINCT FROM
+                 COALESCE(trc.change_count, 0));
+
+        IF (0 < cardinality(v_stale)) THEN
+            EXECUTE format(
+                'DELETE FROM materialized_views.%I'
+                ' WHERE (tool_run_id = ANY($1))',
+                v_name)
+            USING v_stale;
+            EXECUTE format(
+                'INSERT INTO materialized_views.%I'
+                ' SELECT * FROM public.%I'
+                ' WHERE (tool_run_id = ANY($1))',
+                v_name, v_name)
+            USING v_stale;
+
+            DELETE FROM materialized_views.refreshed_tool_runs AS rtr
+            WHERE (rtr.view_name = v_name) AND
+                  (rtr.tool_run_id = ANY(v_stale));
+            INSERT INTO materialized_views.refreshed_tool_runs
+                (view_name, tool_run_id, execute_time, change_count)
+            SELECT v_name, stale.id, stale.execute_time, stale.change_count
+            FROM unnest(v_stale, v_times, v_counts)
+                 AS stale(id, execute_time, change_count)
+            -- Removed since read
+            WHERE EXISTS (SELECT 1 FROM tool_runs AS tr
+                          WHERE (tr.id = stale.id));
+        END IF;
+
+        view_name           := v_name;
+        tool_runs_refreshed := cardinality(v_stale);
+        RETURN NEXT;
+    END LOOP;
+
+    v_digest := materialized_views.tool_runs_digest();
+
+    FOREACH v_name IN ARRAY ARRAY[
+        'ip_nets_overlapping',
+        'device_ip_route_connections'
+    ]
+    LOOP
+        view_name           := v_name;
+        tool_runs_refreshed := 0;
+
+        IF NOT EXISTS (
+            SELECT 1
+            FROM materialized_views.refresh_states AS rs
+            WHERE (rs.view_name = v_name) AND
+                  (rs.tool_runs_digest = v_digest))
+        THEN
+            EXECUTE format(
+                'REFRESH MATERIALIZED VIEW materialized_views.%I',
+                v_name);
+
+            INSERT INTO materialized_views.refresh_states
+                (view_name, tool_runs_digest, refresh_time)
+            VALUES (v_name, v_digest, now())
+            ON CONFLICT (view_name) DO UPDATE
+            SET tool_runs_digest = EXCLUDED.tool_runs_digest,
+                refresh_time     = EXCLUDED.refresh_time;
+
+            SELECT count(*) INTO tool_runs_refreshed FROM tool_runs;
+        END IF;
+
+        RETURN NEXT;
+    END LOOP;
+END;
+$$ LANGUAGE plpgsql;
+
+
+-- ----------------------------------------------------------------------
+-- MATERIALIZED_VIEWS_REFRESH_STATE()
+--
+-- The copies hold no rows until the first refresh_materialized_views().
+-- Reports whether that refresh happened and whether the copies still
+-- cover the current tool runs, so readers can refuse or warn.
+-- ----------------------------------------------------------------------
+
+CREATE FUNCTION materialized_views_refresh_state(
+    OUT is_refreshed        BOOLEAN,
+    OUT is_current          BOOLEAN
+) AS $$
+    SELECT
+        (0 < count(*)),
+        (0 < count(*)) AND
+        bool_and(rs.tool_runs_digest = materialized_views.tool_runs_digest())
+    FROM materialized_views.refresh_states AS rs;
+$$ LANGUAGE sql STABLE;
+
+
+-- ----------------------------------------------------------------------
+
+COMMIT TRANSACTION;
@@ -0,0 +1,218 @@
+#!/bin/bash --
+
+# =============================================================================
+# Copyright 2023 National Technology & Engineering Solutions of Sandia, LLC
+# (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+# Government retains certain rights in this software.
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+# SOFTWARE.
+# =============================================================================
+# Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+# =============================================================================
+
+# Loads a synthetic 100k host / 10k subnet dataset into a scratch database
+# and records the execution time of the containment joined views with and
+# without the inet_ops GiST indexes (and the prior ip_nets_overlapping).
+#
+# Usage: benchmark-inet-indexes.sh [db-name] [results-file]
+#
+# The database name must end in _bench and the database must not already
+# exist; it is left in place afterwards and must be dropped manually.
+
+set -e
+
+DB_NAME="${1:-site_inet_bench}"
+RESULTS="${2:-inet-index-timings.txt}"
+SCHEMA_DIR="$(dirname "$(readlink -f "$0")")"
+PSQL=(psql --quiet --no-psqlrc --set ON_ERROR_STOP=1 --dbname "$DB_NAME")
+
+VIEWS=(
+  ip_nets_overlapping
+  raw_intra_network_ports
+  raw_inter_network_ports
+  device_ip_route_connections
+)
+
+if [[ "$DB_NAME" != *_bench ]]; then
+  echo "Database name must end in _bench: $DB_NAME" >&2
+  exit 1
+fi
+if ! createdb "$DB_NAME"; then
+  echo "Could not create $DB_NAME; an existing database is never reused," \
+       "drop it first if it is a prior benchmark" >&2
+  exit 1
+fi
+
+for schema in "$SCHEMA_DIR"/*.sql; do
+  "${PSQL[@]}" --file "$schema" > /dev/null
+done
+
+"${PSQL[@]}" <<'SQL'
+INSERT INTO tool_runs (id, tool_name, command_line, data_path, execute_time)
+SELECT ('00000000-0000-0000-0000-' || lpad(to_hex(i), 12, '0'))::UUID,
+       'benchmark', 'benchmark-inet-indexes.sh', '/dev/null',
+       tsrange(now()::TIMESTAMP, now()::TIMESTAMP, '[]')
+FROM generate_series(1, 2) AS i;
+
+CREATE TEMP VIEW bench_run AS
+SELECT '00000000-0000-0000-0000-000000000001'::UUID AS id;
+
+-- 10k /24 subnets, with their /16 and /8 supernets
+INSERT INTO raw_ip_nets (tool_run_id, ip_net)
+SELECT (SELECT id FROM bench_run),
+       ('10.' || (i / 256) || '.' || (i % 256) || '.0/24')::CIDR
+FROM generate_series(0, 9999) AS i
+UNION
+SELECT (SELECT id FROM bench_run), ('10.' || i || '.0.0/16')::CIDR
+FROM generate_series(0, 9999 / 256) AS i
+UNION
+SELECT (SELECT id FROM bench_run), '10.0.0.0/8'::CIDR;
+
+-- 100k hosts, 10 per subnet, each with an open port
+INSERT INTO raw_ip_addrs (tool_run_id, ip_addr, is_responding)
+SELECT (SELECT id FROM bench_run),
+       ('10.' || (i / 256) || '.' || (i % 256) || '.' || (10 + h))::INET,
+       true
+FROM generate_series(0, 9999) AS i, generate_series(0, 9) AS h;
+
+INSERT INTO raw_ports (tool_run_id, ip_addr, protocol, port, port_state)
+SELECT tool_run_id, ip_addr, 'tcp', 22, 'open'
+FROM raw_ip_addrs;
+
+-- The system the scans were run from
+INSERT INTO tool_run_interfaces
+  (tool_run_id, interface_name, media_type, is_up)
+SELECT id, 'eth0', 'ethernet', true FROM bench_run;
+
+INSERT INTO tool_run_ip_addrs (tool_run_id, interface_name, ip_addr)
+SELECT id, 'eth0', '10.0.0.250/24' FROM bench_run;
+
+INSERT INTO tool_run_ip_routes
+  (tool_run_id, interface_name, dst_ip_net, next_hop_ip_addr)
+SELECT id, 'eth0', '0.0.0.0/0', '10.0.0.1' FROM bench_run;
+
+-- 200 routers, each with a LAN subnet and a WAN link to a core device
+CREATE TEMP VIEW bench_router AS
+SELECT i AS n, 'router' || i AS device_id,
+       ('10.' || (i / 256) || '.' || (i % 256) || '.1')::INET AS lan_ip_addr,
+       ('10.' || (i / 256) || '.' || (i % 256) || '.0/24')::CIDR AS lan_ip_net,
+       ('172.16.' || (i / 64) || '.' || (4 * (i % 64) + 1))::INET
+         AS wan_ip_addr,
+       ('172.16.' || (i / 64) || '.' || (4 * (i % 64)) || '/30')::CIDR
+         AS wan_ip_net,
+       ('172.16.' || (i / 64) || '.' || (4 * (i % 64) + 2))::INET
+         AS core_ip_addr
+FROM generate_series(1, 200) AS i;
+
+INSERT INTO raw_devices (tool_run_id, device_id)
+SELECT '00000000-0000-0000-0000-000000000002'::UUID, device_id FROM bench_router
+UNION ALL
+SELECT '00000000-0000-0000-0000-000000000002'::UUID, 'core';
+
+INSERT INTO raw_device_interfaces
+  (tool_run_id, device_id, interface_name, media_type, is_up)
+SELECT '00000000-0000-0000-0000-000000000002'::UUID, device_id, iface,
+       'ethernet', true
+FROM bench_router, unnest(ARRAY['lan', 'wan']) AS iface
+UNION ALL
+SELECT '00000000-0000-0000-0000-000000000002'::UUID, 'core', 'wan' || n,
+       'ethernet', true
+FROM bench_router;
+
+INSERT INTO raw_ip_addrs (tool_run_id, ip_addr, is_responding)
+SELECT '00000000-0000-0000-0000-000000000002'::UUID, ip_addr, true
+FROM bench_router,
+     unnest(ARRAY[lan_ip_addr, wan_ip_addr, core_ip_addr]) AS ip_addr;
+
+INSERT INTO raw_device_ip_addrs
+  (tool_run_id, device_id, interface_name, ip_addr, ip_net)
+SELECT '00000000-0000-0000-0000-000000000002'::UUID, device_id, 'lan',
+       lan_ip_addr, lan_ip_net
+FROM bench_router
+UNION ALL
+SELECT '00000000-0000-0000-0000-000000000002'::UUID, device_id, 'wan',
+       wan_ip_addr, wan_ip_net
+FROM bench_router
+UNION ALL
+SELECT '00000000-0000-0000-0000-000000000002'::UUID, 'core', 'wan' || n,
+       core_ip_addr, wan_ip_net
+FROM bench_router;
+
+INSERT INTO raw_device_ip_routes
+  (tool_run_id, device_id, vrf_id, table_id, is_active, dst_ip_net,
+   next_hop_ip_addr, protocol, administrative_distance, metric)
+SELECT '00000000-0000-0000-0000-000000000002'::UUID, device_id, '', '', true,
+       '0.0.0.0/0', core_ip_addr, 'static', 1, 0
+FROM bench_router
+UNION ALL
+SELECT '00000000-0000-0000-0000-000000000002'::UUID, 'core', '', '', true,
+       lan_ip_net, wan_ip_addr, 'static', 1, 0
+FROM bench_router;
+
+ANALYZE;
+SQL
+
+# Prints the execution time (ms) of counting the rows of a view.
+timeView()
+{
+  local setup="$1"
+  local view="$2"
+  "${PSQL[@]}" --tuples-only --no-align <<SQL \
+    | sed -n 's/^Execution Time: \([0-9.]*\) ms$/\1/p'
+BEGIN;
+$setup
+EXPLAIN (ANALYZE, TIMING OFF) SELECT count(*) FROM $view;
+ROLLBACK;
+SQL
+}
+
+# Reverts, within the transaction, to the schema prior to the GiST indexes.
+# Only ip_nets_overlapping was rewritten alongside them; the other views keep
+# their original definitions (e.g., device_ip_route_connections still joins
+# device_vrfs_ip_addrs), so both columns time the same view text.
+BEFORE_SETUP="$(cat <<'SQL'
+DO $$
+DECLARE idx RECORD;
+BEGIN
+  FOR idx IN
+    SELECT indexname FROM pg_indexes
+    WHERE (schemaname = 'public') AND (indexname LIKE '%\_idx\_gist\_%')
+  LOOP
+    EXECUTE format('DROP INDEX %I', idx.indexname);
+  END LOOP;
+END $$;
+CREATE OR REPLACE VIEW ip_nets_overlapping AS
+SELECT DISTINCT
+    ip_nets_0.ip_net            AS ip_net_larger,
+    ip_nets_1.ip_net            AS ip_net_smaller
+FROM raw_ip_nets AS ip_nets_0
+JOIN raw_ip_nets AS ip_nets_1
+ON (ip_nets_0.ip_net >> ip_nets_1.ip_net)
+;
+SQL
+)"
+
+{
+  printf '%-32s %14s %14s\n' "view" "before (ms)" "after (ms)"
+  for view in "${VIEWS[@]}"; do
+    before="$(timeView "$BEFORE_SETUP" "$view")"
+    after="$(timeView "" "$view")"
+    printf '%-32s %14s %14s\n' "$view" "$before" "$after"
+  done
+} | tee "$RESULTS"
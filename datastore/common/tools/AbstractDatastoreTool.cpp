@@ -24,6 +24,8 @@
 // Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
 // =============================================================================
 
+#include <pqxx/pqxx>
+
 #include <netmeld/datastore/tools/AbstractDatastoreTool.hpp>
 
 
@@ -87,6 +89,17 @@ namespace netmeld::datastore::tools {
         );
   }
 
+  void
+  AbstractDatastoreTool::addMaterializedViewsOption()
+  {
+    opts.addOptionalOption("materialized-views", std::make_tuple(
+          "materialized-views",
+          NULL_SEMANTIC,
+          "Read the materialized copies of derived views, if refreshed"
+          " (see `refresh_materialized_views()`).")
+        );
+  }
+
   const std::string
   AbstractDatastoreTool::getDbName() const
   {
@@ -110,6 +123,43 @@ namespace netmeld::datastore::tools {
     if ("" != dbArgs) {
       oss << " " << dbArgs;
     }
+
+    // Same named copies shadow the views they materialize
+    if (opts.exists("materialized-views")) {
+      checkMaterializedViews(oss.str());
+      oss << " options='-c search_path=materialized_views,public'";
+    }
     return oss.str();
   }
+
+  void
+  AbstractDatastoreTool::checkMaterializedViews(
+      const std::string& _dbConnectString) const
+  {
+    pqxx::connection db {_dbConnectString};
+    pqxx::nontransaction t {db};
+
+    const auto& exists {t.exec(
+        "SELECT to_regprocedure('materialized_views_refresh_state()')"
+        "         IS NOT NULL")};
+    if (!exists.at(0).at(0).as<bool>()) {
+      throw std::runtime_error(
+          "Data store has no materialized views; re-initialize it to use"
+          " --materialized-views");
+    }
+
+    const auto& state {t.exec(
+        "SELECT is_refreshed, is_current"
+        " FROM materialized_views_refresh_state()")};
+    if (!state.at(0).at("is_refreshed").as<bool>()) {
+      throw std::runtime_error(
+          "Materialized views are empty until refreshed; run"
+          " `SELECT * FROM refresh_materialized_views()` first");
+    }
+    if (!state.at(0).at("is_current").as<bool>()) {
+      LOG_WARN << "Materialized views predate the current tool runs; run"
+               << " `SELECT * FROM refresh_materialized_views()` to include"
+               << " them\n";
+    }
+  }
 }
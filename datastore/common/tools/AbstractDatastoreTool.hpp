@@ -65,11 +65,15 @@ namespace netmeld::datastore::tools {
       void addModuleOptions() override;
 
       void addRequiredDeviceId();
+      void addMaterializedViewsOption();
 
       const std::string getDbName() const;
       const std::string getDbArgs() const;
       const std::string getDbConnectString() const;
 
+      // Refuse never refreshed (empty) copies, warn on out of date ones
+      void checkMaterializedViews(const std::string&) const;
+
     public:
   };
 }
@@ -46,6 +46,14 @@ namespace netmeld::datastore::tools {
   // ===========================================================================
   // Tool Entry Points (execution order)
   // ===========================================================================
+  void
+  AbstractExportTool::addModuleOptions()
+  {
+    AbstractDatastoreTool::addModuleOptions();
+
+    addMaterializedViewsOption();
+  }
+
   int
   AbstractExportTool::runTool()
   {
@@ -59,6 +59,8 @@ namespace netmeld::datastore::tools {
     // =========================================================================
     private:
     protected:
+      void addModuleOptions() override;
+
       virtual void printHelp() const override;
       // Tool specific behavior entry point
       virtual int  runTool() override;
@@ -45,6 +45,14 @@ namespace netmeld::datastore::tools {
   // ===========================================================================
   // Tool Entry Points (execution order)
   // ===========================================================================
+  void
+  AbstractGraphTool::addModuleOptions()
+  {
+    AbstractDatastoreTool::addModuleOptions();
+
+    addMaterializedViewsOption();
+  }
+
   int
   AbstractGraphTool::runTool()
   {
@@ -27,6 +27,9 @@
 #ifndef ABSTRACT_IMPORT_TOOL_HPP
 #define ABSTRACT_IMPORT_TOOL_HPP
 
+#include <atomic>
+#include <vector>
+
 #include <netmeld/core/objects/Time.hpp>
 #include <netmeld/core/objects/Uuid.hpp>
 #include <netmeld/datastore/tools/AbstractDatastoreTool.hpp>
@@ -73,9 +76,25 @@ namespace netmeld::datastore::tools {
     // Methods
     // =========================================================================
     private:
+      // Gives each new tool run its own partitions, if the DB is partitioned
+      // and idle
+      void createToolRunPartitions(pqxx::connection&,
+                                   const std::vector<nmco::Uuid>&);
       // Performs default inserts into the DB
       void generalInserts(pqxx::transaction_base&, const std::string&);
       void addModuleOptions() override;
+      // Files named by data-path, with directories expanded to their contents
+      std::vector<sfs::path> getDataPaths() const;
+      // Imports the current data path under its own tool run
+      int importDataPath();
+      // Imports the files with a pool of jobs forked workers
+      int importDataPaths(const std::vector<sfs::path>&);
+      // Imports claimed files, over one connection, until none are left
+      int importWorker(const std::vector<sfs::path>&,
+                       const std::vector<nmco::Uuid>&,
+                       std::atomic<size_t>&, std::atomic<size_t>*);
+      // Saves the parsed data path under its own tool run
+      void saveData(pqxx::connection&);
 
     protected:
       const sfs::path   getDataPath() const;
@@ -27,7 +27,25 @@
 // NOTE This implementation is included in the header (at the end) since it
 //      leverages templating.
 
+#include <algorithm>
+#include <atomic>
+#include <iostream>
+#include <map>
+#include <new>
+#include <optional>
+#include <set>
+#include <system_error>
+#include <thread>
+
+extern "C" {
+#include <sys/mman.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+}
+
 #include <netmeld/datastore/parsers/ParserHelper.hpp>
+#include <netmeld/datastore/utils/BulkRowSink.hpp>
 #include <netmeld/datastore/utils/QueriesCommon.hpp>
 
 namespace nmcu = netmeld::core::utils;
@@ -58,18 +76,192 @@ namespace netmeld::datastore::tools {
   int
   AbstractImportTool<P,R>::runTool()
   {
-    if (opts.exists("data-path")) {
-      dataPath = sfs::canonical(opts.getValue("data-path"));
+    const auto& dataPaths {getDataPaths()};
+    if (1 < dataPaths.size()) {
+      return importDataPaths(dataPaths);
+    }
+    if (!dataPaths.empty()) {
+      dataPath = dataPaths.front();
     }
 
+    return importDataPath();
+  }
+
+  template<typename P, typename R>
+  int
+  AbstractImportTool<P,R>::importDataPath()
+  {
     setToolRunId();
 
     parseData(); // only returns on success
 
     pqxx::connection db {getDbConnectString()};
     nmdu::dbPrepareCommon(db);
+    createToolRunPartitions(db, {toolRunId});
+    saveData(db);
+
+    return nmcu::Exit::SUCCESS;
+  }
+
+  // Files are imported by a bounded pool of forked workers, each holding one
+  // connection (and its prepared statements) while claiming paths from a
+  // counter shared with its siblings.  A worker ended by a parse failure
+  // (importers generally exit) is replaced while paths remain.
+  template<typename P, typename R>
+  int
+  AbstractImportTool<P,R>::importDataPaths(
+      const std::vector<sfs::path>& dataPaths)
+  {
+    if (opts.exists("tool-run-id")) {
+      LOG_ERROR << "Option --tool-run-id requires exactly one DATA_PATH\n";
+      return nmcu::Exit::FAILURE;
+    }
+
+    auto numJobs {opts.template getValueAs<size_t>("jobs")};
+    if (0 == numJobs) {
+      numJobs = std::max(1U, std::thread::hardware_concurrency());
+    }
+    numJobs = std::min(numJobs, dataPaths.size());
+
+    // Partitions are created up front as doing so needs the tables idle
+    std::vector<nmco::Uuid> toolRunIds;
+    for (size_t i {0}; i < dataPaths.size(); ++i) {
+      setToolRunId();
+      toolRunIds.push_back(toolRunId);
+    }
+    {
+      pqxx::connection db {getDbConnectString()};
+      createToolRunPartitions(db, toolRunIds);
+    }
+
+    // Slot 0 is the next unclaimed path, slot i+1 is set once path i is saved
+    using Slot = std::atomic<size_t>;
+    static_assert(Slot::is_always_lock_free);
+    const size_t numSlots {1 + dataPaths.size()};
+    void* const shared {mmap(nullptr, numSlots * sizeof(Slot),
+                             PROT_READ | PROT_WRITE,
+                             MAP_SHARED | MAP_ANONYMOUS, -1, 0)};
+    if (MAP_FAILED == shared) {
+      throw std::system_error(errno, std::generic_category(), "mmap");
+    }
+    Slot* const slots {static_cast<Slot*>(shared)};
+    for (size_t i {0}; i < numSlots; ++i) {
+      new (&slots[i]) Slot {0};
+    }
+    Slot& nextPath {slots[0]};
+
+    // Each worker, with the number of paths claimed when it started
+    std::map<pid_t, size_t> running;
+
+    const auto spawn = [&]() {
+      // Anything still buffered would otherwise be written by both processes
+      std::cout.flush();
+      std::cerr.flush();
+
+      const pid_t pid {fork()};
+      if (-1 == pid) {
+        throw std::system_error(errno, std::generic_category(), "fork");
+      }
+      if (0 == pid) {
+        int status {nmcu::Exit::FAILURE};
+        try {
+          status = importWorker(dataPaths, toolRunIds, nextPath, slots + 1);
+        } catch (const std::exception& e) {
+          LOG_ERROR << e.what() << '\n';
+        }
+        // Skip exit handlers and destructors registered by the parent (e.g.,
+        // its database connections), so only flush what this worker wrote
+        std::cout.flush();
+        std::cerr.flush();
+        _exit(status);
+      }
+      running.emplace(pid, nextPath.load());
+    };
+
+    const auto reap = [&]() {
+      int status {0};
+      const pid_t pid {waitpid(-1, &status, 0)};
+      if (-1 == pid) {
+        throw std::system_error(errno, std::generic_category(), "waitpid");
+      }
+      const auto claimedAtStart {running.at(pid)};
+      running.erase(pid);
+
+      // Replace a failed worker while paths remain, unless none were claimed
+      // since it started (e.g., the datastore is unreachable)
+      const auto claimed {nextPath.load()};
+      if ((!WIFEXITED(status) || nmcu::Exit::SUCCESS != WEXITSTATUS(status))
+          && claimedAtStart < claimed && claimed < dataPaths.size())
+      {
+        spawn();
+      }
+    };
+
+    for (size_t i {0}; i < numJobs; ++i) {
+      spawn();
+    }
+    while (!running.empty()) {
+      reap();
+    }
+
+    size_t failures {0};
+    for (size_t i {0}; i < dataPaths.size(); ++i) {
+      if (0 == slots[i + 1].load()) {
+        LOG_ERROR << "Failed to import: " << dataPaths[i].string() << '\n';
+        ++failures;
+      }
+    }
+    munmap(shared, numSlots * sizeof(Slot));
+
+    LOG_INFO << "Imported " << (dataPaths.size() - failures) << " of "
+             << dataPaths.size() << " files\n";
+
+    return (0 == failures) ? nmcu::Exit::SUCCESS : nmcu::Exit::FAILURE;
+  }
+
+  template<typename P, typename R>
+  int
+  AbstractImportTool<P,R>::importWorker(
+      const std::vector<sfs::path>& dataPaths,
+      const std::vector<nmco::Uuid>& toolRunIds,
+      std::atomic<size_t>& nextPath,
+      std::atomic<size_t>* const saved)
+  {
+    pqxx::connection db {getDbConnectString()};
+    nmdu::dbPrepareCommon(db);
+
+    // Only results and device details are reset between files, importers
+    // must otherwise (re)initialize per file state when parsing
+    const auto initialDevInfo {devInfo};
+
+    for (size_t i; (i = nextPath.fetch_add(1)) < dataPaths.size();) {
+      dataPath  = dataPaths[i];
+      toolRunId = toolRunIds[i];
+      tResults  = R();
+      devInfo   = initialDevInfo;
+      try {
+        parseData(); // only returns on success
+        saveData(db);
+        saved[i] = 1;
+      } catch (const std::exception& e) {
+        LOG_ERROR << dataPath.string() << ": " << e.what() << '\n';
+      }
+    }
+
+    return nmcu::Exit::SUCCESS;
+  }
+
+  template<typename P, typename R>
+  void
+  AbstractImportTool<P,R>::saveData(pqxx::connection& db)
+  {
     pqxx::work t{db};
 
+    std::optional<nmdu::BulkRowSink> sink;
+    if (!opts.exists("no-bulk-insert")) {
+      sink.emplace(t);
+    }
+
     if (opts.exists("tool-run-metadata")) {
       LOG_DEBUG << "Running as tool-run-metadata\n";
       toolRunMetadataInserts(t);
@@ -80,13 +272,14 @@ namespace netmeld::datastore::tools {
       specificInserts(t);
     }
 
+    if (sink) {
+      sink->flush();
+    }
     t.commit();
 
     if (!opts.exists("tool-run-id")) {
       LOG_INFO << "tool-run-id: " << toolRunId << '\n';
     }
-
-    return nmcu::Exit::SUCCESS;
   }
 
   template<typename P, typename R>
@@ -140,8 +333,16 @@ namespace netmeld::datastore::tools {
 
     opts.addRequiredOption("data-path", std::make_tuple(
           "data-path",
-          po::value<std::string>()->required(),
-          "Data to parse. Either --data-path param or implicit last argument.")
+          po::value<std::vector<std::string>>()->required(),
+          "Data to parse; directories are searched for files. Either"
+          " --data-path param or implicit last argument(s).")
+        );
+
+    opts.addOptionalOption("jobs", std::make_tuple(
+          "jobs,j",
+          po::value<size_t>()->default_value(0),
+          "Inputs to import concurrently, each under its own tool run;"
+          " 0 uses all available cores.")
         );
 
     opts.addOptionalOption("pipe", std::make_tuple(
@@ -155,6 +356,11 @@ namespace netmeld::datastore::tools {
           po::value<std::string>(),
           "UUID for this run of the tool.")
         );
+    opts.addAdvancedOption("no-bulk-insert", std::make_tuple(
+          "no-bulk-insert",
+          NULL_SEMANTIC,
+          "Save each result row individually instead of batching them.")
+        );
     opts.addAdvancedOption("tool-run-metadata", std::make_tuple(
           "tool-run-metadata",
           NULL_SEMANTIC,
@@ -173,13 +379,52 @@ namespace netmeld::datastore::tools {
   // ===========================================================================
   // General Functions (alphabetical)
   // ===========================================================================
+  template<typename P, typename R>
+  void
+  AbstractImportTool<P,R>::createToolRunPartitions(
+      pqxx::connection& db,
+      const std::vector<nmco::Uuid>& toolRunIds)
+  {
+    if (opts.exists("tool-run-metadata")) {
+      return;
+    }
+
+    // Data stores initialized without the function are never partitioned
+    {
+      pqxx::nontransaction t {db};
+      const auto& found {t.exec(
+          "SELECT to_regproc('tool_run_partitions_create') IS NOT NULL")};
+      if (!found.at(0).at(0).as<bool>()) {
+        return;
+      }
+    }
+    db.prepare
+      ("create_tool_run_partitions",
+       "SELECT tool_run_partitions_create($1)");
+
+    // Own transaction per tool run, so each holds its locks only briefly
+    size_t numCreated {0};
+    for (const auto& id : toolRunIds) {
+      pqxx::work t {db};
+      const auto& created {t.exec_prepared("create_tool_run_partitions", id)};
+      t.commit();
+      if (created.at(0).at(0).as<bool>()) {
+        ++numCreated;
+      }
+    }
+    if (numCreated < toolRunIds.size()) {
+      LOG_DEBUG << "Tool runs without partitions of their own: "
+                << (toolRunIds.size() - numCreated) << '\n';
+    }
+  }
+
   template<typename P, typename R>
   void
   AbstractImportTool<P,R>::generalInserts(
       pqxx::transaction_base& t,
       const std::string& dataFile)
   {
-    t.exec_prepared("insert_tool_run",
+    nmdu::execPrepared(t, "insert_tool_run",
         toolRunId,
         programName,
         helpBlurb, // commandLine
@@ -200,6 +445,43 @@ namespace netmeld::datastore::tools {
     devInfo.save(t, toolRunId);
   }
 
+  template<typename P, typename R>
+  std::vector<sfs::path>
+  AbstractImportTool<P,R>::getDataPaths() const
+  {
+    std::vector<sfs::path> dataPaths;
+    // Paths are kept as given, for the tool run, but a file named more than
+    // once (e.g., via a link or an overlapping directory) is imported once
+    std::set<sfs::path> imported;
+    const auto add = [&](const sfs::path& path) {
+      if (imported.insert(sfs::canonical(path)).second) {
+        dataPaths.push_back(path);
+      }
+    };
+
+    for (const auto& value : opts.getValues("data-path")) {
+      const sfs::path path {value};
+      if (!sfs::is_directory(sfs::canonical(path))) {
+        add(path);
+        continue;
+      }
+
+      std::vector<sfs::path> files;
+      for (const auto& entry : sfs::recursive_directory_iterator(path)) {
+        if (entry.is_regular_file()) {
+          files.push_back(entry.path());
+        }
+      }
+      if (files.empty()) {
+        LOG_WARN << "No files found in: " << path.string() << '\n';
+      }
+      std::sort(files.begin(), files.end());
+      std::for_each(files.cbegin(), files.cend(), add);
+    }
+
+    return dataPaths;
+  }
+
   template<typename P, typename R>
   sfs::path const
   AbstractImportTool<P,R>::getDataPath() const
@@ -25,6 +25,7 @@
 // =============================================================================
 
 #include <netmeld/datastore/tools/AbstractInsertTool.hpp>
+#include <netmeld/datastore/utils/BulkRowSink.hpp>
 
 namespace nmdu = netmeld::datastore::utils;
 
@@ -111,7 +112,7 @@ namespace netmeld::datastore::tools {
   void
   AbstractInsertTool::generalInserts(pqxx::transaction_base& t)
   {
-    t.exec_prepared("insert_tool_run",
+    nmdu::execPrepared(t, "insert_tool_run",
         toolRunId,
         programName,
         opts.getCommandLine(),
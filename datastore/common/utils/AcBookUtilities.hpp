@@ -27,42 +27,108 @@
 #ifndef AC_BOOK_UTILITIES_HPP
 #define AC_BOOK_UTILITIES_HPP
 
+#include <cstdint>
 #include <map>
+#include <memory>
+#include <set>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 
 namespace netmeld::datastore::utils {
 
+  /* Flattens nested network/service book references in place.
+
+     Books are keyed by set (e.g., zone) then name.  A book member which names
+     another non-empty book in the same set is a reference and is replaced by
+     that book's (flattened) members.  Members naming empty or unknown books
+     are left as-is.
+
+     The reference graph is ordered once (Tarjan's SCC algorithm, which yields
+     referenced books before their referrers) and each book is flattened
+     exactly once.  Flattened results are sorted vectors of interned member
+     ids shared between referrers, so a book only referring to one other book
+     costs a pointer copy.  Reference cycles (including self-references) are
+     collapsed: every book in the cycle receives the union of the cycle's
+     members and the cycle is reported via `getCycles()`.
+  */
   template<typename DType>
-  bool
-  expanded(std::map<std::string, std::map<std::string, DType>>& book,
-           const std::string& targetSet, const std::string& targetData,
-           const std::string& defaultSet=""
-    )
-  {
-    // book doesn't exist
-    if (!book.count(targetSet)) { return false; }
-    // book exists, no data
-    if (!book[targetSet].count(targetData)) { return false; }
-    const auto& set {book[targetSet][targetData].getData()};
-    // book and data exist, but empty
-    if (set.empty()) { return false; }
-
-    // recursive function
-    std::vector<std::string> vec {set.begin(), set.end()};
-    for (const auto& data : vec) {
-      // skip self-reference data
-      if (targetData == data) { continue; }
-      if (expanded(book, targetSet, data, defaultSet)) {
-        book[targetSet][targetData].removeData(data);
-        book[targetSet][targetData].addData(book[targetSet][data].getData());
-      } else if (!defaultSet.empty()) {
-        expanded(book, defaultSet, data);
-      }
-    }
-    return true;
-  }
+  class AcBookExpander {
+    // =========================================================================
+    // Types
+    // =========================================================================
+    public:
+      using Books = std::map<std::string, std::map<std::string, DType>>;
+
+    private:
+      using Members = std::shared_ptr<const std::vector<uint32_t>>;
+
+      struct Node {
+        const std::string*        set;
+        const std::string*        name;
+        DType*                    book;
+        std::vector<size_t>       refs;     // referenced nodes
+        std::vector<std::string>  refNames; // members which are references
+        std::vector<uint32_t>     leaves;   // interned non-reference members
+      };
+
+    // =========================================================================
+    // Variables
+    // =========================================================================
+    private: // Variables will probably rarely appear at this scope
+      Books& books;
+
+      // Interned book members
+      std::vector<std::string>                   pool;
+      std::unordered_map<std::string, uint32_t>  poolIds;
+
+      std::vector<Node>                          nodes;
+      std::unordered_map<const DType*, size_t>   nodeIds;
+      std::vector<size_t>                        sccOf;
+      std::vector<Members>                       flattened; // per SCC
+      std::vector<bool>                          written;
+
+      std::vector<std::string>                   cycles;
 
+    protected: // Variables intended for internal/subclass API
+    public: // Variables should rarely appear at this scope
+
+    // =========================================================================
+    // Constructors
+    // =========================================================================
+    private: // Constructors which should be hidden from API users
+    protected: // Constructors part of subclass API
+    public: // Constructors part of public API
+      explicit AcBookExpander(Books&);
+
+    // =========================================================================
+    // Methods
+    // =========================================================================
+    private: // Methods which should be hidden from API users
+      uint32_t intern(const std::string&);
+      void buildGraph();
+      void orderAndFlatten();
+      void flattenScc(size_t, const std::vector<size_t>&);
+      void writeBack(size_t);
+
+    protected: // Methods part of subclass API
+    public: // Methods part of public API
+      // Expand one book, and transitively the books it references; false if
+      // the book does not exist or is empty
+      bool expand(const std::string&, const std::string&);
+      // Expand every book
+      void expandAll();
+
+      // Human readable description of each reference cycle found
+      const std::vector<std::string>& getCycles() const;
+  };
+
+  // Expand every book in place, returning any reference cycles found
+  template<typename DType>
+  std::vector<std::string>
+  expandAll(std::map<std::string, std::map<std::string, DType>>&);
 }
+#include "AcBookUtilities.ipp"
+
 #endif  /* AC_BOOK_UTILITIES_HPP */
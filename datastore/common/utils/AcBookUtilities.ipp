@@ -0,0 +1,290 @@
+// =============================================================================
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+// =============================================================================
+
+// NOTE This implementation is included in the header (at the end) since it
+//      leverages templating.
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+
+
+namespace netmeld::datastore::utils {
+
+  // ===========================================================================
+  // Constructors
+  // ===========================================================================
+  template<typename DType>
+  AcBookExpander<DType>::AcBookExpander(Books& _books) :
+    books(_books)
+  {
+    buildGraph();
+    orderAndFlatten();
+  }
+
+
+  // ===========================================================================
+  // Methods
+  // ===========================================================================
+  template<typename DType>
+  uint32_t
+  AcBookExpander<DType>::intern(const std::string& _member)
+  {
+    const auto [it, inserted] {
+      poolIds.try_emplace(_member, static_cast<uint32_t>(pool.size()))};
+    if (inserted) {
+      pool.push_back(_member);
+    }
+    return it->second;
+  }
+
+  template<typename DType>
+  void
+  AcBookExpander<DType>::buildGraph()
+  {
+    // Snapshot each book's data once, it is returned by value
+    std::vector<std::set<std::string>> raw;
+    for (auto& [set, setBooks] : books) {
+      for (auto& [name, book] : setBooks) {
+        nodeIds.emplace(&book, nodes.size());
+        nodes.push_back({&set, &name, &book, {}, {}, {}});
+        raw.push_back(book.getData());
+      }
+    }
+
+    for (size_t i {0}; i < nodes.size(); ++i) {
+      auto& node {nodes[i]};
+      const auto& setBooks {books.at(*node.set)};
+      for (const auto& member : raw[i]) {
+        const auto it {setBooks.find(member)};
+        if (setBooks.end() != it) {
+          const auto refId {nodeIds.at(&it->second)};
+          if (!raw[refId].empty()) {
+            node.refs.push_back(refId);
+            node.refNames.push_back(member);
+            continue;
+          }
+        }
+        node.leaves.push_back(intern(member));
+      }
+    }
+
+    written.assign(nodes.size(), false);
+  }
+
+  template<typename DType>
+  void
+  AcBookExpander<DType>::orderAndFlatten()
+  {
+    // Iterative Tarjan; an SCC completes only after every SCC it references
+    constexpr size_t UNSET {std::numeric_limits<size_t>::max()};
+    std::vector<size_t> index(nodes.size(), UNSET);
+    std::vector<size_t> low(nodes.size(), UNSET);
+    std::vector<bool>   onStack(nodes.size(), false);
+    std::vector<size_t> stack;
+    std::vector<std::pair<size_t, size_t>> calls; // node, next ref
+    size_t counter {0};
+
+    sccOf.assign(nodes.size(), UNSET);
+
+    auto visit = [&](size_t _v) {
+        index[_v] = low[_v] = counter++;
+        stack.push_back(_v);
+        onStack[_v] = true;
+        calls.emplace_back(_v, 0);
+      };
+
+    for (size_t root {0}; root < nodes.size(); ++root) {
+      if (UNSET != index[root]) { continue; }
+      visit(root);
+      while (!calls.empty()) {
+        const auto v {calls.back().first};
+        const auto& refs {nodes[v].refs};
+        if (calls.back().second < refs.size()) {
+          const auto w {refs[calls.back().second++]};
+          if (UNSET == index[w]) {
+            visit(w);
+          } else if (onStack[w]) {
+            low[v] = std::min(low[v], index[w]);
+          }
+          continue;
+        }
+
+        calls.pop_back();
+        if (!calls.empty()) {
+          auto& parentLow {low[calls.back().first]};
+          parentLow = std::min(parentLow, low[v]);
+        }
+        if (low[v] == index[v]) {
+          std::vector<size_t> component;
+          size_t w;
+          do {
+            w = stack.back();
+            stack.pop_back();
+            onStack[w] = false;
+            component.push_back(w);
+          } while (w != v);
+          flattenScc(flattened.size(), component);
+        }
+      }
+    }
+  }
+
+  template<typename DType>
+  void
+  AcBookExpander<DType>::flattenScc(size_t _sccId,
+                                    const std::vector<size_t>& _component)
+  {
+    for (const auto n : _component) {
+      sccOf[n] = _sccId;
+    }
+
+    bool isCyclic {_component.size() > 1};
+    bool hasLeaves {false};
+    std::vector<size_t> children;
+    for (const auto n : _component) {
+      hasLeaves = hasLeaves || !nodes[n].leaves.empty();
+      for (const auto r : nodes[n].refs) {
+        if (_sccId == sccOf[r]) {
+          isCyclic = true;
+        } else {
+          children.push_back(sccOf[r]);
+        }
+      }
+    }
+    std::sort(children.begin(), children.end());
+    children.erase(std::unique(children.begin(), children.end()),
+                   children.end());
+
+    if (!hasLeaves && 1 == children.size()) {
+      // Pure alias of one other book (or cycle), share its members
+      flattened.push_back(flattened[children.front()]);
+    } else {
+      std::vector<uint32_t> members;
+      for (const auto n : _component) {
+        members.insert(members.end(),
+                       nodes[n].leaves.begin(), nodes[n].leaves.end());
+      }
+      for (const auto c : children) {
+        members.insert(members.end(),
+                       flattened[c]->begin(), flattened[c]->end());
+      }
+      std::sort(members.begin(), members.end());
+      members.erase(std::unique(members.begin(), members.end()),
+                    members.end());
+      flattened.push_back(
+          std::make_shared<const std::vector<uint32_t>>(std::move(members)));
+    }
+
+    if (isCyclic) {
+      std::vector<std::string> names;
+      for (const auto n : _component) {
+        names.push_back(*nodes[n].name);
+      }
+      std::sort(names.begin(), names.end());
+      const auto& set {*nodes[_component.front()].set};
+      std::string cycle {"Cyclic book reference in (" + set + "):"};
+      for (const auto& name : names) {
+        cycle += " " + name;
+      }
+      cycles.push_back(cycle);
+    }
+  }
+
+  template<typename DType>
+  void
+  AcBookExpander<DType>::writeBack(size_t _nodeId)
+  {
+    if (written[_nodeId]) { return; }
+    written[_nodeId] = true;
+
+    auto& node {nodes[_nodeId]};
+    if (node.refs.empty()) { return; } // nothing to substitute
+
+    for (const auto& refName : node.refNames) {
+      node.book->removeData(refName);
+    }
+    for (const auto id : *flattened[sccOf[_nodeId]]) {
+      node.book->addData(pool[id]);
+    }
+  }
+
+  template<typename DType>
+  bool
+  AcBookExpander<DType>::expand(const std::string& _set,
+                                const std::string& _name)
+  {
+    const auto setIt {books.find(_set)};
+    if (books.end() == setIt) { return false; }
+    const auto bookIt {setIt->second.find(_name)};
+    if (setIt->second.end() == bookIt) { return false; }
+    const auto root {nodeIds.at(&bookIt->second)};
+    if (nodes[root].refs.empty() && nodes[root].leaves.empty()) {
+      return false;
+    }
+
+    // Referenced books are expanded in place as well
+    std::vector<size_t> pending {root};
+    while (!pending.empty()) {
+      const auto n {pending.back()};
+      pending.pop_back();
+      if (written[n]) { continue; }
+      pending.insert(pending.end(),
+                     nodes[n].refs.begin(), nodes[n].refs.end());
+      writeBack(n);
+    }
+    return true;
+  }
+
+  template<typename DType>
+  void
+  AcBookExpander<DType>::expandAll()
+  {
+    for (size_t n {0}; n < nodes.size(); ++n) {
+      writeBack(n);
+    }
+  }
+
+  template<typename DType>
+  const std::vector<std::string>&
+  AcBookExpander<DType>::getCycles() const
+  {
+    return cycles;
+  }
+
+
+  // ===========================================================================
+  // Free functions
+  // ===========================================================================
+  template<typename DType>
+  std::vector<std::string>
+  expandAll(std::map<std::string, std::map<std::string, DType>>& _books)
+  {
+    AcBookExpander<DType> expander {_books};
+    expander.expandAll();
+    return expander.getCycles();
+  }
+}
@@ -0,0 +1,130 @@
+// =============================================================================
+// Copyright 2023 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+// =============================================================================
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+#include <boost/test/unit_test.hpp>
+
+#include <netmeld/datastore/objects/AcNetworkBook.hpp>
+#include <netmeld/datastore/utils/AcBookUtilities.hpp>
+
+namespace nmdo = netmeld::datastore::objects;
+namespace nmdu = netmeld::datastore::utils;
+
+using Books = std::map<std::string, std::map<std::string, nmdo::AcNetworkBook>>;
+
+
+namespace {
+  void
+  addBook(Books& _books, const std::string& _set, const std::string& _name,
+          const std::set<std::string>& _data)
+  {
+    auto& book {_books[_set][_name]};
+    book.setName(_name);
+    book.addData(_data);
+  }
+}
+
+
+BOOST_AUTO_TEST_CASE(testExpandAllNested)
+{
+  Books books;
+  addBook(books, "global", "a", {"1.1.1.1", "b"});
+  addBook(books, "global", "b", {"2.2.2.2", "c"});
+  addBook(books, "global", "c", {"3.3.3.3"});
+  addBook(books, "global", "d", {"unknown"});
+  addBook(books, "global", "e", {});
+  addBook(books, "global", "f", {"e", "4.4.4.4"});
+  addBook(books, "global", "g", {"b", "c"});
+  addBook(books, "z1", "x", {"c", "5.5.5.5"});
+
+  const auto cycles {nmdu::expandAll(books)};
+  BOOST_TEST(cycles.empty());
+
+  const std::set<std::string> a {"1.1.1.1", "2.2.2.2", "3.3.3.3"};
+  BOOST_TEST(a == books["global"]["a"].getData());
+  const std::set<std::string> b {"2.2.2.2", "3.3.3.3"};
+  BOOST_TEST(b == books["global"]["b"].getData());
+  BOOST_TEST(b == books["global"]["g"].getData());
+  const std::set<std::string> c {"3.3.3.3"};
+  BOOST_TEST(c == books["global"]["c"].getData());
+  // Unknown and empty books are not references
+  const std::set<std::string> d {"unknown"};
+  BOOST_TEST(d == books["global"]["d"].getData());
+  const std::set<std::string> f {"e", "4.4.4.4"};
+  BOOST_TEST(f == books["global"]["f"].getData());
+  // References only resolve within the same set
+  const std::set<std::string> x {"c", "5.5.5.5"};
+  BOOST_TEST(x == books["z1"]["x"].getData());
+}
+
+BOOST_AUTO_TEST_CASE(testExpandAllCycles)
+{
+  Books books;
+  addBook(books, "global", "a", {"1.1.1.1", "b"});
+  addBook(books, "global", "b", {"2.2.2.2", "c"});
+  addBook(books, "global", "c", {"3.3.3.3", "a"});
+  addBook(books, "global", "d", {"c"});
+  addBook(books, "global", "s", {"s", "4.4.4.4"});
+
+  const auto found {nmdu::expandAll(books)};
+  const std::set<std::string> cycles {found.begin(), found.end()};
+  BOOST_TEST(2 == found.size());
+  BOOST_TEST(cycles.count("Cyclic book reference in (global): a b c"));
+  BOOST_TEST(cycles.count("Cyclic book reference in (global): s"));
+
+  const std::set<std::string> abc {"1.1.1.1", "2.2.2.2", "3.3.3.3"};
+  BOOST_TEST(abc == books["global"]["a"].getData());
+  BOOST_TEST(abc == books["global"]["b"].getData());
+  BOOST_TEST(abc == books["global"]["c"].getData());
+  BOOST_TEST(abc == books["global"]["d"].getData());
+  const std::set<std::string> s {"4.4.4.4"};
+  BOOST_TEST(s == books["global"]["s"].getData());
+}
+
+BOOST_AUTO_TEST_CASE(testExpand)
+{
+  Books books;
+  addBook(books, "global", "a", {"1.1.1.1", "b"});
+  addBook(books, "global", "b", {"2.2.2.2", "c"});
+  addBook(books, "global", "c", {"3.3.3.3"});
+  addBook(books, "global", "e", {});
+  addBook(books, "global", "g", {"a"});
+
+  nmdu::AcBookExpander<nmdo::AcNetworkBook> expander {books};
+  BOOST_TEST(!expander.expand("global", "missing"));
+  BOOST_TEST(!expander.expand("missing", "a"));
+  BOOST_TEST(!expander.expand("global", "e"));
+
+  BOOST_TEST(expander.expand("global", "a"));
+  const std::set<std::string> a {"1.1.1.1", "2.2.2.2", "3.3.3.3"};
+  BOOST_TEST(a == books["global"]["a"].getData());
+  const std::set<std::string> b {"2.2.2.2", "3.3.3.3"};
+  BOOST_TEST(b == books["global"]["b"].getData());
+  // Referrers are left alone
+  const std::set<std::string> g {"a"};
+  BOOST_TEST(g == books["global"]["g"].getData());
+}
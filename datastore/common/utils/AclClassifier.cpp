@@ -0,0 +1,957 @@
+// =============================================================================
+// Copyright 2023 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+// =============================================================================
+
+#include <algorithm>
+#include <bit>
+#include <cctype>
+#include <sstream>
+#include <stdexcept>
+
+#include <netmeld/core/utils/LoggerSingleton.hpp>
+#include <netmeld/datastore/objects/PortRange.hpp>
+#include <netmeld/datastore/utils/AclClassifier.hpp>
+#include <netmeld/datastore/utils/BulkRowSink.hpp>
+
+namespace nmdo = netmeld::datastore::objects;
+
+
+namespace {
+  using IpBytes = std::array<uint8_t, 16>;
+
+  // Next key of the family, none if already the last address
+  std::optional<IpBytes>
+  successor(IpBytes _key, uint8_t _family)
+  {
+    const size_t length {(4 == _family) ? 4U : 16U};
+    for (size_t i {length}; i-- > 0;) {
+      if (++_key[i] != 0) {
+        return _key;
+      }
+    }
+    return std::nullopt;
+  }
+
+  std::string
+  toLower(std::string _value)
+  {
+    std::transform(_value.begin(), _value.end(), _value.begin(),
+                   [](unsigned char c){ return std::tolower(c); });
+    return _value;
+  }
+
+  // Protocols which match every protocol
+  bool
+  isAnyProtocol(const std::string& _protocol)
+  {
+    return _protocol.empty()
+        || "any" == _protocol
+        || "ip" == _protocol
+        || "all" == _protocol
+        ;
+  }
+}
+
+namespace netmeld::datastore::utils {
+
+  // ===========================================================================
+  // IntervalIndex
+  // ===========================================================================
+  template<typename K>
+  uint32_t
+  AclClassifier::IntervalIndex<K>::find(const K& _key) const
+  {
+    auto it {std::upper_bound(starts.cbegin(), starts.cend(), _key)};
+    return setIds[static_cast<size_t>(it - starts.cbegin()) - 1];
+  }
+
+  template<typename K>
+  std::set<uint32_t>
+  AclClassifier::IntervalIndex<K>::findAll(const K& _first,
+                                           const K& _last) const
+  {
+    std::set<uint32_t> ids;
+    auto it {std::upper_bound(starts.cbegin(), starts.cend(), _first)};
+    for (size_t i {static_cast<size_t>(it - starts.cbegin()) - 1};
+         i < starts.size() && !(_last < starts[i]); ++i)
+    {
+      ids.insert(setIds[i]);
+    }
+    return ids;
+  }
+
+  template<typename K>
+  void
+  AclClassifier::IntervalIndex<K>::addOverlapping(const K& _first,
+                                                  const K& _last,
+                                                  Bitset& _set) const
+  {
+    // Those covering the first key, plus those starting after it within
+    const auto& covering {sets[find(_first)]};
+    for (size_t w {0}; w < covering.size(); ++w) {
+      _set[w] |= covering[w];
+    }
+    auto it {std::upper_bound(rangeStarts.cbegin(), rangeStarts.cend(), _first,
+                              [](const K& key, const auto& start)
+                              { return key < start.first; })};
+    for (; it != rangeStarts.cend() && !(_last < it->first); ++it) {
+      _set[it->second / 64] |= uint64_t{1} << (it->second % 64);
+    }
+  }
+
+  // ===========================================================================
+  // Constructors
+  // ===========================================================================
+
+  // ===========================================================================
+  // Methods
+  // ===========================================================================
+  bool
+  AclClassifier::toIpRange(const std::string& _net, IpKey& _first,
+                           IpKey& _last)
+  {
+    const auto slash {_net.find('/')};
+    auto key {IpKey::fromString(_net.substr(0, slash))};
+    if (!key.isValid()) {
+      return false;
+    }
+
+    const size_t maxPrefix {(4 == key.family) ? 32U : 128U};
+    size_t prefix {maxPrefix};
+    if (std::string::npos != slash) {
+      const auto digits {_net.substr(slash + 1)};
+      if (digits.empty() || digits.size() > 3
+          || !std::all_of(digits.cbegin(), digits.cend(),
+                          [](unsigned char c){ return std::isdigit(c); }))
+      {
+        return false;
+      }
+      prefix = std::stoul(digits);
+      if (prefix > maxPrefix) {
+        return false;
+      }
+    }
+
+    _first = key;
+    _last  = key;
+    for (size_t i {0}; i < maxPrefix / 8; ++i) {
+      const size_t bitsKept {
+        std::min<size_t>(8, prefix > i * 8 ? prefix - i * 8 : 0)
+      };
+      const uint8_t mask {
+        static_cast<uint8_t>(bitsKept ? (0xFF << (8 - bitsKept)) : 0)
+      };
+      _first.bytes[i] &= mask;
+      _last.bytes[i]  = static_cast<uint8_t>(_first.bytes[i] | ~mask);
+    }
+    return true;
+  }
+
+  size_t
+  AclClassifier::addRule(const AclClassifierRule& _rule)
+  {
+    compiled = false;
+    rules.push_back({_rule, {}, {}, {}, {}, {}});
+    return rules.size() - 1;
+  }
+
+  bool
+  AclClassifier::addSrcIpNet(size_t _ruleId, const std::string& _net)
+  {
+    IpKey first, last;
+    if (!toIpRange(_net, first, last)) {
+      return false;
+    }
+    compiled = false;
+    rules.at(_ruleId).srcNets.emplace(first, last);
+    return true;
+  }
+
+  bool
+  AclClassifier::addDstIpNet(size_t _ruleId, const std::string& _net)
+  {
+    IpKey first, last;
+    if (!toIpRange(_net, first, last)) {
+      return false;
+    }
+    compiled = false;
+    rules.at(_ruleId).dstNets.emplace(first, last);
+    return true;
+  }
+
+  void
+  AclClassifier::addService(size_t _ruleId, const std::string& _protocol,
+                            uint16_t _srcPortFirst, uint16_t _srcPortLast,
+                            uint16_t _dstPortFirst, uint16_t _dstPortLast)
+  {
+    compiled = false;
+    rules.at(_ruleId).services.insert(
+        { toLower(_protocol)
+        , std::min(_srcPortFirst, _srcPortLast)
+        , std::max(_srcPortFirst, _srcPortLast)
+        , std::min(_dstPortFirst, _dstPortLast)
+        , std::max(_dstPortFirst, _dstPortLast)
+        });
+  }
+
+  void
+  AclClassifier::addIncomingIface(size_t _ruleId, const std::string& _iface)
+  {
+    compiled = false;
+    auto& ifaces {rules.at(_ruleId).incomingIfaces};
+    if (!_iface.empty()) {
+      ifaces.insert(toLower(_iface));
+    }
+  }
+
+  void
+  AclClassifier::addOutgoingIface(size_t _ruleId, const std::string& _iface)
+  {
+    compiled = false;
+    auto& ifaces {rules.at(_ruleId).outgoingIfaces};
+    if (!_iface.empty()) {
+      ifaces.insert(toLower(_iface));
+    }
+  }
+
+  template<typename K>
+  void
+  AclClassifier::buildIndex(IntervalIndex<K>& _index,
+      const std::vector<std::tuple<K, std::optional<K>, size_t>>& _ranges,
+      const K& _minKey, size_t _entryCount, size_t _words)
+  {
+    // Sweep the range starts and (exclusive) ends in key order; an entry is
+    // in an interval's set while any of its ranges covers the interval
+    struct Event {
+      K      key;
+      size_t entry;
+      int    delta;
+    };
+    std::vector<Event> events;
+    events.reserve(_ranges.size() * 2);
+    for (const auto& [first, end, entry] : _ranges) {
+      events.push_back({first, entry, 1});
+      if (end) {
+        events.push_back({*end, entry, -1});
+      }
+    }
+    std::sort(events.begin(), events.end(),
+              [](const Event& a, const Event& b){ return a.key < b.key; });
+
+    _index = {};
+    std::map<Bitset, uint32_t> pool;
+    auto intern = [&](const Bitset& _set) {
+      auto [it, added] {
+        pool.emplace(_set, static_cast<uint32_t>(_index.sets.size()))
+      };
+      if (added) {
+        _index.sets.push_back(_set);
+      }
+      return it->second;
+    };
+    auto addInterval = [&](const K& _start, const Bitset& _set) {
+      const auto id {intern(_set)};
+      if (!_index.setIds.empty() && _index.setIds.back() == id) {
+        return; // same set as the previous interval, extend it
+      }
+      _index.starts.push_back(_start);
+      _index.setIds.push_back(id);
+    };
+
+    for (const auto& [first, end, entry] : _ranges) {
+      _index.rangeStarts.emplace_back(first, entry);
+    }
+    std::sort(_index.rangeStarts.begin(), _index.rangeStarts.end(),
+              [](const auto& a, const auto& b){ return a.first < b.first; });
+
+    std::vector<uint32_t> counts(_entryCount, 0);
+    Bitset current(_words, 0);
+    size_t i {0};
+    if (events.empty() || _minKey < events.front().key) {
+      addInterval(_minKey, current);
+    }
+    while (i < events.size()) {
+      const K key {events[i].key};
+      for (; i < events.size() && !(key < events[i].key); ++i) {
+        const auto entry {events[i].entry};
+        const auto word {entry / 64};
+        const uint64_t bit {uint64_t{1} << (entry % 64)};
+        if (events[i].delta > 0) {
+          if (0 == counts[entry]++) {
+            current[word] |= bit;
+          }
+        } else if (0 == --counts[entry]) {
+          current[word] &= ~bit;
+        }
+      }
+      addInterval(key, current);
+    }
+  }
+
+  void
+  AclClassifier::compile()
+  {
+    // Entries follow rule priority; ties keep the order rules were added
+    std::vector<size_t> order(rules.size());
+    for (size_t i {0}; i < order.size(); ++i) {
+      order[i] = i;
+    }
+    std::stable_sort(order.begin(), order.end(),
+        [this](size_t a, size_t b)
+        { return rules[a].rule.priority < rules[b].rule.priority; });
+
+    actions.clear();
+    for (const auto& spec : rules) {
+      actions.push_back(toLower(spec.rule.action));
+    }
+
+    entries.clear();
+    ruleEntries.assign(rules.size(), {0, 0});
+    for (const auto ruleId : order) {
+      ruleEntries[ruleId].first = entries.size();
+      for (const auto& service : rules[ruleId].services) {
+        entries.push_back({ruleId, service});
+      }
+      ruleEntries[ruleId].second = entries.size();
+    }
+    words = (entries.size() + 63) / 64;
+
+    using IpRange   = std::tuple<IpBytes, std::optional<IpBytes>, size_t>;
+    using PortRange = std::tuple<uint32_t, std::optional<uint32_t>, size_t>;
+    std::vector<IpRange> src4, src6, dst4, dst6;
+    std::vector<PortRange> srcPortRanges, dstPortRanges;
+
+    protocols.clear();
+    incomingIfaces.clear();
+    outgoingIfaces.clear();
+    anyProtocol.assign(words, 0);
+    anyIncomingIface.assign(words, 0);
+    anyOutgoingIface.assign(words, 0);
+    allEntries.assign(words, 0);
+
+    auto setBit = [this](Bitset& _set, size_t _entry) {
+      _set.resize(words, 0);
+      _set[_entry / 64] |= uint64_t{1} << (_entry % 64);
+    };
+
+    for (size_t e {0}; e < entries.size(); ++e) {
+      const auto& spec    {rules[entries[e].ruleId]};
+      const auto& service {entries[e].service};
+
+      for (const auto& [first, last] : spec.srcNets) {
+        auto& ranges {(4 == first.family) ? src4 : src6};
+        ranges.emplace_back(first.bytes,
+                            successor(last.bytes, first.family), e);
+      }
+      for (const auto& [first, last] : spec.dstNets) {
+        auto& ranges {(4 == first.family) ? dst4 : dst6};
+        ranges.emplace_back(first.bytes,
+                            successor(last.bytes, first.family), e);
+      }
+      srcPortRanges.emplace_back(service.srcPortFirst,
+                                 uint32_t{service.srcPortLast} + 1, e);
+      dstPortRanges.emplace_back(service.dstPortFirst,
+                                 uint32_t{service.dstPortLast} + 1, e);
+
+      if (isAnyProtocol(service.protocol)) {
+        setBit(anyProtocol, e);
+      } else {
+        setBit(protocols[service.protocol], e);
+      }
+
+      if (spec.incomingIfaces.empty()) {
+        setBit(anyIncomingIface, e);
+      }
+      for (const auto& iface : spec.incomingIfaces) {
+        setBit(incomingIfaces[iface], e);
+      }
+      if (spec.outgoingIfaces.empty()) {
+        setBit(anyOutgoingIface, e);
+      }
+      for (const auto& iface : spec.outgoingIfaces) {
+        setBit(outgoingIfaces[iface], e);
+      }
+
+      setBit(allEntries, e);
+    }
+
+    // Fold the wildcards in so lookups need only one set per dimension
+    for (const auto& [sets, anySet]
+           : { std::make_pair(&protocols, &anyProtocol)
+             , std::make_pair(&incomingIfaces, &anyIncomingIface)
+             , std::make_pair(&outgoingIfaces, &anyOutgoingIface)
+             })
+    {
+      for (auto& [_, set] : *sets) {
+        for (size_t w {0}; w < words; ++w) {
+          set[w] |= (*anySet)[w];
+        }
+      }
+    }
+
+    const IpBytes minIp {};
+    buildIndex(srcIps4, src4, minIp, entries.size(), words);
+    buildIndex(srcIps6, src6, minIp, entries.size(), words);
+    buildIndex(dstIps4, dst4, minIp, entries.size(), words);
+    buildIndex(dstIps6, dst6, minIp, entries.size(), words);
+    buildIndex(srcPorts, srcPortRanges, uint32_t{0}, entries.size(), words);
+    buildIndex(dstPorts, dstPortRanges, uint32_t{0}, entries.size(), words);
+
+    compiled = true;
+  }
+
+  const AclClassifier::Bitset&
+  AclClassifier::getValueSet(const std::map<std::string, Bitset>& _sets,
+                             const Bitset& _anySet,
+                             const std::string& _value) const
+  {
+    // An unlisted value, or "any" itself, matches only the wildcard rules
+    const auto value {toLower(_value)};
+    if (isAnyProtocol(value)) {
+      return _anySet;
+    }
+    const auto it {_sets.find(value)};
+    return (_sets.cend() == it) ? _anySet : it->second;
+  }
+
+  const AclClassifier::Bitset&
+  AclClassifier::getIfaceSet(const std::map<std::string, Bitset>& _sets,
+                             const Bitset& _anySet,
+                             const std::string& _iface) const
+  {
+    // An unspecified flow interface matches regardless of rule interfaces
+    if (_iface.empty()) {
+      return allEntries;
+    }
+    const auto it {_sets.find(toLower(_iface))};
+    return (_sets.cend() == it) ? _anySet : it->second;
+  }
+
+  std::optional<size_t>
+  AclClassifier::firstMatch(const Dimensions& _sets) const
+  {
+    for (size_t w {0}; w < words; ++w) {
+      uint64_t bits {~uint64_t{0}};
+      for (const auto* set : _sets) {
+        bits &= (*set)[w];
+      }
+      if (bits) {
+        return entries[w * 64 + static_cast<size_t>(std::countr_zero(bits))]
+               .ruleId;
+      }
+    }
+    return std::nullopt;
+  }
+
+  std::vector<const AclClassifier::Bitset*>
+  AclClassifier::spanSets(const std::map<std::string, Bitset>& _sets,
+                          const Bitset& _anySet,
+                          const std::set<std::string>& _values) const
+  {
+    // No values spans every listed value plus the unlisted ones (_anySet)
+    std::vector<const Bitset*> spanned;
+    if (_values.empty()) {
+      spanned.push_back(&_anySet);
+      for (const auto& [_, set] : _sets) {
+        spanned.push_back(&set);
+      }
+    }
+    for (const auto& value : _values) {
+      const auto it {_sets.find(value)};
+      spanned.push_back((_sets.cend() == it) ? &_anySet : &it->second);
+    }
+    return spanned;
+  }
+
+  template<typename F>
+  void
+  AclClassifier::forEachCell(const Cells& _cells, size_t _words,
+                             F&& _visit) const
+  {
+    if (0 == _words) {
+      _visit(std::optional<size_t>{});
+      return;
+    }
+
+    // A combination whose prefix already matches nothing is visited once
+    std::vector<Bitset> running(_cells.size() + 1,
+                                Bitset(_words, ~uint64_t{0}));
+    bool stop {false};
+    auto visitDepth = [&](auto& _self, size_t _depth) -> void {
+      for (const auto* set : _cells[_depth]) {
+        auto& current {running[_depth + 1]};
+        std::optional<size_t> lowest;
+        for (size_t w {_words}; w-- > 0;) {
+          current[w] = running[_depth][w] & (*set)[w];
+          if (current[w]) {
+            lowest = w * 64 + static_cast<size_t>(std::countr_zero(current[w]));
+          }
+        }
+
+        if (!lowest || _depth + 1 == _cells.size()) {
+          stop = !_visit(lowest);
+        } else {
+          _self(_self, _depth + 1);
+        }
+        if (stop) {
+          return;
+        }
+      }
+    };
+    visitDepth(visitDepth, 0);
+  }
+
+  std::optional<size_t>
+  AclClassifier::classify(const AclFlow& _flow) const
+  {
+    if (!compiled) {
+      throw std::logic_error("AclClassifier used before compile()");
+    }
+    if (!_flow.srcIp.isValid() || _flow.srcIp.family != _flow.dstIp.family) {
+      return std::nullopt;
+    }
+
+    const bool isV4 {4 == _flow.srcIp.family};
+    const auto& srcIps {isV4 ? srcIps4 : srcIps6};
+    const auto& dstIps {isV4 ? dstIps4 : dstIps6};
+
+    return firstMatch(
+        {{ &srcIps.sets[srcIps.find(_flow.srcIp.bytes)]
+        , &dstIps.sets[dstIps.find(_flow.dstIp.bytes)]
+        , &srcPorts.sets[srcPorts.find(_flow.srcPort)]
+        , &dstPorts.sets[dstPorts.find(_flow.dstPort)]
+        , &getValueSet(protocols, anyProtocol, _flow.protocol)
+        , &getIfaceSet(incomingIfaces, anyIncomingIface, _flow.incomingIface)
+        , &getIfaceSet(outgoingIfaces, anyOutgoingIface, _flow.outgoingIface)
+        }});
+  }
+
+  AclRangeResult
+  AclClassifier::classify(const AclFlowRange& _range) const
+  {
+    if (!compiled) {
+      throw std::logic_error("AclClassifier used before compile()");
+    }
+
+    AclRangeResult result;
+    const auto family {_range.srcIpFirst.family};
+    if (!_range.srcIpFirst.isValid()
+        || family != _range.srcIpLast.family
+        || family != _range.dstIpFirst.family
+        || family != _range.dstIpLast.family)
+    {
+      result.anyNoMatch = true;
+      return result;
+    }
+
+    const bool isV4 {4 == family};
+    const auto& srcIps {isV4 ? srcIps4 : srcIps6};
+    const auto& dstIps {isV4 ? dstIps4 : dstIps6};
+
+    const auto srcIpIds {
+      srcIps.findAll(_range.srcIpFirst.bytes, _range.srcIpLast.bytes)
+    };
+    const auto dstIpIds {
+      dstIps.findAll(_range.dstIpFirst.bytes, _range.dstIpLast.bytes)
+    };
+    const auto srcPortIds {
+      srcPorts.findAll(_range.srcPortFirst, _range.srcPortLast)
+    };
+    const auto dstPortIds {
+      dstPorts.findAll(_range.dstPortFirst, _range.dstPortLast)
+    };
+
+    // Empty, or "any", spans every listed value and all unlisted ones
+    auto spanOf = [](const std::string& _value, bool _isAny) {
+      std::set<std::string> values;
+      if (!_isAny) {
+        values.insert(toLower(_value));
+      }
+      return values;
+    };
+
+    Cells cells;
+    for (const auto id : srcIpIds)   { cells[0].push_back(&srcIps.sets[id]); }
+    for (const auto id : dstIpIds)   { cells[1].push_back(&dstIps.sets[id]); }
+    for (const auto id : srcPortIds) { cells[2].push_back(&srcPorts.sets[id]); }
+    for (const auto id : dstPortIds) { cells[3].push_back(&dstPorts.sets[id]); }
+    cells[4] = spanSets(protocols, anyProtocol,
+        spanOf(_range.protocol, isAnyProtocol(toLower(_range.protocol))));
+    cells[5] = spanSets(incomingIfaces, anyIncomingIface,
+        spanOf(_range.incomingIface, _range.incomingIface.empty()));
+    cells[6] = spanSets(outgoingIfaces, anyOutgoingIface,
+        spanOf(_range.outgoingIface, _range.outgoingIface.empty()));
+
+    bool allAllowed {true};
+    forEachCell(cells, words, [&](const std::optional<size_t>& _entry) {
+      if (!_entry) {
+        result.anyNoMatch = true;
+        allAllowed = false;
+        return true;
+      }
+      const auto ruleId {entries[*_entry].ruleId};
+      result.ruleIds.insert(ruleId);
+      if ("allow" == actions[ruleId]) {
+        result.anyAllowed = true;
+      } else {
+        allAllowed = false;
+      }
+      return true;
+    });
+    result.allAllowed = allAllowed && result.anyAllowed;
+
+    return result;
+  }
+
+  AclRuleAnalysis
+  AclClassifier::analyze(size_t _ruleId) const
+  {
+    if (!compiled) {
+      throw std::logic_error("AclClassifier used before compile()");
+    }
+
+    AclRuleAnalysis result;
+    const auto& spec {rules.at(_ruleId)};
+    const auto [firstEntry, lastEntry] {ruleEntries[_ruleId]};
+    const auto& action {actions[_ruleId]};
+
+    Bitset earlier(words, 0);
+    std::fill_n(earlier.begin(), firstEntry / 64, ~uint64_t{0});
+    if (firstEntry % 64) {
+      earlier[firstEntry / 64] = (uint64_t{1} << (firstEntry % 64)) - 1;
+    }
+
+    using IpRanges   = std::vector<std::pair<IpBytes, IpBytes>>;
+    using PortRanges = std::vector<std::pair<uint32_t, uint32_t>>;
+    auto netsOf = [](const RuleSpec& _spec, bool _isSrc, uint8_t _family) {
+      IpRanges ranges;
+      for (const auto& [first, last] : (_isSrc ? _spec.srcNets
+                                               : _spec.dstNets))
+      {
+        if (_family == first.family) {
+          ranges.emplace_back(first.bytes, last.bytes);
+        }
+      }
+      return ranges;
+    };
+    auto portsOf = [](const Service& _service, bool _isSrc) {
+      return _isSrc
+          ? PortRanges {{_service.srcPortFirst, _service.srcPortLast}}
+          : PortRanges {{_service.dstPortFirst, _service.dstPortLast}};
+    };
+    auto protocolOf = [](const Service& _service) {
+      std::set<std::string> values;
+      if (!isAnyProtocol(_service.protocol)) {
+        values.insert(_service.protocol);
+      }
+      return values;
+    };
+
+    // Each entry, per IP family, is one product region of the rule
+    size_t regions {0};
+    bool isCovered {true};
+    for (size_t e {firstEntry}; e < lastEntry; ++e) {
+      const auto& service {entries[e].service};
+      for (const uint8_t family : {uint8_t{4}, uint8_t{6}}) {
+        const auto srcNets {netsOf(spec, true, family)};
+        const auto dstNets {netsOf(spec, false, family)};
+        if (srcNets.empty() || dstNets.empty()) {
+          continue;
+        }
+        ++regions;
+
+        // Earlier entries overlapping the region in every dimension
+        Bitset overlap {earlier};
+        auto restrict = [&](const auto& _index, const auto& _ranges) {
+          Bitset spanned(words, 0);
+          for (const auto& [first, last] : _ranges) {
+            _index.addOverlapping(first, last, spanned);
+          }
+          for (size_t w {0}; w < words; ++w) {
+            overlap[w] &= spanned[w];
+          }
+        };
+        auto restrictValues = [&](const std::map<std::string, Bitset>& _sets,
+                                  const std::set<std::string>& _values) {
+          if (_values.empty()) {
+            return; // spans every value, so overlaps every entry
+          }
+          Bitset spanned(words, 0);
+          for (const auto& value : _values) {
+            const auto& set {_sets.at(value)};
+            for (size_t w {0}; w < words; ++w) {
+              spanned[w] |= set[w];
+            }
+          }
+          for (size_t w {0}; w < words; ++w) {
+            overlap[w] &= spanned[w];
+          }
+        };
+        restrict((4 == family) ? srcIps4 : srcIps6, srcNets);
+        restrict((4 == family) ? dstIps4 : dstIps6, dstNets);
+        restrict(srcPorts, portsOf(service, true));
+        restrict(dstPorts, portsOf(service, false));
+        restrictValues(protocols, protocolOf(service));
+        restrictValues(incomingIfaces, spec.incomingIfaces);
+        restrictValues(outgoingIfaces, spec.outgoingIfaces);
+
+        std::vector<size_t> overlapping;
+        for (size_t w {0}; w < words; ++w) {
+          for (uint64_t bits {overlap[w]}; bits; bits &= bits - 1) {
+            const auto entry {
+              w * 64 + static_cast<size_t>(std::countr_zero(bits))
+            };
+            overlapping.push_back(entry);
+            const auto ruleId {entries[entry].ruleId};
+            if (action != actions[ruleId]) {
+              result.conflictingRuleIds.insert(ruleId);
+            }
+          }
+        }
+        if (overlapping.empty()) {
+          isCovered = false;
+          continue;
+        }
+
+        // Within the region, only the boundaries of the overlapping entries
+        // matter; re-index just those, bit i standing for overlapping[i]
+        const size_t count {overlapping.size()};
+        const size_t countWords {(count + 63) / 64};
+        auto setBit = [](Bitset& _set, size_t _i) {
+          _set[_i / 64] |= uint64_t{1} << (_i % 64);
+        };
+
+        Cells cells;
+        std::array<IntervalIndex<IpBytes>, 2>  ipPieces;
+        std::array<IntervalIndex<uint32_t>, 2> portPieces;
+        for (size_t d {0}; d < 2; ++d) {
+          const bool isSrc {0 == d};
+
+          std::vector<std::tuple<IpBytes, std::optional<IpBytes>, size_t>>
+            ipRanges;
+          std::vector<std::tuple<uint32_t, std::optional<uint32_t>, size_t>>
+            portRanges;
+          for (size_t i {0}; i < count; ++i) {
+            const auto& entry {entries[overlapping[i]]};
+            for (const auto& [first, last]
+                   : netsOf(rules[entry.ruleId], isSrc, family))
+            {
+              ipRanges.emplace_back(first, successor(last, family), i);
+            }
+            for (const auto& [first, last] : portsOf(entry.service, isSrc)) {
+              portRanges.emplace_back(first, last + 1, i);
+            }
+          }
+          buildIndex(ipPieces[d], ipRanges, IpBytes{}, count, countWords);
+          buildIndex(portPieces[d], portRanges, uint32_t{0}, count,
+                     countWords);
+
+          std::set<uint32_t> ids;
+          for (const auto& [first, last] : (isSrc ? srcNets : dstNets)) {
+            ids.merge(ipPieces[d].findAll(first, last));
+          }
+          for (const auto id : ids) {
+            cells[d].push_back(&ipPieces[d].sets[id]);
+          }
+          for (const auto& [first, last] : portsOf(service, isSrc)) {
+            for (const auto id : portPieces[d].findAll(first, last)) {
+              cells[2 + d].push_back(&portPieces[d].sets[id]);
+            }
+          }
+        }
+
+        // Value dimensions: a piece per value, plus one for unlisted values
+        std::array<std::vector<Bitset>, 3> valuePieces;
+        auto spanValues = [&](std::vector<Bitset>& _pieces,
+                              const std::set<std::string>& _values,
+                              const auto& _valuesOf) {
+          std::set<std::string> keys {_values};
+          if (_values.empty()) {
+            for (size_t i {0}; i < count; ++i) {
+              keys.merge(_valuesOf(i));
+            }
+            _pieces.emplace_back(countWords, 0); // unlisted values
+            for (size_t i {0}; i < count; ++i) {
+              if (_valuesOf(i).empty()) {
+                setBit(_pieces.back(), i);
+              }
+            }
+          }
+          for (const auto& key : keys) {
+            _pieces.emplace_back(countWords, 0);
+            for (size_t i {0}; i < count; ++i) {
+              const auto values {_valuesOf(i)};
+              if (values.empty() || values.count(key)) {
+                setBit(_pieces.back(), i);
+              }
+            }
+          }
+        };
+        spanValues(valuePieces[0], protocolOf(service), [&](size_t _i) {
+          return protocolOf(entries[overlapping[_i]].service);
+        });
+        spanValues(valuePieces[1], spec.incomingIfaces, [&](size_t _i) {
+          return rules[entries[overlapping[_i]].ruleId].incomingIfaces;
+        });
+        spanValues(valuePieces[2], spec.outgoingIfaces, [&](size_t _i) {
+          return rules[entries[overlapping[_i]].ruleId].outgoingIfaces;
+        });
+        for (size_t d {0}; d < valuePieces.size(); ++d) {
+          for (const auto& piece : valuePieces[d]) {
+            cells[4 + d].push_back(&piece);
+          }
+        }
+
+        forEachCell(cells, countWords, [&](const std::optional<size_t>& _i) {
+          if (!_i) {
+            isCovered = false;
+            return false;
+          }
+          result.coveringRuleIds.insert(entries[overlapping[*_i]].ruleId);
+          return true;
+        });
+      }
+    }
+    result.isCovered = isCovered && regions > 0;
+    result.isRedundant = result.isCovered &&
+        std::all_of(result.coveringRuleIds.begin(),
+                    result.coveringRuleIds.end(),
+                    [&](size_t _id) { return action == actions[_id]; });
+
+    return result;
+  }
+
+  AclClassifier
+  AclClassifier::fromDatastore(pqxx::transaction_base& t,
+                               const std::string& deviceId)
+  {
+    // Each row is one expansion of a stored rule; the (cartesian) row
+    // values of a rule are regrouped into a single classifier rule
+    const auto& rows {execPrepared(t, "select_device_acl_rules", deviceId)};
+
+    AclClassifier acl;
+    std::map<std::string, size_t> ruleIds;
+    for (const auto& row : rows) {
+      if (row.at("src_ip_net").is_null() || row.at("dst_ip_net").is_null()) {
+        continue;
+      }
+
+      // A zone without interfaces, other than "any", never matches
+      const auto incomingZone {row.at("incoming_zone_id").as<std::string>()};
+      const auto outgoingZone {row.at("outgoing_zone_id").as<std::string>()};
+      const auto incomingIface {
+        row.at("incoming_interface_name").as<std::string>("")
+      };
+      const auto outgoingIface {
+        row.at("outgoing_interface_name").as<std::string>("")
+      };
+      if ((incomingIface.empty() && "any" != incomingZone) ||
+          (outgoingIface.empty() && "any" != outgoingZone))
+      {
+        continue;
+      }
+
+      std::ostringstream oss;
+      for (const auto& field : { "priority", "action"
+                               , "incoming_zone_id", "outgoing_zone_id"
+                               , "src_ip_net_set_namespace"
+                               , "src_ip_net_set_id"
+                               , "dst_ip_net_set_namespace"
+                               , "dst_ip_net_set_id"
+                               , "service_id", "src_port_set_id"
+                               , "dst_port_set_id", "description"
+                               })
+      {
+        oss << row.at(field).as<std::string>("") << '\x1f';
+      }
+
+      auto [it, isNew] {ruleIds.emplace(oss.str(), 0)};
+      if (isNew) {
+        it->second = acl.addRule(
+            { row.at("priority").as<size_t>()
+            , row.at("action").as<std::string>()
+            , row.at("description").as<std::string>()
+            });
+      }
+      const auto ruleId {it->second};
+
+      if (!acl.addSrcIpNet(ruleId, row.at("src_ip_net").as<std::string>())
+          || !acl.addDstIpNet(ruleId, row.at("dst_ip_net").as<std::string>()))
+      {
+        LOG_WARN << deviceId << ": skipping unparsable IP network in rule "
+                 << row.at("priority").as<std::string>() << '\n';
+        continue;
+      }
+
+      nmdo::PortRange srcPorts {0, UINT16_MAX};
+      if (!row.at("src_port_range").is_null()) {
+        srcPorts = nmdo::PortRange(
+            row.at("src_port_range").as<std::string>());
+      }
+      nmdo::PortRange dstPorts {0, UINT16_MAX};
+      if (!row.at("dst_port_range").is_null()) {
+        dstPorts = nmdo::PortRange(
+            row.at("dst_port_range").as<std::string>());
+      }
+      acl.addService(ruleId, row.at("protocol").as<std::string>("any"),
+                     std::get<0>(srcPorts), std::get<1>(srcPorts),
+                     std::get<0>(dstPorts), std::get<1>(dstPorts));
+
+      acl.addIncomingIface(ruleId, incomingIface);
+      acl.addOutgoingIface(ruleId, outgoingIface);
+    }
+    acl.compile();
+
+    LOG_DEBUG << deviceId << ": compiled " << rows.size() << " rows into "
+              << acl.getRuleCount() << " rules (" << acl.getEntryCount()
+              << " entries)\n";
+
+    return acl;
+  }
+
+  const AclClassifierRule&
+  AclClassifier::getRule(size_t _ruleId) const
+  {
+    return rules.at(_ruleId).rule;
+  }
+
+  size_t
+  AclClassifier::getRuleCount() const
+  {
+    return rules.size();
+  }
+
+  size_t
+  AclClassifier::getEntryCount() const
+  {
+    return entries.size();
+  }
+
+  bool
+  AclClassifier::isCompiled() const
+  {
+    return compiled;
+  }
+}
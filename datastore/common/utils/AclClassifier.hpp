@@ -0,0 +1,251 @@
+// =============================================================================
+// Copyright 2023 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+// =============================================================================
+
+#ifndef ACL_CLASSIFIER_HPP
+#define ACL_CLASSIFIER_HPP
+
+#include <array>
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <set>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <pqxx/pqxx>
+
+#include <netmeld/datastore/utils/AddressKeys.hpp>
+
+
+namespace netmeld::datastore::utils {
+
+  // A single flow; an empty interface matches rules for any interface
+  struct AclFlow {
+    IpKey       srcIp;
+    IpKey       dstIp;
+    std::string protocol;
+    uint16_t    srcPort {0};
+    uint16_t    dstPort {0};
+    std::string incomingIface;
+    std::string outgoingIface;
+  };
+
+  // Every flow within the (inclusive) bounds
+  struct AclFlowRange {
+    IpKey       srcIpFirst;
+    IpKey       srcIpLast;
+    IpKey       dstIpFirst;
+    IpKey       dstIpLast;
+    std::string protocol;
+    uint16_t    srcPortFirst {0};
+    uint16_t    srcPortLast  {UINT16_MAX};
+    uint16_t    dstPortFirst {0};
+    uint16_t    dstPortLast  {UINT16_MAX};
+    std::string incomingIface;
+    std::string outgoingIface;
+  };
+
+  struct AclClassifierRule {
+    size_t      priority {0};
+    std::string action; // "allow" permits, anything else does not
+    std::string description;
+  };
+
+  struct AclRangeResult {
+    bool             anyAllowed  {false};
+    bool             allAllowed  {false};
+    bool             anyNoMatch  {false}; // some flows match no rule
+    std::set<size_t> ruleIds;             // first matches, see getRule()
+  };
+
+  struct AclRuleAnalysis {
+    bool             isCovered {false}; // no flow first matches the rule
+    bool             isRedundant {false};// covered only by its own action
+    std::set<size_t> coveringRuleIds;   // earlier rules matching first
+    std::set<size_t> conflictingRuleIds;// earlier overlapping, other action
+  };
+
+  /* First-match packet classifier over expanded ACL rules.
+
+     Rules are added with their (already expanded) address networks,
+     services, and interfaces, then compiled once.  Each rule/service pair
+     is an entry, ordered by rule priority then insertion.  Every dimension
+     is cut into elementary intervals (or exact values), each holding the
+     bitset of entries covering it; a lookup is a binary search per
+     dimension followed by intersecting the bitsets and taking the lowest
+     set bit, so the cost does not grow with rule order.  Identical bitsets
+     are stored once per dimension.
+
+     A range lookup visits each distinct combination of bitsets the range
+     spans, so its cost depends on how many rule boundaries fall inside it.
+     Rule analysis first finds the earlier entries overlapping a rule (those
+     covering each range's start plus those starting within it), then cuts
+     the rule's own region at just their boundaries and visits those
+     combinations, stopping at the first no earlier entry matches.
+  */
+  class AclClassifier {
+    // =========================================================================
+    // Variables
+    // =========================================================================
+    private: // Variables will probably rarely appear at this scope
+      using Bitset = std::vector<uint64_t>;
+      // IPs, ports, protocol, and interfaces, in that order
+      using Dimensions = std::array<const Bitset*, 7>;
+      using Cells      = std::array<std::vector<const Bitset*>, 7>;
+
+      // Disjoint [starts[i], starts[i+1]) intervals covering the key space
+      template<typename K>
+      struct IntervalIndex {
+        std::vector<K>        starts;
+        std::vector<uint32_t> setIds;
+        std::vector<Bitset>   sets;
+        std::vector<std::pair<K, size_t>> rangeStarts; // sorted, per entry
+
+        uint32_t find(const K&) const;
+        std::set<uint32_t> findAll(const K&, const K&) const;
+        // Sets the bits of entries overlapping the (inclusive) range
+        void addOverlapping(const K&, const K&, Bitset&) const;
+      };
+      using IpBytes = std::array<uint8_t, 16>;
+
+      struct Service {
+        std::string protocol;
+        uint16_t    srcPortFirst;
+        uint16_t    srcPortLast;
+        uint16_t    dstPortFirst;
+        uint16_t    dstPortLast;
+
+        auto operator<=>(const Service&) const = default;
+      };
+
+      // Sets, as a stored rule arrives as the cartesian product of its
+      // networks and services
+      struct RuleSpec {
+        AclClassifierRule rule;
+        std::set<std::pair<IpKey, IpKey>> srcNets;
+        std::set<std::pair<IpKey, IpKey>> dstNets;
+        std::set<std::string> incomingIfaces; // empty matches any
+        std::set<std::string> outgoingIfaces; // empty matches any
+        std::set<Service>     services;
+      };
+
+      struct Entry {
+        size_t  ruleId;
+        Service service;
+      };
+
+      std::vector<RuleSpec> rules;
+      std::vector<Entry>    entries;
+      std::vector<std::pair<size_t, size_t>> ruleEntries; // [first, last)
+      std::vector<std::string> actions; // lower case, per rule
+      size_t                words {0};
+      bool                  compiled {false};
+
+      IntervalIndex<IpBytes>  srcIps4;
+      IntervalIndex<IpBytes>  srcIps6;
+      IntervalIndex<IpBytes>  dstIps4;
+      IntervalIndex<IpBytes>  dstIps6;
+      IntervalIndex<uint32_t> srcPorts;
+      IntervalIndex<uint32_t> dstPorts;
+
+      std::map<std::string, Bitset> protocols;
+      Bitset                        anyProtocol;
+      std::map<std::string, Bitset> incomingIfaces;
+      Bitset                        anyIncomingIface;
+      std::map<std::string, Bitset> outgoingIfaces;
+      Bitset                        anyOutgoingIface;
+      Bitset                        allEntries;
+
+    protected: // Variables intended for internal/subclass API
+    public: // Variables should rarely appear at this scope
+
+    // =========================================================================
+    // Constructors
+    // =========================================================================
+    private: // Constructors which should be hidden from API users
+    protected: // Constructors part of subclass API
+    public: // Constructors part of public API
+      AclClassifier() = default;
+
+    // =========================================================================
+    // Methods
+    // =========================================================================
+    private: // Methods which should be hidden from API users
+      template<typename K>
+      static void buildIndex(IntervalIndex<K>&,
+                             const std::vector<std::tuple<K, std::optional<K>,
+                                                          size_t>>&,
+                             const K&, size_t, size_t);
+
+      const Bitset& getValueSet(const std::map<std::string, Bitset>&,
+                                const Bitset&, const std::string&) const;
+      const Bitset& getIfaceSet(const std::map<std::string, Bitset>&,
+                                const Bitset&, const std::string&) const;
+      std::vector<const Bitset*>
+        spanSets(const std::map<std::string, Bitset>&, const Bitset&,
+                 const std::set<std::string>&) const;
+
+      std::optional<size_t> firstMatch(const Dimensions&) const;
+
+      // Visits the lowest set bit of the intersection of every combination
+      // of one set per dimension, until the visitor returns false
+      template<typename F>
+      void forEachCell(const Cells&, size_t, F&&) const;
+
+    protected: // Methods part of subclass API
+    public: // Methods part of public API
+      // "addr" or "addr/prefix" to its first and last address; false if bad
+      static bool toIpRange(const std::string&, IpKey&, IpKey&);
+
+      // Compiled from a device's rules in the device_acl_rules view, using
+      // the dbPrepareCommon() statements
+      static AclClassifier fromDatastore(pqxx::transaction_base&,
+                                         const std::string&);
+
+      // Building; the returned id identifies the rule in later calls
+      size_t addRule(const AclClassifierRule&);
+      bool addSrcIpNet(size_t, const std::string&);
+      bool addDstIpNet(size_t, const std::string&);
+      void addService(size_t, const std::string&,
+                      uint16_t, uint16_t, uint16_t, uint16_t);
+      void addIncomingIface(size_t, const std::string&);
+      void addOutgoingIface(size_t, const std::string&);
+
+      void compile();
+
+      // Lookups, only valid once compiled
+      std::optional<size_t> classify(const AclFlow&) const;
+      AclRangeResult classify(const AclFlowRange&) const;
+      AclRuleAnalysis analyze(size_t) const;
+
+      const AclClassifierRule& getRule(size_t) const;
+      size_t getRuleCount() const;
+      size_t getEntryCount() const;
+      bool isCompiled() const;
+  };
+}
+#endif // ACL_CLASSIFIER_HPP
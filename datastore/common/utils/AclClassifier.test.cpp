@@ -0,0 +1,402 @@
+// =============================================================================
+// Copyright 2023 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+// =============================================================================
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+#include <boost/test/unit_test.hpp>
+
+#include <netmeld/datastore/utils/AclClassifier.hpp>
+
+namespace nmdu = netmeld::datastore::utils;
+
+
+nmdu::AclFlow
+makeFlow(const std::string& _srcIp, const std::string& _dstIp,
+         const std::string& _protocol, uint16_t _srcPort, uint16_t _dstPort)
+{
+  nmdu::AclFlow flow;
+  flow.srcIp    = nmdu::IpKey::fromString(_srcIp);
+  flow.dstIp    = nmdu::IpKey::fromString(_dstIp);
+  flow.protocol = _protocol;
+  flow.srcPort  = _srcPort;
+  flow.dstPort  = _dstPort;
+  return flow;
+}
+
+BOOST_AUTO_TEST_CASE(testToIpRange)
+{
+  nmdu::IpKey first, last;
+
+  BOOST_TEST(nmdu::AclClassifier::toIpRange("10.1.2.3/8", first, last));
+  BOOST_TEST((first == nmdu::IpKey::fromString("10.0.0.0")));
+  BOOST_TEST((last == nmdu::IpKey::fromString("10.255.255.255")));
+
+  BOOST_TEST(nmdu::AclClassifier::toIpRange("10.1.2.3", first, last));
+  BOOST_TEST((first == last));
+
+  BOOST_TEST(nmdu::AclClassifier::toIpRange("0.0.0.0/0", first, last));
+  BOOST_TEST((last == nmdu::IpKey::fromString("255.255.255.255")));
+
+  BOOST_TEST(nmdu::AclClassifier::toIpRange("fe80::/10", first, last));
+  BOOST_TEST((first == nmdu::IpKey::fromString("fe80::")));
+  BOOST_TEST((last == nmdu::IpKey::fromString(
+                        "febf:ffff:ffff:ffff:ffff:ffff:ffff:ffff")));
+
+  BOOST_TEST(!nmdu::AclClassifier::toIpRange("10.1.2.3/33", first, last));
+  BOOST_TEST(!nmdu::AclClassifier::toIpRange("10.1.2.3/", first, last));
+  BOOST_TEST(!nmdu::AclClassifier::toIpRange("bad/8", first, last));
+}
+
+BOOST_AUTO_TEST_CASE(testClassifyFirstMatch)
+{
+  nmdu::AclClassifier acl;
+
+  // Added out of order, priority decides
+  const auto deny  {acl.addRule({20, "block", "deny web"})};
+  acl.addSrcIpNet(deny, "0.0.0.0/0");
+  acl.addDstIpNet(deny, "10.0.0.0/8");
+  acl.addService(deny, "tcp", 0, 65535, 80, 80);
+
+  const auto allow {acl.addRule({10, "allow", "allow host"})};
+  acl.addSrcIpNet(allow, "192.168.1.10/32");
+  acl.addDstIpNet(allow, "10.1.0.0/16");
+  acl.addService(allow, "tcp", 0, 65535, 80, 443);
+
+  const auto any   {acl.addRule({30, "allow", "allow rest"})};
+  acl.addSrcIpNet(any, "0.0.0.0/0");
+  acl.addDstIpNet(any, "0.0.0.0/0");
+  acl.addService(any, "any", 0, 65535, 0, 65535);
+
+  BOOST_TEST(!acl.isCompiled());
+  BOOST_CHECK_THROW(acl.classify(makeFlow("1.1.1.1", "2.2.2.2", "tcp", 1, 2)),
+                    std::logic_error);
+  acl.compile();
+  BOOST_TEST(acl.isCompiled());
+  BOOST_TEST(3 == acl.getRuleCount());
+  BOOST_TEST(3 == acl.getEntryCount());
+
+  auto match {acl.classify(makeFlow("192.168.1.10", "10.1.2.3", "tcp",
+                                    1024, 80))};
+  BOOST_TEST((match && allow == *match));
+  BOOST_TEST("allow host" == acl.getRule(*match).description);
+
+  match = acl.classify(makeFlow("192.168.1.11", "10.1.2.3", "TCP", 1024, 80));
+  BOOST_TEST((match && deny == *match));
+
+  match = acl.classify(makeFlow("192.168.1.11", "10.1.2.3", "tcp", 1024, 81));
+  BOOST_TEST((match && any == *match));
+
+  match = acl.classify(makeFlow("192.168.1.11", "10.1.2.3", "udp", 1024, 80));
+  BOOST_TEST((match && any == *match));
+
+  match = acl.classify(makeFlow("192.168.1.10", "10.2.0.1", "tcp", 1024, 443));
+  BOOST_TEST((match && any == *match));
+
+  // No IPv6 rules, and mixed families never match
+  BOOST_TEST(!acl.classify(makeFlow("fe80::1", "fe80::2", "tcp", 1, 80)));
+  BOOST_TEST(!acl.classify(makeFlow("10.0.0.1", "fe80::2", "tcp", 1, 80)));
+}
+
+BOOST_AUTO_TEST_CASE(testClassifyDimensions)
+{
+  nmdu::AclClassifier acl;
+
+  const auto v6 {acl.addRule({1, "allow", ""})};
+  acl.addSrcIpNet(v6, "fe80::/10");
+  acl.addDstIpNet(v6, "::/0");
+  acl.addService(v6, "udp", 0, 65535, 53, 53);
+  acl.addService(v6, "tcp", 0, 65535, 53, 53);
+
+  const auto iface {acl.addRule({2, "deny", ""})};
+  acl.addSrcIpNet(iface, "0.0.0.0/0");
+  acl.addSrcIpNet(iface, "::/0");
+  acl.addDstIpNet(iface, "0.0.0.0/0");
+  acl.addDstIpNet(iface, "::/0");
+  acl.addService(iface, "ip", 0, 65535, 0, 65535);
+  acl.addIncomingIface(iface, "Eth0");
+
+  const auto srcPort {acl.addRule({3, "allow", ""})};
+  acl.addSrcIpNet(srcPort, "255.255.255.255");
+  acl.addDstIpNet(srcPort, "0.0.0.0/0");
+  acl.addService(srcPort, "udp", 67, 68, 0, 65535);
+
+  acl.compile();
+  BOOST_TEST(4 == acl.getEntryCount());
+
+  auto match {acl.classify(makeFlow("fe80::1", "2001:db8::1", "tcp", 1, 53))};
+  BOOST_TEST((match && v6 == *match));
+  match = acl.classify(makeFlow("fe80::1", "2001:db8::1", "icmp", 1, 53));
+  BOOST_TEST((match && iface == *match));
+
+  // Unspecified flow interfaces match any rule interface
+  auto flow {makeFlow("2001:db8::1", "fe80::1", "icmp", 0, 0)};
+  match = acl.classify(flow);
+  BOOST_TEST((match && iface == *match));
+  flow.incomingIface = "eth0";
+  match = acl.classify(flow);
+  BOOST_TEST((match && iface == *match));
+  flow.incomingIface = "eth1";
+  BOOST_TEST(!acl.classify(flow));
+
+  flow = makeFlow("255.255.255.255", "10.0.0.1", "udp", 68, 9);
+  flow.incomingIface = "eth1";
+  match = acl.classify(flow);
+  BOOST_TEST((match && srcPort == *match));
+  flow.srcPort = 69;
+  BOOST_TEST(!acl.classify(flow));
+}
+
+BOOST_AUTO_TEST_CASE(testClassifyRange)
+{
+  nmdu::AclClassifier acl;
+
+  const auto deny {acl.addRule({1, "deny", ""})};
+  acl.addSrcIpNet(deny, "10.0.0.128/25");
+  acl.addDstIpNet(deny, "0.0.0.0/0");
+  acl.addService(deny, "tcp", 0, 65535, 22, 22);
+
+  const auto allow {acl.addRule({2, "allow", ""})};
+  acl.addSrcIpNet(allow, "10.0.0.0/8");
+  acl.addDstIpNet(allow, "0.0.0.0/0");
+  acl.addService(allow, "tcp", 0, 65535, 0, 65535);
+
+  acl.compile();
+
+  nmdu::AclFlowRange range;
+  range.protocol = "tcp";
+  nmdu::AclClassifier::toIpRange("10.0.0.0/25", range.srcIpFirst,
+                                 range.srcIpLast);
+  nmdu::AclClassifier::toIpRange("0.0.0.0/0", range.dstIpFirst,
+                                 range.dstIpLast);
+
+  auto result {acl.classify(range)};
+  BOOST_TEST(result.anyAllowed);
+  BOOST_TEST(result.allAllowed);
+  BOOST_TEST(!result.anyNoMatch);
+  BOOST_TEST((std::set<size_t>{allow} == result.ruleIds));
+
+  nmdu::AclClassifier::toIpRange("10.0.0.0/24", range.srcIpFirst,
+                                 range.srcIpLast);
+  result = acl.classify(range);
+  BOOST_TEST(result.anyAllowed);
+  BOOST_TEST(!result.allAllowed);
+  BOOST_TEST((std::set<size_t>{deny, allow} == result.ruleIds));
+
+  range.dstPortFirst = range.dstPortLast = 22;
+  nmdu::AclClassifier::toIpRange("10.0.0.128/25", range.srcIpFirst,
+                                 range.srcIpLast);
+  result = acl.classify(range);
+  BOOST_TEST(!result.anyAllowed);
+  BOOST_TEST((std::set<size_t>{deny} == result.ruleIds));
+
+  // Any protocol covers tcp and everything else, which nothing matches
+  range.protocol = "any";
+  result = acl.classify(range);
+  BOOST_TEST(!result.anyAllowed);
+  BOOST_TEST(result.anyNoMatch);
+
+  nmdu::AclClassifier::toIpRange("0.0.0.0/0", range.srcIpFirst,
+                                 range.srcIpLast);
+  range.protocol = "tcp";
+  range.dstPortFirst = 0;
+  range.dstPortLast  = 65535;
+  result = acl.classify(range);
+  BOOST_TEST(result.anyAllowed);
+  BOOST_TEST(result.anyNoMatch);
+  BOOST_TEST(!result.allAllowed);
+}
+
+BOOST_AUTO_TEST_CASE(testClassifyRangeInterfaces)
+{
+  nmdu::AclClassifier acl;
+
+  const auto allow {acl.addRule({1, "allow", ""})};
+  acl.addSrcIpNet(allow, "0.0.0.0/0");
+  acl.addDstIpNet(allow, "0.0.0.0/0");
+  acl.addService(allow, "any", 0, 65535, 0, 65535);
+  acl.addIncomingIface(allow, "eth0");
+
+  acl.compile();
+
+  nmdu::AclFlowRange range;
+  nmdu::AclClassifier::toIpRange("0.0.0.0/0", range.srcIpFirst,
+                                 range.srcIpLast);
+  nmdu::AclClassifier::toIpRange("0.0.0.0/0", range.dstIpFirst,
+                                 range.dstIpLast);
+
+  // Unspecified interfaces span eth0 and every other interface
+  auto result {acl.classify(range)};
+  BOOST_TEST(result.anyAllowed);
+  BOOST_TEST(!result.allAllowed);
+  BOOST_TEST(result.anyNoMatch);
+
+  range.incomingIface = "eth0";
+  result = acl.classify(range);
+  BOOST_TEST(result.allAllowed);
+}
+
+BOOST_AUTO_TEST_CASE(testAnalyze)
+{
+  nmdu::AclClassifier acl;
+
+  const auto web {acl.addRule({1, "allow", ""})};
+  acl.addSrcIpNet(web, "10.0.0.0/8");
+  acl.addDstIpNet(web, "192.168.0.0/24");
+  acl.addService(web, "tcp", 0, 65535, 80, 80);
+
+  const auto ssh {acl.addRule({2, "block", ""})};
+  acl.addSrcIpNet(ssh, "10.0.0.0/9");
+  acl.addSrcIpNet(ssh, "10.128.0.0/9");
+  acl.addDstIpNet(ssh, "192.168.0.0/24");
+  acl.addService(ssh, "tcp", 0, 65535, 22, 22);
+
+  // Covered by web alone, same action
+  const auto redundant {acl.addRule({3, "allow", ""})};
+  acl.addSrcIpNet(redundant, "10.1.0.0/16");
+  acl.addDstIpNet(redundant, "192.168.0.10");
+  acl.addService(redundant, "tcp", 1024, 65535, 80, 80);
+
+  // Covered by web and ssh together, which differ in action
+  const auto shadowed {acl.addRule({4, "allow", ""})};
+  acl.addSrcIpNet(shadowed, "10.0.0.0/8");
+  acl.addDstIpNet(shadowed, "192.168.0.0/25");
+  acl.addService(shadowed, "tcp", 0, 65535, 22, 22);
+  acl.addService(shadowed, "tcp", 0, 65535, 80, 80);
+
+  // Partly overlaps ssh, a different action
+  const auto correlated {acl.addRule({5, "allow", ""})};
+  acl.addSrcIpNet(correlated, "0.0.0.0/0");
+  acl.addDstIpNet(correlated, "192.168.0.0/16");
+  acl.addService(correlated, "tcp", 0, 65535, 22, 22);
+
+  const auto disjoint {acl.addRule({6, "allow", ""})};
+  acl.addSrcIpNet(disjoint, "fe80::/10");
+  acl.addDstIpNet(disjoint, "fe80::/10");
+  acl.addService(disjoint, "tcp", 0, 65535, 80, 80);
+
+  acl.compile();
+
+  auto result {acl.analyze(web)};
+  BOOST_TEST(!result.isCovered);
+  BOOST_TEST(!result.isRedundant);
+  BOOST_TEST(result.coveringRuleIds.empty());
+  BOOST_TEST(result.conflictingRuleIds.empty());
+
+  result = acl.analyze(redundant);
+  BOOST_TEST(result.isCovered);
+  BOOST_TEST(result.isRedundant);
+  BOOST_TEST((std::set<size_t>{web} == result.coveringRuleIds));
+  BOOST_TEST(result.conflictingRuleIds.empty());
+
+  result = acl.analyze(shadowed);
+  BOOST_TEST(result.isCovered);
+  BOOST_TEST(!result.isRedundant);
+  BOOST_TEST((std::set<size_t>{web, ssh} == result.coveringRuleIds));
+  BOOST_TEST((std::set<size_t>{ssh} == result.conflictingRuleIds));
+
+  result = acl.analyze(correlated);
+  BOOST_TEST(!result.isCovered);
+  BOOST_TEST((std::set<size_t>{ssh} == result.conflictingRuleIds));
+
+  result = acl.analyze(disjoint);
+  BOOST_TEST(!result.isCovered);
+  BOOST_TEST(result.conflictingRuleIds.empty());
+}
+
+BOOST_AUTO_TEST_CASE(testAnalyzeCoveringActions)
+{
+  nmdu::AclClassifier acl;
+
+  const auto first {acl.addRule({0, "permit", ""})};
+  acl.addSrcIpNet(first, "10.0.0.0/8");
+  acl.addDstIpNet(first, "0.0.0.0/0");
+  acl.addService(first, "any", 0, 65535, 0, 65535);
+
+  // Never first matches, yet overlaps the last rule with another action
+  const auto middle {acl.addRule({1, "deny", ""})};
+  acl.addSrcIpNet(middle, "10.0.0.0/16");
+  acl.addDstIpNet(middle, "0.0.0.0/0");
+  acl.addService(middle, "any", 0, 65535, 0, 65535);
+
+  const auto last {acl.addRule({2, "permit", ""})};
+  acl.addSrcIpNet(last, "10.0.0.0/8");
+  acl.addDstIpNet(last, "0.0.0.0/0");
+  acl.addService(last, "any", 0, 65535, 0, 65535);
+
+  acl.compile();
+
+  auto result {acl.analyze(middle)};
+  BOOST_TEST(result.isCovered);
+  BOOST_TEST(!result.isRedundant);
+  BOOST_TEST((std::set<size_t>{first} == result.coveringRuleIds));
+
+  // Redundant: only the first rule, same action, ever matches before it
+  result = acl.analyze(last);
+  BOOST_TEST(result.isCovered);
+  BOOST_TEST(result.isRedundant);
+  BOOST_TEST((std::set<size_t>{first} == result.coveringRuleIds));
+  BOOST_TEST((std::set<size_t>{middle} == result.conflictingRuleIds));
+}
+
+BOOST_AUTO_TEST_CASE(testCartesianRows)
+{
+  nmdu::AclClassifier acl;
+
+  // As fromDatastore() regroups them: one row per combination of a rule's
+  // networks and services, each adding all of its values again
+  const auto multi {acl.addRule({1, "allow", "multi"})};
+  for (const auto& src : {"10.0.0.0/8", "172.16.0.0/12"}) {
+    for (const auto& dst : {"192.168.1.0/24", "192.168.2.0/24"}) {
+      for (const uint16_t port : {22, 80}) {
+        BOOST_TEST(acl.addSrcIpNet(multi, src));
+        BOOST_TEST(acl.addDstIpNet(multi, dst));
+        acl.addService(multi, "tcp", 0, 65535, port, port);
+      }
+    }
+  }
+
+  const auto rest {acl.addRule({2, "block", "rest"})};
+  acl.addSrcIpNet(rest, "0.0.0.0/0");
+  acl.addDstIpNet(rest, "0.0.0.0/0");
+  acl.addService(rest, "any", 0, 65535, 0, 65535);
+
+  acl.compile();
+  BOOST_TEST(2 == acl.getRuleCount());
+  BOOST_TEST(3 == acl.getEntryCount());
+
+  auto match {acl.classify(makeFlow("172.16.1.1", "192.168.2.1", "tcp",
+                                    1024, 80))};
+  BOOST_TEST((match && multi == *match));
+  match = acl.classify(makeFlow("10.1.1.1", "192.168.1.1", "tcp", 1024, 22));
+  BOOST_TEST((match && multi == *match));
+  match = acl.classify(makeFlow("10.1.1.1", "192.168.3.1", "tcp", 1024, 22));
+  BOOST_TEST((match && rest == *match));
+
+  // Repeated values leave a rule covering only itself
+  auto result {acl.analyze(multi)};
+  BOOST_TEST(!result.isCovered);
+  BOOST_TEST(result.coveringRuleIds.empty());
+}
@@ -0,0 +1,164 @@
+// =============================================================================
+// Copyright 2023 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+// =============================================================================
+
+#include <arpa/inet.h>
+#include <cstring>
+
+#include <netmeld/datastore/utils/AddressKeys.hpp>
+
+
+namespace {
+  // Finalizer from splitmix64, spreads all input bits across the output
+  uint64_t
+  mix(uint64_t x)
+  {
+    x ^= x >> 30;
+    x *= 0xbf58476d1ce4e5b9ULL;
+    x ^= x >> 27;
+    x *= 0x94d049bb133111ebULL;
+    x ^= x >> 31;
+    return x;
+  }
+
+  int
+  hexValue(char c)
+  {
+    if ('0' <= c && c <= '9') { return c - '0'; }
+    if ('a' <= c && c <= 'f') { return c - 'a' + 10; }
+    if ('A' <= c && c <= 'F') { return c - 'A' + 10; }
+    return -1;
+  }
+}
+
+namespace netmeld::datastore::utils {
+
+  // ===========================================================================
+  // IpKey
+  // ===========================================================================
+  IpKey
+  IpKey::fromBytes(const uint8_t* _bytes, size_t _length)
+  {
+    IpKey key;
+    if (4 == _length || 16 == _length) {
+      std::memcpy(key.bytes.data(), _bytes, _length);
+      key.family = (4 == _length) ? 4 : 6;
+    }
+    return key;
+  }
+
+  IpKey
+  IpKey::fromString(const std::string& _ip)
+  {
+    IpKey key;
+    if (1 == inet_pton(AF_INET, _ip.c_str(), key.bytes.data())) {
+      key.family = 4;
+    } else if (1 == inet_pton(AF_INET6, _ip.c_str(), key.bytes.data())) {
+      key.family = 6;
+    } else {
+      key.bytes.fill(0);
+    }
+    return key;
+  }
+
+  bool
+  IpKey::isValid() const
+  {
+    return 0 != family;
+  }
+
+  nmdo::IpAddress
+  IpKey::toIpAddress() const
+  {
+    if (!isValid()) {
+      return nmdo::IpAddress();
+    }
+    const size_t length {(4 == family) ? 4U : 16U};
+    return nmdo::IpAddress(
+        std::vector<uint8_t>(bytes.begin(), bytes.begin() + length));
+  }
+
+
+  // ===========================================================================
+  // MacKey
+  // ===========================================================================
+  MacKey
+  MacKey::fromBytes(const uint8_t* _bytes)
+  {
+    MacKey key;
+    std::memcpy(key.bytes.data(), _bytes, key.bytes.size());
+    return key;
+  }
+
+  bool
+  MacKey::fromString(const std::string& _mac, MacKey& _key)
+  {
+    // xx:xx:xx:xx:xx:xx
+    if (17 != _mac.size()) {
+      return false;
+    }
+    for (size_t i {0}; i < 6; ++i) {
+      const auto hi {hexValue(_mac[i*3])};
+      const auto lo {hexValue(_mac[i*3 + 1])};
+      if (0 > hi || 0 > lo) {
+        return false;
+      }
+      if (5 > i && ':' != _mac[i*3 + 2] && '-' != _mac[i*3 + 2]) {
+        return false;
+      }
+      _key.bytes[i] = static_cast<uint8_t>((hi << 4) | lo);
+    }
+    return true;
+  }
+
+  nmdo::MacAddress
+  MacKey::toMacAddress() const
+  {
+    return nmdo::MacAddress(std::vector<uint8_t>(bytes.begin(), bytes.end()));
+  }
+}
+
+
+// =============================================================================
+// Hashing
+// =============================================================================
+size_t
+std::hash<netmeld::datastore::utils::IpKey>::operator()(
+    const netmeld::datastore::utils::IpKey& _key) const noexcept
+{
+  uint64_t hi, lo;
+  std::memcpy(&hi, _key.bytes.data(), sizeof(hi));
+  std::memcpy(&lo, _key.bytes.data() + sizeof(hi), sizeof(lo));
+  return static_cast<size_t>(mix(hi ^ mix(lo ^ _key.family)));
+}
+
+size_t
+std::hash<netmeld::datastore::utils::MacKey>::operator()(
+    const netmeld::datastore::utils::MacKey& _key) const noexcept
+{
+  uint64_t value {0};
+  std::memcpy(&value, _key.bytes.data(), _key.bytes.size());
+  return static_cast<size_t>(mix(value));
+}
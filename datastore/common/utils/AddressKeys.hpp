@@ -0,0 +1,88 @@
+// =============================================================================
+// Copyright 2023 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+// =============================================================================
+
+#ifndef ADDRESS_KEYS_HPP
+#define ADDRESS_KEYS_HPP
+
+#include <array>
+#include <compare>
+#include <cstdint>
+#include <functional>
+#include <string>
+
+#include <netmeld/datastore/objects/IpAddress.hpp>
+#include <netmeld/datastore/objects/MacAddress.hpp>
+
+namespace nmdo = netmeld::datastore::objects;
+
+
+namespace netmeld::datastore::utils {
+
+  /* Fixed size, trivially copyable address keys for aggregation tables.
+
+     Building and comparing these never allocates, unlike the IpAddress and
+     MacAddress objects, so they suit per-packet lookups; convert to the
+     objects once when saving.
+  */
+  struct IpKey {
+    std::array<uint8_t, 16> bytes  {}; // IPv4 uses the first four
+    uint8_t                 family {0}; // 4, 6, or 0 if invalid
+
+    // Length must be 4 or 16, otherwise the key is invalid
+    static IpKey fromBytes(const uint8_t*, size_t);
+    static IpKey fromString(const std::string&);
+
+    bool isValid() const;
+    nmdo::IpAddress toIpAddress() const;
+
+    auto operator<=>(const IpKey&) const = default;
+    bool operator==(const IpKey&) const = default;
+  };
+
+  struct MacKey {
+    std::array<uint8_t, 6> bytes {};
+
+    static MacKey fromBytes(const uint8_t*);
+    // Accepts colon or hyphen separated hex; false if malformed
+    static bool fromString(const std::string&, MacKey&);
+
+    nmdo::MacAddress toMacAddress() const;
+
+    auto operator<=>(const MacKey&) const = default;
+    bool operator==(const MacKey&) const = default;
+  };
+}
+
+template<>
+struct std::hash<netmeld::datastore::utils::IpKey> {
+  size_t operator()(const netmeld::datastore::utils::IpKey&) const noexcept;
+};
+
+template<>
+struct std::hash<netmeld::datastore::utils::MacKey> {
+  size_t operator()(const netmeld::datastore::utils::MacKey&) const noexcept;
+};
+#endif // ADDRESS_KEYS_HPP
@@ -0,0 +1,131 @@
+// =============================================================================
+// Copyright 2023 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+// =============================================================================
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+
+#include <boost/test/unit_test.hpp>
+
+#include <netmeld/core/utils/FlatHashMap.hpp>
+#include <netmeld/datastore/utils/AddressKeys.hpp>
+
+namespace nmcu = netmeld::core::utils;
+namespace nmdu = netmeld::datastore::utils;
+
+
+BOOST_AUTO_TEST_CASE(testIpKey)
+{
+  {
+    nmdu::IpKey key;
+    BOOST_TEST(!key.isValid());
+    BOOST_TEST(!key.toIpAddress().isValid());
+  }
+
+  {
+    const uint8_t bytes[] {10, 1, 2, 3};
+    auto key {nmdu::IpKey::fromBytes(bytes, sizeof(bytes))};
+    BOOST_TEST(key.isValid());
+    BOOST_TEST(4 == key.family);
+    BOOST_TEST("10.1.2.3/32" == key.toIpAddress().toString());
+    BOOST_TEST((key == nmdu::IpKey::fromString("10.1.2.3")));
+  }
+
+  {
+    auto key {nmdu::IpKey::fromString("fe80::1")};
+    BOOST_TEST(key.isValid());
+    BOOST_TEST(6 == key.family);
+    BOOST_TEST("fe80::1/128" == key.toIpAddress().toString());
+
+    const uint8_t bytes[16] {0xfe, 0x80, 0,0,0,0,0,0,0,0,0,0,0,0,0, 1};
+    BOOST_TEST((key == nmdu::IpKey::fromBytes(bytes, sizeof(bytes))));
+  }
+
+  { // v4 and v6 with the same leading bytes differ
+    const uint8_t bytes[16] {10, 1, 2, 3};
+    BOOST_TEST((nmdu::IpKey::fromBytes(bytes, 4)
+                != nmdu::IpKey::fromBytes(bytes, 16)));
+  }
+
+  {
+    BOOST_TEST(!nmdu::IpKey::fromString("").isValid());
+    BOOST_TEST(!nmdu::IpKey::fromString("10.1.2").isValid());
+    BOOST_TEST(!nmdu::IpKey::fromString("host.local").isValid());
+    const uint8_t bytes[] {10, 1, 2, 3, 4};
+    BOOST_TEST(!nmdu::IpKey::fromBytes(bytes, sizeof(bytes)).isValid());
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testMacKey)
+{
+  {
+    const uint8_t bytes[] {0x00, 0x11, 0x22, 0xaa, 0xbb, 0xcc};
+    auto key {nmdu::MacKey::fromBytes(bytes)};
+    BOOST_TEST("00:11:22:aa:bb:cc" == key.toMacAddress().toString());
+
+    nmdu::MacKey parsed;
+    BOOST_TEST(nmdu::MacKey::fromString("00:11:22:AA:bb:cc", parsed));
+    BOOST_TEST((key == parsed));
+    BOOST_TEST(nmdu::MacKey::fromString("00-11-22-aa-bb-cc", parsed));
+    BOOST_TEST((key == parsed));
+  }
+
+  {
+    nmdu::MacKey key;
+    BOOST_TEST(!nmdu::MacKey::fromString("", key));
+    BOOST_TEST(!nmdu::MacKey::fromString("00:11:22:aa:bb", key));
+    BOOST_TEST(!nmdu::MacKey::fromString("00:11:22:aa:bb:cg", key));
+    BOOST_TEST(!nmdu::MacKey::fromString("00:11:22:aa:bb:cc:", key));
+    BOOST_TEST(!nmdu::MacKey::fromString("00.11.22.aa.bb.cc", key));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testHashing)
+{
+  {
+    std::hash<nmdu::IpKey> hasher;
+    BOOST_TEST(hasher(nmdu::IpKey::fromString("10.1.2.3"))
+               == hasher(nmdu::IpKey::fromString("10.1.2.3")));
+    BOOST_TEST(hasher(nmdu::IpKey::fromString("10.1.2.3"))
+               != hasher(nmdu::IpKey::fromString("10.1.2.4")));
+  }
+
+  {
+    nmcu::FlatHashMap<nmdu::IpKey, size_t> ips;
+    nmcu::FlatHashMap<nmdu::MacKey, size_t> macs;
+    for (uint8_t i {0}; i < 200; ++i) {
+      const uint8_t ip[] {10, 0, i, 1};
+      const uint8_t mac[] {0, 0, 0, 0, i, 1};
+      ++ips[nmdu::IpKey::fromBytes(ip, sizeof(ip))];
+      ++ips[nmdu::IpKey::fromBytes(ip, sizeof(ip))];
+      ++macs[nmdu::MacKey::fromBytes(mac)];
+    }
+    BOOST_TEST(200 == ips.size());
+    BOOST_TEST(200 == macs.size());
+    for (const auto& [key, count] : ips) {
+      BOOST_TEST(2 == count);
+    }
+  }
+}
@@ -0,0 +1,322 @@
+// =============================================================================
+// Copyright 2023 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+// =============================================================================
+
+#include <cctype>
+#include <map>
+#include <mutex>
+#include <tuple>
+#include <utility>
+
+#include <netmeld/core/utils/LoggerSingleton.hpp>
+#include <netmeld/datastore/utils/BulkRowSink.hpp>
+
+
+namespace netmeld::datastore::utils {
+
+  // ===========================================================================
+  // Helpers
+  // ===========================================================================
+  static std::map<const pqxx::transaction_base*, BulkRowSink*> sinks;
+  static std::mutex sinksMutex;
+
+  static const std::map<std::string, size_t>&
+  bulkStatementIndexes()
+  {
+    static const std::map<std::string, size_t> indexes {[](){
+      std::map<std::string, size_t> tmp;
+      const auto& statements {dbBulkStatements()};
+      for (size_t i {0}; i < statements.size(); ++i) {
+        tmp.emplace(statements[i].name, i);
+      }
+      return tmp;
+    }()};
+
+    return indexes;
+  }
+
+  // Lower cased words (identifiers, keywords, numbers) of a statement
+  static std::vector<std::string>
+  sqlWords(const std::string& sql)
+  {
+    std::vector<std::string> words;
+    std::string word;
+    for (const char c : sql) {
+      const auto uc {static_cast<unsigned char>(c)};
+      if (std::isalnum(uc) || '_' == c) {
+        word.push_back(static_cast<char>(std::tolower(uc)));
+      } else if (!word.empty()) {
+        words.push_back(word);
+        word.clear();
+      }
+    }
+    if (!word.empty()) {
+      words.push_back(word);
+    }
+    return words;
+  }
+
+  static const std::vector<std::string>&
+  bulkTargetTables()
+  {
+    static const std::vector<std::string> tables {[](){
+      std::vector<std::string> tmp;
+      for (const auto& statement : dbBulkStatements()) {
+        tmp.push_back(BulkRowSink::targetTable(statement));
+      }
+      return tmp;
+    }()};
+
+    return tables;
+  }
+
+  // stream_to accepts tuples, so expand the row into one of matching arity
+  template<size_t... I>
+  static void
+  streamRow(pqxx::stream_to& stream, const std::vector<std::string>& row,
+            std::index_sequence<I...>)
+  {
+    stream << std::make_tuple(row[I]...);
+  }
+
+  template<size_t N=1>
+  static void
+  streamRow(pqxx::stream_to& stream, const std::vector<std::string>& row)
+  {
+    if constexpr (N > 16) {
+      throw std::length_error("BulkRowSink row exceeds supported width");
+    } else {
+      if (N == row.size()) {
+        streamRow(stream, row, std::make_index_sequence<N>{});
+      } else {
+        streamRow<N+1>(stream, row);
+      }
+    }
+  }
+
+
+  // ===========================================================================
+  // Constructors
+  // ===========================================================================
+  BulkRowSink::BulkRowSink(pqxx::transaction_base& _t, size_t _maxRows) :
+    t(_t),
+    maxRows(_maxRows),
+    rows(dbBulkStatements().size()),
+    stagingCreated(dbBulkStatements().size(), false)
+  {
+    std::lock_guard<std::mutex> lock(sinksMutex);
+    sinks[&t] = this;
+  }
+
+  BulkRowSink::~BulkRowSink()
+  {
+    if (0 != numRows) {
+      LOG_WARN << "BulkRowSink discarding " << numRows
+               << " unflushed rows" << std::endl;
+    }
+
+    std::lock_guard<std::mutex> lock(sinksMutex);
+    sinks.erase(&t);
+  }
+
+
+  // ===========================================================================
+  // Methods
+  // ===========================================================================
+  BulkRowSink*
+  BulkRowSink::find(const pqxx::transaction_base& _t)
+  {
+    std::lock_guard<std::mutex> lock(sinksMutex);
+    const auto& it {sinks.find(&_t)};
+    return (sinks.end() == it) ? nullptr : it->second;
+  }
+
+  bool
+  BulkRowSink::mustFlushBefore(
+      const std::string& sql,
+      const std::set<std::string>& tables,
+      const std::multimap<std::string, std::string>& foreignKeys)
+  {
+    if (tables.empty()) { return false; }
+
+    const auto& words {sqlWords(sql)};
+    std::string target;
+    bool isDelete {false};
+    if (3 <= words.size() && "insert" == words[0] && "into" == words[1]) {
+      target   = words[2];
+    } else if (2 <= words.size() && "update" == words[0]) {
+      target   = words[1];
+    } else if (3 <= words.size() && "delete" == words[0] && "from" == words[1]) {
+      target   = words[2];
+      isDelete = true;
+    } else {
+      return true;
+    }
+
+    for (const auto& word : words) {
+      if (tables.count(word)) { return true; }
+    }
+    for (const auto& [referencing, referenced] : foreignKeys) {
+      // Written rows may reference buffered rows
+      if (target == referencing && tables.count(referenced)) {
+        return true;
+      }
+      // Removed rows may be referenced by buffered rows
+      if (isDelete && target == referenced && tables.count(referencing)) {
+        return true;
+      }
+    }
+
+    return false;
+  }
+
+  std::string
+  BulkRowSink::targetTable(const BulkStatement& statement)
+  {
+    const auto& words {sqlWords(statement.mergeQuery)};
+    for (size_t i {0}; i + 2 < words.size(); ++i) {
+      if ("insert" == words[i] && "into" == words[i+1]) {
+        return words[i+2];
+      }
+    }
+    return "";
+  }
+
+  bool
+  BulkRowSink::add(const std::string& name, std::vector<std::string>&& row)
+  {
+    const auto& indexes {bulkStatementIndexes()};
+    const auto& it {indexes.find(name)};
+    if (indexes.end() == it
+        || dbBulkStatements()[it->second].numParams != row.size())
+    {
+      return false;
+    }
+
+    rows[it->second].emplace_back(std::move(row));
+    ++numRows;
+
+    if (numRows >= maxRows) {
+      flush();
+    }
+
+    return true;
+  }
+
+  void
+  BulkRowSink::flush()
+  {
+    if (0 == numRows) { return; }
+
+    const auto& statements {dbBulkStatements()};
+    for (size_t i {0}; i < statements.size(); ++i) {
+      auto& stmtRows {rows[i]};
+      if (stmtRows.empty()) { continue; }
+
+      const auto& statement {statements[i]};
+      LOG_DEBUG << "BulkRowSink flushing " << stmtRows.size()
+                << " rows for " << statement.name << std::endl;
+
+      stage(i);
+      {
+        pqxx::stream_to stream {t, statement.stagingTable};
+        for (const auto& row : stmtRows) {
+          streamRow(stream, row);
+        }
+        stream.complete();
+      }
+      t.exec(statement.mergeQuery);
+      t.exec("TRUNCATE " + statement.stagingTable);
+
+      stmtRows.clear();
+    }
+
+    numRows = 0;
+  }
+
+  void
+  BulkRowSink::flushBefore(const std::string& name)
+  {
+    if (0 == numRows) { return; }
+
+    std::set<std::string> tables;
+    const auto& targets {bulkTargetTables()};
+    for (size_t i {0}; i < targets.size(); ++i) {
+      if (!rows[i].empty()) {
+        tables.insert(targets[i]);
+      }
+    }
+
+    // Statements prepared outside a registry are of unknown effect
+    const auto* sql {findStatement(t.conn(), name)};
+    if (nullptr == sql || mustFlushBefore(*sql, tables, getForeignKeys())) {
+      flush();
+    }
+  }
+
+  const std::multimap<std::string, std::string>&
+  BulkRowSink::getForeignKeys()
+  {
+    if (!foreignKeys) {
+      foreignKeys.emplace();
+      const auto& result {t.exec(
+          "SELECT conrelid::REGCLASS::TEXT, confrelid::REGCLASS::TEXT"
+          " FROM pg_catalog.pg_constraint"
+          " WHERE (contype = 'f')")};
+      for (const auto& row : result) {
+        foreignKeys->emplace(row[0].as<std::string>(),
+                             row[1].as<std::string>());
+      }
+    }
+
+    return *foreignKeys;
+  }
+
+  size_t
+  BulkRowSink::pending() const
+  {
+    return numRows;
+  }
+
+  void
+  BulkRowSink::stage(size_t index)
+  {
+    if (stagingCreated[index]) { return; }
+
+    const auto& statement {dbBulkStatements()[index]};
+
+    std::ostringstream oss;
+    oss << "CREATE TEMP TABLE IF NOT EXISTS " << statement.stagingTable
+        << " (";
+    for (size_t i {1}; i <= statement.numParams; ++i) {
+      if (1 != i) { oss << ", "; }
+      oss << 'c' << i << " TEXT";
+    }
+    oss << ") ON COMMIT DROP";
+
+    t.exec(oss.str());
+    stagingCreated[index] = true;
+  }
+}
@@ -0,0 +1,127 @@
+// =============================================================================
+// Copyright 2023 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+// =============================================================================
+
+#ifndef BULK_ROW_SINK_HPP
+#define BULK_ROW_SINK_HPP
+
+#include <map>
+#include <optional>
+#include <set>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <pqxx/pqxx>
+
+#include <netmeld/datastore/utils/QueriesCommon.hpp>
+
+
+namespace netmeld::datastore::utils {
+
+  /* Per-transaction buffer of rows destined for prepared INSERT statements.
+
+     While a sink is attached to a transaction, execPrepared() diverts calls
+     for any statement listed in dbBulkStatements() into the sink instead of
+     issuing one round trip per row.  Buffered rows are COPY'd into staging
+     tables and merged into the real tables, in dependency order, when:
+     - a statement which is not bulk capable is executed via execPrepared()
+       and needs the buffered rows (see mustFlushBefore()), so reads see them
+       and foreign keys to them are satisfied,
+     - the buffered row count exceeds the configured limit, or
+     - flush() is called (which must occur before commit).
+  */
+  class BulkRowSink {
+    // =========================================================================
+    // Variables
+    // =========================================================================
+    private:
+      pqxx::transaction_base& t;
+
+      size_t maxRows;
+      size_t numRows {0};
+
+      std::vector<std::vector<std::vector<std::string>>> rows;
+      std::vector<bool> stagingCreated;
+
+      // Referencing table to referenced tables, read on first use
+      std::optional<std::multimap<std::string, std::string>> foreignKeys;
+
+    protected:
+    public:
+
+    // =========================================================================
+    // Constructors and Destructors
+    // =========================================================================
+    private:
+    protected:
+    public:
+      explicit BulkRowSink(pqxx::transaction_base&, size_t=50000);
+      ~BulkRowSink();
+
+      BulkRowSink(const BulkRowSink&) = delete;
+      BulkRowSink& operator=(const BulkRowSink&) = delete;
+
+    // =========================================================================
+    // Methods
+    // =========================================================================
+    private:
+      const std::multimap<std::string, std::string>& getForeignKeys();
+      void stage(size_t);
+
+    protected:
+    public:
+      static BulkRowSink* find(const pqxx::transaction_base&);
+
+      // Whether rows buffered for the given tables must be merged before the
+      // statement runs: it names one of them, writes a table with a foreign
+      // key to one, or deletes from a table one of them references.
+      // Anything but a plain INSERT, UPDATE, or DELETE always requires it.
+      static bool mustFlushBefore(const std::string&,
+                                  const std::set<std::string>&,
+                                  const std::multimap<std::string,
+                                                      std::string>&);
+      // Table a bulk statement merges its rows into
+      static std::string targetTable(const BulkStatement&);
+
+      bool add(const std::string&, std::vector<std::string>&&);
+      void flush();
+      // Flush if the named, not bulk capable, statement needs the rows
+      void flushBefore(const std::string&);
+      size_t pending() const;
+  };
+
+  // Drop-in for pqxx::transaction_base::exec_prepared.  Prepares the
+  // statement on first use if it is from a registry attached to the
+  // connection (see StatementRegistry).  INSERTs which return nothing are
+  // routed through the transaction's BulkRowSink, if any, in which case the
+  // returned result is empty.
+  template<typename... Args>
+  pqxx::result
+  execPrepared(pqxx::transaction_base&, const std::string&, const Args&...);
+}
+#include "BulkRowSink.ipp"
+
+#endif // BULK_ROW_SINK_HPP
@@ -0,0 +1,72 @@
+// =============================================================================
+// Copyright 2023 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+// =============================================================================
+
+// NOTE This implementation is included in the header (at the end) since it
+//      leverages templating.
+
+
+namespace netmeld::datastore::utils {
+
+  inline std::string
+  toBulkField(const std::string& value)
+  {
+    return value;
+  }
+
+  inline std::string
+  toBulkField(const char* value)
+  {
+    return value;
+  }
+
+  template<typename T>
+  std::string
+  toBulkField(const T& value)
+  {
+    return pqxx::to_string(value);
+  }
+
+  template<typename... Args>
+  pqxx::result
+  execPrepared(pqxx::transaction_base& t, const std::string& name,
+               const Args&... args)
+  {
+    BulkRowSink* sink {BulkRowSink::find(t)};
+
+    // NULLs cannot round trip through the TEXT staging tables
+    if constexpr (!(std::is_null_pointer_v<Args> || ...)) {
+      if (nullptr != sink && sink->add(name, {toBulkField(args)...})) {
+        return pqxx::result();
+      }
+    }
+
+    if (nullptr != sink) {
+      sink->flushBefore(name);
+    }
+    ensurePrepared(t.conn(), name);
+    return t.exec_prepared(name, args...);
+  }
+}
@@ -0,0 +1,139 @@
+// =============================================================================
+// Copyright 2023 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+// =============================================================================
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+#include <boost/test/unit_test.hpp>
+
+#include <netmeld/datastore/utils/BulkRowSink.hpp>
+
+namespace nmdu = netmeld::datastore::utils;
+
+
+// Foreign keys of the Netmeld schema between the tables used below
+static const std::multimap<std::string, std::string> FOREIGN_KEYS {
+  {"raw_ip_addrs",                "tool_runs"},
+  {"raw_mac_addrs",               "tool_runs"},
+  {"raw_ip_nets",                 "tool_runs"},
+  {"raw_mac_addrs_ip_addrs",      "raw_ip_addrs"},
+  {"raw_mac_addrs_ip_addrs",      "raw_mac_addrs"},
+  {"raw_hostnames",               "raw_ip_addrs"},
+  {"raw_operating_systems",       "raw_ip_addrs"},
+  {"raw_ports",                   "raw_ip_addrs"},
+  {"raw_network_services",        "raw_ports"},
+  {"raw_devices",                 "tool_runs"},
+  {"raw_device_ip_addrs",         "raw_ip_addrs"},
+  {"raw_device_ip_routes",        "raw_devices"},
+  {"tool_run_ip_routes",          "tool_runs"},
+};
+
+static const std::string&
+statement(const std::string& name)
+{
+  const auto* sql {nmdu::commonStatements().find(name)};
+  BOOST_TEST_REQUIRE(nullptr != sql);
+  return *sql;
+}
+
+
+BOOST_AUTO_TEST_CASE(testBulkStatementOrder)
+{
+  const auto& statements {nmdu::dbBulkStatements()};
+
+  std::vector<std::string> targets;
+  for (const auto& bulk : statements) {
+    // Each mirrors the prepared statement of the same name
+    BOOST_TEST(nullptr != nmdu::commonStatements().find(bulk.name));
+
+    const auto& target {nmdu::BulkRowSink::targetTable(bulk)};
+    BOOST_TEST(!target.empty());
+    targets.push_back(target);
+  }
+
+  // Referenced tables are merged before the tables referencing them
+  for (size_t i {0}; i < targets.size(); ++i) {
+    for (size_t j {i+1}; j < targets.size(); ++j) {
+      const auto& range {FOREIGN_KEYS.equal_range(targets[i])};
+      for (auto it {range.first}; it != range.second; ++it) {
+        BOOST_TEST(targets[j] != it->second,
+                   targets[i] << " merged before " << targets[j]);
+      }
+    }
+  }
+
+  BOOST_TEST("raw_ip_addrs"
+             == nmdu::BulkRowSink::targetTable(statements.at(2)));
+}
+
+BOOST_AUTO_TEST_CASE(testMustFlushBefore)
+{
+  const std::set<std::string> none;
+  const std::set<std::string> addrs {"raw_ip_addrs"};
+  const std::set<std::string> ports {"raw_ip_addrs", "raw_ports"};
+
+  // Nothing buffered, nothing to flush
+  BOOST_TEST(!nmdu::BulkRowSink::mustFlushBefore(
+      "SELECT 1", none, FOREIGN_KEYS));
+
+  // Unrelated writes leave the rows buffered
+  BOOST_TEST(!nmdu::BulkRowSink::mustFlushBefore(
+      statement("insert_raw_device"), addrs, FOREIGN_KEYS));
+  BOOST_TEST(!nmdu::BulkRowSink::mustFlushBefore(
+      statement("insert_raw_device_vlan_range"), ports, FOREIGN_KEYS));
+  BOOST_TEST(!nmdu::BulkRowSink::mustFlushBefore(
+      statement("update_tool_run"), addrs, FOREIGN_KEYS));
+
+  // Inserted rows referencing buffered rows
+  BOOST_TEST(nmdu::BulkRowSink::mustFlushBefore(
+      statement("insert_raw_device_ip_addr"), addrs, FOREIGN_KEYS));
+  BOOST_TEST(nmdu::BulkRowSink::mustFlushBefore(
+      "INSERT INTO raw_network_services (tool_run_id) VALUES ($1)",
+      ports, FOREIGN_KEYS));
+
+  // Statements naming a buffered table, in any case
+  BOOST_TEST(nmdu::BulkRowSink::mustFlushBefore(
+      "insert into raw_ip_addrs (tool_run_id, ip_addr) values ($1, $2)",
+      addrs, FOREIGN_KEYS));
+  BOOST_TEST(nmdu::BulkRowSink::mustFlushBefore(
+      "INSERT INTO raw_devices SELECT tool_run_id, host(ip_addr)"
+      " FROM Raw_Ip_Addrs", addrs, FOREIGN_KEYS));
+
+  // Rows which buffered rows reference are not removed under them
+  BOOST_TEST(nmdu::BulkRowSink::mustFlushBefore(
+      "DELETE FROM tool_runs WHERE (id = $1)", addrs, FOREIGN_KEYS));
+  BOOST_TEST(nmdu::BulkRowSink::mustFlushBefore(
+      "UPDATE raw_ip_addrs SET is_responding = true", ports, FOREIGN_KEYS));
+  BOOST_TEST(!nmdu::BulkRowSink::mustFlushBefore(
+      "DELETE FROM raw_devices WHERE (device_id = $1)", addrs,
+      FOREIGN_KEYS));
+
+  // Reads and anything else of unknown effect
+  BOOST_TEST(nmdu::BulkRowSink::mustFlushBefore(
+      statement("select_raw_device_ip_addrs"), addrs, FOREIGN_KEYS));
+  BOOST_TEST(nmdu::BulkRowSink::mustFlushBefore(
+      "WITH x AS (SELECT 1) INSERT INTO raw_devices SELECT * FROM x",
+      addrs, FOREIGN_KEYS));
+}
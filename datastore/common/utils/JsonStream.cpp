@@ -0,0 +1,84 @@
+// =============================================================================
+// Copyright 2023 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+// =============================================================================
+
+#include <netmeld/datastore/utils/JsonStream.hpp>
+
+using json = nlohmann::json;
+
+
+namespace netmeld::datastore::utils {
+
+  size_t
+  forEachJsonElement(std::istream& in, const std::set<std::string>& names,
+                     const std::function<void(const std::string&,
+                                              const json&)>& handler)
+  {
+    // Depth 1 is the root object's members, depth 2 is an array's elements.
+    // Events still occur within discarded members, so track selection here
+    std::string name;
+    bool selected {false};
+    bool inArray  {false};
+    size_t found {0};
+
+    auto callback = [&](int depth, json::parse_event_t event, json& parsed)
+      {
+        if (1 == depth) {
+          switch (event) {
+            case json::parse_event_t::key:
+              name     = parsed.get<std::string>();
+              selected = names.contains(name);
+              return selected; // discard others whole
+            case json::parse_event_t::array_start:
+              inArray = selected;
+              found  += selected ? 1 : 0;
+              return true;
+            default:
+              inArray = false;
+              return true;
+          }
+        }
+
+        if (2 == depth && inArray) {
+          switch (event) {
+            case json::parse_event_t::object_end:
+            case json::parse_event_t::array_end:
+            case json::parse_event_t::value:
+              handler(name, parsed);
+              return false; // handled, so free it
+            default:
+              break;
+          }
+        }
+
+        return true;
+      };
+
+    // Only an empty skeleton of the document is left
+    [[maybe_unused]] const auto& root {json::parse(in, callback)};
+
+    return found;
+  }
+}
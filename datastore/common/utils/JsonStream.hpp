@@ -0,0 +1,56 @@
+// =============================================================================
+// Copyright 2023 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+// =============================================================================
+
+#ifndef JSON_STREAM_HPP
+#define JSON_STREAM_HPP
+
+#include <functional>
+#include <istream>
+#include <set>
+#include <string>
+
+#include <nlohmann/json.hpp>
+
+
+namespace netmeld::datastore::utils {
+
+  /* Passes each element of the named top level arrays to the handler, e.g.,
+     each entry of "Reservations" in `aws ec2 describe-instances` output.
+
+     Unlike json::parse() of the whole document, only the element being
+     handled is materialized; it is discarded once the handler returns, as
+     are all other top level members.  Elements are handled in document
+     order and the handler is given the name of the array it is from.
+
+     Returns the number of named arrays found.  Throws json::parse_error on
+     malformed input, and passes on anything the handler throws.
+  */
+  size_t
+  forEachJsonElement(std::istream&, const std::set<std::string>&,
+                     const std::function<void(const std::string&,
+                                              const nlohmann::json&)>&);
+}
+#endif // JSON_STREAM_HPP
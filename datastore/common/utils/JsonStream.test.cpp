@@ -0,0 +1,97 @@
+// =============================================================================
+// Copyright 2023 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+// =============================================================================
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+#include <boost/test/unit_test.hpp>
+
+#include <sstream>
+
+#include <netmeld/datastore/utils/JsonStream.hpp>
+
+namespace nmdu = netmeld::datastore::utils;
+
+using json = nlohmann::json;
+
+
+BOOST_AUTO_TEST_CASE(testForEachJsonElement)
+{
+  const std::string text {R"(
+    { "NextToken": "abc"
+    , "Skipped": [ {"a": 1}, 2, [3] ]
+    , "Reservations":
+      [ { "Instances": [ {"InstanceId": "i-1"} ], "OwnerId": "1" }
+      , 4
+      , [5, {"b": 6}]
+      ]
+    , "Vpcs": { "NotAnArray": [7] }
+    , "Subnets": []
+    }
+  )"};
+
+  std::vector<std::string> handled;
+  auto handler = [&handled](const std::string& name, const json& element) {
+      handled.push_back(name + "=" + element.dump());
+    };
+
+  {
+    std::istringstream iss {text};
+    const auto found {
+      nmdu::forEachJsonElement(iss, {"Reservations", "Subnets", "Vpcs"},
+                               handler)};
+    BOOST_TEST(2 == found);
+
+    const std::vector<std::string> expected {
+      R"(Reservations={"Instances":[{"InstanceId":"i-1"}],"OwnerId":"1"})",
+      R"(Reservations=4)",
+      R"(Reservations=[5,{"b":6}])",
+    };
+    BOOST_TEST(expected == handled, boost::test_tools::per_element());
+  }
+
+  {
+    handled.clear();
+    std::istringstream iss {text};
+    BOOST_TEST(0 == nmdu::forEachJsonElement(iss, {"Missing"}, handler));
+    BOOST_TEST(handled.empty());
+  }
+
+  {
+    std::istringstream iss {R"({ "Reservations": [ {"a": 1}, )"};
+    BOOST_CHECK_THROW(nmdu::forEachJsonElement(iss, {"Reservations"}, handler),
+                      json::parse_error);
+  }
+
+  {
+    std::istringstream iss {R"({ "Reservations": [ 1, 2 ] })"};
+    BOOST_CHECK_THROW(
+        nmdu::forEachJsonElement(iss, {"Reservations"},
+            [](const std::string&, const json&) {
+              throw std::runtime_error("handler");
+            }),
+        std::runtime_error);
+  }
+}
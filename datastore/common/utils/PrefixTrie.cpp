@@ -0,0 +1,274 @@
+// =============================================================================
+// Copyright 2023 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+// =============================================================================
+
+#include <algorithm>
+#include <bit>
+#include <cctype>
+
+#include <netmeld/datastore/utils/PrefixTrie.hpp>
+
+
+namespace netmeld::datastore::utils {
+
+  // ===========================================================================
+  // Methods
+  // ===========================================================================
+  size_t
+  PrefixTrie::rootIndex(const IpKey& _key)
+  {
+    return (6 == _key.family) ? 1 : 0;
+  }
+
+  size_t
+  PrefixTrie::bitAt(const IpBytes& _bytes, size_t _bit)
+  {
+    return (_bytes[_bit / 8] >> (7 - (_bit % 8))) & 1U;
+  }
+
+  // Number of leading bits, up to the limit, the two have in common
+  size_t
+  PrefixTrie::commonLength(const IpBytes& _lhs, const IpBytes& _rhs,
+                           size_t _limit)
+  {
+    for (size_t i {0}; i * 8 < _limit; ++i) {
+      const auto diff {static_cast<uint8_t>(_lhs[i] ^ _rhs[i])};
+      if (0 != diff) {
+        return std::min(_limit,
+                        i * 8 + static_cast<size_t>(std::countl_zero(diff)));
+      }
+    }
+    return _limit;
+  }
+
+  PrefixTrie::IpBytes
+  PrefixTrie::masked(const IpBytes& _bytes, size_t _length)
+  {
+    IpBytes bytes {};
+    for (size_t i {0}; i * 8 < _length; ++i) {
+      const size_t bitsKept {std::min<size_t>(8, _length - i * 8)};
+      bytes[i] = static_cast<uint8_t>(_bytes[i] & (0xFF << (8 - bitsKept)));
+    }
+    return bytes;
+  }
+
+  uint32_t
+  PrefixTrie::addNode(const IpBytes& _bytes, size_t _length)
+  {
+    Node node;
+    node.bytes  = masked(_bytes, _length);
+    node.length = static_cast<uint8_t>(_length);
+    nodes.push_back(node);
+
+    return static_cast<uint32_t>(nodes.size() - 1);
+  }
+
+  bool
+  PrefixTrie::toNetwork(const std::string& _net, IpKey& _key,
+                        uint8_t& _length)
+  {
+    const auto slash {_net.find('/')};
+    auto key {IpKey::fromString(_net.substr(0, slash))};
+    if (!key.isValid()) {
+      return false;
+    }
+
+    const size_t maxLength {(4 == key.family) ? 32U : 128U};
+    size_t length {maxLength};
+    if (std::string::npos != slash) {
+      const auto digits {_net.substr(slash + 1)};
+      if (digits.empty() || digits.size() > 3
+          || !std::all_of(digits.cbegin(), digits.cend(),
+                          [](unsigned char c){ return std::isdigit(c); }))
+      {
+        return false;
+      }
+      length = std::stoul(digits);
+      if (length > maxLength) {
+        return false;
+      }
+    }
+
+    key.bytes = masked(key.bytes, length);
+    _key      = key;
+    _length   = static_cast<uint8_t>(length);
+    return true;
+  }
+
+  bool
+  PrefixTrie::insert(const IpKey& _net, uint8_t _length, uint32_t _value)
+  {
+    const size_t maxLength {(4 == _net.family) ? 32U : 128U};
+    if (!_net.isValid() || _length > maxLength) {
+      return false;
+    }
+    const auto bytes {masked(_net.bytes, _length)};
+    const auto root  {rootIndex(_net)};
+
+    // Links are tracked by owner, as adding a node may move the others
+    uint32_t parent {NONE};
+    size_t   side   {0};
+    auto link = [&]() -> uint32_t& {
+        return (NONE == parent) ? roots[root] : nodes[parent].children[side];
+      };
+
+    while (true) {
+      const auto current {link()};
+      if (NONE == current) {
+        const auto leaf {addNode(bytes, _length)};
+        nodes[leaf].hasValue = true;
+        nodes[leaf].value    = _value;
+        link() = leaf;
+        ++numNetworks;
+        return true;
+      }
+
+      const size_t nodeLength {nodes[current].length};
+      const auto common {
+        commonLength(nodes[current].bytes, bytes,
+                     std::min<size_t>(nodeLength, _length))
+      };
+
+      if (common == nodeLength) {
+        if (nodeLength == _length) {
+          auto& node {nodes[current]};
+          if (!node.hasValue) {
+            node.hasValue = true;
+            ++numNetworks;
+          }
+          node.value = _value;
+          return true;
+        }
+        parent = current;
+        side   = bitAt(bytes, nodeLength);
+        continue;
+      }
+
+      // The network ends above, or diverges within, the current node
+      const auto currentSide {bitAt(nodes[current].bytes, common)};
+      uint32_t added {NONE};
+      if (common == _length) {
+        added = addNode(bytes, _length);
+        nodes[added].hasValue = true;
+        nodes[added].value    = _value;
+        nodes[added].children[currentSide] = current;
+      } else {
+        const auto leaf {addNode(bytes, _length)};
+        nodes[leaf].hasValue = true;
+        nodes[leaf].value    = _value;
+
+        added = addNode(bytes, common);
+        nodes[added].children[currentSide]     = current;
+        nodes[added].children[1 - currentSide] = leaf;
+      }
+      link() = added;
+      ++numNetworks;
+      return true;
+    }
+  }
+
+  bool
+  PrefixTrie::insert(const std::string& _net, uint32_t _value)
+  {
+    IpKey   key;
+    uint8_t length {0};
+    if (!toNetwork(_net, key, length)) {
+      return false;
+    }
+    return insert(key, length, _value);
+  }
+
+  std::optional<uint32_t>
+  PrefixTrie::find(const IpKey& _ip) const
+  {
+    if (!_ip.isValid()) {
+      return std::nullopt;
+    }
+    const size_t maxLength {(4 == _ip.family) ? 32U : 128U};
+
+    std::optional<uint32_t> best;
+    auto current {roots[rootIndex(_ip)]};
+    while (NONE != current) {
+      const auto& node {nodes[current]};
+      if (commonLength(node.bytes, _ip.bytes, node.length) < node.length) {
+        break;
+      }
+      if (node.hasValue) {
+        best = node.value;
+      }
+      if (node.length >= maxLength) {
+        break;
+      }
+      current = node.children[bitAt(_ip.bytes, node.length)];
+    }
+
+    return best;
+  }
+
+  std::optional<uint32_t>
+  PrefixTrie::findExact(const IpKey& _net, uint8_t _length) const
+  {
+    const size_t maxLength {(4 == _net.family) ? 32U : 128U};
+    if (!_net.isValid() || _length > maxLength) {
+      return std::nullopt;
+    }
+    const auto bytes {masked(_net.bytes, _length)};
+
+    auto current {roots[rootIndex(_net)]};
+    while (NONE != current) {
+      const auto& node {nodes[current]};
+      if (node.length > _length
+          || commonLength(node.bytes, bytes, node.length) < node.length)
+      {
+        break;
+      }
+      if (node.length == _length) {
+        return node.hasValue ? std::optional<uint32_t>(node.value)
+                             : std::nullopt;
+      }
+      current = node.children[bitAt(bytes, node.length)];
+    }
+
+    return std::nullopt;
+  }
+
+  size_t
+  PrefixTrie::size() const
+  {
+    return numNetworks;
+  }
+
+  size_t
+  PrefixTrie::nodeCount() const
+  {
+    return nodes.size();
+  }
+
+  bool
+  PrefixTrie::empty() const
+  {
+    return 0 == numNetworks;
+  }
+}
@@ -0,0 +1,115 @@
+// =============================================================================
+// Copyright 2023 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+// =============================================================================
+
+#ifndef PREFIX_TRIE_HPP
+#define PREFIX_TRIE_HPP
+
+#include <array>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <netmeld/datastore/utils/AddressKeys.hpp>
+
+
+namespace netmeld::datastore::utils {
+
+  /* Longest prefix match over IPv4 and IPv6 networks.
+
+     One path compressed binary (Patricia) trie per address family.  A node
+     exists only where a network is stored or where two stored networks
+     diverge, so a lookup visits at most one node per stored network on its
+     path instead of one per address bit.  Nodes are held in a single vector
+     and refer to each other by index.
+
+     Each stored network maps to a caller chosen value, typically an index
+     into the caller's own table.
+  */
+  class PrefixTrie {
+    // =========================================================================
+    // Variables
+    // =========================================================================
+    private: // Variables will probably rarely appear at this scope
+      static constexpr uint32_t NONE {UINT32_MAX};
+
+      using IpBytes = std::array<uint8_t, 16>;
+
+      struct Node {
+        IpBytes                 bytes    {};   // masked to length
+        uint8_t                 length   {0};
+        bool                    hasValue {false};
+        uint32_t                value    {0};
+        std::array<uint32_t, 2> children {NONE, NONE};
+      };
+
+      std::vector<Node>       nodes;
+      std::array<uint32_t, 2> roots {NONE, NONE}; // IPv4, IPv6
+      size_t                  numNetworks {0};
+
+    protected: // Variables intended for internal/subclass API
+    public: // Variables should rarely appear at this scope
+
+    // =========================================================================
+    // Constructors
+    // =========================================================================
+    private: // Constructors which should be hidden from API users
+    protected: // Constructors part of subclass API
+    public: // Constructors part of public API
+      PrefixTrie() = default;
+
+    // =========================================================================
+    // Methods
+    // =========================================================================
+    private: // Methods which should be hidden from API users
+      static size_t rootIndex(const IpKey&);
+      static size_t bitAt(const IpBytes&, size_t);
+      static size_t commonLength(const IpBytes&, const IpBytes&, size_t);
+      static IpBytes masked(const IpBytes&, size_t);
+
+      uint32_t addNode(const IpBytes&, size_t);
+
+    protected: // Methods part of subclass API
+    public: // Methods part of public API
+      // "addr" or "addr/prefix" to the (masked) network; false if malformed
+      static bool toNetwork(const std::string&, IpKey&, uint8_t&);
+
+      // Stores the value for the network, replacing any previous value;
+      // false if the network is malformed
+      bool insert(const IpKey&, uint8_t, uint32_t);
+      bool insert(const std::string&, uint32_t);
+
+      // Value of the longest stored network containing the address
+      std::optional<uint32_t> find(const IpKey&) const;
+      // Value stored for exactly the network
+      std::optional<uint32_t> findExact(const IpKey&, uint8_t) const;
+
+      size_t size() const;
+      size_t nodeCount() const;
+      bool empty() const;
+  };
+}
+#endif // PREFIX_TRIE_HPP
@@ -0,0 +1,155 @@
+// =============================================================================
+// Copyright 2023 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+// =============================================================================
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+#include <boost/test/unit_test.hpp>
+
+#include <random>
+
+#include <netmeld/datastore/utils/PrefixTrie.hpp>
+
+namespace nmdu = netmeld::datastore::utils;
+
+
+std::optional<uint32_t>
+lookup(const nmdu::PrefixTrie& _trie, const std::string& _ip)
+{
+  return _trie.find(nmdu::IpKey::fromString(_ip));
+}
+
+BOOST_AUTO_TEST_CASE(testToNetwork)
+{
+  nmdu::IpKey key;
+  uint8_t length {0};
+
+  BOOST_TEST(nmdu::PrefixTrie::toNetwork("10.1.2.3/8", key, length));
+  BOOST_TEST((key == nmdu::IpKey::fromString("10.0.0.0")));
+  BOOST_TEST(8 == length);
+
+  BOOST_TEST(nmdu::PrefixTrie::toNetwork("10.1.2.3", key, length));
+  BOOST_TEST((key == nmdu::IpKey::fromString("10.1.2.3")));
+  BOOST_TEST(32 == length);
+
+  BOOST_TEST(nmdu::PrefixTrie::toNetwork("fe80::1/10", key, length));
+  BOOST_TEST((key == nmdu::IpKey::fromString("fe80::")));
+  BOOST_TEST(10 == length);
+
+  BOOST_TEST(!nmdu::PrefixTrie::toNetwork("10.1.2.3/33", key, length));
+  BOOST_TEST(!nmdu::PrefixTrie::toNetwork("10.1.2.3/", key, length));
+  BOOST_TEST(!nmdu::PrefixTrie::toNetwork("bad/8", key, length));
+}
+
+BOOST_AUTO_TEST_CASE(testLongestMatch)
+{
+  nmdu::PrefixTrie trie;
+  BOOST_TEST(trie.empty());
+  BOOST_TEST(!lookup(trie, "10.1.2.3"));
+
+  // Added out of order, so nodes are split and pushed down
+  BOOST_TEST(trie.insert("10.1.2.0/24", 24));
+  BOOST_TEST(trie.insert("10.1.3.0/24", 124));
+  BOOST_TEST(trie.insert("10.0.0.0/8", 8));
+  BOOST_TEST(trie.insert("10.1.2.3/32", 32));
+  BOOST_TEST(trie.insert("0.0.0.0/0", 0));
+  BOOST_TEST(trie.insert("::/0", 1000));
+  BOOST_TEST(trie.insert("2001:db8::/32", 1032));
+  BOOST_TEST(!trie.insert("10.0.0.0/40", 40));
+  BOOST_TEST(7 == trie.size());
+
+  BOOST_TEST(32 == lookup(trie, "10.1.2.3").value());
+  BOOST_TEST(24 == lookup(trie, "10.1.2.4").value());
+  BOOST_TEST(124 == lookup(trie, "10.1.3.255").value());
+  BOOST_TEST(8 == lookup(trie, "10.200.0.1").value());
+  BOOST_TEST(0 == lookup(trie, "192.168.1.1").value());
+  BOOST_TEST(1032 == lookup(trie, "2001:db8::1").value());
+  BOOST_TEST(1000 == lookup(trie, "fe80::1").value());
+  BOOST_TEST(!trie.find(nmdu::IpKey()));
+
+  // Replacing keeps the count
+  BOOST_TEST(trie.insert("10.0.0.0/8", 88));
+  BOOST_TEST(7 == trie.size());
+  BOOST_TEST(88 == lookup(trie, "10.200.0.1").value());
+
+  nmdu::IpKey key;
+  uint8_t length {0};
+  nmdu::PrefixTrie::toNetwork("10.1.2.0/24", key, length);
+  BOOST_TEST(24 == trie.findExact(key, length).value());
+  nmdu::PrefixTrie::toNetwork("10.1.0.0/16", key, length);
+  BOOST_TEST(!trie.findExact(key, length));
+}
+
+BOOST_AUTO_TEST_CASE(testAgainstLinearScan)
+{
+  std::mt19937 gen {42};
+  std::uniform_int_distribution<uint32_t> octet {0, 3};
+  std::uniform_int_distribution<uint32_t> prefix {0, 32};
+
+  // Few distinct octets so that networks nest and collide often
+  auto randomIp = [&]() {
+      return std::to_string(octet(gen)) + "." + std::to_string(octet(gen))
+           + "." + std::to_string(octet(gen)) + "." + std::to_string(octet(gen));
+    };
+
+  nmdu::PrefixTrie trie;
+  std::vector<std::pair<nmdu::IpKey, uint8_t>> networks;
+  for (uint32_t i {0}; i < 500; ++i) {
+    nmdu::IpKey key;
+    uint8_t length {0};
+    const auto net {randomIp() + "/" + std::to_string(prefix(gen))};
+    BOOST_TEST(nmdu::PrefixTrie::toNetwork(net, key, length));
+
+    trie.insert(key, length, i);
+    networks.emplace_back(key, length);
+  }
+
+  for (size_t i {0}; i < 2000; ++i) {
+    const auto ip {nmdu::IpKey::fromString(randomIp())};
+
+    // Longest, then latest, stored network containing the address
+    std::optional<uint32_t> expected;
+    int bestLength {-1};
+    for (uint32_t j {0}; j < networks.size(); ++j) {
+      const auto& [net, length] {networks[j]};
+      bool contains {true};
+      for (size_t bit {0}; bit < length; ++bit) {
+        const auto shift {7 - (bit % 8)};
+        if (((net.bytes[bit / 8] >> shift) & 1)
+            != ((ip.bytes[bit / 8] >> shift) & 1))
+        {
+          contains = false;
+          break;
+        }
+      }
+      if (contains && length >= bestLength) {
+        bestLength = length;
+        expected   = j;
+      }
+    }
+
+    BOOST_TEST((expected == trie.find(ip)));
+  }
+}
@@ -24,19 +24,20 @@
 // Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
 // =============================================================================
 
+#include <netmeld/datastore/utils/BulkRowSink.hpp>
 #include <netmeld/datastore/utils/QueriesCommon.hpp>
 
 
 namespace netmeld::datastore::utils {
 
-  void
-  dbPrepareAws(pqxx::connection& db)
+  static void
+  declareAws(StatementRegistry& registry)
   {
     // ----------------------------------------------------------------------
     // TABLES: AWS CidrBlock related
     // ----------------------------------------------------------------------
 
-    db.prepare
+    registry.declare
       ("insert_raw_aws_cidr_block", R"(
           INSERT INTO raw_aws_cidr_blocks
             (tool_run_id, cidr_block)
@@ -45,7 +46,7 @@ namespace netmeld::datastore::utils {
           ON CONFLICT DO NOTHING
         )");
 
-    db.prepare
+    registry.declare
       ("insert_raw_aws_cidr_block_detail", R"(
           INSERT INTO raw_aws_cidr_block_details
             (tool_run_id, cidr_block, state, description)
@@ -54,7 +55,7 @@ namespace netmeld::datastore::utils {
           ON CONFLICT DO NOTHING
         )");
 
-    db.prepare
+    registry.declare
       ("insert_raw_aws_cidr_block_fqdn", R"(
           INSERT INTO raw_aws_cidr_block_fqdns
             (tool_run_id, cidr_block, fqdn)
@@ -69,7 +70,7 @@ namespace netmeld::datastore::utils {
     // TABLES: AWS Instance related
     // ----------------------------------------------------------------------
 
-    db.prepare
+    registry.declare
       ("insert_raw_aws_instance", R"(
           INSERT INTO raw_aws_instances
             (tool_run_id, instance_id)
@@ -78,7 +79,7 @@ namespace netmeld::datastore::utils {
           ON CONFLICT DO NOTHING
         )");
 
-    db.prepare
+    registry.declare
       ("insert_raw_aws_instance_detail", R"(
           INSERT INTO raw_aws_instance_details
             (tool_run_id, instance_id, instance_type, image_id
@@ -98,7 +99,7 @@ namespace netmeld::datastore::utils {
     // TABLES: AWS Network Interface related
     // ----------------------------------------------------------------------
 
-    db.prepare
+    registry.declare
       ("insert_raw_aws_network_interface", R"(
           INSERT INTO raw_aws_network_interfaces
             (tool_run_id, interface_id)
@@ -107,7 +108,7 @@ namespace netmeld::datastore::utils {
           ON CONFLICT DO NOTHING
         )");
 
-    db.prepare
+    registry.declare
       ("insert_raw_aws_network_interface_detail", R"(
           INSERT INTO raw_aws_network_interface_details
             (tool_run_id, interface_id, interface_type
@@ -120,7 +121,7 @@ namespace netmeld::datastore::utils {
           ON CONFLICT DO NOTHING
         )");
 
-    db.prepare
+    registry.declare
       ("insert_raw_aws_network_interface_attachment", R"(
           INSERT INTO raw_aws_network_interface_attachments
             (tool_run_id, interface_id, id, status, delete_on_termination)
@@ -129,7 +130,7 @@ namespace netmeld::datastore::utils {
           ON CONFLICT DO NOTHING
         )");
 
-    db.prepare
+    registry.declare
       ("insert_raw_aws_network_interface_mac", R"(
           INSERT INTO raw_aws_network_interface_macs
             (tool_run_id, interface_id, mac_address)
@@ -138,7 +139,7 @@ namespace netmeld::datastore::utils {
           ON CONFLICT DO NOTHING
         )");
 
-    db.prepare
+    registry.declare
       ("insert_raw_aws_network_interface_ip", R"(
           INSERT INTO raw_aws_network_interface_ips
             (tool_run_id, interface_id, ip_address)
@@ -152,7 +153,7 @@ namespace netmeld::datastore::utils {
     // TABLES: AWS VPC related
     // ----------------------------------------------------------------------
 
-    db.prepare
+    registry.declare
       ("insert_raw_aws_vpc", R"(
           INSERT INTO raw_aws_vpcs
             (tool_run_id, vpc_id)
@@ -161,7 +162,7 @@ namespace netmeld::datastore::utils {
           ON CONFLICT DO NOTHING
         )");
 
-    db.prepare
+    registry.declare
       ("insert_raw_aws_vpc_owner", R"(
           INSERT INTO raw_aws_vpc_owners
             (tool_run_id, vpc_id, owner_id)
@@ -170,7 +171,7 @@ namespace netmeld::datastore::utils {
           ON CONFLICT DO NOTHING
         )");
 
-    db.prepare
+    registry.declare
       ("insert_raw_aws_vpc_detail", R"(
           INSERT INTO raw_aws_vpc_details
             (tool_run_id, vpc_id, state)
@@ -179,7 +180,7 @@ namespace netmeld::datastore::utils {
           ON CONFLICT DO NOTHING
         )");
 
-    db.prepare
+    registry.declare
       ("insert_raw_aws_vpc_cidr_block", R"(
           INSERT INTO raw_aws_vpc_cidr_blocks
             (tool_run_id, vpc_id, cidr_block, state)
@@ -193,7 +194,7 @@ namespace netmeld::datastore::utils {
     // TABLES: AWS VPC Peering Connection related
     // ----------------------------------------------------------------------
 
-    db.prepare
+    registry.declare
       ("insert_raw_aws_vpc_peering_connection", R"(
           INSERT INTO raw_aws_vpc_peering_connections
             (tool_run_id, pcx_id)
@@ -202,7 +203,7 @@ namespace netmeld::datastore::utils {
           ON CONFLICT DO NOTHING
         )");
 
-    db.prepare
+    registry.declare
       ("insert_raw_aws_vpc_peering_connection_peer", R"(
           INSERT INTO raw_aws_vpc_peering_connection_peers
             ( tool_run_id, pcx_id
@@ -217,7 +218,7 @@ namespace netmeld::datastore::utils {
           ON CONFLICT DO NOTHING
         )");
 
-    db.prepare
+    registry.declare
       ("insert_raw_aws_vpc_peering_connection_status", R"(
           INSERT INTO raw_aws_vpc_peering_connection_statuses
             (tool_run_id, pcx_id, code, message)
@@ -231,7 +232,7 @@ namespace netmeld::datastore::utils {
     // TABLES: AWS Security Group related
     // ----------------------------------------------------------------------
 
-    db.prepare
+    registry.declare
       ("insert_raw_aws_security_group", R"(
           INSERT INTO raw_aws_security_groups
             (tool_run_id, security_group_id)
@@ -240,7 +241,7 @@ namespace netmeld::datastore::utils {
           ON CONFLICT DO NOTHING
         )");
 
-    db.prepare
+    registry.declare
       ("insert_raw_aws_security_group_detail", R"(
           INSERT INTO raw_aws_security_group_details
             (tool_run_id, security_group_id, group_name, description)
@@ -249,7 +250,7 @@ namespace netmeld::datastore::utils {
           ON CONFLICT DO NOTHING
         )");
 
-    db.prepare
+    registry.declare
       ("insert_raw_aws_security_group_rules_port", R"(
           INSERT INTO raw_aws_security_group_rules_ports
             (tool_run_id, security_group_id, egress, protocol
@@ -262,7 +263,7 @@ namespace netmeld::datastore::utils {
           ON CONFLICT DO NOTHING
         )");
 
-    db.prepare
+    registry.declare
       ("insert_raw_aws_security_group_rules_type_code", R"(
           INSERT INTO raw_aws_security_group_rules_type_codes
             (tool_run_id, security_group_id, egress, protocol
@@ -275,7 +276,7 @@ namespace netmeld::datastore::utils {
           ON CONFLICT DO NOTHING
         )");
 
-    db.prepare
+    registry.declare
       ("insert_raw_aws_security_group_rules_non_ip_detail", R"(
           INSERT INTO raw_aws_security_group_rules_non_ip_details
             (tool_run_id, security_group_id, egress, protocol
@@ -288,7 +289,7 @@ namespace netmeld::datastore::utils {
           ON CONFLICT DO NOTHING
         )");
 
-    db.prepare
+    registry.declare
       ("insert_raw_aws_security_group_rules_non_ip_port", R"(
           INSERT INTO raw_aws_security_group_rules_non_ip_ports
             (tool_run_id, security_group_id, egress, protocol
@@ -301,7 +302,7 @@ namespace netmeld::datastore::utils {
           ON CONFLICT DO NOTHING
         )");
 
-    db.prepare
+    registry.declare
       ("insert_raw_aws_security_group_rules_non_ip_type_code", R"(
           INSERT INTO raw_aws_security_group_rules_non_ip_type_codes
             (tool_run_id, security_group_id, egress, protocol
@@ -319,7 +320,7 @@ namespace netmeld::datastore::utils {
     // TABLES: AWS Network ACL related
     // ----------------------------------------------------------------------
 
-    db.prepare
+    registry.declare
       ("insert_raw_aws_network_acl", R"(
           INSERT INTO raw_aws_network_acls
             (tool_run_id, network_acl_id)
@@ -328,7 +329,7 @@ namespace netmeld::datastore::utils {
           ON CONFLICT DO NOTHING
         )");
 
-    db.prepare
+    registry.declare
       ("insert_raw_aws_network_acl_rule", R"(
           INSERT INTO raw_aws_network_acl_rules
             (tool_run_id, network_acl_id, egress, rule_number, action
@@ -341,7 +342,7 @@ namespace netmeld::datastore::utils {
           ON CONFLICT DO NOTHING
         )");
 
-    db.prepare
+    registry.declare
       ("insert_raw_aws_network_acl_rules_port", R"(
           INSERT INTO raw_aws_network_acl_rules_ports
             (tool_run_id, network_acl_id, egress, rule_number, from_port
@@ -354,7 +355,7 @@ namespace netmeld::datastore::utils {
           ON CONFLICT DO NOTHING
         )");
 
-    db.prepare
+    registry.declare
       ("insert_raw_aws_network_acl_rules_type_code", R"(
           INSERT INTO raw_aws_network_acl_rules_type_codes
             (tool_run_id, network_acl_id, egress, rule_number, type, code)
@@ -368,7 +369,7 @@ namespace netmeld::datastore::utils {
     // TABLES: AWS Subnet related
     // ----------------------------------------------------------------------
 
-    db.prepare
+    registry.declare
       ("insert_raw_aws_subnet", R"(
           INSERT INTO raw_aws_subnets
             (tool_run_id, subnet_id)
@@ -377,7 +378,7 @@ namespace netmeld::datastore::utils {
           ON CONFLICT DO NOTHING
         )");
 
-    db.prepare
+    registry.declare
       ("insert_raw_aws_subnet_detail", R"(
           INSERT INTO raw_aws_subnet_details
             (tool_run_id, subnet_id, availability_zone, subnet_arn)
@@ -386,7 +387,7 @@ namespace netmeld::datastore::utils {
           ON CONFLICT DO NOTHING
         )");
 
-    db.prepare
+    registry.declare
       ("insert_raw_aws_subnet_cidr_block", R"(
           INSERT INTO raw_aws_subnet_cidr_blocks
             (tool_run_id, subnet_id, cidr_block)
@@ -400,7 +401,7 @@ namespace netmeld::datastore::utils {
     // TABLES: AWS Route Table related
     // ----------------------------------------------------------------------
 
-    db.prepare
+    registry.declare
       ("insert_raw_aws_route_table", R"(
           INSERT INTO raw_aws_route_tables
             (tool_run_id, route_table_id)
@@ -409,7 +410,7 @@ namespace netmeld::datastore::utils {
           ON CONFLICT DO NOTHING
         )");
 
-    db.prepare
+    registry.declare
       ("insert_raw_aws_route_table_association", R"(
           INSERT INTO raw_aws_route_table_associations
             (tool_run_id, route_table_id, association_id)
@@ -418,7 +419,7 @@ namespace netmeld::datastore::utils {
           ON CONFLICT DO NOTHING
         )");
 
-    db.prepare
+    registry.declare
       ("insert_raw_aws_route_table_route_cidr", R"(
           INSERT INTO raw_aws_route_table_routes_cidr
             (tool_run_id, route_table_id, destination_id, state
@@ -431,7 +432,7 @@ namespace netmeld::datastore::utils {
           ON CONFLICT DO NOTHING
         )");
 
-    db.prepare
+    registry.declare
       ("insert_raw_aws_route_table_route_non_cidr", R"(
           INSERT INTO raw_aws_route_table_routes_non_cidr
             (tool_run_id, route_table_id, destination_id, state
@@ -449,7 +450,7 @@ namespace netmeld::datastore::utils {
     // TABLES: AWS Transit Gateway related
     // ----------------------------------------------------------------------
 
-    db.prepare
+    registry.declare
       ("insert_raw_aws_transit_gateway", R"(
           INSERT INTO raw_aws_transit_gateways
             (tool_run_id, tgw_id)
@@ -458,7 +459,7 @@ namespace netmeld::datastore::utils {
           ON CONFLICT DO NOTHING
         )");
 
-    db.prepare
+    registry.declare
       ("insert_raw_aws_transit_gateway_owner", R"(
           INSERT INTO raw_aws_transit_gateway_owners
             (tool_run_id, tgw_id, owner_id)
@@ -467,7 +468,7 @@ namespace netmeld::datastore::utils {
           ON CONFLICT DO NOTHING
         )");
 
-    db.prepare
+    registry.declare
       ("insert_raw_aws_transit_gateway_attachment", R"(
           INSERT INTO raw_aws_transit_gateway_attachments
             (tool_run_id, tgw_id, tgw_attach_id, state)
@@ -476,7 +477,7 @@ namespace netmeld::datastore::utils {
           ON CONFLICT DO NOTHING
         )");
 
-    db.prepare
+    registry.declare
       ("insert_raw_aws_transit_gateway_attachment_detail", R"(
           INSERT INTO raw_aws_transit_gateway_attachment_details
             ( tool_run_id, tgw_id, tgw_attach_id
@@ -496,7 +497,7 @@ namespace netmeld::datastore::utils {
     // TABLES: AWS multi-service/component related
     // ----------------------------------------------------------------------
 
-    db.prepare
+    registry.declare
       ("insert_raw_aws_instance_network_interface", R"(
           INSERT INTO raw_aws_instance_network_interfaces
             (tool_run_id, instance_id, interface_id)
@@ -505,7 +506,7 @@ namespace netmeld::datastore::utils {
           ON CONFLICT DO NOTHING
         )");
 
-    db.prepare
+    registry.declare
       ("insert_raw_aws_network_interface_vpc_subnet", R"(
           INSERT INTO raw_aws_network_interface_vpc_subnet
             (tool_run_id, interface_id, vpc_id, subnet_id)
@@ -514,7 +515,7 @@ namespace netmeld::datastore::utils {
           ON CONFLICT DO NOTHING
         )");
 
-    db.prepare
+    registry.declare
       ("insert_raw_aws_network_interface_security_group", R"(
           INSERT INTO raw_aws_network_interface_security_groups
             (tool_run_id, interface_id, security_group_id)
@@ -523,7 +524,7 @@ namespace netmeld::datastore::utils {
           ON CONFLICT DO NOTHING
         )");
 
-    db.prepare
+    registry.declare
       ("insert_raw_aws_vpc_subnet", R"(
           INSERT INTO raw_aws_vpc_subnets
             (tool_run_id, vpc_id, subnet_id)
@@ -532,7 +533,7 @@ namespace netmeld::datastore::utils {
           ON CONFLICT DO NOTHING
         )");
 
-    db.prepare
+    registry.declare
       ("insert_raw_aws_vpc_security_group", R"(
           INSERT INTO raw_aws_vpc_security_groups
             (tool_run_id, vpc_id, security_group_id)
@@ -541,7 +542,7 @@ namespace netmeld::datastore::utils {
           ON CONFLICT DO NOTHING
         )");
 
-    db.prepare
+    registry.declare
       ("insert_raw_aws_vpc_network_acl", R"(
           INSERT INTO raw_aws_vpc_network_acls
             (tool_run_id, vpc_id, network_acl_id)
@@ -550,7 +551,7 @@ namespace netmeld::datastore::utils {
           ON CONFLICT DO NOTHING
         )");
 
-    db.prepare
+    registry.declare
       ("insert_raw_aws_vpc_route_table", R"(
           INSERT INTO raw_aws_vpc_route_tables
             (tool_run_id, vpc_id, route_table_id, is_default)
@@ -559,7 +560,7 @@ namespace netmeld::datastore::utils {
           ON CONFLICT DO NOTHING
         )");
 
-    db.prepare
+    registry.declare
       ("insert_raw_aws_network_acl_subnet", R"(
           INSERT INTO raw_aws_network_acl_subnets
             (tool_run_id, network_acl_id, subnet_id)
@@ -571,14 +572,14 @@ namespace netmeld::datastore::utils {
     // ----------------------------------------------------------------------
   }
 
-  void
-  dbPrepareCommon(pqxx::connection& db)
+  static void
+  declareCommon(StatementRegistry& registry)
   {
     // ----------------------------------------------------------------------
     // TABLE: tool_runs
     // ----------------------------------------------------------------------
 
-    db.prepare
+    registry.declare
       ("insert_tool_run",
        "INSERT INTO tool_runs"
        "  (id, tool_name, command_line, data_path, execute_time)"
@@ -586,7 +587,7 @@ namespace netmeld::datastore::utils {
        " ON CONFLICT"
        " DO NOTHING");
 
-    db.prepare
+    registry.declare
       ("update_tool_run",
        "UPDATE tool_runs"
        " SET execute_time = TSRANGE($2, $3, '[]')"
@@ -596,7 +597,7 @@ namespace netmeld::datastore::utils {
     // TABLE: tool_run_interfaces
     // ----------------------------------------------------------------------
 
-    db.prepare
+    registry.declare
       ("insert_tool_run_interface",
        "INSERT INTO tool_run_interfaces"
        "  (tool_run_id, interface_name, media_type, is_up)"
@@ -608,7 +609,7 @@ namespace netmeld::datastore::utils {
     // TABLE: tool_run_mac_addrs
     // ----------------------------------------------------------------------
 
-    db.prepare
+    registry.declare
       ("insert_tool_run_mac_addr",
        "INSERT INTO tool_run_mac_addrs"
        "  (tool_run_id, interface_name, mac_addr)"
@@ -620,7 +621,7 @@ namespace netmeld::datastore::utils {
     // TABLE: tool_run_ip_addrs
     // ----------------------------------------------------------------------
 
-    db.prepare
+    registry.declare
       ("insert_tool_run_ip_addr",
        "INSERT INTO tool_run_ip_addrs"
        "  (tool_run_id, interface_name, ip_addr)"
@@ -632,7 +633,7 @@ namespace netmeld::datastore::utils {
     // TABLE: tool_run_ip_routes
     // ----------------------------------------------------------------------
 
-    db.prepare
+    registry.declare
       ("insert_tool_run_ip_route",
        "INSERT INTO tool_run_ip_routes"
        "  (tool_run_id, interface_name, dst_ip_net, next_hop_ip_addr)"
@@ -644,7 +645,7 @@ namespace netmeld::datastore::utils {
     // TABLE: raw_devices
     // ----------------------------------------------------------------------
 
-    db.prepare
+    registry.declare
       ("insert_raw_device",
        "INSERT INTO raw_devices"
        "  (tool_run_id, device_id)"
@@ -656,7 +657,7 @@ namespace netmeld::datastore::utils {
     // TABLE: raw_devices_aaa
     // ----------------------------------------------------------------------
 
-    db.prepare
+    registry.declare
       ("insert_raw_device_aaa",
        "INSERT INTO raw_devices_aaa"
        "  (tool_run_id, device_id, aaa_command)"
@@ -668,7 +669,7 @@ namespace netmeld::datastore::utils {
     // TABLE: device_extra_weights
     // ----------------------------------------------------------------------
 
-    db.prepare
+    registry.declare
       ("insert_device_extra_weight",
        "INSERT INTO device_extra_weights"
        "  (device_id, extra_weight)"
@@ -680,7 +681,7 @@ namespace netmeld::datastore::utils {
     // TABLE: raw_device_virtualizations
     // ----------------------------------------------------------------------
 
-    db.prepare
+    registry.declare
       ("insert_raw_device_virtualization",
        "INSERT INTO raw_device_virtualizations"
        "  (tool_run_id, host_device_id, guest_device_id)"
@@ -692,7 +693,7 @@ namespace netmeld::datastore::utils {
     // TABLE: device_colors
     // ----------------------------------------------------------------------
 
-    db.prepare
+    registry.declare
       ("insert_device_color",
        "INSERT INTO device_colors"
        "  (device_id, color)"
@@ -704,7 +705,7 @@ namespace netmeld::datastore::utils {
     // TABLE: raw_device_hardware_information
     // ----------------------------------------------------------------------
 
-    db.prepare
+    registry.declare
       ("insert_raw_device_hardware_information",
        "INSERT INTO raw_device_hardware_information"
        "  (tool_run_id, device_id, device_type, vendor,"
@@ -719,7 +720,7 @@ namespace netmeld::datastore::utils {
     // TABLE: raw_device_interfaces
     // ----------------------------------------------------------------------
 
-    db.prepare
+    registry.declare
       ("insert_raw_device_interface",
        "INSERT INTO raw_device_interfaces"
        "  (tool_run_id, device_id, interface_name, media_type, is_up, description)"
@@ -731,7 +732,7 @@ namespace netmeld::datastore::utils {
     // TABLE: raw_device_mac_addrs
     // ----------------------------------------------------------------------
 
-    db.prepare
+    registry.declare
       ("insert_raw_device_mac_addr",
        "INSERT INTO raw_device_mac_addrs"
        "  (tool_run_id, device_id, interface_name, mac_addr)"
@@ -743,7 +744,7 @@ namespace netmeld::datastore::utils {
     // TABLE: raw_device_ip_addrs
     // ----------------------------------------------------------------------
 
-    db.prepare
+    registry.declare
       ("insert_raw_device_ip_addr",
        "INSERT INTO raw_device_ip_addrs"
        "  (tool_run_id, device_id, interface_name, ip_addr, ip_net)"
@@ -755,7 +756,7 @@ namespace netmeld::datastore::utils {
     // TABLE: raw_device_vrfs
     // ----------------------------------------------------------------------
 
-    db.prepare
+    registry.declare
       ("insert_raw_device_vrf",
        "INSERT INTO raw_device_vrfs"
        "  (tool_run_id, device_id, vrf_id)"
@@ -767,7 +768,7 @@ namespace netmeld::datastore::utils {
     // TABLE: raw_device_vrfs_interfaces
     // ----------------------------------------------------------------------
 
-    db.prepare
+    registry.declare
       ("insert_raw_device_vrf_interface",
        "INSERT INTO raw_device_vrfs_interfaces"
        "  (tool_run_id, device_id, vrf_id, interface_name)"
@@ -779,7 +780,7 @@ namespace netmeld::datastore::utils {
     // TABLE: raw_device_ip_routes
     // ----------------------------------------------------------------------
 
-    db.prepare
+    registry.declare
       ("insert_raw_device_ip_route",
        "INSERT INTO raw_device_ip_routes"
        "  (tool_run_id, device_id, vrf_id, table_id, is_active, dst_ip_net,"
@@ -797,7 +798,7 @@ namespace netmeld::datastore::utils {
     // TABLE: raw_device_link_connections
     // ----------------------------------------------------------------------
 
-    db.prepare
+    registry.declare
       ("insert_raw_device_link_connection",
        "INSERT INTO raw_device_link_connections"
        "  (tool_run_id, self_device_id, self_interface_name, peer_mac_addr)"
@@ -809,7 +810,7 @@ namespace netmeld::datastore::utils {
     // TABLE: raw_device_ip_servers
     // ----------------------------------------------------------------------
 
-    db.prepare
+    registry.declare
       ("insert_raw_device_ip_server",
        "INSERT INTO raw_device_ip_servers"
        "  (tool_run_id, device_id, interface_name, service_name,"
@@ -823,7 +824,7 @@ namespace netmeld::datastore::utils {
     // TABLE: raw_device_dns_resolvers
     // ----------------------------------------------------------------------
 
-    db.prepare
+    registry.declare
       ("insert_raw_device_dns_resolver",
        "INSERT INTO raw_device_dns_resolvers"
        "  (tool_run_id, device_id, interface_name, scope_domain,"
@@ -835,7 +836,7 @@ namespace netmeld::datastore::utils {
     // TABLE: raw_device_dns_search_domains
     // ----------------------------------------------------------------------
 
-    db.prepare
+    registry.declare
       ("insert_raw_device_dns_search_domain",
        "INSERT INTO raw_device_dns_search_domains"
        "  (tool_run_id, device_id, search_domain)"
@@ -847,7 +848,7 @@ namespace netmeld::datastore::utils {
     // TABLE: raw_device_dns_references
     // ----------------------------------------------------------------------
 
-    db.prepare
+    registry.declare
       ("insert_raw_device_dns_reference",
        "INSERT INTO raw_device_dns_references"
        "  (tool_run_id, device_id, hostname)"
@@ -859,7 +860,7 @@ namespace netmeld::datastore::utils {
     // TABLE: raw_mac_addrs
     // ----------------------------------------------------------------------
 
-    db.prepare
+    registry.declare
       ("insert_raw_mac_addr",
        "INSERT INTO raw_mac_addrs AS orig"
        "  (tool_run_id, mac_addr, is_responding)"
@@ -873,7 +874,7 @@ namespace netmeld::datastore::utils {
     // TABLE: raw_ip_addrs
     // ----------------------------------------------------------------------
 
-    db.prepare
+    registry.declare
       ("insert_raw_ip_addr",
        "INSERT INTO raw_ip_addrs AS orig"
        "  (tool_run_id, ip_addr, is_responding)"
@@ -887,7 +888,7 @@ namespace netmeld::datastore::utils {
     // TABLE: raw_mac_addrs_ip_addrs
     // ----------------------------------------------------------------------
 
-    db.prepare
+    registry.declare
       ("insert_raw_mac_addr_ip_addr",
        "INSERT INTO raw_mac_addrs_ip_addrs"
        "  (tool_run_id, mac_addr, ip_addr)"
@@ -899,7 +900,7 @@ namespace netmeld::datastore::utils {
     // TABLE: raw_hostnames
     // ----------------------------------------------------------------------
 
-    db.prepare
+    registry.declare
       ("insert_raw_hostname",
        "INSERT INTO raw_hostnames"
        "  (tool_run_id, ip_addr, hostname, reason)"
@@ -911,7 +912,7 @@ namespace netmeld::datastore::utils {
     // TABLE: raw_dns_lookups
     // ----------------------------------------------------------------------
 
-    db.prepare
+    registry.declare
       ("insert_raw_dns_lookup",
        "INSERT INTO raw_dns_lookups"
        "  (tool_run_id, resolver_ip_addr, resolver_port,"
@@ -931,7 +932,7 @@ namespace netmeld::datastore::utils {
     // TABLE: raw_operating_systems
     // ----------------------------------------------------------------------
 
-    db.prepare
+    registry.declare
       ("insert_raw_operating_system",
        "INSERT INTO raw_operating_systems AS orig"
        "  (tool_run_id, ip_addr,"
@@ -946,7 +947,7 @@ namespace netmeld::datastore::utils {
     // VLAN Related
     // ----------------------------------------------------------------------
 
-    db.prepare
+    registry.declare
       ("insert_raw_vlan",
        "INSERT INTO raw_vlans"
        "  (tool_run_id, vlan, description)"
@@ -954,7 +955,7 @@ namespace netmeld::datastore::utils {
        " ON CONFLICT"
        " DO NOTHING");
 
-    db.prepare
+    registry.declare
       ("insert_raw_device_vlan",
        "INSERT INTO raw_device_vlans"
        "  (tool_run_id, device_id, vlan, description)"
@@ -962,7 +963,16 @@ namespace netmeld::datastore::utils {
        " ON CONFLICT"
        " DO NOTHING");
 
-    db.prepare
+    registry.declare
+      ("insert_raw_device_vlan_range",
+       "INSERT INTO raw_device_vlans"
+       "  (tool_run_id, device_id, vlan)"
+       " SELECT ($1)::UUID, $2, (vlan)::VlanNumber"
+       " FROM generate_series(($3)::INT, ($4)::INT) AS vlan"
+       " ON CONFLICT"
+       " DO NOTHING");
+
+    registry.declare
       ("insert_raw_vlan_ip_net",
        "INSERT INTO raw_vlans_ip_nets"
        "  (tool_run_id, vlan, ip_net)"
@@ -970,7 +980,7 @@ namespace netmeld::datastore::utils {
        " ON CONFLICT"
        " DO NOTHING");
 
-    db.prepare
+    registry.declare
       ("insert_raw_device_vlan_ip_net",
        "INSERT INTO raw_device_vlans_ip_nets"
        "  (tool_run_id, device_id, vlan, ip_net)"
@@ -982,7 +992,7 @@ namespace netmeld::datastore::utils {
     // TABLE: raw_ip_nets
     // ----------------------------------------------------------------------
 
-    db.prepare
+    registry.declare
       ("insert_raw_ip_net",
        "INSERT INTO raw_ip_nets"
        "  (tool_run_id, ip_net, description)"
@@ -990,7 +1000,7 @@ namespace netmeld::datastore::utils {
        " ON CONFLICT"
        " DO NOTHING");
 
-    db.prepare
+    registry.declare
       ("update_raw_ip_net_description",
        "UPDATE raw_ip_nets"
        " SET description = nullif($3, '')"
@@ -1001,7 +1011,7 @@ namespace netmeld::datastore::utils {
     // TABLE: ip_nets_extra_weights
     // ----------------------------------------------------------------------
 
-    db.prepare
+    registry.declare
       ("insert_ip_net_extra_weight",
        "INSERT INTO ip_nets_extra_weights"
        "  (ip_net, extra_weight)"
@@ -1013,7 +1023,7 @@ namespace netmeld::datastore::utils {
     // TABLE: raw_ip_traceroutes
     // ----------------------------------------------------------------------
 
-    db.prepare
+    registry.declare
       ("insert_raw_ip_traceroute",
        "INSERT INTO raw_ip_traceroutes"
        "  (tool_run_id, hop_count, next_hop_ip_addr, dst_ip_addr)"
@@ -1025,7 +1035,7 @@ namespace netmeld::datastore::utils {
     // TABLE: raw_packages
     // ----------------------------------------------------------------------
 
-    db.prepare
+    registry.declare
       ("insert_raw_packages",
        "INSERT INTO raw_packages"
        "  (tool_run_id, package_state, package_name, package_version, package_architecture, package_description)"
@@ -1037,7 +1047,7 @@ namespace netmeld::datastore::utils {
     // TABLE: raw_ports
     // ----------------------------------------------------------------------
 
-    db.prepare
+    registry.declare
       ("insert_raw_port",
        "INSERT INTO raw_ports"
        "  (tool_run_id, ip_addr, protocol, port, port_state, port_reason)"
@@ -1050,7 +1060,7 @@ namespace netmeld::datastore::utils {
     // TABLE: raw_network_services
     // ----------------------------------------------------------------------
 
-    db.prepare
+    registry.declare
       ("insert_raw_network_service",
        "INSERT INTO raw_network_services"
        "  (tool_run_id, ip_addr, protocol, port,"
@@ -1065,7 +1075,7 @@ namespace netmeld::datastore::utils {
     // TABLE: raw_nessus_results
     // ----------------------------------------------------------------------
 
-    db.prepare
+    registry.declare
       ("insert_raw_nessus_result",
        "INSERT INTO raw_nessus_results"
        "  (tool_run_id, ip_addr, protocol, port,"
@@ -1081,7 +1091,7 @@ namespace netmeld::datastore::utils {
     // TABLE: raw_nessus_results_cves
     // ----------------------------------------------------------------------
 
-    db.prepare
+    registry.declare
       ("insert_raw_nessus_result_cve",
        "INSERT INTO raw_nessus_results_cves"
        "  (tool_run_id, ip_addr, protocol, port,"
@@ -1095,7 +1105,7 @@ namespace netmeld::datastore::utils {
     // TABLE: raw_nessus_results_metasploit_modules
     // ----------------------------------------------------------------------
 
-    db.prepare
+    registry.declare
       ("insert_raw_nessus_result_metasploit_module",
        "INSERT INTO raw_nessus_results_metasploit_modules"
        "  (tool_run_id, ip_addr, protocol, port,"
@@ -1109,7 +1119,7 @@ namespace netmeld::datastore::utils {
     // TABLE: raw_nse_results
     // ----------------------------------------------------------------------
 
-    db.prepare
+    registry.declare
       ("insert_raw_nse_result",
        "INSERT INTO raw_nse_results"
        "  (tool_run_id, ip_addr, protocol, port,"
@@ -1123,7 +1133,7 @@ namespace netmeld::datastore::utils {
     // TABLE: raw_ssh_host_public_keys
     // ----------------------------------------------------------------------
 
-    db.prepare
+    registry.declare
       ("insert_raw_ssh_host_public_key",
        "INSERT INTO raw_ssh_host_public_keys"
        "  (tool_run_id, ip_addr, protocol, port,"
@@ -1137,7 +1147,7 @@ namespace netmeld::datastore::utils {
     // TABLE: raw_ssh_host_algorithms
     // ----------------------------------------------------------------------
 
-    db.prepare
+    registry.declare
       ("insert_raw_ssh_host_algorithm",
        "INSERT INTO raw_ssh_host_algorithms"
        "  (tool_run_id, ip_addr, protocol, port,"
@@ -1151,7 +1161,7 @@ namespace netmeld::datastore::utils {
     // TABLE: InterfaceNetwork
     // ----------------------------------------------------------------------
 
-    db.prepare
+    registry.declare
       ("insert_raw_device_interfaces_cdp",
        "INSERT INTO raw_device_interfaces_cdp"
        "  (tool_run_id, device_id, interface_name, is_cdp_enabled)"
@@ -1159,7 +1169,7 @@ namespace netmeld::datastore::utils {
        " ON CONFLICT"
        " DO NOTHING");
 
-    db.prepare
+    registry.declare
       ("insert_raw_device_interfaces_bpdu",
        "INSERT INTO raw_device_interfaces_bpdu"
        "  (tool_run_id, device_id, interface_name, "
@@ -1168,7 +1178,7 @@ namespace netmeld::datastore::utils {
        " ON CONFLICT"
        " DO NOTHING");
 
-    db.prepare
+    registry.declare
       ("insert_raw_device_interfaces_portfast",
        "INSERT INTO raw_device_interfaces_portfast"
        "  (tool_run_id, device_id, interface_name, is_portfast_enabled)"
@@ -1176,7 +1186,7 @@ namespace netmeld::datastore::utils {
        " ON CONFLICT"
        " DO NOTHING");
 
-    db.prepare
+    registry.declare
       ("insert_raw_device_interfaces_mode",
        "INSERT INTO raw_device_interfaces_mode"
        "  (tool_run_id, device_id, interface_name, interface_mode)"
@@ -1184,7 +1194,7 @@ namespace netmeld::datastore::utils {
        " ON CONFLICT"
        " DO NOTHING");
 
-    db.prepare
+    registry.declare
       ("insert_raw_device_interfaces_port_security",
        "INSERT INTO raw_device_interfaces_port_security"
        "  (tool_run_id, device_id, interface_name, "
@@ -1194,7 +1204,7 @@ namespace netmeld::datastore::utils {
        " ON CONFLICT"
        " DO NOTHING");
 
-    db.prepare
+    registry.declare
       ("insert_raw_device_interfaces_port_security_mac_addr",
        "INSERT INTO raw_device_interfaces_port_security_mac_addrs"
        "  (tool_run_id, device_id, interface_name, mac_addr)"
@@ -1202,7 +1212,7 @@ namespace netmeld::datastore::utils {
        " ON CONFLICT"
        " DO NOTHING");
 
-    db.prepare
+    registry.declare
       ("insert_raw_device_interfaces_vlan",
        "INSERT INTO raw_device_interfaces_vlans"
        "  (tool_run_id, device_id, interface_name, vlan)"
@@ -1210,7 +1220,16 @@ namespace netmeld::datastore::utils {
        " ON CONFLICT"
        " DO NOTHING");
 
-    db.prepare
+    registry.declare
+      ("insert_raw_device_interfaces_vlan_range",
+       "INSERT INTO raw_device_interfaces_vlans"
+       "  (tool_run_id, device_id, interface_name, vlan)"
+       " SELECT ($1)::UUID, $2, $3, (vlan)::VlanNumber"
+       " FROM generate_series(($4)::INT, ($5)::INT) AS vlan"
+       " ON CONFLICT"
+       " DO NOTHING");
+
+    registry.declare
       ("insert_raw_device_interface_hierarchy",
        "INSERT INTO raw_device_interface_hierarchies"
        "  (tool_run_id, device_id, underlying_interface_name, virtual_interface_name)"
@@ -1222,7 +1241,7 @@ namespace netmeld::datastore::utils {
     // TABLE: Ac*Book
     // ----------------------------------------------------------------------
 
-    db.prepare
+    registry.declare
       ("insert_raw_device_ac_net",
        "INSERT INTO raw_device_ac_nets"
        "  (tool_run_id, device_id, net_set_id, net_set, net_set_data)"
@@ -1230,7 +1249,7 @@ namespace netmeld::datastore::utils {
        " ON CONFLICT"
        " DO NOTHING");
 
-    db.prepare
+    registry.declare
       ("insert_raw_device_ac_service",
        "INSERT INTO raw_device_ac_services"
        "  (tool_run_id, device_id, service_set, service_set_data)"
@@ -1242,7 +1261,7 @@ namespace netmeld::datastore::utils {
     // TABLE: AcRule
     // ----------------------------------------------------------------------
 
-    db.prepare
+    registry.declare
       ("insert_raw_device_ac_rule",
        "INSERT INTO raw_device_ac_rules"
        "  (tool_run_id, device_id, enabled, ac_id,"
@@ -1260,7 +1279,7 @@ namespace netmeld::datastore::utils {
     // TABLE: raw_device_acl_zones_bases
     // ----------------------------------------------------------------------
 
-    db.prepare(
+    registry.declare(
       "insert_raw_device_acl_zone_base",
       "INSERT INTO raw_device_acl_zones_bases"
       "  (tool_run_id, device_id, zone_id)"
@@ -1273,7 +1292,7 @@ namespace netmeld::datastore::utils {
     // TABLE: raw_device_acl_zones_interfaces
     // ----------------------------------------------------------------------
 
-    db.prepare(
+    registry.declare(
       "insert_raw_device_acl_zone_interface",
       "INSERT INTO raw_device_acl_zones_interfaces"
       "  (tool_run_id, device_id, zone_id, interface_name)"
@@ -1286,7 +1305,7 @@ namespace netmeld::datastore::utils {
     // TABLE: raw_device_acl_zones_includes
     // ----------------------------------------------------------------------
 
-    db.prepare(
+    registry.declare(
       "insert_raw_device_acl_zone_include",
       "INSERT INTO raw_device_acl_zones_includes"
       "  (tool_run_id, device_id, zone_id, included_id)"
@@ -1299,7 +1318,7 @@ namespace netmeld::datastore::utils {
     // TABLE: raw_device_acl_ip_nets_bases
     // ----------------------------------------------------------------------
 
-    db.prepare(
+    registry.declare(
       "insert_raw_device_acl_ip_net_base",
       "INSERT INTO raw_device_acl_ip_nets_bases"
       "  (tool_run_id, device_id, ip_net_set_namespace, ip_net_set_id)"
@@ -1312,7 +1331,7 @@ namespace netmeld::datastore::utils {
     // TABLE: raw_device_acl_ip_nets_ip_nets
     // ----------------------------------------------------------------------
 
-    db.prepare(
+    registry.declare(
       "insert_raw_device_acl_ip_net_ip_net",
       "INSERT INTO raw_device_acl_ip_nets_ip_nets"
       "  (tool_run_id, device_id, ip_net_set_namespace, ip_net_set_id, ip_net)"
@@ -1325,7 +1344,7 @@ namespace netmeld::datastore::utils {
     // TABLE: raw_device_acl_ip_nets_hostnames
     // ----------------------------------------------------------------------
 
-    db.prepare(
+    registry.declare(
       "insert_raw_device_acl_ip_net_hostname",
       "INSERT INTO raw_device_acl_ip_nets_hostnames"
       "  (tool_run_id, device_id, ip_net_set_namespace, ip_net_set_id, hostname)"
@@ -1338,7 +1357,7 @@ namespace netmeld::datastore::utils {
     // TABLE: raw_device_acl_ip_nets_includes
     // ----------------------------------------------------------------------
 
-    db.prepare(
+    registry.declare(
       "insert_raw_device_acl_ip_net_include",
       "INSERT INTO raw_device_acl_ip_nets_includes"
       "  (tool_run_id, device_id, ip_net_set_namespace, ip_net_set_id,"
@@ -1352,7 +1371,7 @@ namespace netmeld::datastore::utils {
     // TABLE: raw_device_acl_ports_bases
     // ----------------------------------------------------------------------
 
-    db.prepare(
+    registry.declare(
       "insert_raw_device_acl_port_base",
       "INSERT INTO raw_device_acl_ports_bases"
       "  (tool_run_id, device_id, port_set_id)"
@@ -1365,7 +1384,7 @@ namespace netmeld::datastore::utils {
     // TABLE: raw_device_acl_ports_ports
     // ----------------------------------------------------------------------
 
-    db.prepare(
+    registry.declare(
       "insert_raw_device_acl_port_port",
       "INSERT INTO raw_device_acl_ports_ports"
       "  (tool_run_id, device_id, port_set_id, port_range)"
@@ -1378,7 +1397,7 @@ namespace netmeld::datastore::utils {
     // TABLE: raw_device_acl_ports_includes
     // ----------------------------------------------------------------------
 
-    db.prepare(
+    registry.declare(
       "insert_raw_device_acl_port_include",
       "INSERT INTO raw_device_acl_ports_includes"
       "  (tool_run_id, device_id, port_set_id, included_id)"
@@ -1391,7 +1410,7 @@ namespace netmeld::datastore::utils {
     // TABLE: raw_device_acl_services_bases
     // ----------------------------------------------------------------------
 
-    db.prepare(
+    registry.declare(
       "insert_raw_device_acl_service_base",
       "INSERT INTO raw_device_acl_services_bases"
       "  (tool_run_id, device_id, service_id)"
@@ -1404,7 +1423,7 @@ namespace netmeld::datastore::utils {
     // TABLE: raw_device_acl_services_protocols
     // ----------------------------------------------------------------------
 
-    db.prepare(
+    registry.declare(
       "insert_raw_device_acl_service_protocol",
       "INSERT INTO raw_device_acl_services_protocols"
       "  (tool_run_id, device_id, service_id, protocol)"
@@ -1417,7 +1436,7 @@ namespace netmeld::datastore::utils {
     // TABLE: raw_device_acl_services_ports
     // ----------------------------------------------------------------------
 
-    db.prepare(
+    registry.declare(
       "insert_raw_device_acl_service_port",
       "INSERT INTO raw_device_acl_services_ports"
       "  (tool_run_id, device_id, service_id, protocol,"
@@ -1432,7 +1451,7 @@ namespace netmeld::datastore::utils {
     // TABLE: raw_device_acl_services_includes
     // ----------------------------------------------------------------------
 
-    db.prepare(
+    registry.declare(
       "insert_raw_device_acl_service_include",
       "INSERT INTO raw_device_acl_services_includes"
       "  (tool_run_id, device_id, service_id, included_id)"
@@ -1445,7 +1464,7 @@ namespace netmeld::datastore::utils {
     // TABLE: raw_device_acl_rules_ports
     // ----------------------------------------------------------------------
 
-    db.prepare(
+    registry.declare(
       "insert_raw_device_acl_rule_port",
       "INSERT INTO raw_device_acl_rules_ports"
       "  (tool_run_id, device_id, priority, action,"
@@ -1462,7 +1481,7 @@ namespace netmeld::datastore::utils {
     // TABLE: raw_device_acl_rules_services
     // ----------------------------------------------------------------------
 
-    db.prepare(
+    registry.declare(
       "insert_raw_device_acl_rule_service",
       "INSERT INTO raw_device_acl_rules_services"
       "  (tool_run_id, device_id, priority, action,"
@@ -1479,7 +1498,7 @@ namespace netmeld::datastore::utils {
     // TABLE: ToolObservations
     // ----------------------------------------------------------------------
 
-    db.prepare
+    registry.declare
       ("insert_raw_tool_observation",
        "INSERT INTO raw_tool_observations"
        "  (tool_run_id, category, observation)"
@@ -1491,7 +1510,7 @@ namespace netmeld::datastore::utils {
     // TABLE: Prowler*
     // ----------------------------------------------------------------------
 
-    db.prepare
+    registry.declare
     ("insert_raw_prowler_check", R"(
         INSERT INTO raw_prowler_checks
           (tool_run_id, account_number, timestamp, region,
@@ -1513,7 +1532,7 @@ namespace netmeld::datastore::utils {
     // SELECT statements
     // ----------------------------------------------------------------------
 
-    db.prepare
+    registry.declare
       ("select_raw_device_ip_addrs",
        "SELECT * FROM raw_device_ip_addrs"
        "  WHERE ($1 = tool_run_id)"
@@ -1521,7 +1540,107 @@ namespace netmeld::datastore::utils {
        "    AND ($3 = interface_name)"
       );
 
+    registry.declare
+      ("select_acl_device_ids",
+       "SELECT device_id FROM device_acl_rules_ports"
+       " UNION"
+       " SELECT device_id FROM device_acl_rules_services"
+       " ORDER BY device_id"
+      );
+
+    registry.declare
+      ("select_device_acl_rules",
+       "SELECT DISTINCT"
+       "   priority,"
+       "   action,"
+       "   incoming_zone_id,"
+       "   incoming_interface_name,"
+       "   outgoing_zone_id,"
+       "   outgoing_interface_name,"
+       "   src_ip_net_set_namespace,"
+       "   src_ip_net_set_id,"
+       "   src_ip_net,"
+       "   dst_ip_net_set_namespace,"
+       "   dst_ip_net_set_id,"
+       "   dst_ip_net,"
+       "   COALESCE(service_id, '') AS service_id,"
+       "   protocol,"
+       "   COALESCE(src_port_set_id, '') AS src_port_set_id,"
+       "   src_port_range,"
+       "   COALESCE(dst_port_set_id, '') AS dst_port_set_id,"
+       "   dst_port_range,"
+       "   COALESCE(description, '') AS description"
+       " FROM device_acl_rules"
+       " WHERE ($1 = device_id)"
+       " ORDER BY priority"
+      );
+
+    registry.declare
+      ("select_device_vrfs_ip_addrs",
+       "SELECT DISTINCT"
+       "   device_id,"
+       "   COALESCE(vrf_id, '') AS vrf_id,"
+       "   interface_name,"
+       "   ip_addr"
+       " FROM device_vrfs_ip_addrs"
+       " ORDER BY device_id, vrf_id, interface_name, ip_addr"
+      );
+
+    // Ordered so equal cost routes resolve the same way on every load
+    registry.declare
+      ("select_active_device_ip_routes",
+       "SELECT DISTINCT"
+       "   device_id,"
+       "   vrf_id,"
+       "   dst_ip_net,"
+       "   next_vrf_id,"
+       "   host(next_hop_ip_addr) AS next_hop_ip_addr,"
+       "   outgoing_interface_name,"
+       "   protocol,"
+       "   administrative_distance,"
+       "   metric"
+       " FROM device_ip_routes"
+       " WHERE is_active"
+       " ORDER BY device_id, vrf_id, dst_ip_net,"
+       "          administrative_distance, metric,"
+       "          next_vrf_id, next_hop_ip_addr, outgoing_interface_name"
+      );
+  }
+
+  const StatementRegistry&
+  awsStatements()
+  {
+    static const StatementRegistry registry {[](){
+      StatementRegistry tmp;
+      declareAws(tmp);
+      return tmp;
+    }()};
+
+    return registry;
+  }
+
+  const StatementRegistry&
+  commonStatements()
+  {
+    static const StatementRegistry registry {[](){
+      StatementRegistry tmp;
+      declareCommon(tmp);
+      return tmp;
+    }()};
+
+    return registry;
+  }
+
+  void
+  dbPrepareAws(pqxx::connection& db)
+  {
+    attachStatements(db, awsStatements());
+  }
 
+  void
+  dbPrepareCommon(pqxx::connection& db)
+  {
+    attachStatements(db, commonStatements());
     dbPrepareAws(db);
 
     // ----------------------------------------------------------------------
@@ -1531,7 +1650,7 @@ namespace netmeld::datastore::utils {
     if (true) {
       pqxx::work t{db};
 
-      t.exec_prepared("insert_tool_run",
+      execPrepared(t, "insert_tool_run",
         "32b2fd62-08ff-4d44-8da7-6fbd581a90c6",  // id
         "human",   // tool_name
         "human",   // command_line
@@ -1544,4 +1663,120 @@ namespace netmeld::datastore::utils {
 
     // ----------------------------------------------------------------------
   }
+
+  const std::vector<BulkStatement>&
+  dbBulkStatements()
+  {
+    // NOTE: Each merge mirrors the conversions of the prepared statement of
+    //       the same name, with $N replaced by the staging column cN.  Where
+    //       the prepared statement updates on conflict, the staged rows are
+    //       first aggregated per key as one INSERT may not touch a row twice.
+    static const std::vector<BulkStatement> statements {
+      { "insert_raw_ip_net", 3, "bulk_raw_ip_nets",
+        "INSERT INTO raw_ip_nets"
+        "  (tool_run_id, ip_net, description)"
+        " SELECT (c1)::UUID, network((c2)::INET), nullif(c3, '')"
+        " FROM bulk_raw_ip_nets"
+        " ON CONFLICT"
+        " DO NOTHING"
+      },
+      { "insert_raw_mac_addr", 3, "bulk_raw_mac_addrs",
+        "INSERT INTO raw_mac_addrs AS orig"
+        "  (tool_run_id, mac_addr, is_responding)"
+        " SELECT (c1)::UUID, (c2)::MACADDR, bool_or((c3)::BOOLEAN)"
+        " FROM bulk_raw_mac_addrs"
+        " GROUP BY 1, 2"
+        " ON CONFLICT"
+        "  (tool_run_id, mac_addr)"
+        " DO UPDATE"
+        "  SET is_responding ="
+        "        GREATEST(orig.is_responding, EXCLUDED.is_responding)"
+      },
+      { "insert_raw_ip_addr", 3, "bulk_raw_ip_addrs",
+        "INSERT INTO raw_ip_addrs AS orig"
+        "  (tool_run_id, ip_addr, is_responding)"
+        " SELECT (c1)::UUID, host((c2)::INET)::INET, bool_or((c3)::BOOLEAN)"
+        " FROM bulk_raw_ip_addrs"
+        " GROUP BY 1, 2"
+        " ON CONFLICT"
+        "  (tool_run_id, ip_addr)"
+        " DO UPDATE"
+        "  SET is_responding ="
+        "        GREATEST(orig.is_responding, EXCLUDED.is_responding)"
+      },
+      { "insert_raw_mac_addr_ip_addr", 3, "bulk_raw_mac_addrs_ip_addrs",
+        "INSERT INTO raw_mac_addrs_ip_addrs"
+        "  (tool_run_id, mac_addr, ip_addr)"
+        " SELECT (c1)::UUID, (c2)::MACADDR, host((c3)::INET)::INET"
+        " FROM bulk_raw_mac_addrs_ip_addrs"
+        " ON CONFLICT"
+        " DO NOTHING"
+      },
+      { "insert_raw_hostname", 4, "bulk_raw_hostnames",
+        "INSERT INTO raw_hostnames"
+        "  (tool_run_id, ip_addr, hostname, reason)"
+        " SELECT (c1)::UUID, host((c2)::INET)::INET, c3, c4"
+        " FROM bulk_raw_hostnames"
+        " ON CONFLICT"
+        " DO NOTHING"
+      },
+      { "insert_raw_operating_system", 7, "bulk_raw_operating_systems",
+        "INSERT INTO raw_operating_systems"
+        "  (tool_run_id, ip_addr,"
+        "   vendor_name, product_name, product_version, cpe, accuracy)"
+        " SELECT (c1)::UUID, host((c2)::INET)::INET,"
+        "        nullif(c3, ''), nullif(c4, ''), nullif(c5, ''),"
+        "        nullif(c6, ''), (c7)::FLOAT"
+        " FROM bulk_raw_operating_systems"
+        " ON CONFLICT"
+        " DO NOTHING"
+      },
+      { "insert_raw_port", 6, "bulk_raw_ports",
+        "INSERT INTO raw_ports"
+        "  (tool_run_id, ip_addr, protocol, port, port_state, port_reason)"
+        " SELECT (c1)::UUID, host((c2)::INET)::INET, c3, (c4)::PortNumber,"
+        "        nullif(c5, ''), nullif(c6, '')"
+        " FROM bulk_raw_ports"
+        " ON CONFLICT"
+        " DO NOTHING"
+      },
+      { "insert_raw_network_service", 8, "bulk_raw_network_services",
+        "INSERT INTO raw_network_services"
+        "  (tool_run_id, ip_addr, protocol, port,"
+        "   service_name, service_description, service_reason,"
+        "   observer_ip_addr)"
+        " SELECT (c1)::UUID, host((c2)::INET)::INET, c3, (c4)::PortNumber,"
+        "        nullif(c5, ''), nullif(c6, ''), nullif(c7, ''),"
+        "        (nullif(c8, '0.0.0.0/0'))::INET"
+        " FROM bulk_raw_network_services"
+        " ON CONFLICT"
+        " DO NOTHING"
+      },
+      { "insert_raw_device_ip_route", 14, "bulk_raw_device_ip_routes",
+        "INSERT INTO raw_device_ip_routes"
+        "  (tool_run_id, device_id, vrf_id, table_id, is_active, dst_ip_net,"
+        "   next_vrf_id, next_table_id, next_hop_ip_addr,"
+        "   outgoing_interface_name,"
+        "   protocol, administrative_distance, metric, description)"
+        " SELECT (c1)::UUID, c2, c3, c4, (c5)::BOOLEAN, network((c6)::INET),"
+        "        nullif(c7, ''), nullif(c8, ''),"
+        "        host((nullif(c9, '0.0.0.0/0'))::INET)::INET,"
+        "        nullif(c10, ''),"
+        "        nullif(c11, ''), (c12)::INT, (c13)::INT, nullif(c14, '')"
+        " FROM bulk_raw_device_ip_routes"
+        " ON CONFLICT"
+        " DO NOTHING"
+      },
+      { "insert_tool_run_ip_route", 4, "bulk_tool_run_ip_routes",
+        "INSERT INTO tool_run_ip_routes"
+        "  (tool_run_id, interface_name, dst_ip_net, next_hop_ip_addr)"
+        " SELECT (c1)::UUID, c2, network((c3)::INET), host((c4)::INET)::INET"
+        " FROM bulk_tool_run_ip_routes"
+        " ON CONFLICT"
+        " DO NOTHING"
+      },
+    };
+
+    return statements;
+  }
 }
@@ -27,16 +27,45 @@
 #ifndef QUERIES_COMMON_HPP
 #define QUERIES_COMMON_HPP
 
+#include <string>
+#include <vector>
+
 #include <pqxx/pqxx>
 
+#include <netmeld/datastore/utils/StatementRegistry.hpp>
+
 
 namespace netmeld::datastore::utils {
 
+  // Set-based replacement for a prepared INSERT statement.  Rows destined for
+  // the named prepared statement are COPY'd, as TEXT columns c1..cN, into
+  // stagingTable and then moved into the real table with mergeQuery.
+  struct BulkStatement
+  {
+    std::string name;
+    size_t      numParams;
+    std::string stagingTable;
+    std::string mergeQuery;
+  };
+
+  // Statements shared by the datastore tools, declared on first call
+  const StatementRegistry&
+  commonStatements();
+
+  const StatementRegistry&
+  awsStatements();
+
+  // Attach the shared statements to a connection; each is prepared on first
+  // use via execPrepared(), see prewarmStatements() to prepare eagerly
   void
   dbPrepareCommon(pqxx::connection&);
 
   void
   dbPrepareAws(pqxx::connection&);
 
+  // Ordered such that referenced tables are merged before referencing tables
+  const std::vector<BulkStatement>&
+  dbBulkStatements();
+
 }
 #endif  /* QUERIES_COMMON_HPP */
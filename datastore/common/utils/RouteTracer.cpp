@@ -0,0 +1,296 @@
+// =============================================================================
+// Copyright 2023 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+// =============================================================================
+
+#include <arpa/inet.h>
+
+#include <algorithm>
+#include <cctype>
+#include <tuple>
+
+#include <netmeld/datastore/utils/BulkRowSink.hpp>
+#include <netmeld/datastore/utils/RouteTracer.hpp>
+
+
+namespace {
+  std::string
+  toLower(std::string _value)
+  {
+    std::transform(_value.begin(), _value.end(), _value.begin(),
+                   [](unsigned char c){ return std::tolower(c); });
+    return _value;
+  }
+
+  // Interfaces which drop whatever is routed to them
+  bool
+  isDiscardIface(const std::string& _iface)
+  {
+    const auto iface {toLower(_iface)};
+    return iface.starts_with("null") || "discard" == iface
+        || "reject" == iface || "blackhole" == iface;
+  }
+
+  // Unspecified (0.0.0.0 or ::) next hops are treated as none
+  bool
+  isUsableNextHop(const netmeld::datastore::utils::IpKey& _ip)
+  {
+    return _ip.isValid()
+        && std::any_of(_ip.bytes.cbegin(), _ip.bytes.cend(),
+                       [](uint8_t b){ return 0 != b; });
+  }
+
+  std::string
+  toNetString(const netmeld::datastore::utils::IpKey& _net, uint8_t _length)
+  {
+    char buffer[INET6_ADDRSTRLEN] {};
+    inet_ntop((4 == _net.family) ? AF_INET : AF_INET6, _net.bytes.data(),
+              buffer, sizeof(buffer));
+    return std::string(buffer) + "/" + std::to_string(_length);
+  }
+}
+
+
+namespace netmeld::datastore::utils {
+
+  std::string
+  toString(RouteTraceResult _result)
+  {
+    switch (_result) {
+      case RouteTraceResult::DELIVERED: return "delivered";
+      case RouteTraceResult::EXITED:    return "exited";
+      case RouteTraceResult::BLACKHOLE: return "blackhole";
+      case RouteTraceResult::LOOP:      return "loop";
+      case RouteTraceResult::HOP_LIMIT: return "hop-limit";
+      case RouteTraceResult::NO_SOURCE: return "no-source";
+    }
+    return "unknown";
+  }
+
+  // ===========================================================================
+  // Methods
+  // ===========================================================================
+  uint32_t
+  RouteTracer::getTableId(const std::string& _deviceId,
+                          const std::string& _vrfId)
+  {
+    const auto [it, isNew] {
+      tableIds.try_emplace({_deviceId, _vrfId},
+                           static_cast<uint32_t>(tables.size()))
+    };
+    if (isNew) {
+      tables.push_back({_deviceId, _vrfId, {}});
+    }
+    return it->second;
+  }
+
+  // Keeps the lowest (distance, metric) route, the first one on a tie
+  bool
+  RouteTracer::addRoute(uint32_t _tableId, const IpKey& _net,
+                        uint8_t _length, Route&& _route)
+  {
+    auto& trie {tables[_tableId].routeIds};
+    if (const auto existing {trie.findExact(_net, _length)}; existing) {
+      const auto& kept {routes[*existing]};
+      if (std::tie(kept.adminDistance, kept.metric)
+          <= std::tie(_route.adminDistance, _route.metric))
+      {
+        return true;
+      }
+    }
+
+    routes.push_back(std::move(_route));
+    return trie.insert(_net, _length,
+                       static_cast<uint32_t>(routes.size() - 1));
+  }
+
+  uint32_t
+  RouteTracer::findSourceTable(const IpKey& _src) const
+  {
+    if (const auto it {addressOwners.find(_src)}; addressOwners.end() != it) {
+      return it->second;
+    }
+    return attachedNets.find(_src).value_or(NONE);
+  }
+
+  RouteTracer
+  RouteTracer::fromDatastore(pqxx::transaction_base& t)
+  {
+    RouteTracer tracer;
+
+    for (const auto& row : execPrepared(t, "select_device_vrfs_ip_addrs")) {
+      tracer.addInterfaceAddress(row.at("device_id").as<std::string>(),
+                                 row.at("vrf_id").as<std::string>(""),
+                                 row.at("interface_name").as<std::string>(),
+                                 row.at("ip_addr").as<std::string>());
+    }
+
+    for (const auto& row :
+         execPrepared(t, "select_active_device_ip_routes"))
+    {
+      RouteTracerRoute route;
+      route.deviceId          = row.at("device_id").as<std::string>();
+      route.vrfId             = row.at("vrf_id").as<std::string>();
+      route.dstIpNet          = row.at("dst_ip_net").as<std::string>();
+      route.nextVrfId         = row.at("next_vrf_id").as<std::string>("");
+      route.nextHopIpAddr     = row.at("next_hop_ip_addr").as<std::string>("");
+      route.outgoingIfaceName =
+        row.at("outgoing_interface_name").as<std::string>("");
+      route.protocol          = row.at("protocol").as<std::string>("");
+      route.adminDistance     =
+        row.at("administrative_distance").as<uint32_t>();
+      route.metric            = row.at("metric").as<uint32_t>();
+
+      tracer.addRoute(route);
+    }
+
+    return tracer;
+  }
+
+  bool
+  RouteTracer::addInterfaceAddress(const std::string& _deviceId,
+                                   const std::string& _vrfId,
+                                   const std::string& _ifaceName,
+                                   const std::string& _ipAddr)
+  {
+    IpKey   net;
+    uint8_t length {0};
+    if (!PrefixTrie::toNetwork(_ipAddr, net, length)) {
+      return false;
+    }
+    const auto ip {IpKey::fromString(_ipAddr.substr(0, _ipAddr.find('/')))};
+    const auto tableId {getTableId(_deviceId, _vrfId)};
+
+    addressOwners.try_emplace(ip, tableId);
+    if (!attachedNets.findExact(net, length)) {
+      attachedNets.insert(net, length, tableId);
+    }
+
+    Route route;
+    route.hop = {_deviceId, _vrfId, toNetString(net, length), "connected",
+                 "", "", _ifaceName};
+    return addRoute(tableId, net, length, std::move(route));
+  }
+
+  bool
+  RouteTracer::addRoute(const RouteTracerRoute& _route)
+  {
+    IpKey   net;
+    uint8_t length {0};
+    if (!PrefixTrie::toNetwork(_route.dstIpNet, net, length)) {
+      return false;
+    }
+    const auto tableId {getTableId(_route.deviceId, _route.vrfId)};
+
+    Route route;
+    route.hop = { _route.deviceId, _route.vrfId, _route.dstIpNet
+                , _route.protocol, _route.nextVrfId, _route.nextHopIpAddr
+                , _route.outgoingIfaceName
+                };
+    route.nextHopIp     = IpKey::fromString(_route.nextHopIpAddr);
+    route.adminDistance = _route.adminDistance;
+    route.metric        = _route.metric;
+    route.isDiscard     = isDiscardIface(_route.outgoingIfaceName);
+    if (!_route.nextVrfId.empty()) {
+      route.nextTableId = getTableId(_route.deviceId, _route.nextVrfId);
+    }
+
+    return addRoute(tableId, net, length, std::move(route));
+  }
+
+  RouteTrace
+  RouteTracer::trace(const IpKey& _src, const IpKey& _dst,
+                     size_t _maxHops) const
+  {
+    RouteTrace trace;
+
+    auto tableId {findSourceTable(_src)};
+    if (NONE == tableId || !_dst.isValid()) {
+      trace.result = RouteTraceResult::NO_SOURCE;
+      return trace;
+    }
+
+    const auto dstOwner {addressOwners.find(_dst)};
+    std::vector<uint32_t> visited;
+    while (true) {
+      if (addressOwners.end() != dstOwner && dstOwner->second == tableId) {
+        trace.result = RouteTraceResult::DELIVERED;
+        break;
+      }
+      if (std::find(visited.cbegin(), visited.cend(), tableId)
+          != visited.cend())
+      {
+        trace.result = RouteTraceResult::LOOP;
+        break;
+      }
+      if (trace.hops.size() >= _maxHops) {
+        trace.result = RouteTraceResult::HOP_LIMIT;
+        break;
+      }
+      visited.push_back(tableId);
+
+      const auto routeId {tables[tableId].routeIds.find(_dst)};
+      if (!routeId) {
+        trace.result = RouteTraceResult::BLACKHOLE;
+        break;
+      }
+      const auto& route {routes[*routeId]};
+      trace.hops.push_back(route.hop);
+
+      if (route.isDiscard) {
+        trace.result = RouteTraceResult::BLACKHOLE;
+        break;
+      }
+      if (NONE != route.nextTableId) {
+        tableId = route.nextTableId;
+        continue;
+      }
+      if (!isUsableNextHop(route.nextHopIp)) {
+        trace.result = RouteTraceResult::DELIVERED;
+        break;
+      }
+
+      const auto nextHop {addressOwners.find(route.nextHopIp)};
+      if (addressOwners.end() == nextHop) {
+        trace.result = RouteTraceResult::EXITED;
+        break;
+      }
+      tableId = nextHop->second;
+    }
+
+    return trace;
+  }
+
+  size_t
+  RouteTracer::getTableCount() const
+  {
+    return tables.size();
+  }
+
+  size_t
+  RouteTracer::getRouteCount() const
+  {
+    return routes.size();
+  }
+}
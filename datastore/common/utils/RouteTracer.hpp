@@ -0,0 +1,169 @@
+// =============================================================================
+// Copyright 2023 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+// =============================================================================
+
+#ifndef ROUTE_TRACER_HPP
+#define ROUTE_TRACER_HPP
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <pqxx/pqxx>
+
+#include <netmeld/datastore/utils/AddressKeys.hpp>
+#include <netmeld/datastore/utils/PrefixTrie.hpp>
+
+
+namespace netmeld::datastore::utils {
+
+  // A route as stored in the device_ip_routes view; an empty vrf is the
+  // default VRF and an empty next VRF stays within the route's VRF
+  struct RouteTracerRoute {
+    std::string deviceId;
+    std::string vrfId;
+    std::string dstIpNet;
+    std::string nextVrfId;
+    std::string nextHopIpAddr;
+    std::string outgoingIfaceName;
+    std::string protocol;
+    uint32_t    adminDistance {0};
+    uint32_t    metric        {0};
+  };
+
+  // The route a device selected while forwarding
+  struct RouteHop {
+    std::string deviceId;
+    std::string vrfId;
+    std::string dstIpNet;
+    std::string protocol;
+    std::string nextVrfId;
+    std::string nextHopIpAddr;
+    std::string outgoingIfaceName;
+  };
+
+  enum class RouteTraceResult {
+    DELIVERED, // destination owned by, or attached to, the last device
+    EXITED,    // next hop not owned by any known device
+    BLACKHOLE, // no route, or a discard route
+    LOOP,      // a device/VRF was revisited
+    HOP_LIMIT, // too many hops without another result
+    NO_SOURCE, // source not owned by, or attached to, any known device
+  };
+
+  std::string toString(RouteTraceResult);
+
+  struct RouteTrace {
+    std::vector<RouteHop> hops;
+    RouteTraceResult      result {RouteTraceResult::NO_SOURCE};
+  };
+
+  /* Hop-by-hop forwarding over the routing tables of many devices.
+
+     Every device/VRF has its own longest prefix match trie over its routes;
+     where several routes share a destination network the one with the
+     lowest administrative distance, then metric, is kept (the first one
+     added on a tie, so equal cost paths follow a single path).  Interface
+     addresses add AD 0 connected routes and are indexed, by address, to
+     resolve next hops to the peer device/VRF owning them and, by network,
+     to find the first device a source address is attached to.
+
+     A trace starts at the device/VRF owning or attached to the source and
+     follows the selected route's next VRF or next hop until the
+     destination is reached or some other result is determined.  A route
+     without a usable next hop delivers to the attached network.
+  */
+  class RouteTracer {
+    // =========================================================================
+    // Variables
+    // =========================================================================
+    private: // Variables will probably rarely appear at this scope
+      static constexpr uint32_t NONE {UINT32_MAX};
+
+      struct Route {
+        RouteHop hop;
+        IpKey    nextHopIp;
+        uint32_t nextTableId   {NONE};
+        uint32_t adminDistance {0};
+        uint32_t metric        {0};
+        bool     isDiscard     {false};
+      };
+
+      struct Table {
+        std::string deviceId;
+        std::string vrfId;
+        PrefixTrie  routeIds;
+      };
+
+      std::vector<Route> routes;
+      std::vector<Table> tables;
+      std::map<std::pair<std::string, std::string>, uint32_t> tableIds;
+
+      std::unordered_map<IpKey, uint32_t> addressOwners; // to table id
+      PrefixTrie                          attachedNets;  // to table id
+
+    protected: // Variables intended for internal/subclass API
+    public: // Variables should rarely appear at this scope
+
+    // =========================================================================
+    // Constructors
+    // =========================================================================
+    private: // Constructors which should be hidden from API users
+    protected: // Constructors part of subclass API
+    public: // Constructors part of public API
+      RouteTracer() = default;
+
+    // =========================================================================
+    // Methods
+    // =========================================================================
+    private: // Methods which should be hidden from API users
+      uint32_t getTableId(const std::string&, const std::string&);
+      bool addRoute(uint32_t, const IpKey&, uint8_t, Route&&);
+
+      uint32_t findSourceTable(const IpKey&) const;
+
+    protected: // Methods part of subclass API
+    public: // Methods part of public API
+      // Loaded from the active routes in the device_ip_routes view and the
+      // device_vrfs_ip_addrs view, using the dbPrepareCommon() statements
+      static RouteTracer fromDatastore(pqxx::transaction_base&);
+
+      // An "addr/prefix" assigned to the device's interface in the VRF;
+      // false if malformed
+      bool addInterfaceAddress(const std::string&, const std::string&,
+                               const std::string&, const std::string&);
+      // False if the destination network is malformed
+      bool addRoute(const RouteTracerRoute&);
+
+      RouteTrace trace(const IpKey&, const IpKey&, size_t = 64) const;
+
+      size_t getTableCount() const;
+      size_t getRouteCount() const;
+  };
+}
+#endif // ROUTE_TRACER_HPP
@@ -0,0 +1,159 @@
+// =============================================================================
+// Copyright 2023 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+// =============================================================================
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+#include <boost/test/unit_test.hpp>
+
+#include <netmeld/datastore/utils/RouteTracer.hpp>
+
+namespace nmdu = netmeld::datastore::utils;
+
+
+nmdu::RouteTracerRoute
+makeRoute(const std::string& _deviceId, const std::string& _dstIpNet,
+          const std::string& _nextHopIpAddr, uint32_t _adminDistance = 1,
+          const std::string& _outgoingIfaceName = "")
+{
+  nmdu::RouteTracerRoute route;
+  route.deviceId          = _deviceId;
+  route.dstIpNet          = _dstIpNet;
+  route.nextHopIpAddr     = _nextHopIpAddr;
+  route.outgoingIfaceName = _outgoingIfaceName;
+  route.protocol          = "static";
+  route.adminDistance     = _adminDistance;
+  return route;
+}
+
+nmdu::RouteTrace
+trace(const nmdu::RouteTracer& _tracer, const std::string& _src,
+      const std::string& _dst, size_t _maxHops = 64)
+{
+  return _tracer.trace(nmdu::IpKey::fromString(_src),
+                       nmdu::IpKey::fromString(_dst), _maxHops);
+}
+
+std::vector<std::string>
+devices(const nmdu::RouteTrace& _trace)
+{
+  std::vector<std::string> deviceIds;
+  for (const auto& hop : _trace.hops) {
+    deviceIds.push_back(hop.deviceId);
+  }
+  return deviceIds;
+}
+
+/* r1 --- r2 --- r3, with r2 also reaching a "blue" VRF and the internet
+*/
+nmdu::RouteTracer
+makeTopology()
+{
+  nmdu::RouteTracer tracer;
+
+  tracer.addInterfaceAddress("r1", "", "eth0", "10.0.1.1/24");
+  tracer.addInterfaceAddress("r1", "", "eth1", "10.0.12.1/30");
+  tracer.addRoute(makeRoute("r1", "0.0.0.0/0", "10.0.12.2"));
+  tracer.addRoute(makeRoute("r1", "10.0.3.0/24", "10.0.12.99", 110));
+  tracer.addRoute(makeRoute("r1", "10.0.3.0/24", "10.0.12.2", 1));
+
+  tracer.addInterfaceAddress("r2", "", "eth0", "10.0.12.2/30");
+  tracer.addInterfaceAddress("r2", "", "eth1", "10.0.23.1/30");
+  tracer.addInterfaceAddress("r2", "blue", "eth2", "192.168.0.1/24");
+  tracer.addRoute(makeRoute("r2", "0.0.0.0/0", "203.0.113.1"));
+  tracer.addRoute(makeRoute("r2", "10.0.1.0/24", "10.0.12.1"));
+  tracer.addRoute(makeRoute("r2", "10.0.3.0/24", "10.0.23.2"));
+  tracer.addRoute(makeRoute("r2", "10.8.0.0/16", "10.0.23.2"));
+  tracer.addRoute(makeRoute("r2", "10.9.0.0/16", "", 1, "Null0"));
+  auto leak {makeRoute("r2", "192.168.0.0/24", "")};
+  leak.nextVrfId = "blue";
+  tracer.addRoute(leak);
+
+  tracer.addInterfaceAddress("r3", "", "eth0", "10.0.23.2/30");
+  tracer.addInterfaceAddress("r3", "", "eth1", "10.0.3.1/24");
+  tracer.addRoute(makeRoute("r3", "0.0.0.0/0", "10.0.23.1"));
+
+  tracer.addInterfaceAddress("r4", "", "eth0", "10.0.4.1/24");
+
+  return tracer;
+}
+
+BOOST_AUTO_TEST_CASE(testTraceResults)
+{
+  const auto tracer {makeTopology()};
+  BOOST_TEST(5 == tracer.getTableCount());
+
+  // Lower administrative distance is kept, whatever the order added
+  auto result {trace(tracer, "10.0.1.5", "10.0.3.7")};
+  BOOST_TEST((nmdu::RouteTraceResult::DELIVERED == result.result));
+  BOOST_TEST((std::vector<std::string>{"r1", "r2", "r3"}
+              == devices(result)));
+  BOOST_TEST("10.0.12.2" == result.hops[0].nextHopIpAddr);
+  BOOST_TEST("connected" == result.hops[2].protocol);
+  BOOST_TEST("eth1" == result.hops[2].outgoingIfaceName);
+
+  // Owned by r3, so no route is needed there
+  result = trace(tracer, "10.0.1.5", "10.0.3.1");
+  BOOST_TEST((nmdu::RouteTraceResult::DELIVERED == result.result));
+  BOOST_TEST((std::vector<std::string>{"r1", "r2"} == devices(result)));
+
+  // Sourced from a device's own address, back the other way
+  result = trace(tracer, "10.0.23.2", "10.0.1.5");
+  BOOST_TEST((nmdu::RouteTraceResult::DELIVERED == result.result));
+  BOOST_TEST((std::vector<std::string>{"r3", "r2", "r1"}
+              == devices(result)));
+
+  result = trace(tracer, "10.0.1.5", "192.168.0.9");
+  BOOST_TEST((nmdu::RouteTraceResult::DELIVERED == result.result));
+  BOOST_TEST((std::vector<std::string>{"r1", "r2", "r2"}
+              == devices(result)));
+  BOOST_TEST("blue" == result.hops[1].nextVrfId);
+  BOOST_TEST("blue" == result.hops[2].vrfId);
+
+  result = trace(tracer, "10.0.1.5", "8.8.8.8");
+  BOOST_TEST((nmdu::RouteTraceResult::EXITED == result.result));
+  BOOST_TEST("203.0.113.1" == result.hops.back().nextHopIpAddr);
+
+  result = trace(tracer, "10.0.1.5", "10.9.1.1");
+  BOOST_TEST((nmdu::RouteTraceResult::BLACKHOLE == result.result));
+  BOOST_TEST("Null0" == result.hops.back().outgoingIfaceName);
+
+  result = trace(tracer, "10.0.4.5", "8.8.8.8");
+  BOOST_TEST((nmdu::RouteTraceResult::BLACKHOLE == result.result));
+  BOOST_TEST(result.hops.empty());
+
+  result = trace(tracer, "10.0.1.5", "10.8.1.1");
+  BOOST_TEST((nmdu::RouteTraceResult::LOOP == result.result));
+  BOOST_TEST((std::vector<std::string>{"r1", "r2", "r3"}
+              == devices(result)));
+
+  result = trace(tracer, "10.0.1.5", "10.0.3.7", 2);
+  BOOST_TEST((nmdu::RouteTraceResult::HOP_LIMIT == result.result));
+  BOOST_TEST(2 == result.hops.size());
+
+  result = trace(tracer, "172.16.0.1", "10.0.3.7");
+  BOOST_TEST((nmdu::RouteTraceResult::NO_SOURCE == result.result));
+  BOOST_TEST("no-source" == nmdu::toString(result.result));
+}
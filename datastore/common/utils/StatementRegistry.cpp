@@ -0,0 +1,178 @@
+// =============================================================================
+// Copyright 2023 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+// =============================================================================
+
+#include <algorithm>
+#include <mutex>
+#include <set>
+
+#include <netmeld/datastore/utils/StatementRegistry.hpp>
+
+
+namespace netmeld::datastore::utils {
+
+  // ===========================================================================
+  // Helpers
+  // ===========================================================================
+  struct ConnectionStatements
+  {
+    int                                   backendPid {0};
+    std::vector<const StatementRegistry*> registries;
+    std::set<std::string>                 prepared;
+  };
+
+  static std::map<const pqxx::connection*, ConnectionStatements> connections;
+  static std::mutex connectionsMutex;
+
+
+  // ===========================================================================
+  // Methods
+  // ===========================================================================
+  void
+  StatementRegistry::declare(const std::string& name, const std::string& sql)
+  {
+    statements[name] = sql;
+  }
+
+  const std::string*
+  StatementRegistry::find(const std::string& name) const
+  {
+    const auto& it {statements.find(name)};
+    return (statements.end() == it) ? nullptr : &it->second;
+  }
+
+  std::vector<std::string>
+  StatementRegistry::getNames() const
+  {
+    std::vector<std::string> names;
+    for (const auto& [name, _] : statements) {
+      names.push_back(name);
+    }
+    return names;
+  }
+
+  size_t
+  StatementRegistry::size() const
+  {
+    return statements.size();
+  }
+
+
+  // ===========================================================================
+  // Free functions
+  // ===========================================================================
+  void
+  attachStatements(pqxx::connection& db, const StatementRegistry& registry)
+  {
+    std::lock_guard<std::mutex> lock(connectionsMutex);
+    auto& state {connections[&db]};
+
+    // A new connection may reuse the address of a closed one
+    const auto pid {db.backendpid()};
+    if (state.backendPid != pid) {
+      state = ConnectionStatements();
+      state.backendPid = pid;
+    }
+
+    const auto& registries {state.registries};
+    if (registries.end() ==
+        std::find(registries.begin(), registries.end(), &registry))
+    {
+      state.registries.push_back(&registry);
+    }
+  }
+
+  void
+  ensurePrepared(pqxx::connection& db, const std::string& name)
+  {
+    const std::string* sql {nullptr};
+    {
+      std::lock_guard<std::mutex> lock(connectionsMutex);
+      const auto& it {connections.find(&db)};
+      if (connections.end() == it || it->second.prepared.count(name)) {
+        return;
+      }
+      for (const auto* registry : it->second.registries) {
+        sql = registry->find(name);
+        if (nullptr != sql) { break; }
+      }
+    }
+    if (nullptr == sql) { return; }
+
+    // A connection is only used by one thread, so prepare without the lock
+    db.prepare(name, *sql);
+
+    std::lock_guard<std::mutex> lock(connectionsMutex);
+    connections[&db].prepared.insert(name);
+  }
+
+  const std::string*
+  findStatement(const pqxx::connection& db, const std::string& name)
+  {
+    std::lock_guard<std::mutex> lock(connectionsMutex);
+    const auto& it {connections.find(&db)};
+    if (connections.end() == it) { return nullptr; }
+    for (const auto* registry : it->second.registries) {
+      const auto* sql {registry->find(name)};
+      if (nullptr != sql) { return sql; }
+    }
+    return nullptr;
+  }
+
+  void
+  prewarmStatements(pqxx::connection& db,
+                    const std::vector<std::string>& names)
+  {
+    if (!names.empty()) {
+      for (const auto& name : names) {
+        ensurePrepared(db, name);
+      }
+      return;
+    }
+
+    std::vector<std::string> allNames;
+    {
+      std::lock_guard<std::mutex> lock(connectionsMutex);
+      const auto& it {connections.find(&db)};
+      if (connections.end() == it) { return; }
+      for (const auto* registry : it->second.registries) {
+        const auto& registryNames {registry->getNames()};
+        allNames.insert(allNames.end(),
+                        registryNames.begin(), registryNames.end());
+      }
+    }
+    for (const auto& name : allNames) {
+      ensurePrepared(db, name);
+    }
+  }
+
+  size_t
+  preparedStatementCount(const pqxx::connection& db)
+  {
+    std::lock_guard<std::mutex> lock(connectionsMutex);
+    const auto& it {connections.find(&db)};
+    return (connections.end() == it) ? 0 : it->second.prepared.size();
+  }
+}
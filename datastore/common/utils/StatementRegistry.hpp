@@ -0,0 +1,104 @@
+// =============================================================================
+// Copyright 2023 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+// =============================================================================
+
+#ifndef STATEMENT_REGISTRY_HPP
+#define STATEMENT_REGISTRY_HPP
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include <pqxx/pqxx>
+
+
+namespace netmeld::datastore::utils {
+
+  /* Named SQL statements, declared once per process.
+
+     A registry is attached to a connection instead of preparing every
+     statement up front; each statement is then prepared on that connection
+     the first time it is executed through execPrepared() (or when explicitly
+     pre-warmed).  Statements not in any attached registry are left to pqxx,
+     so tool specific statements prepared directly on the connection still
+     work.
+  */
+  class StatementRegistry {
+    // =========================================================================
+    // Variables
+    // =========================================================================
+    private: // Variables will probably rarely appear at this scope
+      std::map<std::string, std::string> statements;
+
+    protected: // Variables intended for internal/subclass API
+    public: // Variables should rarely appear at this scope
+
+    // =========================================================================
+    // Constructors
+    // =========================================================================
+    private: // Constructors which should be hidden from API users
+    protected: // Constructors part of subclass API
+    public: // Constructors part of public API
+      StatementRegistry() = default;
+
+    // =========================================================================
+    // Methods
+    // =========================================================================
+    private: // Methods which should be hidden from API users
+    protected: // Methods part of subclass API
+    public: // Methods part of public API
+      // Later declarations of the same name replace earlier ones
+      void declare(const std::string&, const std::string&);
+
+      // Statement text, or nullptr if not declared
+      const std::string* find(const std::string&) const;
+      std::vector<std::string> getNames() const;
+      size_t size() const;
+  };
+
+  // Make a registry's statements available, on first use, to a connection;
+  // a connection may have several registries attached
+  void
+  attachStatements(pqxx::connection&, const StatementRegistry&);
+
+  // Prepare the named statement, if declared for the connection and not yet
+  // prepared on it
+  void
+  ensurePrepared(pqxx::connection&, const std::string&);
+
+  // Text of the named statement declared for the connection, or nullptr
+  const std::string*
+  findStatement(const pqxx::connection&, const std::string&);
+
+  // Prepare the named statements now, or every attached statement if none
+  // are named
+  void
+  prewarmStatements(pqxx::connection&, const std::vector<std::string>& = {});
+
+  // Number of attached statements actually prepared on the connection
+  size_t
+  preparedStatementCount(const pqxx::connection&);
+}
+#endif // STATEMENT_REGISTRY_HPP
@@ -0,0 +1,67 @@
+// =============================================================================
+// Copyright 2023 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+// =============================================================================
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+#include <boost/test/unit_test.hpp>
+
+#include <netmeld/datastore/utils/QueriesCommon.hpp>
+#include <netmeld/datastore/utils/StatementRegistry.hpp>
+
+namespace nmdu = netmeld::datastore::utils;
+
+
+BOOST_AUTO_TEST_CASE(testDeclare)
+{
+  nmdu::StatementRegistry registry;
+  BOOST_TEST(0 == registry.size());
+  BOOST_TEST(nullptr == registry.find("select_one"));
+
+  registry.declare("select_one", "SELECT 1");
+  registry.declare("select_two", "SELECT 2");
+  BOOST_TEST(2 == registry.size());
+  BOOST_TEST("SELECT 1" == *registry.find("select_one"));
+
+  registry.declare("select_one", "SELECT 1 AS one");
+  BOOST_TEST(2 == registry.size());
+  BOOST_TEST("SELECT 1 AS one" == *registry.find("select_one"));
+
+  const std::vector<std::string> names {"select_one", "select_two"};
+  BOOST_TEST(names == registry.getNames());
+}
+
+BOOST_AUTO_TEST_CASE(testCommonStatements)
+{
+  const auto& common {nmdu::commonStatements()};
+  BOOST_TEST(&common == &nmdu::commonStatements());
+  BOOST_TEST(nullptr != common.find("insert_tool_run"));
+  BOOST_TEST(nullptr != common.find("select_device_acl_rules"));
+  BOOST_TEST(nullptr == common.find("insert_raw_aws_cidr_block"));
+
+  const auto& aws {nmdu::awsStatements()};
+  BOOST_TEST(nullptr != aws.find("insert_raw_aws_cidr_block"));
+  BOOST_TEST(nullptr == aws.find("insert_tool_run"));
+}
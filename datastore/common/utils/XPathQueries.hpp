@@ -0,0 +1,67 @@
+// =============================================================================
+// Copyright 2023 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+// =============================================================================
+
+#ifndef XPATH_QUERIES_HPP
+#define XPATH_QUERIES_HPP
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+
+#include <pugixml.hpp>
+
+
+namespace netmeld::datastore::utils {
+
+  /* Compiled XPath queries, shared by the pugixml based importers.
+
+     Passing a string to select_node(s)() makes pugixml parse and compile the
+     expression on every call; a query from here is compiled once per process
+     and can be evaluated concurrently.  Only pass fixed expressions, as
+     queries are never released.
+
+     Header only, as the datastore library does not link against pugixml.
+  */
+  inline const pugi::xpath_query&
+  xpathQuery(std::string_view expression)
+  {
+    static std::mutex mutex;
+    static std::map<std::string, std::unique_ptr<const pugi::xpath_query>,
+                    std::less<>> queries;
+
+    std::lock_guard<std::mutex> lock {mutex};
+    auto it {queries.find(expression)};
+    if (queries.end() == it) {
+      std::string key {expression};
+      auto query {std::make_unique<const pugi::xpath_query>(key.c_str())};
+      it = queries.emplace(std::move(key), std::move(query)).first;
+    }
+    return *(it->second);
+  }
+}
+#endif // XPATH_QUERIES_HPP
@@ -0,0 +1,227 @@
+// =============================================================================
+// Copyright 2023 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+// =============================================================================
+
+#include <algorithm>
+#include <cctype>
+#include <stdexcept>
+
+#include <netmeld/datastore/utils/XmlElementReader.hpp>
+
+
+namespace netmeld::datastore::utils {
+
+  // ===========================================================================
+  // Constructors
+  // ===========================================================================
+  XmlElementReader::XmlElementReader(std::istream& _in,
+                                     const std::set<std::string>& _names,
+                                     size_t _chunkSize) :
+    in(_in),
+    names(_names.begin(), _names.end()),
+    chunkSize(std::max<size_t>(1, _chunkSize))
+  {}
+
+
+  // ===========================================================================
+  // Methods
+  // ===========================================================================
+  const std::string&
+  XmlElementReader::readRootElement()
+  {
+    if (rootElement.empty()) {
+      std::string name, xml;
+      scan(name, xml, true);
+    }
+    return rootElement;
+  }
+
+  bool
+  XmlElementReader::next(std::string& name, std::string& xml)
+  {
+    return scan(name, xml, false);
+  }
+
+  bool
+  XmlElementReader::scan(std::string& name, std::string& xml, bool rootOnly)
+  {
+    while (true) {
+      auto lt {buffer.find('<', pos)};
+      while (std::string::npos == lt) {
+        pos = buffer.size();
+        if (!fill()) {
+          if (0 < captureDepth) {
+            throw std::runtime_error("XML ended within element: "
+                                     + captureName);
+          }
+          return false;
+        }
+        lt = buffer.find('<', pos);
+      }
+      pos = lt;
+
+      // Enough to tell the kind of markup apart
+      while (buffer.size() - pos < 9 && fill()) {}
+      const std::string_view markup {std::string_view(buffer).substr(pos)};
+      if (markup.starts_with("<!--")) {
+        pos = find("-->", 4) + 3;
+        continue;
+      }
+      if (markup.starts_with("<![CDATA[")) {
+        pos = find("]]>", 9) + 3;
+        continue;
+      }
+      if (markup.starts_with("<?")) {
+        pos = find("?>", 2) + 2;
+        continue;
+      }
+      if (markup.starts_with("<!")) {
+        pos = findTagEnd() + 1;
+        continue;
+      }
+
+      const size_t end {findTagEnd()};
+      if ('/' == buffer[pos + 1]) {
+        if (  0 < captureDepth
+           && tagName(pos + 2, end) == captureName
+           && 0 == --captureDepth)
+        {
+          name = captureName;
+          xml  = buffer.substr(captureStart, end + 1 - captureStart);
+          pos  = end + 1;
+          return true;
+        }
+        pos = end + 1;
+        continue;
+      }
+
+      const bool selfClosing {'/' == buffer[end - 1]};
+      const auto tag {tagName(pos + 1, end)};
+      if (rootElement.empty()) {
+        rootElement = buffer.substr(pos, end - pos - (selfClosing ? 1 : 0))
+                    + "/>";
+        pos = end + 1;
+        if (rootOnly) {
+          return true;
+        }
+        continue;
+      }
+
+      if (0 < captureDepth) {
+        if (!selfClosing && tag == captureName) {
+          ++captureDepth;
+        }
+      } else if (names.contains(tag)) {
+        if (selfClosing) {
+          name = tag;
+          xml  = buffer.substr(pos, end + 1 - pos);
+          pos  = end + 1;
+          return true;
+        }
+        captureName  = tag;
+        captureStart = pos;
+        captureDepth = 1;
+      }
+      pos = end + 1;
+    }
+  }
+
+  bool
+  XmlElementReader::fill()
+  {
+    // Keep the element being captured, otherwise only unscanned data
+    const size_t keep {(0 < captureDepth) ? captureStart : pos};
+    buffer.erase(0, keep);
+    pos -= keep;
+    captureStart = 0;
+
+    const size_t size {buffer.size()};
+    buffer.resize(size + chunkSize);
+    in.read(buffer.data() + size, static_cast<std::streamsize>(chunkSize));
+    buffer.resize(size + static_cast<size_t>(in.gcount()));
+
+    return size < buffer.size();
+  }
+
+  size_t
+  XmlElementReader::find(std::string_view text, size_t offset)
+  {
+    while (true) {
+      const auto found {buffer.find(text, pos + offset)};
+      if (std::string::npos != found) {
+        return found;
+      }
+
+      // Resume where a match split across chunks could start
+      const size_t scanned {buffer.size() - pos};
+      offset = std::max(offset, scanned - std::min(scanned, text.size() - 1));
+      if (!fill()) {
+        throw std::runtime_error("XML ended before: " + std::string(text));
+      }
+    }
+  }
+
+  size_t
+  XmlElementReader::findTagEnd()
+  {
+    char   quote    {'\0'};
+    size_t brackets {0}; // DOCTYPE internal subset
+    for (size_t i {1}; ; ++i) {
+      while (buffer.size() <= pos + i) {
+        if (!fill()) {
+          throw std::runtime_error("XML ended within a tag");
+        }
+      }
+
+      const char c {buffer[pos + i]};
+      if ('\0' != quote) {
+        if (quote == c) {
+          quote = '\0';
+        }
+      } else if ('"' == c || '\'' == c) {
+        quote = c;
+      } else if ('[' == c) {
+        ++brackets;
+      } else if (']' == c && 0 < brackets) {
+        --brackets;
+      } else if ('>' == c && 0 == brackets) {
+        return pos + i;
+      }
+    }
+  }
+
+  std::string_view
+  XmlElementReader::tagName(size_t first, size_t last) const
+  {
+    size_t i {first};
+    while (  i < last
+          && !std::isspace(static_cast<unsigned char>(buffer[i]))
+          && '/' != buffer[i] && '>' != buffer[i])
+    {
+      ++i;
+    }
+    return std::string_view(buffer).substr(first, i - first);
+  }
+}
@@ -0,0 +1,108 @@
+// =============================================================================
+// Copyright 2023 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+// =============================================================================
+
+#ifndef XML_ELEMENT_READER_HPP
+#define XML_ELEMENT_READER_HPP
+
+#include <istream>
+#include <set>
+#include <string>
+#include <string_view>
+
+
+namespace netmeld::datastore::utils {
+
+  /* Pulls selected elements out of an XML stream without building a DOM.
+
+     Input is read in fixed size chunks and only scanned for markup
+     boundaries, so memory is bounded by the largest returned element rather
+     than the whole document.  Each element whose name is in the given set
+     (at any depth, but not within another returned element) is returned as
+     standalone XML text, ready for a DOM parser (e.g., pugixml) to load.
+     Comments, CDATA, processing instructions, and DOCTYPE are skipped.
+
+     Assumes an ASCII compatible encoding (e.g., UTF-8); malformed or
+     truncated input throws std::runtime_error.
+  */
+  class XmlElementReader {
+    // =========================================================================
+    // Variables
+    // =========================================================================
+    private: // Variables will probably rarely appear at this scope
+      std::istream& in;
+      std::set<std::string, std::less<>> names;
+      size_t chunkSize;
+
+      std::string buffer;
+      size_t      pos {0}; // next unscanned offset within buffer
+
+      // Element currently being returned, if captureDepth is not 0
+      std::string captureName;
+      size_t      captureStart {0};
+      size_t      captureDepth {0};
+
+      std::string rootElement;
+
+    protected: // Variables intended for internal/subclass API
+    public: // Variables should rarely appear at this scope
+
+    // =========================================================================
+    // Constructors
+    // =========================================================================
+    private: // Constructors which should be hidden from API users
+    protected: // Constructors part of subclass API
+    public: // Constructors part of public API
+      XmlElementReader(std::istream&, const std::set<std::string>&,
+                       size_t=(1 << 20));
+      XmlElementReader(const XmlElementReader&) = delete;
+      XmlElementReader& operator=(const XmlElementReader&) = delete;
+
+    // =========================================================================
+    // Methods
+    // =========================================================================
+    private: // Methods which should be hidden from API users
+      // Drop scanned data no longer needed and append a chunk; false at EOF
+      bool fill();
+      // Offset of the first byte of the text, searching from pos + offset
+      size_t find(std::string_view, size_t);
+      // Offset of the '>' closing the tag starting at pos
+      size_t findTagEnd();
+      std::string_view tagName(size_t, size_t) const;
+      // Advance to the next returned element, or just past the root start
+      // tag if requested; false at EOF
+      bool scan(std::string&, std::string&, bool);
+
+    protected: // Methods part of subclass API
+    public: // Methods part of public API
+      // Start tag of the document element, self-closed so it can be parsed
+      // on its own; empty if the stream contains no elements
+      const std::string& readRootElement();
+
+      // False once the stream is exhausted
+      bool next(std::string&, std::string&);
+  };
+}
+#endif // XML_ELEMENT_READER_HPP
@@ -0,0 +1,152 @@
+// =============================================================================
+// Copyright 2023 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+// =============================================================================
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+#include <boost/test/unit_test.hpp>
+
+#include <sstream>
+#include <vector>
+
+#include <netmeld/datastore/utils/XmlElementReader.hpp>
+
+namespace nmdu = netmeld::datastore::utils;
+
+
+namespace {
+  std::vector<std::string>
+  readAll(const std::string& text, const std::set<std::string>& names,
+          size_t chunkSize)
+  {
+    std::istringstream iss {text};
+    nmdu::XmlElementReader reader {iss, names, chunkSize};
+
+    std::vector<std::string> elements;
+    std::string name, xml;
+    while (reader.next(name, xml)) {
+      elements.push_back(name + "=" + xml);
+    }
+    return elements;
+  }
+}
+
+
+BOOST_AUTO_TEST_CASE(testNext)
+{
+  const std::string text {
+    R"STR(<?xml version="1.0" encoding="UTF-8"?>
+    <!DOCTYPE nmaprun [ <!ENTITY x "y"> ]>
+    <?xml-stylesheet href="file:///nmap.xsl" type="text/xsl"?>
+    <nmaprun start="123" args="a > b">
+    <scaninfo protocol="tcp"/>
+    <!-- <host>commented</host> -->
+    <hosthint><address addr="1.2.3.4"/></hosthint>
+    <host><address addr="1.2.3.4"/><hostnames/>
+    <hostscript><script output="&lt;/host&gt; > "/></hostscript>
+    <![CDATA[</host>]]>
+    <host nested="yes"></host>
+    </host>
+    <host
+      starttime="1" ><ports><port portid='22'/></ports></host >
+    <runstats><finished time="456"/></runstats>
+    </nmaprun>
+    )STR"};
+
+  const std::vector<std::string> expected {
+    R"(scaninfo=<scaninfo protocol="tcp"/>)",
+    R"(host=<host><address addr="1.2.3.4"/><hostnames/>
+    <hostscript><script output="&lt;/host&gt; > "/></hostscript>
+    <![CDATA[</host>]]>
+    <host nested="yes"></host>
+    </host>)",
+    R"(host=<host
+      starttime="1" ><ports><port portid='22'/></ports></host >)",
+  };
+
+  // Element boundaries must not depend on where chunks split the input
+  for (size_t chunkSize : {1, 2, 3, 7, 64, 1 << 20}) {
+    BOOST_TEST_CONTEXT("chunkSize: " << chunkSize) {
+      const auto& elements {readAll(text, {"host", "scaninfo"}, chunkSize)};
+      BOOST_TEST(expected == elements, boost::test_tools::per_element());
+    }
+  }
+
+  BOOST_TEST(readAll(text, {"ReportHost"}, 5).empty());
+  BOOST_TEST(readAll("", {"host"}, 5).empty());
+}
+
+BOOST_AUTO_TEST_CASE(testReadRootElement)
+{
+  {
+    std::istringstream iss {R"(<?xml version="1.0"?><nmaprun start="1" >)"
+                            R"(<host/></nmaprun>)"};
+    nmdu::XmlElementReader reader {iss, {"host"}, 4};
+
+    BOOST_TEST(R"(<nmaprun start="1" />)" == reader.readRootElement());
+    BOOST_TEST(R"(<nmaprun start="1" />)" == reader.readRootElement());
+
+    std::string name, xml;
+    BOOST_TEST(reader.next(name, xml));
+    BOOST_TEST("host" == name);
+    BOOST_TEST("<host/>" == xml);
+    BOOST_TEST(!reader.next(name, xml));
+  }
+
+  {
+    std::istringstream iss {"<root/>"};
+    nmdu::XmlElementReader reader {iss, {"host"}};
+    BOOST_TEST("<root/>" == reader.readRootElement());
+  }
+
+  {
+    std::istringstream iss {"no markup"};
+    nmdu::XmlElementReader reader {iss, {"host"}};
+    BOOST_TEST(reader.readRootElement().empty());
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testTruncated)
+{
+  std::string name, xml;
+
+  {
+    std::istringstream iss {"<a><host><b/>"};
+    nmdu::XmlElementReader reader {iss, {"host"}, 2};
+    BOOST_CHECK_THROW(reader.next(name, xml), std::runtime_error);
+  }
+
+  {
+    std::istringstream iss {R"(<a><host attr="x>)"};
+    nmdu::XmlElementReader reader {iss, {"host"}, 2};
+    BOOST_CHECK_THROW(reader.next(name, xml), std::runtime_error);
+  }
+
+  {
+    std::istringstream iss {"<a><!-- <host> -"};
+    nmdu::XmlElementReader reader {iss, {"host"}, 2};
+    BOOST_CHECK_THROW(reader.next(name, xml), std::runtime_error);
+  }
+}
@@ -40,26 +40,26 @@ typedef std::vector<PortRange>                   Results;
 // Parser definition
 // =============================================================================
 class Parser :
-  public qi::grammar<nmdp::IstreamIter, Results(), qi::ascii::blank_type>
+  public qi::grammar<nmdp::ConstIter, Results(), qi::ascii::blank_type>
 {
   // ===========================================================================
   // Variables
   // ===========================================================================
   private:
     // Rules
-    qi::rule<nmdp::IstreamIter, Results(), qi::ascii::blank_type>
+    qi::rule<nmdp::ConstIter, Results(), qi::ascii::blank_type>
       start;
 
-    qi::rule<nmdp::IstreamIter, PortRange(), qi::ascii::blank_type>
+    qi::rule<nmdp::ConstIter, PortRange(), qi::ascii::blank_type>
       line;
 
-    qi::rule<nmdp::IstreamIter, PortRange(), qi::ascii::blank_type>
+    qi::rule<nmdp::ConstIter, PortRange(), qi::ascii::blank_type>
       portRange;
 
-    qi::rule<nmdp::IstreamIter, std::string()>
+    qi::rule<nmdp::ConstIter, std::string()>
       protocol;
 
-    qi::rule<nmdp::IstreamIter, qi::ascii::blank_type>
+    qi::rule<nmdp::ConstIter, qi::ascii::blank_type>
       comment;
 
   // ===========================================================================
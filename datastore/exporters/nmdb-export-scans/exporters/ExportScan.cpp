@@ -24,6 +24,8 @@
 // Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
 // =============================================================================
 
+#include <algorithm>
+
 #include "ExportScan.hpp"
 
 namespace netmeld::export_scans {
@@ -78,4 +80,20 @@ namespace netmeld::export_scans {
 
     return name;
   }
+
+  void
+  ExportScan::logRowRate(
+      const std::string& report, size_t count,
+      const std::chrono::steady_clock::time_point& start
+    ) const
+  {
+    const std::chrono::duration<double> elapsed
+      {std::chrono::steady_clock::now() - start};
+    const auto seconds {std::max(elapsed.count(), 0.001)};
+
+    LOG_INFO << "Exported " << count << " " << report << " rows in "
+             << elapsed.count() << "s ("
+             << static_cast<size_t>(static_cast<double>(count) / seconds)
+             << " rows/s)" << std::endl;
+  }
 }
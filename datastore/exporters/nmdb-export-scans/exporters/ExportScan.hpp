@@ -27,6 +27,8 @@
 #ifndef EXPORT_SCAN_HPP
 #define EXPORT_SCAN_HPP
 
+#include <chrono>
+
 #include <pqxx/pqxx>
 
 #include <netmeld/core/utils/LoggerSingleton.hpp>
@@ -46,6 +48,9 @@ namespace netmeld::export_scans {
     protected: // Variables intended for internal/subclass API
       pqxx::connection db;
 
+      // Rows fetched per round trip when streaming through a cursor
+      static constexpr long CURSOR_ROWS {10000};
+
     public: // Variables should rarely appear at this scope
 
     // ========================================================================
@@ -68,6 +73,9 @@ namespace netmeld::export_scans {
           pqxx::read_transaction&, const std::string&
         ) const;
 
+      void logRowRate(const std::string&, size_t,
+                      const std::chrono::steady_clock::time_point&) const;
+
     public: // Methods part of public API
       virtual void exportScan(const std::unique_ptr<Writer>&) = 0;
   };
@@ -32,50 +32,7 @@ namespace netmeld::export_scans {
   // ========================================================================
   InterNetwork::InterNetwork(const std::string& dbConnInfo) :
     ExportScan(dbConnInfo)
-  {
-    db.prepare(
-      "select_internetwork_scan_source",
-      R"(
-      SELECT DISTINCT src_ip_addr
-      FROM inter_network_ports
-      ORDER BY src_ip_addr
-      )");
-
-    db.prepare(
-      "select_internetwork_scan_router",
-      R"(
-      SELECT DISTINCT next_hop_ip_addr
-      FROM inter_network_ports
-      WHERE ($1 = src_ip_addr)
-      ORDER BY next_hop_ip_addr
-      )");
-
-    db.prepare(
-      "select_internetwork_scan_destination",
-      R"(
-      SELECT DISTINCT dst_ip_addr
-      FROM inter_network_ports
-      WHERE ($1 = src_ip_addr)
-        AND ($2 = next_hop_ip_addr)
-      ORDER BY dst_ip_addr
-      )");
-
-    db.prepare(
-      "select_internetwork_scan_port",
-      R"(
-      SELECT DISTINCT
-        protocol, port, port_state, port_reason
-      FROM inter_network_ports
-      WHERE ($1 = src_ip_addr)
-        AND ($2 = next_hop_ip_addr)
-        AND ($3 = dst_ip_addr)
-        AND ( ( ( ('open' = port_state) OR ('closed' = port_state) )
-                AND NOT ( ('ip' = protocol) OR ('' = protocol)
-                          OR ('-1' = port) ) )
-              OR ( ('-1' = port) AND ('open' = port_state) ) )
-      ORDER BY protocol, port, port_state, port_reason
-      )");
-  }
+  {}
 
   // ========================================================================
   // Methods
@@ -109,40 +66,94 @@ namespace netmeld::export_scans {
   }
 
   void
-  InterNetwork::exportFromDb(const auto& writer, const std::string& srcIp)
+  InterNetwork::exportScan(const std::unique_ptr<Writer>& writer)
   {
-    pqxx::read_transaction t {db};
-
-    pqxx::result routerRows
-      {t.exec_prepared("select_internetwork_scan_router", srcIp)};
-    for (const auto& routerRow : routerRows) {
-      std::string rtrIp;
-      routerRow.at("next_hop_ip_addr").to(rtrIp);
-
-      std::string rtrName {getHostname(t, rtrIp)};
+    // Single ordered pass: every source with its routed ports and the
+    // router and destination hostnames; a source with nothing reportable
+    // yields one row with a NULL router so it still gets an (empty) report
+    const std::string query {R"(
+      WITH raw AS (
+        SELECT src_ip_addr, next_hop_ip_addr, dst_ip_addr,
+               protocol, port, port_state, port_reason
+        FROM inter_network_ports
+      ), ports AS (
+        SELECT DISTINCT *
+        FROM raw
+        WHERE ( ( ('open' = port_state) OR ('closed' = port_state) )
+                AND NOT ( ('ip' = protocol) OR ('' = protocol)
+                          OR ('-1' = port) ) )
+           OR ( ('-1' = port) AND ('open' = port_state) )
+      ), names AS (
+        SELECT ip_addr, string_agg(device_id, ', ') AS device_id
+        FROM device_ip_addrs
+        GROUP BY ip_addr
+      )
+      SELECT
+        src.src_ip_addr,
+        p.next_hop_ip_addr, rn.device_id AS next_hop_name,
+        p.dst_ip_addr, dn.device_id AS dst_name,
+        p.protocol, p.port, p.port_state, p.port_reason
+      FROM (SELECT DISTINCT src_ip_addr FROM raw) AS src
+      LEFT JOIN ports AS p
+        ON (src.src_ip_addr = p.src_ip_addr)
+      LEFT JOIN names AS rn
+        ON (p.next_hop_ip_addr = rn.ip_addr)
+      LEFT JOIN names AS dn
+        ON (p.dst_ip_addr = dn.ip_addr)
+      ORDER BY src.src_ip_addr, p.next_hop_ip_addr, p.dst_ip_addr,
+               p.protocol, p.port, p.port_state, p.port_reason
+      )"};
+
+    const auto start {std::chrono::steady_clock::now()};
+    size_t rowCount {0};
+
+    std::ostream* out {nullptr};
+    std::string srcIp;
+
+    auto fClose = [&]() {
+      if (nullptr != out) {
+        writer->endInterNetwork(*out);
+        writer->closeStream();
+        out = nullptr;
+      }
+    };
 
-      pqxx::result destinationRows {
-        t.exec_prepared("select_internetwork_scan_destination", srcIp, rtrIp)
-      };
-      for (const auto& destinationRow : destinationRows) {
-        std::string dstIp;
-        destinationRow.at("dst_ip_addr").to(dstIp);
+    pqxx::read_transaction t {db};
+    {
+      pqxx::icursorstream cursor
+        {t, query, "inter_network_scan", CURSOR_ROWS};
+      pqxx::result rows;
+      while (cursor >> rows) {
+        for (const auto& row : rows) {
+          std::string tmpSrcIp;
+          row.at("src_ip_addr").to(tmpSrcIp);
+          if (nullptr == out || srcIp != tmpSrcIp) {
+            fClose();
+            srcIp = tmpSrcIp;
+            out = &writer->openStream("inter-network-from-" + srcIp);
+            writer->beginInterNetwork(*out, srcIp);
+          }
 
-        std::string dstIpName {getHostname(t, dstIp)};
+          if (row.at("next_hop_ip_addr").is_null()) {
+            continue;
+          }
 
-        pqxx::result portRows {
-          t.exec_prepared("select_internetwork_scan_port",
-              srcIp, rtrIp, dstIp)
-        };
-        for (const auto& portRow : portRows) {
+          std::string rtrIp;
+          row.at("next_hop_ip_addr").to(rtrIp);
+          std::string rtrName;
+          row.at("next_hop_name").to(rtrName);
+          std::string dstIp;
+          row.at("dst_ip_addr").to(dstIp);
+          std::string dstIpName;
+          row.at("dst_name").to(dstIpName);
           std::string protocol;
-          portRow.at("protocol").to(protocol);
+          row.at("protocol").to(protocol);
           std::string port;
-          portRow.at("port").to(port);
+          row.at("port").to(port);
           std::string portState;
-          portRow.at("port_state").to(portState);
+          row.at("port_state").to(portState);
           std::string portReason;
-          portRow.at("port_reason").to(portReason);
+          row.at("port_reason").to(portReason);
 
           if ("-1" == port) {
             port = "other";
@@ -152,40 +163,24 @@ namespace netmeld::export_scans {
             rtrIp, rtrName, dstIp, dstIpName,
             port, protocol, portState, portReason
           };
-          writer->addRow(data);
+          writer->addInterNetworkRow(*out, data);
+          ++rowCount;
         }
       }
     }
     t.abort();
-  }
-
-  void
-  InterNetwork::exportScan(const std::unique_ptr<Writer>& writer)
-  {
-    pqxx::read_transaction t {db};
-
-    pqxx::result sourceRows
-      {t.exec_prepared("select_internetwork_scan_source")};
-    t.abort();
 
-    auto fWrite = [&](const std::string& srcIp) {
+    if (nullptr == out && srcIp.empty()) {
+      exportTemplate(writer);
       writer->writeData(
-        "inter-network-from-" + srcIp,
-        writer->getInterNetwork(srcIp)
+        "inter-network-from-IP/CIDR",
+        writer->getInterNetwork("IP/CIDR")
       );
       writer->clearData();
-    };
-
-    std::string srcIp {"IP/CIDR"};
-    if (0 == sourceRows.size()) {
-      exportTemplate(writer);
-      fWrite(srcIp);
-    } else {
-      for (const auto& sourceRow : sourceRows) {
-        sourceRow.at("src_ip_addr").to(srcIp);
-        exportFromDb(writer, srcIp);
-        fWrite(srcIp);
-      }
+      return;
     }
+    fClose();
+
+    logRowRate("inter-network", rowCount, start);
   }
 }
@@ -55,7 +55,6 @@ namespace netmeld::export_scans {
     // ======================================================================
     private: // Methods which should be hidden from API users
       void exportTemplate(const auto&) const;
-      void exportFromDb(const auto&, const std::string&);
 
     protected: // Methods part of subclass API
     public: // Methods part of public API
@@ -32,52 +32,7 @@ namespace netmeld::export_scans {
   // ========================================================================
   IntraNetwork::IntraNetwork(const std::string& dbConnInfo) :
     ExportScan(dbConnInfo)
-  {
-    db.prepare(
-      "select_intranetwork_scan_source",
-      R"(
-      SELECT DISTINCT src_ip_addr
-      FROM intra_network_ports
-      ORDER BY src_ip_addr
-      )");
-
-    db.prepare(
-      "select_intranetwork_scan_destination",
-      R"(
-      SELECT DISTINCT dst_ip_addr
-      FROM intra_network_ports
-      WHERE ($1 = src_ip_addr)
-      ORDER BY dst_ip_addr
-      )");
-
-    db.prepare(
-      "select_intranetwork_scan_port",
-      R"(
-      SELECT DISTINCT
-        protocol, port, port_state, port_reason
-      FROM intra_network_ports
-      WHERE ($1 = src_ip_addr)
-        AND ($2 = dst_ip_addr)
-        AND ( ( ( ('open' = port_state) OR ('closed' = port_state) )
-                AND NOT ( ('ip' = protocol)
-                          OR ('' = protocol)
-                          OR ('-1' = port) ) )
-              OR ( ('-1' = port) AND ('open' = port_state) ) )
-      ORDER BY protocol, port, port_state, port_reason
-      )");
-
-    db.prepare(
-      "select_intranetwork_scan_service",
-      R"(
-      SELECT DISTINCT
-        service_name, service_description, service_reason
-      FROM network_services
-      WHERE ($1 = ip_addr)
-        AND ($2 = protocol)
-        AND ($3 = port)
-      ORDER BY service_reason
-      )");
-  }
+  {}
 
   // ========================================================================
   // Methods
@@ -105,95 +60,152 @@ namespace netmeld::export_scans {
   }
 
   void
-  IntraNetwork::exportFromDb(const auto& writer, const std::string& srcIp)
+  IntraNetwork::exportScan(const std::unique_ptr<Writer>& writer)
   {
+    // Single ordered pass: every source with its ports, hostnames, and
+    // candidate services; a source with nothing reportable yields one row
+    // with a NULL destination so it still gets an (empty) report
+    const std::string query {R"(
+      WITH raw AS (
+        SELECT src_ip_addr, dst_ip_addr,
+               protocol, port, port_state, port_reason
+        FROM intra_network_ports
+      ), ports AS (
+        SELECT DISTINCT *
+        FROM raw
+        WHERE ( ('open' = port_state) OR ('closed' = port_state) )
+          AND NOT ( ('ip' = protocol) OR ('' = protocol) OR ('-1' = port) )
+      ), names AS (
+        SELECT ip_addr, string_agg(device_id, ', ') AS device_id
+        FROM device_ip_addrs
+        GROUP BY ip_addr
+      ), services AS (
+        SELECT DISTINCT
+          ip_addr, protocol, port,
+          service_name, service_description, service_reason
+        FROM network_services
+      )
+      SELECT
+        src.src_ip_addr, p.dst_ip_addr, n.device_id,
+        p.protocol, p.port, p.port_state, p.port_reason,
+        s.ip_addr AS service_ip_addr,
+        s.service_name, s.service_description, s.service_reason
+      FROM (SELECT DISTINCT src_ip_addr FROM raw) AS src
+      LEFT JOIN ports AS p
+        ON (src.src_ip_addr = p.src_ip_addr)
+      LEFT JOIN names AS n
+        ON (p.dst_ip_addr = n.ip_addr)
+      LEFT JOIN services AS s
+        ON (p.dst_ip_addr = s.ip_addr)
+       AND (p.protocol = s.protocol)
+       AND (p.port = s.port)
+      ORDER BY src.src_ip_addr, p.dst_ip_addr,
+               p.protocol, p.port, p.port_state, p.port_reason,
+               s.service_reason
+      )"};
+
+    const auto start {std::chrono::steady_clock::now()};
+    size_t rowCount {0};
+
+    std::ostream* out {nullptr};
+    std::string srcIp;
+    std::string portKey;
+    std::vector<std::string> data;
+
+    auto fFlush = [&]() {
+      if (!data.empty()) {
+        writer->addIntraNetworkRow(*out, data);
+        data.clear();
+        ++rowCount;
+      }
+    };
+    auto fClose = [&]() {
+      fFlush();
+      if (nullptr != out) {
+        writer->endIntraNetwork(*out);
+        writer->closeStream();
+        out = nullptr;
+      }
+    };
+
     pqxx::read_transaction t {db};
-    pqxx::result destinationRows
-      {t.exec_prepared("select_intranetwork_scan_destination", srcIp)};
-
-    for (const auto& destinationRow : destinationRows) {
-      std::string dstIp;
-      destinationRow.at("dst_ip_addr").to(dstIp);
-
-      std::string dstIpName {getHostname(t, dstIp)};
-
-      pqxx::result portRows
-        {t.exec_prepared("select_intranetwork_scan_port", srcIp, dstIp)};
-
-      for (const auto& portRow : portRows) {
-        std::string protocol;
-        portRow.at("protocol").to(protocol);
-        std::string port;
-        portRow.at("port").to(port);
-        std::string portState;
-        portRow.at("port_state").to(portState);
-        std::string portReason;
-        portRow.at("port_reason").to(portReason);
-
-        pqxx::result serviceRows {
-          t.exec_prepared("select_intranetwork_scan_service",
-                          dstIp, protocol, port)
-        };
-
-        std::string serviceName;
-        std::string serviceDesc;
-        for (const auto& serviceRow : serviceRows) {
+    {
+      pqxx::icursorstream cursor
+        {t, query, "intra_network_scan", CURSOR_ROWS};
+      pqxx::result rows;
+      while (cursor >> rows) {
+        for (const auto& row : rows) {
+          std::string tmpSrcIp;
+          row.at("src_ip_addr").to(tmpSrcIp);
+          if (nullptr == out || srcIp != tmpSrcIp) {
+            fClose();
+            srcIp = tmpSrcIp;
+            out = &writer->openStream("intra-network-from-" + srcIp);
+            writer->beginIntraNetwork(*out, srcIp);
+          }
+
+          if (row.at("dst_ip_addr").is_null()) {
+            continue;
+          }
+
+          std::string dstIp;
+          row.at("dst_ip_addr").to(dstIp);
+          std::string dstIpName;
+          row.at("device_id").to(dstIpName);
+          std::string protocol;
+          row.at("protocol").to(protocol);
+          std::string port;
+          row.at("port").to(port);
+          std::string portState;
+          row.at("port_state").to(portState);
+          std::string portReason;
+          row.at("port_reason").to(portReason);
+
+          // Rows for one port are contiguous, one per candidate service
+          std::string tmpKey {dstIp + '\n' + protocol + '\n' + port + '\n'
+                              + portState + '\n' + portReason};
+          if (data.empty() || portKey != tmpKey) {
+            fFlush();
+            portKey = tmpKey;
+            data = {
+              dstIp, dstIpName, port, protocol, portState, portReason,
+              "", ""
+            };
+          }
+
+          if (row.at("service_ip_addr").is_null()) {
+            continue;
+          }
+
           std::string tmpSrvcName;
-          serviceRow.at("service_name").to(tmpSrvcName);
+          row.at("service_name").to(tmpSrvcName);
           std::string tmpSrvcDesc;
-          serviceRow.at("service_description").to(tmpSrvcDesc);
+          row.at("service_description").to(tmpSrvcDesc);
           std::string tmpSrvcReason;
-          serviceRow.at("service_reason").to(tmpSrvcReason);
+          row.at("service_reason").to(tmpSrvcReason);
 
           if (   ("probed" == tmpSrvcReason)
-              || (serviceName.empty() && "unknown" != tmpSrvcName))
+              || (data[6].empty() && "unknown" != tmpSrvcName))
           {
-            serviceName = tmpSrvcName;
-            serviceDesc = tmpSrvcDesc;
+            data[6] = tmpSrvcName;
+            data[7] = tmpSrvcDesc;
           }
         }
-
-        if ("-1" == port) {
-          continue;
-        }
-
-        std::vector<std::string> data {
-          dstIp, dstIpName, port, protocol, portState, portReason,
-          serviceName, serviceDesc
-        };
-        writer->addRow(data);
       }
     }
     t.abort();
-  }
-
-  void
-  IntraNetwork::exportScan(const std::unique_ptr<Writer>& writer)
-  {
-    pqxx::read_transaction t {db};
-
-    pqxx::result sourceRows
-      {t.exec_prepared("select_intranetwork_scan_source")};
-    t.abort();
 
-    auto fWrite = [&](const std::string& srcIp) {
+    if (nullptr == out && srcIp.empty()) {
+      exportTemplate(writer);
       writer->writeData(
-        "intra-network-from-" + srcIp,
-        writer->getIntraNetwork(srcIp)
+        "intra-network-from-IP/CIDR",
+        writer->getIntraNetwork("IP/CIDR")
       );
       writer->clearData();
-    };
-
-    std::string srcIp {"IP/CIDR"};
-    if (0 == sourceRows.size()) {
-      exportTemplate(writer);
-      fWrite(srcIp);
-    } else {
-      for (const auto& sourceRow : sourceRows) {
-        sourceRow.at("src_ip_addr").to(srcIp);
-        exportFromDb(writer, srcIp);
-        fWrite(srcIp);
-      }
+      return;
     }
+    fClose();
+
+    logRowRate("intra-network", rowCount, start);
   }
 }
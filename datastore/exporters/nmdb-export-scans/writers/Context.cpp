@@ -48,90 +48,126 @@ namespace netmeld::export_scans {
   }
 
   std::string
-  Context::getIntraNetwork(const std::string& srcIp) const
+  Context::getIntraNetwork(const std::string& srcIp)
   {
     std::ostringstream oss(std::ios_base::binary | std::ios_base::trunc);
 
-    codeSetup(oss);
-    codeTableIntra(oss, srcIp);
-
-    std::string lastIpName;
+    beginIntraNetwork(oss, srcIp);
     for (const auto& row : rows) {
-      std::string ip          {""}; // row[0]
-      std::string hostname    {""}; // row[1]
-      std::string portProto   {row[2] + '/' + row[3]};
-      std::string pps         {row[4] + '/' + row[5]};
-      std::string serviceName {row[6]};
-      std::string serviceDesc {row[7]};
-
-      std::string rowFrame    {""};
-      std::string nextIpName  {row[0] + row[1]};
-      if (lastIpName != nextIpName) {
-        rowFrame  = "[topframe=on]";
-        ip        = row[0];
-        hostname  = '(' + row[1] + ')';
-      }
-      lastIpName = nextIpName;
+      addIntraNetworkRow(oss, row);
+    }
+    endIntraNetwork(oss);
 
-      pps = replaceAll(pps, "|", "\\|");
+    return oss.str();
+  }
 
-      codeRowIntra(oss,
-          rowFrame, ip, hostname, portProto, pps, serviceName, serviceDesc
-        );
+  void
+  Context::beginIntraNetwork(std::ostream& os, const std::string& srcIp)
+  {
+    codeSetup(os);
+    codeTableIntra(os, srcIp);
+
+    lastIpName.clear();
+  }
+
+  void
+  Context::addIntraNetworkRow(
+      std::ostream& os, const std::vector<std::string>& row)
+  {
+    std::string ip          {""}; // row[0]
+    std::string hostname    {""}; // row[1]
+    std::string portProto   {row[2] + '/' + row[3]};
+    std::string pps         {row[4] + '/' + row[5]};
+    std::string serviceName {row[6]};
+    std::string serviceDesc {row[7]};
+
+    std::string rowFrame    {""};
+    std::string nextIpName  {row[0] + row[1]};
+    if (lastIpName != nextIpName) {
+      rowFrame  = "[topframe=on]";
+      ip        = row[0];
+      hostname  = '(' + row[1] + ')';
     }
+    lastIpName = nextIpName;
 
-    codeTableClose(oss);
-    codeTeardown(oss);
+    pps = replaceAll(pps, "|", "\\|");
 
-    return oss.str();
+    codeRowIntra(os,
+        rowFrame, ip, hostname, portProto, pps, serviceName, serviceDesc
+      );
+  }
+
+  void
+  Context::endIntraNetwork(std::ostream& os)
+  {
+    codeTableClose(os);
+    codeTeardown(os);
   }
 
   std::string
-  Context::getInterNetwork(const std::string& srcIp) const
+  Context::getInterNetwork(const std::string& srcIp)
   {
     std::ostringstream oss(std::ios_base::binary | std::ios_base::trunc);
 
-    codeSetup(oss);
-    codeTableInter(oss, srcIp);
-
-    std::string lastHopIpName;
-    std::string lastIpName;
+    beginInterNetwork(oss, srcIp);
     for (const auto& row : rows) {
-      std::string nextHopIp   {""}; // row[0]
-      std::string nextHopName {""}; // row[1]
-      std::string destIp      {""}; // row[2]
-      std::string destName    {""}; // row[3]
-      std::string portProto   {row[4] + '/' + row[5]};
-      std::string pps         {row[6] + '/' + row[7]};
+      addInterNetworkRow(oss, row);
+    }
+    endInterNetwork(oss);
 
-      std::string rowFrame {""};
+    return oss.str();
+  }
 
-      std::string nextHopIpName {row[0] + row[1]};
-      if (lastHopIpName != nextHopIpName) {
-        rowFrame    = "[topframe=on]";
-        nextHopIp   = row[0];
-        nextHopName = '(' + row[1] + ')';
-      }
-      lastHopIpName = nextHopIpName;
+  void
+  Context::beginInterNetwork(std::ostream& os, const std::string& srcIp)
+  {
+    codeSetup(os);
+    codeTableInter(os, srcIp);
 
-      std::string nextIpName {row[2] + row[3]};
-      if ("" != rowFrame || lastIpName != nextIpName) {
-        destIp    = row[2];
-        destName  ='(' + row[3] + ')';
-      }
-      lastIpName = nextIpName;
+    lastHopIpName.clear();
+    lastIpName.clear();
+  }
 
-      pps = replaceAll(pps, "|", "\\|");
+  void
+  Context::addInterNetworkRow(
+      std::ostream& os, const std::vector<std::string>& row)
+  {
+    std::string nextHopIp   {""}; // row[0]
+    std::string nextHopName {""}; // row[1]
+    std::string destIp      {""}; // row[2]
+    std::string destName    {""}; // row[3]
+    std::string portProto   {row[4] + '/' + row[5]};
+    std::string pps         {row[6] + '/' + row[7]};
+
+    std::string rowFrame {""};
+
+    std::string nextHopIpName {row[0] + row[1]};
+    if (lastHopIpName != nextHopIpName) {
+      rowFrame    = "[topframe=on]";
+      nextHopIp   = row[0];
+      nextHopName = '(' + row[1] + ')';
+    }
+    lastHopIpName = nextHopIpName;
 
-      codeRowInter(oss,
-          rowFrame, nextHopIp, nextHopName, destIp, destName, portProto, pps
-        );
+    std::string nextIpName {row[2] + row[3]};
+    if ("" != rowFrame || lastIpName != nextIpName) {
+      destIp    = row[2];
+      destName  ='(' + row[3] + ')';
     }
+    lastIpName = nextIpName;
 
-    codeTableClose(oss);
-    codeTeardown(oss);
+    pps = replaceAll(pps, "|", "\\|");
 
-    return oss.str();
+    codeRowInter(os,
+        rowFrame, nextHopIp, nextHopName, destIp, destName, portProto, pps
+      );
+  }
+
+  void
+  Context::endInterNetwork(std::ostream& os)
+  {
+    codeTableClose(os);
+    codeTeardown(os);
   }
 
   std::string
@@ -38,6 +38,10 @@ namespace netmeld::export_scans {
     // Variables
     // ======================================================================
     private: // Variables should generally be private
+      // Row grouping state, carried between add*Row() calls
+      std::string lastHopIpName;
+      std::string lastIpName;
+
     protected: // Variables intended for internal/subclass API
     public: // Variables should rarely appear at this scope
 
@@ -58,12 +62,22 @@ namespace netmeld::export_scans {
       std::string getExtension() const override;
 
     public: // Methods part of public API
-      std::string getInterNetwork(const std::string&) const override;
-      std::string getIntraNetwork(const std::string&) const override;
+      std::string getInterNetwork(const std::string&) override;
+      std::string getIntraNetwork(const std::string&) override;
       std::string getNessus() const override;
       std::string getProwler() const override;
       std::string getSshAlgorithms() const override;
 
+      void beginIntraNetwork(std::ostream&, const std::string&) override;
+      void addIntraNetworkRow(
+          std::ostream&, const std::vector<std::string>&) override;
+      void endIntraNetwork(std::ostream&) override;
+
+      void beginInterNetwork(std::ostream&, const std::string&) override;
+      void addInterNetworkRow(
+          std::ostream&, const std::vector<std::string>&) override;
+      void endInterNetwork(std::ostream&) override;
+
 
     // NOTE: The following `code` prefixed functions are helpers solely to
     //       separate the ConTeXt code from the logic.
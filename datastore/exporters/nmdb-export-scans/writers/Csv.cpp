@@ -51,65 +51,107 @@ namespace netmeld::export_scans {
   Csv::addRows(std::ostringstream& oss) const
   {
     for (const auto& row : rows) {
-      bool first {true};
-      for (const auto& col : row) {
-        if (!first) {
-          oss << ',';
-        }
-        first = false;
-        auto ccol {replaceAll(col, R"(")", R"(\")")};
-        oss << '"' << ccol << '"';
+      writeRow(oss, row);
+    }
+  }
+
+  void
+  Csv::writeRow(std::ostream& os, const std::vector<std::string>& row) const
+  {
+    bool first {true};
+    for (const auto& col : row) {
+      if (!first) {
+        os << ',';
       }
-      oss << '\n';
+      first = false;
+      auto ccol {replaceAll(col, R"(")", R"(\")")};
+      os << '"' << ccol << '"';
     }
+    os << '\n';
   }
 
   std::string
-  Csv::getIntraNetwork(const std::string&) const
+  Csv::getIntraNetwork(const std::string& srcIp)
   {
     std::ostringstream oss(std::ios_base::binary | std::ios_base::trunc);
 
-    // add column headers
-    oss << R"("Destination IP",)"
-        << R"("Hostname",)"
-        << R"("Port",)"
-        << R"("Protocol",)"
-        << R"("State",)"
-        << R"("Reason",)"
-        << R"("Service Name",)"
-        << R"("Service Description")"
-        << '\n'
-        ;
-
-    // add table rows
-    addRows(oss);
+    beginIntraNetwork(oss, srcIp);
+    for (const auto& row : rows) {
+      addIntraNetworkRow(oss, row);
+    }
+    endIntraNetwork(oss);
 
     return oss.str();
   }
 
+  void
+  Csv::beginIntraNetwork(std::ostream& os, const std::string&)
+  {
+    // add column headers
+    os << R"("Destination IP",)"
+       << R"("Hostname",)"
+       << R"("Port",)"
+       << R"("Protocol",)"
+       << R"("State",)"
+       << R"("Reason",)"
+       << R"("Service Name",)"
+       << R"("Service Description")"
+       << '\n'
+       ;
+  }
+
+  void
+  Csv::addIntraNetworkRow(
+      std::ostream& os, const std::vector<std::string>& row)
+  {
+    writeRow(os, row);
+  }
+
+  void
+  Csv::endIntraNetwork(std::ostream&)
+  {}
+
   std::string
-  Csv::getInterNetwork(const std::string&) const
+  Csv::getInterNetwork(const std::string& srcIp)
   {
     std::ostringstream oss(std::ios_base::binary | std::ios_base::trunc);
 
-    // add column headers
-    oss << R"("Gateway IP",)"
-        << R"("Hostname",)"
-        << R"("Destination IP",)"
-        << R"("Hostname",)"
-        << R"("Port",)"
-        << R"("Protocol",)"
-        << R"("State",)"
-        << R"("Reason")"
-        << '\n'
-        ;
-
-    // add table rows
-    addRows(oss);
+    beginInterNetwork(oss, srcIp);
+    for (const auto& row : rows) {
+      addInterNetworkRow(oss, row);
+    }
+    endInterNetwork(oss);
 
     return oss.str();
   }
 
+  void
+  Csv::beginInterNetwork(std::ostream& os, const std::string&)
+  {
+    // add column headers
+    os << R"("Gateway IP",)"
+       << R"("Hostname",)"
+       << R"("Destination IP",)"
+       << R"("Hostname",)"
+       << R"("Port",)"
+       << R"("Protocol",)"
+       << R"("State",)"
+       << R"("Reason")"
+       << '\n'
+       ;
+  }
+
+  void
+  Csv::addInterNetworkRow(
+      std::ostream& os, const std::vector<std::string>& row)
+  {
+    writeRow(os, row);
+  }
+
+  void
+  Csv::endInterNetwork(std::ostream&)
+  {}
+
   std::string
   Csv::getNessus() const
   {
@@ -55,16 +55,27 @@ namespace netmeld::export_scans {
     // ======================================================================
     private: // Methods which should be hidden from API users
       void addRows(std::ostringstream&) const;
+      void writeRow(std::ostream&, const std::vector<std::string>&) const;
 
     protected: // Methods part of subclass API
       std::string getExtension() const override;
 
     public: // Methods part of public API
-      std::string getIntraNetwork(const std::string&) const override;
-      std::string getInterNetwork(const std::string&) const override;
+      std::string getIntraNetwork(const std::string&) override;
+      std::string getInterNetwork(const std::string&) override;
       std::string getNessus() const override;
       std::string getProwler() const override;
       std::string getSshAlgorithms() const override;
+
+      void beginIntraNetwork(std::ostream&, const std::string&) override;
+      void addIntraNetworkRow(
+          std::ostream&, const std::vector<std::string>&) override;
+      void endIntraNetwork(std::ostream&) override;
+
+      void beginInterNetwork(std::ostream&, const std::string&) override;
+      void addInterNetworkRow(
+          std::ostream&, const std::vector<std::string>&) override;
+      void endInterNetwork(std::ostream&) override;
   };
 }
 #endif // WRITER_CSV_HPP
@@ -73,13 +73,17 @@ Writer::replaceAll(
   return str;
 }
 
+std::string
+Writer::getFilename(const std::string& filename) const
+{
+  std::regex bs {"/"};
+  return std::regex_replace(filename, bs, "_") + getExtension();
+}
+
 void
 Writer::writeData(const std::string& filename, const std::string& data) const
 {
-  std::regex bs {"/"};
-  auto fullFilename {
-    std::regex_replace(filename, bs, "_") + getExtension()
-  };
+  auto fullFilename {getFilename(filename)};
 
   if (toFile) {
     LOG_INFO << "Writing to file: " << fullFilename << std::endl;
@@ -93,3 +97,35 @@ Writer::writeData(const std::string& filename, const std::string& data) const
              << data << std::endl;
   }
 }
+
+std::ostream&
+Writer::openStream(const std::string& filename)
+{
+  auto fullFilename {getFilename(filename)};
+
+  if (toFile) {
+    LOG_INFO << "Writing to file: " << fullFilename << std::endl;
+    fileStream.open(fullFilename,
+                    std::ios_base::binary | std::ios_base::trunc);
+    outStream = &fileStream;
+  } else {
+    LOG_INFO << "---START OF " << fullFilename << "---" << std::endl;
+    outStream = &LOG_INFO.getStream();
+  }
+
+  return *outStream;
+}
+
+void
+Writer::closeStream()
+{
+  if (nullptr == outStream) {
+    return;
+  }
+
+  *outStream << std::endl;
+  if (fileStream.is_open()) {
+    fileStream.close();
+  }
+  outStream = nullptr;
+}
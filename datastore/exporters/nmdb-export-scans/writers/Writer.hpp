@@ -27,6 +27,8 @@
 #ifndef WRITER_HPP
 #define WRITER_HPP
 
+#include <fstream>
+#include <ostream>
 #include <string>
 #include <vector>
 
@@ -43,6 +45,10 @@ class Writer {
 
     std::vector<std::vector<std::string>> rows;
 
+    // Destination of a streamed document; the file, or the log's stream
+    std::ofstream fileStream;
+    std::ostream* outStream {nullptr};
+
   public: // Variables should rarely appear at this scope
 
   // =========================================================================
@@ -65,6 +71,7 @@ class Writer {
       ) const;
 
     virtual std::string getExtension() const = 0;
+    std::string getFilename(const std::string&) const;
 
   public: // Methods part of public API
     virtual void addRow(const std::vector<std::string>&);
@@ -72,11 +79,27 @@ class Writer {
 
     virtual void writeData(const std::string&, const std::string&) const;
 
-    virtual std::string getIntraNetwork(const std::string&) const = 0;
-    virtual std::string getInterNetwork(const std::string&) const = 0;
+    // Streamed alternative to addRow() then writeData(); rows go straight to
+    // the output instead of being held until the document is complete
+    virtual std::ostream& openStream(const std::string&);
+    virtual void closeStream();
+
+    virtual std::string getIntraNetwork(const std::string&) = 0;
+    virtual std::string getInterNetwork(const std::string&) = 0;
     virtual std::string getNessus() const = 0;
     virtual std::string getProwler() const = 0;
     virtual std::string getSshAlgorithms() const = 0;
+
+    // Document pieces, for streaming; the get*() forms are built from these
+    virtual void beginIntraNetwork(std::ostream&, const std::string&) = 0;
+    virtual void addIntraNetworkRow(
+        std::ostream&, const std::vector<std::string>&) = 0;
+    virtual void endIntraNetwork(std::ostream&) = 0;
+
+    virtual void beginInterNetwork(std::ostream&, const std::string&) = 0;
+    virtual void addInterNetworkRow(
+        std::ostream&, const std::vector<std::string>&) = 0;
+    virtual void endInterNetwork(std::ostream&) = 0;
 };
 
 #endif // WRITER_HPP
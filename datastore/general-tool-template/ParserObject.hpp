@@ -54,7 +54,7 @@ namespace netmeld::core::parsers {
   // Parser definition
   // ===========================================================================
   class ParserObject :
-    public qi::grammar<IstreamIter, std::string()>
+    public qi::grammar<ConstIter, std::string()>
   {
     // =========================================================================
     // Parser Variables
@@ -86,10 +86,10 @@ namespace netmeld::core::parsers {
     // Parser rule definitions (keep close to parser logic)
     // =========================================================================
     private:
-      qi::rule<IstreamIter, std::string()>
+      qi::rule<ConstIter, std::string()>
         start;
 
-      qi::rule<IstreamIter, std::string()>
+      qi::rule<ConstIter, std::string()>
         data;
   };
 }
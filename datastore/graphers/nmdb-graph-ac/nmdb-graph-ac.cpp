@@ -27,6 +27,7 @@
 #include <regex>
 
 #include <netmeld/datastore/tools/AbstractGraphTool.hpp>
+#include <netmeld/datastore/utils/BulkRowSink.hpp>
 
 #include "GraphHelper.hpp"
 
@@ -192,7 +193,7 @@ class Tool : public nmdt::AbstractGraphTool
     addVertices(pqxx::transaction_base& t, const std::string& deviceId)
     {
       pqxx::result vRows =
-        t.exec_prepared("select_device_ac_sets", deviceId);
+        nmdu::execPrepared(t, "select_device_ac_sets", deviceId);
       for (const auto& vRow : vRows) {
         std::string id;
         vRow.at("id").to(id);
@@ -212,7 +213,7 @@ class Tool : public nmdt::AbstractGraphTool
             ;
 
         pqxx::result targetedNetRows =
-          t.exec_prepared("select_device_ac_nets",
+          nmdu::execPrepared(t, "select_device_ac_nets",
               deviceId,
               id,
               name);
@@ -226,7 +227,7 @@ class Tool : public nmdt::AbstractGraphTool
           }
         } else {
           pqxx::result globalNetRows =
-            t.exec_prepared("select_device_ac_nets",
+            nmdu::execPrepared(t, "select_device_ac_nets",
                 deviceId,
                 "global",
                 name);
@@ -253,7 +254,7 @@ class Tool : public nmdt::AbstractGraphTool
     addEdges(pqxx::transaction_base& t, const std::string& deviceId)
     {
       pqxx::result eRows =
-        t.exec_prepared("select_device_ac_edges", deviceId);
+        nmdu::execPrepared(t, "select_device_ac_edges", deviceId);
 
       for (const auto& eRow : eRows) {
         std::string src;
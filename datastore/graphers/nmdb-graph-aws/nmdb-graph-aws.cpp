@@ -28,6 +28,7 @@
 
 #include <netmeld/datastore/objects/PortRange.hpp>
 #include <netmeld/datastore/tools/AbstractGraphTool.hpp>
+#include <netmeld/datastore/utils/BulkRowSink.hpp>
 
 #include "GraphHelper.hpp"
 
@@ -446,7 +447,7 @@ class Tool : public nmdt::AbstractGraphTool
       if (!graphInstances) { return; }
 
       pqxx::result vRows =
-        t.exec_prepared("select_aws_instance_vertices");
+        nmdu::execPrepared(t, "select_aws_instance_vertices");
 
       for (const auto& vRow : vRows) {
         std::string id;
@@ -500,7 +501,7 @@ class Tool : public nmdt::AbstractGraphTool
 
       {
         pqxx::result vRows =
-          t.exec_prepared("select_aws_eni_vertices");
+          nmdu::execPrepared(t, "select_aws_eni_vertices");
 
         for (const auto& vRow : vRows) {
           std::string id;
@@ -515,7 +516,7 @@ class Tool : public nmdt::AbstractGraphTool
       // add interface details
       {
         pqxx::result vRows =
-          t.exec_prepared("select_aws_eni_details");
+          nmdu::execPrepared(t, "select_aws_eni_details");
 
         for (const auto& vRow : vRows) {
           std::string id;
@@ -535,7 +536,7 @@ class Tool : public nmdt::AbstractGraphTool
       }
       {
         pqxx::result vRows =
-          t.exec_prepared("select_aws_eni_mac_ips");
+          nmdu::execPrepared(t, "select_aws_eni_mac_ips");
 
         std::string lastId {""};
         for (const auto& vRow : vRows) {
@@ -562,7 +563,7 @@ class Tool : public nmdt::AbstractGraphTool
       // add sg rules to eni vertex
       {
         pqxx::result vRows =
-          t.exec_prepared("select_aws_eni_vertex_sg_rules");
+          nmdu::execPrepared(t, "select_aws_eni_vertex_sg_rules");
 
         std::map<std::string, std::map<std::string, std::string>>
           sgMap;
@@ -627,7 +628,7 @@ class Tool : public nmdt::AbstractGraphTool
       }
       {
         pqxx::result vRows =
-          t.exec_prepared("select_aws_eni_vertex_sg_rules_empty");
+          nmdu::execPrepared(t, "select_aws_eni_vertex_sg_rules_empty");
 
         for (const auto& vRow : vRows) {
           std::string id;
@@ -695,7 +696,7 @@ class Tool : public nmdt::AbstractGraphTool
     {
       {
         pqxx::result vRows =
-          t.exec_prepared("select_aws_subnet_vertices");
+          nmdu::execPrepared(t, "select_aws_subnet_vertices");
 
         for (const auto& vRow : vRows) {
           std::string id;
@@ -715,7 +716,7 @@ class Tool : public nmdt::AbstractGraphTool
       // add nacl rules to subnet vertex
       {
         pqxx::result vRows =
-          t.exec_prepared("select_aws_subnet_vertex_nacl_rules");
+          nmdu::execPrepared(t, "select_aws_subnet_vertex_nacl_rules");
 
         std::map<std::string, std::map<std::string, std::string>>
           naclMap;
@@ -793,7 +794,7 @@ class Tool : public nmdt::AbstractGraphTool
     addRoutes(pqxx::transaction_base& t)
     {
       pqxx::result routerTables =
-        t.exec_prepared("select_aws_router_vertices");
+        nmdu::execPrepared(t, "select_aws_router_vertices");
 
       for (const auto& vRow : routerTables) {
         std::string rtbId;
@@ -808,7 +809,7 @@ class Tool : public nmdt::AbstractGraphTool
       }
 
       pqxx::result routeTableCidrs =
-        t.exec_prepared("select_aws_router_vertices_cidrs");
+        nmdu::execPrepared(t, "select_aws_router_vertices_cidrs");
       for (const auto& vRow : routeTableCidrs) {
         std::string rtbId;
         vRow.at("route_table_id").to(rtbId);
@@ -836,7 +837,7 @@ class Tool : public nmdt::AbstractGraphTool
       }
 
       pqxx::result routeTableNonCidrs =
-        t.exec_prepared("select_aws_router_vertices_non_cidrs");
+        nmdu::execPrepared(t, "select_aws_router_vertices_non_cidrs");
       for (const auto& vRow : routeTableNonCidrs) {
         std::string rtbId;
         vRow.at("route_table_id").to(rtbId);
@@ -868,7 +869,7 @@ class Tool : public nmdt::AbstractGraphTool
     addVpc(pqxx::transaction_base& t, const std::string& vpcId)
     {
       pqxx::result vRows =
-        t.exec_prepared("select_aws_vpc_vertex", vpcId);
+        nmdu::execPrepared(t, "select_aws_vpc_vertex", vpcId);
 
       for (const auto& vRow : vRows) {
         std::string id;
@@ -1015,7 +1016,7 @@ class Tool : public nmdt::AbstractGraphTool
       if (!(graphInstances && !noNetworkInterfaces)) { return; }
 
       pqxx::result eRows =
-        t.exec_prepared("select_aws_instance_to_eni_edges");
+        nmdu::execPrepared(t, "select_aws_instance_to_eni_edges");
 
       for (const auto& eRow : eRows) {
         std::string src;
@@ -1033,7 +1034,7 @@ class Tool : public nmdt::AbstractGraphTool
       if (noNetworkInterfaces) { return; }
 
       pqxx::result eRows =
-        t.exec_prepared("select_aws_eni_to_subnet_edges");
+        nmdu::execPrepared(t, "select_aws_eni_to_subnet_edges");
 
       for (const auto& eRow : eRows) {
         std::string src;
@@ -1049,7 +1050,7 @@ class Tool : public nmdt::AbstractGraphTool
     addSubnetsToRouteTable(pqxx::transaction_base& t)
     {
       pqxx::result eRows =
-        t.exec_prepared("select_aws_subnet_to_router_edges");
+        nmdu::execPrepared(t, "select_aws_subnet_to_router_edges");
 
       for (const auto& eRow : eRows) {
         std::string src;
@@ -1066,7 +1067,7 @@ class Tool : public nmdt::AbstractGraphTool
     {
       {
         pqxx::result eRows =
-          t.exec_prepared("select_aws_router_vertices_cidrs");
+          nmdu::execPrepared(t, "select_aws_router_vertices_cidrs");
 
         for (const auto& eRow : eRows) {
           std::string src;
@@ -1081,7 +1082,7 @@ class Tool : public nmdt::AbstractGraphTool
       }
       {
         pqxx::result eRows =
-          t.exec_prepared("select_aws_router_vertices_non_cidrs");
+          nmdu::execPrepared(t, "select_aws_router_vertices_non_cidrs");
 
         for (const auto& eRow : eRows) {
           std::string src;
@@ -1101,7 +1102,7 @@ class Tool : public nmdt::AbstractGraphTool
     {
       {
         pqxx::result eRows =
-          t.exec_prepared("select_aws_igw_to_internet");
+          nmdu::execPrepared(t, "select_aws_igw_to_internet");
 
         for (const auto& eRow : eRows) {
           std::string src;
@@ -1118,7 +1119,7 @@ class Tool : public nmdt::AbstractGraphTool
       }
       {
         pqxx::result eRows =
-          t.exec_prepared("select_aws_pcx_to_external");
+          nmdu::execPrepared(t, "select_aws_pcx_to_external");
 
         for (const auto& eRow : eRows) {
           std::string src;
@@ -1138,7 +1139,7 @@ class Tool : public nmdt::AbstractGraphTool
       }
       {
         pqxx::result eRows =
-          t.exec_prepared("select_aws_vpce_to_external");
+          nmdu::execPrepared(t, "select_aws_vpce_to_external");
 
         for (const auto& eRow : eRows) {
           std::string src;
@@ -1155,7 +1156,7 @@ class Tool : public nmdt::AbstractGraphTool
       }
       {
         pqxx::result eRows =
-          t.exec_prepared("select_aws_nat_to_external");
+          nmdu::execPrepared(t, "select_aws_nat_to_external");
 
         for (const auto& eRow : eRows) {
           std::string src;
@@ -1172,7 +1173,7 @@ class Tool : public nmdt::AbstractGraphTool
       }
       {
         pqxx::result eRows =
-          t.exec_prepared("select_aws_route_eni_to_subnet");
+          nmdu::execPrepared(t, "select_aws_route_eni_to_subnet");
 
         for (const auto& eRow : eRows) {
           std::string src;
@@ -1185,7 +1186,7 @@ class Tool : public nmdt::AbstractGraphTool
       }
       {
         pqxx::result eRows =
-          t.exec_prepared("select_aws_tgw_to_resource");
+          nmdu::execPrepared(t, "select_aws_tgw_to_resource");
 
         for (const auto& eRow : eRows) {
           std::string src;
@@ -1209,7 +1210,7 @@ class Tool : public nmdt::AbstractGraphTool
       }
       {
         pqxx::result eRows =
-          t.exec_prepared("select_aws_routes_to_blackhole");
+          nmdu::execPrepared(t, "select_aws_routes_to_blackhole");
 
         for (const auto& eRow : eRows) {
           std::string src;
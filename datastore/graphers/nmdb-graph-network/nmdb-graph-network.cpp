@@ -24,6 +24,8 @@
 // Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
 // =============================================================================
 
+#include <chrono>
+
 #include <boost/graph/dijkstra_shortest_paths.hpp>
 
 #include <netmeld/datastore/tools/AbstractGraphTool.hpp>
@@ -195,6 +197,30 @@ class Tool : public nmdt::AbstractGraphTool
     std::string respondingState;
     bool        passRespondingState {false};
 
+    bool bulkFetch  {true};
+    bool showTiming {false};
+
+    std::chrono::steady_clock::time_point phaseStart;
+
+    // Relations fetched once (bulk fetch) and indexed by what the per subnet,
+    // device, and IP lookups are keyed on
+    struct IfaceRow
+    {
+      std::string interfaceName;
+      std::string ipAddr;
+      bool        ipResponding  {false};
+      std::string macAddr;
+      bool        macResponding {false};
+    };
+    using IpAddrDevice = std::tuple<std::string, std::string>;
+
+    std::map<std::string, size_t>                     netDeviceCounts;
+    std::map<std::string, std::vector<uint16_t>>      netVlans;
+    std::map<std::string, std::vector<std::string>>   netDescriptions;
+    std::map<std::string, std::vector<IpAddrDevice>>  netIpAddrs;
+    std::map<std::string, std::vector<IfaceRow>>      deviceIfaces;
+    std::map<std::string, std::vector<std::string>>   ipAddrHostnames;
+
     // naively colorblind safe:
     // - (use paul tol) https://davidmathlogic.com/colorblind/
     std::string green {"#117733"};
@@ -250,6 +276,18 @@ class Tool : public nmdt::AbstractGraphTool
           "Only graph devices whose IP or MAC responding state is:"
           " any, true, or false")
         );
+      opts.addOptionalOption("timing", std::make_tuple(
+          "timing",
+          NULL_SEMANTIC,
+          "Report time spent in each phase (to stderr)")
+        );
+
+      opts.addAdvancedOption("no-bulk-fetch", std::make_tuple(
+          "no-bulk-fetch",
+          NULL_SEMANTIC,
+          "Query the datastore per subnet, device, and IP address instead of"
+          " fetching each relation once")
+        );
     }
 
     int
@@ -410,6 +448,103 @@ class Tool : public nmdt::AbstractGraphTool
           )"
         );
 
+      // Set based forms of the per subnet/device/IP queries above
+      db.prepare("select_devices_counts_in_networks"
+        , R"(
+          SELECT
+              n.ip_net                      AS ip_net
+            , COUNT(DISTINCT dia.device_id) AS device_count
+          FROM device_ip_addrs AS dia
+          JOIN ip_nets AS n
+            ON (dia.ip_addr <<= n.ip_net)
+          JOIN ip_addrs AS ia
+            ON (dia.ip_addr = ia.ip_addr)
+          WHERE (ia.is_responding = ANY($1))
+          GROUP BY n.ip_net
+          )"
+        );
+
+      db.prepare("select_vlans_by_ip_nets"
+        , R"(
+          SELECT DISTINCT
+              ip_net  AS ip_net
+            , vlan    AS vlan
+          FROM (
+            SELECT vlan, ip_net FROM vlans_ip_nets
+            UNION
+            SELECT vlan, ip_net FROM device_vlans_ip_nets
+          ) AS foo
+          ORDER BY ip_net, vlan
+          )"
+        );
+
+      db.prepare("select_networks_descriptions"
+        , R"(
+          SELECT DISTINCT
+              ip_net                      AS ip_net
+            , (LOWER(TRIM(description)))  AS description
+          FROM (
+            SELECT DISTINCT ip_net, description FROM ip_nets
+            UNION
+            SELECT DISTINCT ip_net, description FROM vlans_summaries
+            UNION
+            SELECT DISTINCT ip_net, description FROM device_vlans_summaries
+          ) AS foo
+          WHERE (description IS NOT NULL)
+          ORDER BY ip_net, description
+          )"
+        );
+
+      db.prepare("select_ip_addrs_and_devices_in_networks"
+        , R"(
+          SELECT DISTINCT
+              n.ip_net      AS ip_net
+            , ia.ip_addr    AS ip_addr
+            , dia.device_id AS device_id
+          FROM ip_addrs AS ia
+          LEFT OUTER JOIN device_ip_addrs AS dia
+            ON (ia.ip_addr = dia.ip_addr)
+          JOIN ip_nets AS n
+            ON (ia.ip_addr <<= n.ip_net)
+          WHERE (ia.is_responding = ANY($1))
+          ORDER BY n.ip_net, ia.ip_addr
+          )"
+        );
+
+      db.prepare("select_devices_ifaces"
+        , R"(
+          SELECT DISTINCT
+              dia.device_id       AS device_id
+            , dia.interface_name  AS interface_name
+            , dia.ip_addr         AS ip_addr
+            , ia.is_responding    AS ip_responding
+            , dmaip.mac_addr      AS mac_addr
+            , ma.is_responding    AS mac_responding
+          FROM device_ip_addrs AS dia
+          LEFT OUTER JOIN device_mac_addrs_ip_addrs AS dmaip
+            ON (dia.device_id = dmaip.device_id)
+            AND (dia.interface_name = dmaip.interface_name)
+          LEFT OUTER JOIN ip_addrs AS ia
+            ON (ia.ip_addr = dia.ip_addr)
+          LEFT OUTER JOIN mac_addrs AS ma
+            ON (ma.mac_addr = dmaip.mac_addr)
+          WHERE (ia.is_responding = ANY($1) OR ma.is_responding = ANY($1))
+          ORDER BY dia.device_id, dia.ip_addr
+          )"
+        );
+
+      // Keyed on host(), as the per IP lookup strips any prefix length
+      db.prepare("select_hostnames_by_ip_addrs"
+        , R"(
+          SELECT DISTINCT
+              host(ip_addr) AS ip_addr
+            , hostname      AS hostname
+          FROM hostnames
+          WHERE (ip_addr = host(ip_addr)::INET)
+          ORDER BY ip_addr, hostname
+          )"
+        );
+
       db.prepare("select_device_connections"
         , R"(
           SELECT DISTINCT
@@ -440,6 +575,8 @@ class Tool : public nmdt::AbstractGraphTool
       hideUnknown = opts.exists("no-unknown");
       removeEmptySubnets = opts.exists("no-empty-subnets");
       showTracerouteHops = opts.exists("show-traceroute-hops");
+      bulkFetch = !opts.exists("no-bulk-fetch");
+      showTiming = opts.exists("timing");
 
       std::string state {opts.getValue("responding-state")};
       if ("0" == state || "true" == state) {
@@ -454,6 +591,13 @@ class Tool : public nmdt::AbstractGraphTool
       }
 
       int layer {std::stoi(opts.getValue("layer"))};
+
+      startPhase();
+      if (bulkFetch) {
+        fetchBulkData(db, layer);
+      }
+      endPhase("fetch");
+
       switch (layer) {
         case 2:
           buildLayer2Graph(db);
@@ -464,6 +608,7 @@ class Tool : public nmdt::AbstractGraphTool
         default:
           break;
       }
+      endPhase(bulkFetch ? "build" : "build (with queries)");
 
       std::string const deviceId {nmcu::toLower(opts.getValue("device-id"))};
       if (!vertexLookup.count(deviceId)) {
@@ -481,9 +626,11 @@ class Tool : public nmdt::AbstractGraphTool
 
       // Remove all the "wrong direction" and redundant edges.
       boost::remove_edge_if(IsRedundantEdge(graph), graph);
+      endPhase("layout");
 
       buildVirtualizationGraph(db);
       buildTracerouteGraph(db);
+      endPhase("overlay");
 
       boost::write_graphviz(
           std::cout, graph,
@@ -492,6 +639,7 @@ class Tool : public nmdt::AbstractGraphTool
           GraphWriter(),        // GraphPropertyWriter
           boost::get(&VertexProperties::name, graph)  // VertexID
         );
+      endPhase("write");
 
       return nmcu::Exit::SUCCESS;
     }
@@ -545,36 +693,24 @@ class Tool : public nmdt::AbstractGraphTool
         ipNetRow.at("extra_weight").to(extraWeight);
 
         // Skip empty subnets if requested
-        pqxx::result netConnection {
-            t.exec_prepared("select_devices_in_network", ipNet, respondingState)
-          };
-        if (removeEmptySubnets && netConnection.size() <= 1) {
+        if (removeEmptySubnets && getDeviceCount(t, ipNet) <= 1) {
           continue;
         }
 
         std::string label {(ipNet + "\\n")};
 
         // Add any VLAN tag information
-        pqxx::result vlanRows {
-            t.exec_prepared("select_vlan_by_ip_net", ipNet)
-          };
-        if (vlanRows.size()) {
+        const auto vlans {getVlans(t, ipNet)};
+        if (!vlans.empty()) {
           label += "VLAN:";
-          for (const auto& vlanRow : vlanRows) {
-            uint16_t vlan;
-            vlanRow.at("vlan").to(vlan);
+          for (const auto vlan : vlans) {
             label += (" " + std::to_string(static_cast<uint32_t>(vlan)));
           }
           label += "\\n";
         }
 
         // Add any IP net description
-        pqxx::result descRows {
-            t.exec_prepared("select_network_descriptions", ipNet)
-          };
-        for (const auto& descRow : descRows) {
-          std::string description;
-          descRow.at("description").to(description);
+        for (const auto& description : getNetworkDescriptions(t, ipNet)) {
           label += description + "\\n";
         }
 
@@ -588,16 +724,8 @@ class Tool : public nmdt::AbstractGraphTool
 
         // Create graph edges that connect the IP network to the devices and IP
         // addresses in that network.
-        pqxx::result ipAddrRows {
-            t.exec_prepared("select_ip_addrs_and_devices_in_network",
-                            ipNet, state)
-          };
-        for (const auto& ipAddrRow : ipAddrRows) {
-          std::string ipAddr;
-          ipAddrRow.at("ip_addr").to(ipAddr);
-          std::string deviceName;
-          ipAddrRow.at("device_id").to(deviceName);
-
+        for (const auto& [ipAddr, deviceName] :
+             getIpAddrsAndDevices(t, ipNet, state)) {
           std::string const vertexName {
               deviceName.size() ? (deviceName) : (ipAddr)
             };
@@ -722,22 +850,10 @@ class Tool : public nmdt::AbstractGraphTool
                  "<br/>";
 
         // Add interface(s)
-        pqxx::result ifaceRows {
-            t.exec_prepared("select_device_ifaces", deviceName, respondingState)
-          };
         bool lPassRespondingState {passRespondingState};
-        for (const auto& ifaceRow : ifaceRows) {
-          std::string ipAddr;
-          ifaceRow.at("ip_addr").to(ipAddr);
-          std::string macAddr;
-          ifaceRow.at("mac_addr").to(macAddr);
-          std::string interfaceName;
-          ifaceRow.at("interface_name").to(interfaceName);
-          bool ipResponding;
-          ifaceRow.at("ip_responding").to(ipResponding); // pgxx: false if NULL
-          bool macResponding;
-          ifaceRow.at("mac_responding").to(macResponding); // pgxx: false if NULL
-
+        for (const auto& [interfaceName, ipAddr, ipResponding,
+                          macAddr, macResponding] :
+             getDeviceIfaces(t, deviceName)) {
           if (ipResponding && !ipAddr.empty()) {
             label += R"(<font color=")" + green + R"(">)"
                    + ipAddr
@@ -864,20 +980,245 @@ class Tool : public nmdt::AbstractGraphTool
     {
       std::string label {""};
 
-      if (!ipAddr.empty()) {
+      if (ipAddr.empty()) {
+        return label;
+      }
+
+      std::vector<std::string> hostnames;
+      if (bulkFetch) {
+        const auto host {ipAddr.substr(0, ipAddr.find('/'))};
+        if (const auto it {ipAddrHostnames.find(host)};
+            ipAddrHostnames.cend() != it) {
+          hostnames = it->second;
+        }
+      } else {
         pqxx::result hostnameRows {
             t.exec_prepared("select_hostnames_by_ip_addr", ipAddr)
           };
         for (const auto& hostnameRow : hostnameRows) {
           std::string hostname;
           hostnameRow.at("hostname").to(hostname);
-          label += ("        " + hostname + "<br align=\"left\"/>");
+          hostnames.push_back(hostname);
         }
       }
+      for (const auto& hostname : hostnames) {
+        label += ("        " + hostname + "<br align=\"left\"/>");
+      }
 
       return label;
     }
 
+    // ------------------------------------------------------------------------
+    // Per subnet/device lookups; from the bulk fetched indexes unless
+    // --no-bulk-fetch, in which case each is a query
+    // ------------------------------------------------------------------------
+    void
+    fetchBulkData(pqxx::connection& db, int layer)
+    {
+      pqxx::work t {db};
+
+      // only connect responding IPs to subnets; unless want specific state
+      const std::string netState
+          {passRespondingState ? "{t}" : respondingState};
+
+      if (3 == layer) {
+        pqxx::result countRows {
+            t.exec_prepared("select_devices_counts_in_networks",
+                            respondingState)
+          };
+        for (const auto& countRow : countRows) {
+          std::string ipNet;
+          countRow.at("ip_net").to(ipNet);
+          size_t count;
+          countRow.at("device_count").to(count);
+          netDeviceCounts[ipNet] = count;
+        }
+
+        pqxx::result vlanRows {t.exec_prepared("select_vlans_by_ip_nets")};
+        for (const auto& vlanRow : vlanRows) {
+          std::string ipNet;
+          vlanRow.at("ip_net").to(ipNet);
+          uint16_t vlan;
+          vlanRow.at("vlan").to(vlan);
+          netVlans[ipNet].push_back(vlan);
+        }
+
+        pqxx::result descRows {
+            t.exec_prepared("select_networks_descriptions")
+          };
+        for (const auto& descRow : descRows) {
+          std::string ipNet;
+          descRow.at("ip_net").to(ipNet);
+          std::string description;
+          descRow.at("description").to(description);
+          netDescriptions[ipNet].push_back(description);
+        }
+
+        pqxx::result ipAddrRows {
+            t.exec_prepared("select_ip_addrs_and_devices_in_networks",
+                            netState)
+          };
+        for (const auto& ipAddrRow : ipAddrRows) {
+          std::string ipNet;
+          ipAddrRow.at("ip_net").to(ipNet);
+          std::string ipAddr;
+          ipAddrRow.at("ip_addr").to(ipAddr);
+          std::string deviceName;
+          ipAddrRow.at("device_id").to(deviceName);
+          netIpAddrs[ipNet].emplace_back(ipAddr, deviceName);
+        }
+      }
+
+      pqxx::result ifaceRows {
+          t.exec_prepared("select_devices_ifaces", respondingState)
+        };
+      for (const auto& ifaceRow : ifaceRows) {
+        std::string deviceName;
+        ifaceRow.at("device_id").to(deviceName);
+        deviceIfaces[deviceName].push_back(toIfaceRow(ifaceRow));
+      }
+
+      pqxx::result hostnameRows {
+          t.exec_prepared("select_hostnames_by_ip_addrs")
+        };
+      for (const auto& hostnameRow : hostnameRows) {
+        std::string ipAddr;
+        hostnameRow.at("ip_addr").to(ipAddr);
+        std::string hostname;
+        hostnameRow.at("hostname").to(hostname);
+        ipAddrHostnames[ipAddr].push_back(hostname);
+      }
+
+      t.commit();
+    }
+
+    IfaceRow
+    toIfaceRow(const pqxx::row& ifaceRow)
+    {
+      IfaceRow iface;
+      ifaceRow.at("interface_name").to(iface.interfaceName);
+      ifaceRow.at("ip_addr").to(iface.ipAddr);
+      ifaceRow.at("ip_responding").to(iface.ipResponding); // unset if NULL
+      ifaceRow.at("mac_addr").to(iface.macAddr);
+      ifaceRow.at("mac_responding").to(iface.macResponding); // unset if NULL
+      return iface;
+    }
+
+    size_t
+    getDeviceCount(pqxx::transaction_base& t, const std::string& ipNet)
+    {
+      if (bulkFetch) {
+        const auto it {netDeviceCounts.find(ipNet)};
+        return (netDeviceCounts.cend() == it) ? 0 : it->second;
+      }
+      return t.exec_prepared("select_devices_in_network",
+                             ipNet, respondingState).size();
+    }
+
+    std::vector<uint16_t>
+    getVlans(pqxx::transaction_base& t, const std::string& ipNet)
+    {
+      if (bulkFetch) {
+        const auto it {netVlans.find(ipNet)};
+        return (netVlans.cend() == it) ? std::vector<uint16_t>() : it->second;
+      }
+
+      std::vector<uint16_t> vlans;
+      pqxx::result vlanRows {t.exec_prepared("select_vlan_by_ip_net", ipNet)};
+      for (const auto& vlanRow : vlanRows) {
+        uint16_t vlan;
+        vlanRow.at("vlan").to(vlan);
+        vlans.push_back(vlan);
+      }
+      return vlans;
+    }
+
+    std::vector<std::string>
+    getNetworkDescriptions(pqxx::transaction_base& t, const std::string& ipNet)
+    {
+      if (bulkFetch) {
+        const auto it {netDescriptions.find(ipNet)};
+        return (netDescriptions.cend() == it)
+             ? std::vector<std::string>()
+             : it->second;
+      }
+
+      std::vector<std::string> descriptions;
+      pqxx::result descRows {
+          t.exec_prepared("select_network_descriptions", ipNet)
+        };
+      for (const auto& descRow : descRows) {
+        std::string description;
+        descRow.at("description").to(description);
+        descriptions.push_back(description);
+      }
+      return descriptions;
+    }
+
+    std::vector<IpAddrDevice>
+    getIpAddrsAndDevices(pqxx::transaction_base& t, const std::string& ipNet,
+                         const std::string& state)
+    {
+      if (bulkFetch) {
+        const auto it {netIpAddrs.find(ipNet)};
+        return (netIpAddrs.cend() == it)
+             ? std::vector<IpAddrDevice>()
+             : it->second;
+      }
+
+      std::vector<IpAddrDevice> ipAddrs;
+      pqxx::result ipAddrRows {
+          t.exec_prepared("select_ip_addrs_and_devices_in_network",
+                          ipNet, state)
+        };
+      for (const auto& ipAddrRow : ipAddrRows) {
+        std::string ipAddr;
+        ipAddrRow.at("ip_addr").to(ipAddr);
+        std::string deviceName;
+        ipAddrRow.at("device_id").to(deviceName);
+        ipAddrs.emplace_back(ipAddr, deviceName);
+      }
+      return ipAddrs;
+    }
+
+    std::vector<IfaceRow>
+    getDeviceIfaces(pqxx::transaction_base& t, const std::string& deviceName)
+    {
+      if (bulkFetch) {
+        const auto it {deviceIfaces.find(deviceName)};
+        return (deviceIfaces.cend() == it)
+             ? std::vector<IfaceRow>()
+             : it->second;
+      }
+
+      std::vector<IfaceRow> ifaces;
+      pqxx::result ifaceRows {
+          t.exec_prepared("select_device_ifaces", deviceName, respondingState)
+        };
+      for (const auto& ifaceRow : ifaceRows) {
+        ifaces.push_back(toIfaceRow(ifaceRow));
+      }
+      return ifaces;
+    }
+
+    void
+    startPhase()
+    {
+      phaseStart = std::chrono::steady_clock::now();
+    }
+
+    // Report time since the prior phase ended; stdout is the graph itself
+    void
+    endPhase(const std::string& name)
+    {
+      const auto now {std::chrono::steady_clock::now()};
+      if (showTiming) {
+        const std::chrono::duration<double> elapsed {now - phaseStart};
+        std::cerr << "Phase " << name << ": " << elapsed.count() << "s\n";
+      }
+      phaseStart = now;
+    }
+
     std::string
     getUseIconString(std::string deviceType)
     {
@@ -61,7 +61,7 @@ typedef std::vector<Data>    Result;
 // Parser definition
 // =============================================================================
 class Parser :
-  public qi::grammar<nmdp::IstreamIter, Result(), qi::ascii::blank_type>
+  public qi::grammar<nmdp::ConstIter, Result(), qi::ascii::blank_type>
 {
   // ===========================================================================
   // Variables
@@ -70,10 +70,10 @@ class Parser :
     //Data d;
 
     // Rules
-    qi::rule<nmdp::IstreamIter, Result(), qi::ascii::blank_type>
+    qi::rule<nmdp::ConstIter, Result(), qi::ascii::blank_type>
       start;
 
-    qi::rule<nmdp::IstreamIter, Data(), qi::ascii::blank_type>
+    qi::rule<nmdp::ConstIter, Data(), qi::ascii::blank_type>
       data;
 
   // ===========================================================================
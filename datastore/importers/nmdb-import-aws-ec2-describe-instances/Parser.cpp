@@ -26,9 +26,14 @@
 
 #include "Parser.hpp"
 
+#include <netmeld/datastore/utils/JsonStream.hpp>
+
 #include <netmeld/datastore/objects/IpAddress.hpp>
 #include <netmeld/datastore/objects/aws/Attachment.hpp>
 
+namespace nmdu = netmeld::datastore::utils;
+
+
 // =============================================================================
 // Parser logic
 // =============================================================================
@@ -47,6 +52,22 @@ Parser::fromJson(const json& _data)
   }
 }
 
+void
+Parser::fromJsonStream(std::istream& _in)
+{
+  try {
+    const auto found {nmdu::forEachJsonElement(_in, {"Reservations"},
+        [this](const std::string&, const json& _reservation) {
+          processInstances(_reservation);
+        })};
+    if (0 == found) {
+      LOG_ERROR << "Parse error, no Reservations array" << std::endl;
+    }
+  } catch (json::out_of_range& ex) {
+    LOG_ERROR << "Parse error " << ex.what() << std::endl;
+  }
+}
+
 void
 Parser::processInstances(const json& _reservation)
 {
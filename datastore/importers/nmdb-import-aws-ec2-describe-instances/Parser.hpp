@@ -27,6 +27,8 @@
 #ifndef PARSER_HPP
 #define PARSER_HPP
 
+#include <istream>
+
 #include <nlohmann/json.hpp>
 
 #include <netmeld/datastore/objects/ToolObservations.hpp>
@@ -80,6 +82,8 @@ class Parser
 
   public:
     void fromJson(const json&);
+    // As above, but only one element is held in memory at a time
+    void fromJsonStream(std::istream&);
     Result getData();
 };
 #endif // PARSER_HPP
@@ -26,9 +26,14 @@
 
 #include "Parser.hpp"
 
+#include <netmeld/datastore/utils/JsonStream.hpp>
+
 #include <netmeld/datastore/objects/IpAddress.hpp>
 #include <netmeld/datastore/objects/aws/Attachment.hpp>
 
+namespace nmdu = netmeld::datastore::utils;
+
+
 // =============================================================================
 // Parser logic
 // =============================================================================
@@ -49,6 +54,15 @@ Parser::fromJson(const json& _data)
   }
 }
 
+void
+Parser::fromJsonStream(std::istream& _in)
+{
+  nmdu::forEachJsonElement(_in, {"NetworkInterfaces"},
+      [this](const std::string&, const json& _interface) {
+        processInterface(_interface);
+      });
+}
+
 void
 Parser::processInterfaces(const json& _json)
 {
@@ -57,28 +71,34 @@ Parser::processInterfaces(const json& _json)
   }
 
   for (const auto& interface : _json.at("NetworkInterfaces")) {
-    nmdoa::NetworkInterface ani;
-    const std::string iid {interface.value("NetworkInterfaceId", "")};
-    ani.setId(iid);
-    ani.setDescription(interface.value("Description", ""));
-    ani.setStatus(interface.value("Status", ""));
-    ani.setType(interface.value("InterfaceType", ""));
-    ani.setMacAddress(interface.value("MacAddress", ""));
-    ani.setSubnetId(interface.value("SubnetId", ""));
-    ani.setVpcId(interface.value("VpcId", ""));
-
-    if (interface.value("SourceDestCheck", true)) {
-      ani.enableSourceDestinationCheck();
-    } else {
-      ani.disableSourceDestinationCheck();
-    }
-
-    processInterfaceAttachment(interface, ani);
-    processSecurityGroups(interface, ani);
-    processIps(interface, ani);
+    processInterface(interface);
+  }
+}
 
-    d.interfaces.emplace_back(ani);
+void
+Parser::processInterface(const json& _json)
+{
+  nmdoa::NetworkInterface ani;
+  const std::string iid {_json.value("NetworkInterfaceId", "")};
+  ani.setId(iid);
+  ani.setDescription(_json.value("Description", ""));
+  ani.setStatus(_json.value("Status", ""));
+  ani.setType(_json.value("InterfaceType", ""));
+  ani.setMacAddress(_json.value("MacAddress", ""));
+  ani.setSubnetId(_json.value("SubnetId", ""));
+  ani.setVpcId(_json.value("VpcId", ""));
+
+  if (_json.value("SourceDestCheck", true)) {
+    ani.enableSourceDestinationCheck();
+  } else {
+    ani.disableSourceDestinationCheck();
   }
+
+  processInterfaceAttachment(_json, ani);
+  processSecurityGroups(_json, ani);
+  processIps(_json, ani);
+
+  d.interfaces.emplace_back(ani);
 }
 
 void
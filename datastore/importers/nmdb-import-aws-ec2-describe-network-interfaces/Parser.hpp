@@ -27,6 +27,8 @@
 #ifndef PARSER_HPP
 #define PARSER_HPP
 
+#include <istream>
+
 #include <nlohmann/json.hpp>
 
 #include <netmeld/datastore/objects/ToolObservations.hpp>
@@ -73,12 +75,15 @@ class Parser
   private:
   protected:
     void processInterfaces(const json&);
+    void processInterface(const json&);
     void processInterfaceAttachment(const json&, nmdoa::NetworkInterface&);
     void processSecurityGroups(const json&, nmdoa::NetworkInterface&);
     void processIps(const json&, nmdoa::NetworkInterface&);
 
   public:
     void fromJson(const json&);
+    // As above, but only one element is held in memory at a time
+    void fromJsonStream(std::istream&);
     Result getData();
 };
 #endif // PARSER_HPP
@@ -28,6 +28,8 @@
 #define BOOST_TEST_MAIN
 #include <boost/test/unit_test.hpp>
 
+#include <sstream>
+
 #include <netmeld/datastore/parsers/ParserTestHelper.hpp>
 
 #include "Parser.hpp"
@@ -346,4 +348,29 @@ BOOST_AUTO_TEST_CASE(testFromJson)
     auto tobj = tp.getData()[0].interfaces;
     BOOST_TEST(0 == tobj.size());
   }
+  {
+    const std::string tv1 {R"(
+        { "NetworkInterfaces": [
+            { "NetworkInterfaceId": "id-1" },
+            { "NetworkInterfaceId": "id-2" }
+          ],
+          "NextToken": "ignored"
+        }
+      )"};
+
+    TestParser tp1;
+    tp1.fromJson(json::parse(tv1));
+    auto tobj1 = tp1.getData()[0].interfaces;
+
+    TestParser tp2;
+    std::istringstream iss {tv1};
+    tp2.fromJsonStream(iss);
+    auto tobj2 = tp2.getData()[0].interfaces;
+
+    BOOST_TEST(2 == tobj2.size());
+    BOOST_TEST(tobj1.size() == tobj2.size());
+    for (size_t i {0}; i < tobj1.size() && i < tobj2.size(); ++i) {
+      BOOST_TEST(tobj1[i].toDebugString() == tobj2[i].toDebugString());
+    }
+  }
 }
@@ -94,7 +94,7 @@ class Tool : public nmdt::AbstractImportTool<P,R>
       this->executionStart = nmco::Time();
 
       Parser parser;
-      parser.fromJson(json::parse(f));
+      parser.fromJsonStream(f);
       this->tResults = parser.getData();
 
       this->executionStop = nmco::Time();
@@ -26,6 +26,11 @@
 
 #include "Parser.hpp"
 
+#include <netmeld/datastore/utils/JsonStream.hpp>
+
+namespace nmdu = netmeld::datastore::utils;
+
+
 // =============================================================================
 // Parser logic
 // =============================================================================
@@ -44,6 +49,22 @@ Parser::fromJson(const json& _data)
   }
 }
 
+void
+Parser::fromJsonStream(std::istream& _in)
+{
+  try {
+    const auto found {nmdu::forEachJsonElement(_in, {"RouteTables"},
+        [this](const std::string&, const json& _routeTable) {
+          processRouteTable(_routeTable);
+        })};
+    if (0 == found) {
+      LOG_ERROR << "Parse error, no RouteTables array" << std::endl;
+    }
+  } catch (json::out_of_range& ex) {
+    LOG_ERROR << "Parse error " << ex.what() << std::endl;
+  }
+}
+
 void
 Parser::processRouteTable(const json& _routeTable)
 {
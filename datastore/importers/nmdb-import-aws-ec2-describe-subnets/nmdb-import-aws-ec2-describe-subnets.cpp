@@ -93,7 +93,7 @@ class Tool : public nmdt::AbstractImportTool<P,R>
       this->executionStart = nmco::Time();
       try {
         Parser parser;
-        parser.fromJson(json::parse(f));
+        parser.fromJsonStream(f);
         this->tResults = parser.getData();
       } catch (json::parse_error& ex) {
         LOG_ERROR << "Parse error at byte " << ex.byte
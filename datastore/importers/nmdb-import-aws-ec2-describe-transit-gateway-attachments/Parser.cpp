@@ -26,6 +26,11 @@
 
 #include "Parser.hpp"
 
+#include <netmeld/datastore/utils/JsonStream.hpp>
+
+
+namespace nmdu = netmeld::datastore::utils;
+
 
 // =============================================================================
 // Parser logic
@@ -45,6 +50,15 @@ Parser::fromJson(const json& _data)
   }
 }
 
+void
+Parser::fromJsonStream(std::istream& _in)
+{
+  nmdu::forEachJsonElement(_in, {"TransitGatewayAttachments"},
+      [this](const std::string&, const json& _tgwa) {
+        processTransitGatewayAttachment(_tgwa);
+      });
+}
+
 void
 Parser::processTransitGatewayAttachments(const json& _json)
 {
@@ -53,22 +67,28 @@ Parser::processTransitGatewayAttachments(const json& _json)
   }
 
   for (const auto& json : _json.at("TransitGatewayAttachments")) {
-    nmdoa::TransitGatewayAttachment tgwa;
-    tgwa.setTgwId(json.value("TransitGatewayId", ""));
-    tgwa.setTgwOwnerId(json.value("TransitGatewayOwnerId", ""));
-    tgwa.setTgwAttachmentId(json.value("TransitGatewayAttachmentId", ""));
-    tgwa.setResourceType(json.value("ResourceType", ""));
-    tgwa.setResourceId(json.value("ResourceId", ""));
-    tgwa.setResourceOwnerId(json.value("ResourceOwnerId", ""));
-    tgwa.setState(json.value("State", ""));
+    processTransitGatewayAttachment(json);
+  }
+}
 
-    if (json.contains("Association")) {
-      const auto& jsonSub {json.at("Association")};
-      tgwa.setAssociationState(jsonSub.value("State", ""));
-    }
+void
+Parser::processTransitGatewayAttachment(const json& _json)
+{
+  nmdoa::TransitGatewayAttachment tgwa;
+  tgwa.setTgwId(_json.value("TransitGatewayId", ""));
+  tgwa.setTgwOwnerId(_json.value("TransitGatewayOwnerId", ""));
+  tgwa.setTgwAttachmentId(_json.value("TransitGatewayAttachmentId", ""));
+  tgwa.setResourceType(_json.value("ResourceType", ""));
+  tgwa.setResourceId(_json.value("ResourceId", ""));
+  tgwa.setResourceOwnerId(_json.value("ResourceOwnerId", ""));
+  tgwa.setState(_json.value("State", ""));
 
-    d.tgwas.emplace_back(tgwa);
+  if (_json.contains("Association")) {
+    const auto& jsonSub {_json.at("Association")};
+    tgwa.setAssociationState(jsonSub.value("State", ""));
   }
+
+  d.tgwas.emplace_back(tgwa);
 }
 
 
@@ -26,8 +26,13 @@
 
 #include "Parser.hpp"
 
+#include <netmeld/datastore/utils/JsonStream.hpp>
+
 #include <netmeld/datastore/objects/aws/CidrBlock.hpp>
 
+namespace nmdu = netmeld::datastore::utils;
+
+
 // =============================================================================
 // Parser logic
 // =============================================================================
@@ -46,6 +51,15 @@ Parser::fromJson(const json& _data)
   }
 }
 
+void
+Parser::fromJsonStream(std::istream& _in)
+{
+  nmdu::forEachJsonElement(_in, {"VpcPeeringConnections"},
+      [this](const std::string&, const json& _pcx) {
+        processVpcPeeringConnection(_pcx);
+      });
+}
+
 void
 Parser::processVpcPeeringConnections(const json& _json)
 {
@@ -54,19 +68,25 @@ Parser::processVpcPeeringConnections(const json& _json)
   }
 
   for (const auto& jPcx : _json.at("VpcPeeringConnections")) {
-    nmdoa::VpcPeeringConnection pcx;
-    pcx.setId(jPcx.value("VpcPeeringConnectionId", ""));
-
-    if (jPcx.contains("Status")) {
-      const auto& status {jPcx.at("Status")};
-      pcx.setStatus(status.value("Code", ""), status.value("Message", ""));
-    }
+    processVpcPeeringConnection(jPcx);
+  }
+}
 
-    processAccepter(jPcx, pcx);
-    processRequester(jPcx, pcx);
+void
+Parser::processVpcPeeringConnection(const json& _json)
+{
+  nmdoa::VpcPeeringConnection pcx;
+  pcx.setId(_json.value("VpcPeeringConnectionId", ""));
 
-    d.pcxs.emplace_back(pcx);
+  if (_json.contains("Status")) {
+    const auto& status {_json.at("Status")};
+    pcx.setStatus(status.value("Code", ""), status.value("Message", ""));
   }
+
+  processAccepter(_json, pcx);
+  processRequester(_json, pcx);
+
+  d.pcxs.emplace_back(pcx);
 }
 
 void
@@ -27,6 +27,8 @@
 #ifndef PARSER_HPP
 #define PARSER_HPP
 
+#include <istream>
+
 #include <nlohmann/json.hpp>
 
 #include <netmeld/datastore/objects/ToolObservations.hpp>
@@ -74,12 +76,15 @@ class Parser
   private:
   protected:
     void processVpcPeeringConnections(const json&);
+    void processVpcPeeringConnection(const json&);
     void processAccepter(const json&, nmdoa::VpcPeeringConnection&);
     void processRequester(const json&, nmdoa::VpcPeeringConnection&);
     void processCidrBlockSets(const json&, nmdoa::Vpc&);
 
   public:
     void fromJson(const json&);
+    // As above, but only one element is held in memory at a time
+    void fromJsonStream(std::istream&);
     Result getData();
 };
 #endif // PARSER_HPP
@@ -26,8 +26,13 @@
 
 #include "Parser.hpp"
 
+#include <netmeld/datastore/utils/JsonStream.hpp>
+
 #include <netmeld/datastore/objects/aws/CidrBlock.hpp>
 
+namespace nmdu = netmeld::datastore::utils;
+
+
 // =============================================================================
 // Parser logic
 // =============================================================================
@@ -46,6 +51,22 @@ Parser::fromJson(const json& _data)
   }
 }
 
+void
+Parser::fromJsonStream(std::istream& _in)
+{
+  try {
+    const auto found {nmdu::forEachJsonElement(_in, {"Vpcs"},
+        [this](const std::string&, const json& _vpc) {
+          processVpcs(_vpc);
+        })};
+    if (0 == found) {
+      LOG_ERROR << "Parse error, no Vpcs array" << std::endl;
+    }
+  } catch (json::out_of_range& ex) {
+    LOG_ERROR << "Parse error " << ex.what() << std::endl;
+  }
+}
+
 void
 Parser::processVpcs(const json& _vpc)
 {
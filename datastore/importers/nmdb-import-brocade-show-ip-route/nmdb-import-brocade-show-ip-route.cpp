@@ -64,11 +64,8 @@ class Tool : public nmdt::AbstractImportTool<P,R>
       const auto& toolRunId {this->getToolRunId()};
       const auto& deviceId  {this->getDeviceId()};
 
-      LOG_DEBUG << "Iterating over results\n";
-      for (auto& result : this->tResults) {
-        result.save(t, toolRunId, deviceId);
-        LOG_DEBUG << result.toDebugString() << std::endl;
-      }
+      this->tResults.save(t, toolRunId, deviceId);
+      LOG_DEBUG << this->tResults.toDebugString() << std::endl;
     }
 
   protected: // Methods part of subclass API
@@ -41,10 +41,14 @@ Parser::Parser() : Parser::base_type(start)
 
   vrf =
     (vrfHeader >>
-     *(ipv4Route | ipv6Route)
+     routes
     )[(qi::_val = pnx::construct<Vrf>(qi::_1, qi::_2))]
     ;
 
+  routes =
+    *(ipv4Route | ipv6Route)
+    ;
+
   vrfHeader =
     -(qi::lit("VRF") >> -qi::lit("name") >> qi::lit(":") >
       (qi::lit("default") | token) >>
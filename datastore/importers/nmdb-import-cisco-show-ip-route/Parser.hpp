@@ -27,7 +27,7 @@
 #ifndef PARSER_HPP
 #define PARSER_HPP
 
-#include <netmeld/datastore/objects/Route.hpp>
+#include <netmeld/datastore/objects/CompactRoutingTable.hpp>
 #include <netmeld/datastore/parsers/ParserIpAddress.hpp>
 
 namespace nmdo = netmeld::datastore::objects;
@@ -36,7 +36,7 @@ namespace nmdp = netmeld::datastore::parsers;
 // =============================================================================
 // Data containers
 // =============================================================================
-typedef std::vector<nmdo::Route> Routes;
+typedef nmdo::CompactRoutingTable Routes;
 
 typedef std::pair<std::string, Routes> Vrf;
 typedef std::vector<Vrf> Vrfs;
@@ -48,30 +48,33 @@ typedef Vrfs Result;
 // Parser definition
 // =============================================================================
 class Parser:
-  public qi::grammar<nmdp::IstreamIter, Result(), qi::ascii::blank_type>
+  public qi::grammar<nmdp::ConstIter, Result(), qi::ascii::blank_type>
 {
   // ===========================================================================
   // Variables
   // ===========================================================================
   private:
     // Rules
-    qi::rule<nmdp::IstreamIter, Result(), qi::ascii::blank_type>
+    qi::rule<nmdp::ConstIter, Result(), qi::ascii::blank_type>
       start;
 
-    qi::rule<nmdp::IstreamIter, Vrf(), qi::ascii::blank_type>
+    qi::rule<nmdp::ConstIter, Vrf(), qi::ascii::blank_type>
       vrf;
 
-    qi::rule<nmdp::IstreamIter, nmdo::Route(), qi::ascii::blank_type>
+    qi::rule<nmdp::ConstIter, Routes(), qi::ascii::blank_type>
+      routes;
+
+    qi::rule<nmdp::ConstIter, nmdo::Route(), qi::ascii::blank_type>
       ipv4Route,
       ipv6Route;
 
-    qi::rule<nmdp::IstreamIter, nmdo::IpAddress(), qi::ascii::blank_type>
+    qi::rule<nmdp::ConstIter, nmdo::IpAddress(), qi::ascii::blank_type>
       dstIpv4Net, dstIpv4NetBlank,
       dstIpv6Net,
       rtrIpv4Addr,
       rtrIpv6Addr;
 
-    qi::rule<nmdp::IstreamIter>
+    qi::rule<nmdp::ConstIter>
       codesLegend,
       ignoredLine;
 
@@ -81,16 +84,16 @@ class Parser:
     nmdp::ParserIpv6Address
       ipv6Addr;
 
-    qi::rule<nmdp::IstreamIter, std::string(), qi::ascii::blank_type>
+    qi::rule<nmdp::ConstIter, std::string(), qi::ascii::blank_type>
       vrfHeader,
       uptime,
       ifaceName;
 
-    qi::rule<nmdp::IstreamIter, size_t()>
+    qi::rule<nmdp::ConstIter, size_t()>
       distance,
       metric;
 
-    qi::rule<nmdp::IstreamIter, std::string()>
+    qi::rule<nmdp::ConstIter, std::string()>
       csvToken,
       typeCode, typeCodeBlank,
       token;
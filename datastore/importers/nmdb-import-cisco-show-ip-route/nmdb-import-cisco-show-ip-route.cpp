@@ -74,11 +74,9 @@ class Tool : public nmdt::AbstractImportTool<P,R>
       LOG_DEBUG << "Iterating over results\n";
       for (auto& [vrfId, routes] : this->tResults) {
         LOG_DEBUG << deviceInfo.toDebugString() << std::endl;
-        for (auto& route : routes) {
-          route.setVrfId(vrfId);
-          route.save(t, toolRunId, deviceId);
-          LOG_DEBUG << route.toDebugString() << std::endl;
-        }
+        routes.setVrfId(vrfId);
+        routes.save(t, toolRunId, deviceId);
+        LOG_DEBUG << routes.toDebugString() << std::endl;
       }
     }
 
@@ -51,17 +51,17 @@ namespace netmeld::datastore::importers::cisco {
   // Parser definition
   // ===========================================================================
   class CiscoAcls :
-    public qi::grammar<nmdp::IstreamIter, Result(), qi::ascii::blank_type>
+    public qi::grammar<nmdp::ConstIter, Result(), qi::ascii::blank_type>
   {
     // =========================================================================
     // Variables
     // =========================================================================
     public:
       // Rules
-      qi::rule<nmdp::IstreamIter, Result(), qi::ascii::blank_type>
+      qi::rule<nmdp::ConstIter, Result(), qi::ascii::blank_type>
         start;
 
-      qi::rule<nmdp::IstreamIter, qi::ascii::blank_type>
+      qi::rule<nmdp::ConstIter, qi::ascii::blank_type>
         ciscoAcl,
         ipv46,
         iosRule,
@@ -89,7 +89,7 @@ namespace netmeld::datastore::importers::cisco {
         remarkArgument,
         ipAccessListExtended, ipAccessList;
 
-      qi::rule<nmdp::IstreamIter, std::string(), qi::ascii::blank_type>
+      qi::rule<nmdp::ConstIter, std::string(), qi::ascii::blank_type>
         bookName,
         action,
         protocolArgument,
@@ -100,14 +100,14 @@ namespace netmeld::datastore::importers::cisco {
 
       nmdp::ParserIpAddress   ipAddr;
 
-      qi::rule<nmdp::IstreamIter, std::string()>
+      qi::rule<nmdp::ConstIter, std::string()>
         addrIpOnly, addrIpMask, addrIpPrefix,
           ipNoPrefix,
         anyTerm,
         logArgumentString,
         ignoredRuleLine;
 
-      qi::rule<nmdp::IstreamIter>
+      qi::rule<nmdp::ConstIter>
         untrackedArguments,
         inactiveArgument;
 
@@ -272,10 +272,8 @@ namespace netmeld::datastore::importers::cisco {
   {
     NetworkBooks zoneBooks;
     zoneBooks.emplace(ZONE, networkBooks);
-    for (const auto& [zone, books] : zoneBooks) {
-      for (const auto& [name, book] : books) {
-        nmdu::expanded(zoneBooks, zone, name, ZONE);
-      }
+    for (const auto& cycle : nmdu::expandAll(zoneBooks)) {
+      LOG_WARN << "CiscoNetworkBook: " << cycle << '\n';
     }
 
     return zoneBooks;
@@ -52,17 +52,17 @@ namespace netmeld::datastore::importers::cisco {
   // Parser definition
   // ===========================================================================
   class CiscoNetworkBook :
-    public qi::grammar<nmdp::IstreamIter, NetworkBooks(), qi::ascii::blank_type>
+    public qi::grammar<nmdp::ConstIter, NetworkBooks(), qi::ascii::blank_type>
   {
     // =========================================================================
     // Variables
     // =========================================================================
     public:
       // Rules
-      qi::rule<nmdp::IstreamIter, NetworkBooks(), qi::ascii::blank_type>
+      qi::rule<nmdp::ConstIter, NetworkBooks(), qi::ascii::blank_type>
         start;
 
-      qi::rule<nmdp::IstreamIter, qi::ascii::blank_type>
+      qi::rule<nmdp::ConstIter, qi::ascii::blank_type>
         ciscoNetworkBook,
         nameLine,
         objectNetwork,
@@ -82,7 +82,7 @@ namespace netmeld::datastore::importers::cisco {
         dataIp,
         dataString;
 
-      qi::rule<nmdp::IstreamIter>
+      qi::rule<nmdp::ConstIter>
         dataIpMask,
         dataIpPrefix,
         dataIpRange,
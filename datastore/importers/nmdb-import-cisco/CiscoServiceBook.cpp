@@ -304,10 +304,8 @@ namespace netmeld::datastore::importers::cisco {
   {
     ServiceBooks zoneBooks;
     zoneBooks.emplace(ZONE, serviceBooks);
-    for (const auto& [zone, books] : zoneBooks) {
-      for (const auto& [name, book] : books) {
-        nmdu::expanded(zoneBooks, zone, name, ZONE);
-      }
+    for (const auto& cycle : nmdu::expandAll(zoneBooks)) {
+      LOG_WARN << "CiscoServiceBook: " << cycle << '\n';
     }
 
     return zoneBooks;
@@ -51,17 +51,17 @@ namespace netmeld::datastore::importers::cisco {
   // Parser definition
   // ===========================================================================
   class CiscoServiceBook :
-    public qi::grammar<nmdp::IstreamIter, ServiceBooks(), qi::ascii::blank_type>
+    public qi::grammar<nmdp::ConstIter, ServiceBooks(), qi::ascii::blank_type>
   {
     // =========================================================================
     // Variables
     // =========================================================================
     public:
       // Rules
-      qi::rule<nmdp::IstreamIter, ServiceBooks(), qi::ascii::blank_type>
+      qi::rule<nmdp::ConstIter, ServiceBooks(), qi::ascii::blank_type>
         start;
 
-      qi::rule<nmdp::IstreamIter, qi::ascii::blank_type>
+      qi::rule<nmdp::ConstIter, qi::ascii::blank_type>
         ciscoServiceBook,
         objectService,
           objectServiceLine,
@@ -82,10 +82,10 @@ namespace netmeld::datastore::importers::cisco {
         objectArgument,
         dataString;
 
-      qi::rule<nmdp::IstreamIter, std::string(), qi::ascii::blank_type>
+      qi::rule<nmdp::ConstIter, std::string(), qi::ascii::blank_type>
         portArgument;
 
-      qi::rule<nmdp::IstreamIter>
+      qi::rule<nmdp::ConstIter>
         icmpArgument,
           icmpTypeCode,
           icmpMessage;
@@ -82,17 +82,17 @@ typedef std::vector<Data> Result;
 // Parser definition
 // =============================================================================
 class Parser :
-  public qi::grammar<nmdp::IstreamIter, Result(), qi::ascii::blank_type>
+  public qi::grammar<nmdp::ConstIter, Result(), qi::ascii::blank_type>
 {
   // ===========================================================================
   // Variables
   // ===========================================================================
   private:
     // Rules
-    qi::rule<nmdp::IstreamIter, Result(), qi::ascii::blank_type>
+    qi::rule<nmdp::ConstIter, Result(), qi::ascii::blank_type>
       start;
 
-    qi::rule<nmdp::IstreamIter, qi::ascii::blank_type>
+    qi::rule<nmdp::ConstIter, qi::ascii::blank_type>
       config,
       domainData,
       globalServices,
@@ -108,33 +108,33 @@ class Parser :
         spanningTree,
       accessPolicyRelated;
 
-    qi::rule<nmdp::IstreamIter, qi::ascii::blank_type,
+    qi::rule<nmdp::ConstIter, qi::ascii::blank_type,
              qi::locals<uint8_t>>
       interface
       ;
 
-    qi::rule<nmdp::IstreamIter, qi::ascii::blank_type,
+    qi::rule<nmdp::ConstIter, qi::ascii::blank_type,
              qi::locals<std::string, std::string>>
       switchportVlan;
 
-    qi::rule<nmdp::IstreamIter, qi::ascii::blank_type, qi::locals<std::string>>
+    qi::rule<nmdp::ConstIter, qi::ascii::blank_type, qi::locals<std::string>>
       policyMap, classMap;
 
-    qi::rule<nmdp::IstreamIter, std::string(), qi::ascii::blank_type>
+    qi::rule<nmdp::ConstIter, std::string(), qi::ascii::blank_type>
       addressArgument,
       ports;
 
-    qi::rule<nmdp::IstreamIter, std::tuple<uint16_t, uint16_t>(), qi::ascii::blank_type>
+    qi::rule<nmdp::ConstIter, std::tuple<uint16_t, uint16_t>(), qi::ascii::blank_type>
       vlanNumberRange;
 
-    qi::rule<nmdp::IstreamIter, std::vector<std::tuple<uint16_t, uint16_t>>(), qi::ascii::blank_type>
+    qi::rule<nmdp::ConstIter, std::vector<std::tuple<uint16_t, uint16_t>>(), qi::ascii::blank_type>
       vlanNumberRangeList;
 
-    qi::rule<nmdp::IstreamIter, std::vector<nmdo::Vlan>(), qi::ascii::blank_type,
+    qi::rule<nmdp::ConstIter, std::vector<nmdo::Vlan>(), qi::ascii::blank_type,
              qi::locals<std::vector<std::tuple<uint16_t, uint16_t>>, nmdo::Vlan>>
       vlan;
 
-    qi::rule<nmdp::IstreamIter, nmdo::IpAddress()>
+    qi::rule<nmdp::ConstIter, nmdo::IpAddress()>
       ipMask;
 
     nmdp::ParserDomainName  domainName;
@@ -27,17 +27,17 @@
 #include "RulesCommon.hpp"
 
 namespace netmeld::datastore::importers::cisco {
-  qi::rule<nmdp::IstreamIter, std::string()>
+  qi::rule<nmdp::ConstIter, std::string()>
   token =
     +(qi::ascii::graph)
     ;
 
-  qi::rule<nmdp::IstreamIter, std::string()>
+  qi::rule<nmdp::ConstIter, std::string()>
   tokens =
     qi::as_string[+(token >> *qi::ascii::blank)]
     ;
 
-  qi::rule<nmdp::IstreamIter, qi::ascii::blank_type>
+  qi::rule<nmdp::ConstIter, qi::ascii::blank_type>
   indent =
     qi::no_skip[+qi::char_(' ')]
     ;
@@ -35,11 +35,11 @@ namespace nmdp = netmeld::datastore::parsers;
 // Parser definition
 // =============================================================================
 namespace netmeld::datastore::importers::cisco {
-  extern qi::rule<nmdp::IstreamIter, std::string()>
+  extern qi::rule<nmdp::ConstIter, std::string()>
     token;
-  extern qi::rule<nmdp::IstreamIter, std::string()>
+  extern qi::rule<nmdp::ConstIter, std::string()>
     tokens;
-  extern qi::rule<nmdp::IstreamIter, qi::ascii::blank_type>
+  extern qi::rule<nmdp::ConstIter, qi::ascii::blank_type>
     indent;
 }
 #endif // DATASTORE_IMPORTERS_RULES_COMMON_HPP
@@ -98,7 +98,7 @@ class Tool : public nmdt::AbstractImportTool<P,R>
 
         LOG_DEBUG << "Iteration over DNS search domains\n";
         for (auto& dnsSearchDomain : results.dnsSearchDomains) {
-          t.exec_prepared("insert_raw_device_dns_search_domain",
+          nmdu::execPrepared(t, "insert_raw_device_dns_search_domain",
               toolRunId,
               deviceId,
               dnsSearchDomain);
@@ -109,7 +109,7 @@ class Tool : public nmdt::AbstractImportTool<P,R>
         for (auto& result : results.aaas) {
           // 04-03-2019 NOTE: Manually saving here because we do not have nor
           // do we want a netmeld datastore object for AAA entries at this time.
-          t.exec_prepared("insert_raw_device_aaa",
+          nmdu::execPrepared(t, "insert_raw_device_aaa",
               toolRunId,
               deviceId,
               result);
@@ -147,14 +147,13 @@ class Tool : public nmdt::AbstractImportTool<P,R>
             "VLAN", "VLAN "
         };
         for (auto& [name, iface] : results.ifaces) {
-          for (const auto& vlan : iface.getVlans()) {
-            const uint16_t vlanId{vlan.getVlanId()};
+          for (const uint16_t vlanId : iface.getVlans()) {
             for (const auto& vlanIfacePrefix : vlanIfacePrefixes) {
               const std::string vlanIfaceName{
                 vlanIfacePrefix + std::to_string(static_cast<unsigned int>(vlanId))
               };
               if (results.ifaces.contains(vlanIfaceName)) {
-                t.exec_prepared("insert_raw_device_interface_hierarchy",
+                nmdu::execPrepared(t, "insert_raw_device_interface_hierarchy",
                     toolRunId,
                     deviceId,
                     iface.getName(),
@@ -177,7 +176,7 @@ class Tool : public nmdt::AbstractImportTool<P,R>
             };
             if (results.ifaces.contains(portChannelIfaceName)) {
               for (const auto& ifaceName : ifaceNames) {
-                t.exec_prepared("insert_raw_device_interface_hierarchy",
+                nmdu::execPrepared(t, "insert_raw_device_interface_hierarchy",
                     toolRunId,
                     deviceId,
                     ifaceName,
@@ -24,21 +24,42 @@
 // Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
 // =============================================================================
 
+#include <atomic>
+#include <optional>
+#include <thread>
+
+#include <netmeld/core/utils/ThreadSafeQueue.hpp>
 #include <netmeld/datastore/parsers/ParserHelper.hpp>
 #include <netmeld/datastore/tools/AbstractImportTool.hpp>
-#include <netmeld/core/utils/ForkExec.hpp>
+#include <netmeld/datastore/utils/BulkRowSink.hpp>
+#include <netmeld/datastore/utils/QueriesCommon.hpp>
+
+#include "nmdb-import-ip-addr-show/Importer.hpp"
+#include "nmdb-import-ip-route-show/Importer.hpp"
+#include "nmdb-import-nmap/Importer.hpp"
+#include "nmdb-import-ping/Importer.hpp"
 
 typedef std::vector<std::string>  Results;
 
+namespace nmcu = netmeld::core::utils;
+namespace nmdo = netmeld::datastore::objects;
 namespace nmdp = netmeld::datastore::parsers;
 namespace nmdt = netmeld::datastore::tools;
-namespace nmcu = netmeld::core::utils;
+namespace nmdu = netmeld::datastore::utils;
+namespace nmdsias = netmeld::datastore::importers::ip_addr_show;
+namespace nmdsirs = netmeld::datastore::importers::ip_route_show;
+namespace nmdsin  = netmeld::datastore::importers::nmap;
+namespace nmdsip  = netmeld::datastore::importers::ping;
 
 
 template<typename P, typename R>
 class Tool : public nmdt::AbstractImportTool<P,R>
 {
   private:
+    std::vector<sfs::path>        dataPaths;
+    nmcu::ThreadSafeQueue<size_t> ready;  // indexes into dataPaths
+    std::atomic<bool>             failed {false};
+
     std::string
     readCommandLine(sfs::path const& p) const
     {
@@ -50,6 +71,17 @@ class Tool : public nmdt::AbstractImportTool<P,R>
       return s;
     }
 
+    // Missing files are expected, clw only saves what the command produced
+    bool
+    hasFile(const sfs::path& p) const
+    {
+      if (sfs::exists(p)) {
+        return true;
+      }
+      LOG_WARN << "Skipping, no such file: " << p.string() << '\n';
+      return false;
+    }
+
   public:
     Tool() : nmdt::AbstractImportTool<P,R>
       ("clw", PROGRAM_NAME, PROGRAM_VERSION)
@@ -58,6 +90,14 @@ class Tool : public nmdt::AbstractImportTool<P,R>
     void
     addToolOptions() override
     {
+      this->opts.removeRequiredOption("data-path");
+      this->opts.addRequiredOption("data-path", std::make_tuple(
+            "data-path",
+            po::value<std::vector<std::string>>()->required(),
+            "clw directories to parse. Either --data-path param or implicit"
+            " last argument(s).")
+          );
+
       this->opts.removeRequiredOption("device-id");
       this->opts.addOptionalOption("device-id", std::make_tuple(
             "device-id",
@@ -73,101 +113,130 @@ class Tool : public nmdt::AbstractImportTool<P,R>
       this->opts.removeAdvancedOption("tool-run-metadata");
     }
 
+    // Each worker holds its own connection; directories share nothing else
     void
-    setToolRunId() override
+    worker()
     {
-      this->toolRunId.readUuid(this->getDataPath()/"tool_run_id.txt");
+      pqxx::connection db {this->getDbConnectString()};
+      nmdu::dbPrepareCommon(db);
+
+      size_t i;
+      while (ready.waitPop(i)) {
+        try {
+          importDirectory(db, dataPaths[i]);
+        } catch (const std::exception& e) {
+          LOG_ERROR << dataPaths[i].string() << ": " << e.what() << '\n';
+          failed = true;
+        }
+      }
     }
 
+    // Parse everything before touching the database, then save it all in
+    // one transaction so a directory is imported completely or not at all
     void
-    parseData() override
+    importDirectory(pqxx::connection& db, const sfs::path& results) const
     {
-      this->executionStart.readTime(this->getDataPath()/"timestamp_start.txt");
-      this->executionStop.readTime(this->getDataPath()/"timestamp_end.txt");
+      nmco::Uuid toolRunId;
+      toolRunId.readUuid(results/"tool_run_id.txt");
 
-      this->helpBlurb =
-        readCommandLine(this->getDataPath()/"command_line_modified.txt");
+      nmco::Time executionStart, executionStop;
+      executionStart.readTime(results/"timestamp_start.txt");
+      executionStop.readTime(results/"timestamp_end.txt");
 
-      this->programName =
-        this->helpBlurb.substr(0, this->helpBlurb.find(' '));
-    }
-
-    void
-    specificInserts(pqxx::transaction_base& t) override
-    {
-      t.commit(); // commit transaction so called tool processing works
-
-      const auto& dbName    {this->getDbName()};
-      const auto& severity  {this->opts.template
-                               getValueAs<nmcu::Severity>("verbosity")};
-      const auto& verbosity {nmcu::toString(severity)};
-      const auto& toolRunId {this->getToolRunId()};
-      const auto& toolName  {this->programName};
-      const auto& results   {this->getDataPath()};
+      const auto& commandLine
+        {readCommandLine(results/"command_line_modified.txt")};
+      const auto& toolName {commandLine.substr(0, commandLine.find(' '))};
 
       // =======================================================================
       // Local device data collection processing
       // =======================================================================
-      if (true) {
-        std::vector<std::string> args = {
-          "nmdb-import-ip-addr-show",
-          "--db-name", dbName,
-          "--verbosity", verbosity,
-          "--tool-run-id", toolRunId.toString(),
-          "--tool-run-metadata",
-          "--device-id", "__tool-run-metadata__",
-          (results/"ip_addr_show.txt").string()
-        };
-
-        nmcu::forkExecWait(args);
+      nmdsias::Result ipAddrs;
+      if (const auto& p {results/"ip_addr_show.txt"}; hasFile(p)) {
+        ipAddrs = nmdsias::parseFile(p.string());
       }
 
-      if (true) {
-        std::vector<std::string> args = {
-          "nmdb-import-ip-route-show",
-          "--db-name", dbName,
-          "--verbosity", verbosity,
-          "--tool-run-id", toolRunId.toString(),
-          "--tool-run-metadata",
-          "--device-id", "__tool-run-metadata__"
-        };
-
-        // IPv4 routes
-        args.push_back((results/"ip4_route_show.txt").string());
-        nmcu::forkExecWait(args);
-        args.pop_back();
-
-        // IPv6 routes
-        args.push_back((results/"ip6_route_show.txt").string());
-        nmcu::forkExecWait(args);
-        args.pop_back();
+      std::vector<nmdsirs::Result> routes;
+      for (const auto& name : {"ip4_route_show.txt", "ip6_route_show.txt"}) {
+        if (const auto& p {results/name}; hasFile(p)) {
+          routes.push_back(nmdsirs::parseFile(p.string()));
+        }
       }
 
       // =======================================================================
       // Remote device data collection processing
       // =======================================================================
+      nmdsin::Result nmapResults;
+      nmdsip::Result pingResults;
       if (toolName == "nmap") {
-        std::vector<std::string> args = {
-          "nmdb-import-nmap",
-          "--db-name", dbName,
-          "--verbosity", verbosity,
-          "--tool-run-id", toolRunId.toString(),
-          (results/"results.xml").string()
-        };
-
-        nmcu::forkExecWait(args);
+        if (const auto& p {results/"results.xml"}; hasFile(p)) {
+          nmco::Time nmapStart, nmapStop; // clw's timestamps take precedence
+          nmapResults = nmdsin::parseFile(p.string(), nmapStart, nmapStop);
+        }
       }
       else if ((toolName == "ping") || (toolName == "ping6")) {
-        std::vector<std::string> args = {
-          "nmdb-import-ping",
-          "--db-name", dbName,
-          "--verbosity", verbosity,
-          "--tool-run-id", toolRunId.toString(),
-          (results/"stdout.txt").string()
-        };
-
-        nmcu::forkExecWait(args);
+        if (const auto& p {results/"stdout.txt"}; hasFile(p)) {
+          pingResults = nmdsip::parseFile(p.string());
+        }
       }
+
+      pqxx::work t {db};
+
+      std::optional<nmdu::BulkRowSink> sink;
+      if (!this->opts.exists("no-bulk-insert")) {
+        sink.emplace(t);
+      }
+
+      nmdu::execPrepared(t, "insert_tool_run",
+          toolRunId,
+          toolName,
+          commandLine,
+          results.string(),
+          executionStart,
+          executionStop);
+
+      nmdsias::saveAsMetadata(t, ipAddrs, toolRunId);
+      for (auto& result : routes) {
+        nmdsirs::saveAsMetadata(t, result, toolRunId);
+      }
+      nmdsin::save(t, nmapResults, toolRunId,
+                   nmdo::IpAddress::getIpv4Default());
+      nmdsip::save(t, pingResults, toolRunId, "");
+
+      if (sink) {
+        sink->flush();
+      }
+      t.commit();
+
+      LOG_INFO << "tool-run-id: " << toolRunId << '\n';
+    }
+
+    int
+    runTool() override
+    {
+      for (const auto& dataPath : this->opts.getValues("data-path")) {
+        dataPaths.push_back(sfs::canonical(dataPath));
+      }
+
+      auto numJobs {this->opts.template getValueAs<size_t>("jobs")};
+      if (0 == numJobs) {
+        numJobs = std::max(1U, std::thread::hardware_concurrency());
+      }
+      numJobs = std::max(size_t {1}, std::min(numJobs, dataPaths.size()));
+
+      for (size_t i {0}; i < dataPaths.size(); ++i) {
+        ready.push(i);
+      }
+      ready.close();
+
+      std::vector<std::thread> workers;
+      for (size_t i {0}; i < numJobs; ++i) {
+        workers.emplace_back(&Tool::worker, this);
+      }
+      for (auto& worker : workers) {
+        worker.join();
+      }
+
+      return failed ? nmcu::Exit::FAILURE : nmcu::Exit::SUCCESS;
     }
 };
 
@@ -47,44 +47,44 @@ typedef nmdo::DnsLookups Result;
 // Parser definition
 // =============================================================================
 class Parser:
-  public qi::grammar<nmdp::IstreamIter, Result(), qi::ascii::blank_type>
+  public qi::grammar<nmdp::ConstIter, Result(), qi::ascii::blank_type>
 {
   // ===========================================================================
   // Variables
   // ===========================================================================
   private:
     // Rules
-    qi::rule<nmdp::IstreamIter, Result(), qi::ascii::blank_type>
+    qi::rule<nmdp::ConstIter, Result(), qi::ascii::blank_type>
       start;
 
-    qi::rule<nmdp::IstreamIter, nmdo::DnsLookup(), qi::ascii::blank_type>
+    qi::rule<nmdp::ConstIter, nmdo::DnsLookup(), qi::ascii::blank_type>
       dnsLookup;
 
-    qi::rule<nmdp::IstreamIter, nmco::DnsQuestion(), qi::ascii::blank_type>
+    qi::rule<nmdp::ConstIter, nmco::DnsQuestion(), qi::ascii::blank_type>
       questionSection;
 
-    qi::rule<nmdp::IstreamIter, DnsResponseSection(), qi::ascii::blank_type>
+    qi::rule<nmdp::ConstIter, DnsResponseSection(), qi::ascii::blank_type>
       responseSection;
 
-    qi::rule<nmdp::IstreamIter, std::string(), qi::ascii::blank_type>
+    qi::rule<nmdp::ConstIter, std::string(), qi::ascii::blank_type>
       statusHeader,
       questionSectionHeader,
       responseSectionHeader;
 
-    qi::rule<nmdp::IstreamIter, nmco::DnsQuestion(), qi::ascii::blank_type>
+    qi::rule<nmdp::ConstIter, nmco::DnsQuestion(), qi::ascii::blank_type>
       questionRecord;
 
-    qi::rule<nmdp::IstreamIter, nmco::DnsResponses(), qi::ascii::blank_type>
+    qi::rule<nmdp::ConstIter, nmco::DnsResponses(), qi::ascii::blank_type>
       responseRecords;
 
-    qi::rule<nmdp::IstreamIter, nmco::DnsResponse(), qi::ascii::blank_type>
+    qi::rule<nmdp::ConstIter, nmco::DnsResponse(), qi::ascii::blank_type>
       responseRecord;
 
-    qi::rule<nmdp::IstreamIter, nmdo::Port(), qi::ascii::blank_type>
+    qi::rule<nmdp::ConstIter, nmdo::Port(), qi::ascii::blank_type>
       serverFooter,
       receivedFooter;
 
-    qi::rule<nmdp::IstreamIter, qi::ascii::blank_type>
+    qi::rule<nmdp::ConstIter, qi::ascii::blank_type>
       tryingHeader,
       optPseudoSection;
 
@@ -94,16 +94,16 @@ class Parser:
     nmdp::ParserIpAddress
       ipAddr;
 
-    qi::rule<nmdp::IstreamIter, std::string()>
+    qi::rule<nmdp::ConstIter, std::string()>
       resourceClass,
       resourceType,
       resourceData,
       token;
 
-    qi::rule<nmdp::IstreamIter, uint32_t()>
+    qi::rule<nmdp::ConstIter, uint32_t()>
       resourceTtl;
 
-    qi::rule<nmdp::IstreamIter>
+    qi::rule<nmdp::ConstIter>
       comment;
 
   // ===========================================================================
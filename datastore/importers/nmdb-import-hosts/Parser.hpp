@@ -44,7 +44,7 @@ typedef std::vector<nmdo::IpAddress>    Result;
 // Parser definition
 // =============================================================================
 class Parser :
-  public qi::grammar<nmdp::IstreamIter, Result(), qi::ascii::blank_type>
+  public qi::grammar<nmdp::ConstIter, Result(), qi::ascii::blank_type>
 {
   // ===========================================================================
   // Variables
@@ -53,10 +53,10 @@ class Parser :
 
   protected:
     // Rules
-    qi::rule<nmdp::IstreamIter, Result(), qi::ascii::blank_type> start;
+    qi::rule<nmdp::ConstIter, Result(), qi::ascii::blank_type> start;
 
-    qi::rule<nmdp::IstreamIter, nmdo::IpAddress(), qi::ascii::blank_type> line;
-    qi::rule<nmdp::IstreamIter, qi::ascii::blank_type> comment;
+    qi::rule<nmdp::ConstIter, nmdo::IpAddress(), qi::ascii::blank_type> line;
+    qi::rule<nmdp::ConstIter, qi::ascii::blank_type> comment;
 
     nmdp::ParserIpAddress ipAddr;
     nmdp::ParserDomainName domainName;
@@ -24,8 +24,8 @@
 // Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
 // =============================================================================
 
-#ifndef PARSER_HPP
-#define PARSER_HPP
+#ifndef IP_ADDR_SHOW_PARSER_HPP
+#define IP_ADDR_SHOW_PARSER_HPP
 
 #include <netmeld/datastore/objects/Interface.hpp>
 #include <netmeld/datastore/objects/ToolObservations.hpp>
@@ -35,69 +35,72 @@
 namespace nmdo = netmeld::datastore::objects;
 namespace nmdp = netmeld::datastore::parsers;
 
-// =============================================================================
-// Data containers
-// =============================================================================
-struct Data
-{
-  std::vector<nmdo::Interface>  ifaces;
-  nmdo::ToolObservations        observations;
-};
-typedef std::vector<Data> Result;
+namespace netmeld::datastore::importers::ip_addr_show {
 
-
-// =============================================================================
-// Parser definition
-// =============================================================================
-class Parser:
-  public qi::grammar<nmdp::IstreamIter, Result(), qi::ascii::blank_type>
-{
   // ===========================================================================
-  // Variables
+  // Data containers
   // ===========================================================================
-  private:
-    // Supporting data structures
-    Data d;
-
-  protected:
-    // Rules
-    qi::rule<nmdp::IstreamIter, Result(), qi::ascii::blank_type>
-      start;
-
-    qi::rule<nmdp::IstreamIter, qi::ascii::blank_type>
-      config;
-
-    qi::rule<nmdp::IstreamIter, nmdo::Interface(), qi::ascii::blank_type>
-      iface;
+  struct Data
+  {
+    std::vector<nmdo::Interface>  ifaces;
+    nmdo::ToolObservations        observations;
+  };
+  typedef std::vector<Data> Result;
 
-    qi::rule<nmdp::IstreamIter, nmdo::IpAddress(), qi::ascii::blank_type>
-      inetLine;
-
-    qi::rule<nmdp::IstreamIter, std::string()>
-      ifaceName,
-      token;
-
-    qi::rule<nmdp::IstreamIter>
-      garbage;
-
-    nmdp::ParserMacAddress
-      macAddr;
-
-    nmdp::ParserIpAddress
-      ipAddr;
-
-  // ===========================================================================
-  // Constructors
-  // ===========================================================================
-  public: // Constructor is only default and must be public
-    Parser();
 
   // ===========================================================================
-  // Methods
+  // Parser definition
   // ===========================================================================
-  private:
-    void addObservation(const std::vector<std::string>&, const nmdo::Interface&);
-    void addIface(const nmdo::Interface&);
-    Result getData();
-};
-#endif // PARSER_HPP
+  class Parser:
+    public qi::grammar<nmdp::ConstIter, Result(), qi::ascii::blank_type>
+  {
+    // =========================================================================
+    // Variables
+    // =========================================================================
+    private:
+      // Supporting data structures
+      Data d;
+
+    protected:
+      // Rules
+      qi::rule<nmdp::ConstIter, Result(), qi::ascii::blank_type>
+        start;
+
+      qi::rule<nmdp::ConstIter, qi::ascii::blank_type>
+        config;
+
+      qi::rule<nmdp::ConstIter, nmdo::Interface(), qi::ascii::blank_type>
+        iface;
+
+      qi::rule<nmdp::ConstIter, nmdo::IpAddress(), qi::ascii::blank_type>
+        inetLine;
+
+      qi::rule<nmdp::ConstIter, std::string()>
+        ifaceName,
+        token;
+
+      qi::rule<nmdp::ConstIter>
+        garbage;
+
+      nmdp::ParserMacAddress
+        macAddr;
+
+      nmdp::ParserIpAddress
+        ipAddr;
+
+    // =========================================================================
+    // Constructors
+    // =========================================================================
+    public: // Constructor is only default and must be public
+      Parser();
+
+    // =========================================================================
+    // Methods
+    // =========================================================================
+    private:
+      void addObservation(const std::vector<std::string>&, const nmdo::Interface&);
+      void addIface(const nmdo::Interface&);
+      Result getData();
+  };
+}
+#endif // IP_ADDR_SHOW_PARSER_HPP
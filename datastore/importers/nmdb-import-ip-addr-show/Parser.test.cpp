@@ -34,10 +34,11 @@
 
 namespace nmdo = netmeld::datastore::objects;
 namespace nmdp = netmeld::datastore::parsers;
+namespace nmdsias = netmeld::datastore::importers::ip_addr_show;
 
 using qi::ascii::blank;
 
-class TestParser : public Parser
+class TestParser : public nmdsias::Parser
 {
   public:
     using Parser::iface;
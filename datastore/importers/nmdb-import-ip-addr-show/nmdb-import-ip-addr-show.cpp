@@ -26,9 +26,10 @@
 
 #include <netmeld/datastore/tools/AbstractImportTool.hpp>
 
-#include "Parser.hpp"
+#include "Importer.hpp"
 
 namespace nmdt = netmeld::datastore::tools;
+namespace nmdsias = netmeld::datastore::importers::ip_addr_show;
 
 
 template<typename P, typename R>
@@ -42,39 +43,20 @@ class Tool : public nmdt::AbstractImportTool<P,R>
     void
     toolRunMetadataInserts(pqxx::transaction_base& t) override
     {
-      const auto& toolRunId {this->getToolRunId()};
-
-      for (auto& results : this->tResults) {
-        for (auto& result: results.ifaces) {
-          result.saveAsMetadata(t, toolRunId);
-          LOG_DEBUG << "[TRM] " << result.toDebugString() << std::endl;
-        }
-      }
+      nmdsias::saveAsMetadata(t, this->tResults, this->getToolRunId());
     }
 
     void
     specificInserts(pqxx::transaction_base& t) override
     {
-      const auto& toolRunId {this->getToolRunId()};
-      const auto& deviceId  {this->getDeviceId()};
-
-      for (auto& results : this->tResults) {
-        LOG_DEBUG << "Iterating over Interfaces\n";
-        for (auto& result: results.ifaces) {
-          result.save(t, toolRunId, deviceId);
-          LOG_DEBUG << result.toDebugString() << '\n';
-        }
-
-        LOG_DEBUG << "Iterating over Observations\n";
-        results.observations.save(t, toolRunId, deviceId);
-        LOG_DEBUG << results.observations.toDebugString() << "\n";
-      }
+      nmdsias::save(t, this->tResults, this->getToolRunId(),
+                    this->getDeviceId());
     }
 };
 
 int
 main(int argc, char** argv)
 {
-  Tool<Parser, Result> tool;
+  Tool<nmdsias::Parser, nmdsias::Result> tool;
   return tool.start(argc, argv);
 }
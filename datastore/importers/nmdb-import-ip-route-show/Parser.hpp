@@ -24,8 +24,8 @@
 // Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
 // =============================================================================
 
-#ifndef PARSER_HPP
-#define PARSER_HPP
+#ifndef IP_ROUTE_SHOW_PARSER_HPP
+#define IP_ROUTE_SHOW_PARSER_HPP
 
 #include <netmeld/datastore/objects/IpAddress.hpp>
 #include <netmeld/datastore/objects/Route.hpp>
@@ -35,58 +35,60 @@
 namespace nmdo = netmeld::datastore::objects;
 namespace nmdp = netmeld::datastore::parsers;
 
+namespace netmeld::datastore::importers::ip_route_show {
 
-// =============================================================================
-// Data containers
-// =============================================================================
-typedef std::vector<nmdo::Route>  Result;
-
-
-// =============================================================================
-// Parser definition
-// =============================================================================
-class Parser :
-  public qi::grammar<nmdp::IstreamIter, Result(), qi::ascii::blank_type>
-{
   // ===========================================================================
-  // Variables
+  // Data containers
   // ===========================================================================
-  private:
-  protected:
-    const std::string IP_REASON {"ip route show"};
-
-    // Rules
-    qi::rule<nmdp::IstreamIter, Result(), qi::ascii::blank_type>
-      start;
-
-    qi::rule<nmdp::IstreamIter, nmdo::Route(), qi::ascii::blank_type>
-      defaultRoute, route, nullRoute;
+  typedef std::vector<nmdo::Route>  Result;
 
-    qi::rule<nmdp::IstreamIter, nmdo::IpAddress(), qi::ascii::blank_type>
-      dstIpNet, nextHopIp;
-
-    qi::rule<nmdp::IstreamIter, std::string(), qi::ascii::blank_type>
-      ifaceName;
-
-    qi::rule<nmdp::IstreamIter, std::string()>
-      token;
-
-    nmdp::ParserIpAddress
-      ipAddr;
-
-  public:
-
-  // ===========================================================================
-  // Constructors
-  // ===========================================================================
-  public: // Constructor is only default and must be public
-    Parser();
 
   // ===========================================================================
-  // Methods
+  // Parser definition
   // ===========================================================================
-  private:
-  protected:
-  public:
-};
-#endif // PARSER_HPP
+  class Parser :
+    public qi::grammar<nmdp::ConstIter, Result(), qi::ascii::blank_type>
+  {
+    // =========================================================================
+    // Variables
+    // =========================================================================
+    private:
+    protected:
+      const std::string IP_REASON {"ip route show"};
+
+      // Rules
+      qi::rule<nmdp::ConstIter, Result(), qi::ascii::blank_type>
+        start;
+
+      qi::rule<nmdp::ConstIter, nmdo::Route(), qi::ascii::blank_type>
+        defaultRoute, route, nullRoute;
+
+      qi::rule<nmdp::ConstIter, nmdo::IpAddress(), qi::ascii::blank_type>
+        dstIpNet, nextHopIp;
+
+      qi::rule<nmdp::ConstIter, std::string(), qi::ascii::blank_type>
+        ifaceName;
+
+      qi::rule<nmdp::ConstIter, std::string()>
+        token;
+
+      nmdp::ParserIpAddress
+        ipAddr;
+
+    public:
+
+    // =========================================================================
+    // Constructors
+    // =========================================================================
+    public: // Constructor is only default and must be public
+      Parser();
+
+    // =========================================================================
+    // Methods
+    // =========================================================================
+    private:
+    protected:
+    public:
+  };
+}
+#endif // IP_ROUTE_SHOW_PARSER_HPP
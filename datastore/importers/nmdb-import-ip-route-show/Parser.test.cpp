@@ -36,11 +36,12 @@
 
 namespace nmdo = netmeld::datastore::objects;
 namespace nmdp = netmeld::datastore::parsers;
+namespace nmdsirs = netmeld::datastore::importers::ip_route_show;
 
 using qi::ascii::blank;
 
 
-class TestParser : public Parser
+class TestParser : public nmdsirs::Parser
 {
   public:
     using Parser::IP_REASON;
@@ -25,9 +25,10 @@
 // =============================================================================
 
 #include <netmeld/datastore/tools/AbstractImportTool.hpp>
-#include "Parser.hpp"
+#include "Importer.hpp"
 
 namespace nmdt = netmeld::datastore::tools;
+namespace nmdsirs = netmeld::datastore::importers::ip_route_show;
 
 
 // =============================================================================
@@ -66,23 +67,13 @@ class Tool : public nmdt::AbstractImportTool<P,R>
     // Overriden from AbstractImportTool
     void toolRunMetadataInserts(pqxx::transaction_base& t) override
     {
-      const auto& toolRunId {this->getToolRunId()};
-
-      for (auto& result : this->tResults) {
-        result.saveAsMetadata(t, toolRunId);
-        LOG_DEBUG << "[TRM] " << result.toDebugString() << std::endl;
-      }
+      nmdsirs::saveAsMetadata(t, this->tResults, this->getToolRunId());
     }
 
     void specificInserts(pqxx::transaction_base& t) override
     {
-      const auto& toolRunId {this->getToolRunId()};
-      const auto& deviceId  {this->getDeviceId()};
-
-      for (auto& result : this->tResults) {
-        result.save(t, toolRunId, deviceId);
-        LOG_DEBUG << result.toDebugString() << std::endl;
-      }
+      nmdsirs::save(t, this->tResults, this->getToolRunId(),
+                    this->getDeviceId());
     }
 
   protected: // Methods part of subclass API
@@ -96,6 +87,6 @@ class Tool : public nmdt::AbstractImportTool<P,R>
 int
 main(int argc, char** argv)
 {
-  Tool<Parser, Result> tool;
+  Tool<nmdsirs::Parser, nmdsirs::Result> tool;
   return tool.start(argc, argv);
 }
@@ -853,27 +853,25 @@ Result
 Parser::getData()
 {
   for (auto& device : devices) {
-    for (const auto& [nsi, nsb] : device.networkBooks) {
-      for (const auto& [ns, nsd] : nsb) {
-        nmdu::expanded(device.networkBooks, nsi, ns, DEFAULT_ZONE);
-      }
+    for (const auto& cycle : nmdu::expandAll(device.networkBooks)) {
+      device.observations.addNotable(cycle);
     }
-    for (const auto& [nsi, nsb] : device.serviceBooks) {
-      for (const auto& [ns, nsd] : nsb) {
-        nmdu::expanded(device.serviceBooks, nsi, ns, DEFAULT_ZONE);
-      }
+    for (const auto& cycle : nmdu::expandAll(device.serviceBooks)) {
+      device.observations.addNotable(cycle);
     }
 
     // all - iface gets all vlan ids
     // VLAN_NAME - iface gets VLAN_NAME ids
+    nmdo::VlanSet allVlans;
+    for (const auto& [_, vl] : device.vlans) {
+      allVlans.add(vl.getVlanId());
+    }
+    for (const auto& [_, vl] : devices.at(0).vlans) {
+      allVlans.add(vl.getVlanId());
+    }
     for (const auto& [iface, members] : ifaceVlanMembers) {
       if ("all" == members) {
-        for (const auto& [_, vl] : device.vlans) {
-          device.ifaces[iface].addVlan(vl.getVlanId());
-        }
-        for (const auto& [_, vl] : devices.at(0).vlans) {
-          device.ifaces[iface].addVlan(vl.getVlanId());
-        }
+        device.ifaces[iface].addVlans(allVlans);
       } else {
         const auto& searchLocal    {device.vlans.find(members)};
         const auto& searchDefault  {devices.at(0).vlans.find(members)};
@@ -71,17 +71,17 @@ typedef std::vector<Data> Result;
 // Parser definition
 // =============================================================================
 class Parser:
-  public qi::grammar<nmdp::IstreamIter, Result(), qi::ascii::blank_type>
+  public qi::grammar<nmdp::ConstIter, Result(), qi::ascii::blank_type>
 {
   // ===========================================================================
   // Variables
   // ===========================================================================
   private:
     // Rules
-    qi::rule<nmdp::IstreamIter, Result(), qi::ascii::blank_type>
+    qi::rule<nmdp::ConstIter, Result(), qi::ascii::blank_type>
       start;
 
-    qi::rule<nmdp::IstreamIter, qi::ascii::blank_type>
+    qi::rule<nmdp::ConstIter, qi::ascii::blank_type>
       config,
       system,
       applications, application, applicationSet, appMultiLine, appSingleLine,
@@ -97,22 +97,22 @@ class Parser:
       routingInstances, routingInstance,
       ignoredBlock, startBlock, stopBlock;
 
-    qi::rule<nmdp::IstreamIter, nmdo::Route(), qi::ascii::blank_type>
+    qi::rule<nmdp::ConstIter, nmdo::Route(), qi::ascii::blank_type>
       route;
 
-    qi::rule<nmdp::IstreamIter, qi::ascii::blank_type,
+    qi::rule<nmdp::ConstIter, qi::ascii::blank_type,
              qi::locals<std::string>>
       address, addressSet, addressBook,
       vlan;
 
-    qi::rule<nmdp::IstreamIter, std::vector<std::string>(),
+    qi::rule<nmdp::ConstIter, std::vector<std::string>(),
              qi::ascii::blank_type>
       tokenList, logBlock;
 
-    qi::rule<nmdp::IstreamIter, std::string()>
+    qi::rule<nmdp::ConstIter, std::string()>
       token;
 
-    qi::rule<nmdp::IstreamIter>
+    qi::rule<nmdp::ConstIter>
       typeSlot,
       comment,
       semicolon,
@@ -93,7 +93,7 @@ class Tool : public nmdt::AbstractImportTool<P,R>
         LOG_DEBUG << devInfo.toDebugString() << '\n';
 
         if (defaultDeviceId != deviceId) {
-          t.exec_prepared("insert_raw_device_virtualization",
+          nmdu::execPrepared(t, "insert_raw_device_virtualization",
               toolRunId,
               defaultDeviceId,
               deviceId);
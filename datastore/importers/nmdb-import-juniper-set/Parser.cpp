@@ -366,15 +366,11 @@ Parser::unsup(const std::string& _value)
 Result
 Parser::getData()
 {
-  for (const auto& [nsi, nsb] : d.networkBooks) {
-    for (const auto& [ns, nsd] : nsb) {
-      nmdu::expanded(d.networkBooks, nsi, ns, DEFAULT_ZONE);
-    }
+  for (const auto& cycle : nmdu::expandAll(d.networkBooks)) {
+    d.observations.addNotable(cycle);
   }
-  for (const auto& [nsi, nsb] : d.serviceBooks) {
-    for (const auto& [ns, nsd] : nsb) {
-      nmdu::expanded(d.serviceBooks, nsi, ns, DEFAULT_ZONE);
-    }
+  for (const auto& cycle : nmdu::expandAll(d.serviceBooks)) {
+    d.observations.addNotable(cycle);
   }
 
   for (const auto& [z, m] : d.ruleBooks) {
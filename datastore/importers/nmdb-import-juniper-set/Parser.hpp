@@ -67,33 +67,33 @@ typedef std::vector<Data>  Result;
 // Parser definition
 // =============================================================================
 class Parser:
-  public qi::grammar<nmdp::IstreamIter, Result(), qi::ascii::blank_type>
+  public qi::grammar<nmdp::ConstIter, Result(), qi::ascii::blank_type>
 {
   // ===========================================================================
   // Variables
   // ===========================================================================
   private:
     // Rules
-    qi::rule<nmdp::IstreamIter, Result(), qi::ascii::blank_type>
+    qi::rule<nmdp::ConstIter, Result(), qi::ascii::blank_type>
       start;
 
-    qi::rule<nmdp::IstreamIter, qi::ascii::blank_type>
+    qi::rule<nmdp::ConstIter, qi::ascii::blank_type>
       config,
       interface, service, zone, address, group, policy,
       interfaces, routes;
 
-    qi::rule<nmdp::IstreamIter, qi::ascii::blank_type, qi::locals<std::string>>
+    qi::rule<nmdp::ConstIter, qi::ascii::blank_type, qi::locals<std::string>>
       route;
 
-    qi::rule<nmdp::IstreamIter, std::vector<std::string>()>
+    qi::rule<nmdp::ConstIter, std::vector<std::string>()>
       ifaceTypeName;
 
-    qi::rule<nmdp::IstreamIter, std::string(), qi::ascii::blank_type>
+    qi::rule<nmdp::ConstIter, std::string(), qi::ascii::blank_type>
       ipAddrOrFqdn,
       srvcSrcPort, srvcDstPort,
       vrouter;
 
-    qi::rule<nmdp::IstreamIter, std::string()>
+    qi::rule<nmdp::ConstIter, std::string()>
       token;
 
     nmdp::ParserIpAddress
@@ -67,10 +67,14 @@ Parser::Parser() : Parser::base_type(start)
 
   routingInstance =
     (routingInstanceHeader >
-     *route
+     routes
     )[(qi::_val = pnx::construct<RoutingInstance>(qi::_1, qi::_2))]
     ;
 
+  routes =
+    *route
+    ;
+
   routingInstanceHeader =
     routingInstanceId >>
     qi::lit(':') >>
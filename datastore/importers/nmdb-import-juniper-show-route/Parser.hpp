@@ -27,7 +27,7 @@
 #ifndef PARSER_HPP
 #define PARSER_HPP
 
-#include <netmeld/datastore/objects/Route.hpp>
+#include <netmeld/datastore/objects/CompactRoutingTable.hpp>
 #include <netmeld/datastore/parsers/ParserIpAddress.hpp>
 
 namespace nmdo = netmeld::datastore::objects;
@@ -36,7 +36,7 @@ namespace nmdp = netmeld::datastore::parsers;
 // =============================================================================
 // Data containers
 // =============================================================================
-typedef std::vector<nmdo::Route> Routes;
+typedef nmdo::CompactRoutingTable Routes;
 
 typedef std::pair<std::string, Routes> RoutingInstance;
 typedef std::vector<RoutingInstance> RoutingInstances;
@@ -51,44 +51,47 @@ typedef LogicalSystems Result;
 // Parser definition
 // =============================================================================
 class Parser:
-  public qi::grammar<nmdp::IstreamIter, Result(), qi::ascii::blank_type>
+  public qi::grammar<nmdp::ConstIter, Result(), qi::ascii::blank_type>
 {
   // ===========================================================================
   // Variables
   // ===========================================================================
   private:
     // Rules
-    qi::rule<nmdp::IstreamIter, Result(), qi::ascii::blank_type>
+    qi::rule<nmdp::ConstIter, Result(), qi::ascii::blank_type>
       start;
 
-    qi::rule<nmdp::IstreamIter, LogicalSystem(), qi::ascii::blank_type>
+    qi::rule<nmdp::ConstIter, LogicalSystem(), qi::ascii::blank_type>
       logicalSystem;
 
-    qi::rule<nmdp::IstreamIter, RoutingInstance(), qi::ascii::blank_type>
+    qi::rule<nmdp::ConstIter, RoutingInstance(), qi::ascii::blank_type>
       routingInstance;
 
-    qi::rule<nmdp::IstreamIter, std::string()>
+    qi::rule<nmdp::ConstIter, Routes(), qi::ascii::blank_type>
+      routes;
+
+    qi::rule<nmdp::ConstIter, std::string()>
       routingInstanceHeader;
 
-    qi::rule<nmdp::IstreamIter, nmdo::Route(), qi::ascii::blank_type>
+    qi::rule<nmdp::ConstIter, nmdo::Route(), qi::ascii::blank_type>
       route;
 
-    qi::rule<nmdp::IstreamIter, nmdo::IpAddress(), qi::ascii::blank_type>
+    qi::rule<nmdp::ConstIter, nmdo::IpAddress(), qi::ascii::blank_type>
       dstIpNet, dstIpNetBlank,
       rtrIpAddr;
 
-    qi::rule<nmdp::IstreamIter>
+    qi::rule<nmdp::ConstIter>
       garbageLine,
       logicalSystemFooter;
 
     nmdp::ParserIpAddress
       ipAddr;
 
-    qi::rule<nmdp::IstreamIter, std::string(), qi::ascii::blank_type>
+    qi::rule<nmdp::ConstIter, std::string(), qi::ascii::blank_type>
       ifaceName,
       logicalSystemHeader;
 
-    qi::rule<nmdp::IstreamIter, std::string()>
+    qi::rule<nmdp::ConstIter, std::string()>
       routingInstanceId,
       token;
 
@@ -79,11 +79,9 @@ class Tool : public nmdt::AbstractImportTool<P,R>
           const std::string deviceId = deviceInfo.getDeviceId();
           deviceInfo.save(t, toolRunId);
           LOG_DEBUG << deviceInfo.toDebugString() << std::endl;
-          for (auto& route : routes) {
-            route.setVrfId(routingInstanceId);
-            route.save(t, toolRunId, deviceId);
-            LOG_DEBUG << route.toDebugString() << std::endl;
-          }
+          routes.setVrfId(routingInstanceId);
+          routes.save(t, toolRunId, deviceId);
+          LOG_DEBUG << routes.toDebugString() << std::endl;
         }
       }
     }
@@ -32,6 +32,7 @@
 #include <netmeld/datastore/parsers/ParserIpAddress.hpp>
 #include <netmeld/datastore/parsers/ParserMacAddress.hpp>
 #include <netmeld/datastore/utils/ServiceFactory.hpp>
+#include <netmeld/datastore/utils/XPathQueries.hpp>
 
 #include <boost/format.hpp>
 #include <boost/lexical_cast.hpp>
@@ -62,10 +63,10 @@ void
 Parser::parseConfig(const pugi::xml_node& configNode)
 {
   for (const auto& groupsMatch :
-       configNode.select_nodes("groups")) {
+       configNode.select_nodes(nmdu::xpathQuery("groups"))) {
     const pugi::xml_node groupsNode{groupsMatch.node()};
     const std::string groupName{
-      groupsNode.select_node("name").node().text().as_string()
+      groupsNode.select_node(nmdu::xpathQuery("name")).node().text().as_string()
     };
 
     if ("junos-defaults" == groupName) {
@@ -85,7 +86,7 @@ Parser::parseConfig(const pugi::xml_node& configNode)
 
   // Initialize logical system.
   std::string logicalSystemName;
-  const auto nameMatch{configNode.select_node("name")};
+  const auto nameMatch{configNode.select_node(nmdu::xpathQuery("name"))};
   if (nameMatch) {
     logicalSystemName = nmcu::toLower(nameMatch.node().text().as_string());
   }
@@ -99,10 +100,10 @@ Parser::parseConfig(const pugi::xml_node& configNode)
   // Parse system settings. Only copy is at global system scope:
   for (const auto& nameServerMatch :
        configNode.select_nodes(
-         "/rpc-reply/configuration/system/name-server[not(@inactive='inactive')]")) {
+         nmdu::xpathQuery("/rpc-reply/configuration/system/name-server[not(@inactive='inactive')]"))) {
     const pugi::xml_node nameServerNode{nameServerMatch.node()};
     nmdo::IpAddress dnsResolverIpAddr{
-      nameServerNode.select_node("name").node().text().as_string()
+      nameServerNode.select_node(nmdu::xpathQuery("name")).node().text().as_string()
     };
     // Service version
     auto dnsService{nmdu::ServiceFactory::makeDns()};
@@ -116,7 +117,7 @@ Parser::parseConfig(const pugi::xml_node& configNode)
 
   for (const auto& domainSearchMatch :
        configNode.select_nodes(
-         "/rpc-reply/configuration/system/domain-search[not(@inactive='inactive')]")) {
+         nmdu::xpathQuery("/rpc-reply/configuration/system/domain-search[not(@inactive='inactive')]"))) {
     const pugi::xml_node domainSearchNode{domainSearchMatch.node()};
     const std::string dnsSearchDomain{domainSearchNode.text().as_string()};
     logicalSystem.dnsSearchDomains.emplace_back(dnsSearchDomain);
@@ -124,10 +125,10 @@ Parser::parseConfig(const pugi::xml_node& configNode)
 
   for (const auto& tacplusServerMatch :
        configNode.select_nodes(
-         "/rpc-reply/configuration/system/tacplus-server[not(@inactive='inactive')]")) {
+         nmdu::xpathQuery("/rpc-reply/configuration/system/tacplus-server[not(@inactive='inactive')]"))) {
     const pugi::xml_node tacplusServerNode{tacplusServerMatch.node()};
     nmdo::IpAddress tacplusServerIpAddr{
-      tacplusServerNode.select_node("name").node().text().as_string()
+      tacplusServerNode.select_node(nmdu::xpathQuery("name")).node().text().as_string()
     };
     auto tacplusService{nmdu::ServiceFactory::makeTacacsPlus()};
     tacplusService.setDstAddress(tacplusServerIpAddr);
@@ -136,23 +137,23 @@ Parser::parseConfig(const pugi::xml_node& configNode)
 
   for (const auto& ntpMatch :
        configNode.select_nodes(
-         "/rpc-reply/configuration/system/ntp[not(@inactive='inactive')]")) {
+         nmdu::xpathQuery("/rpc-reply/configuration/system/ntp[not(@inactive='inactive')]"))) {
     const pugi::xml_node ntpNode{ntpMatch.node()};
     const auto ntpSrcAddrMatch{
-      ntpNode.select_node("source-address[not(@inactive='inactive')]")
+      ntpNode.select_node(nmdu::xpathQuery("source-address[not(@inactive='inactive')]"))
     };
     for (const auto& ntpServerMatch :
-         ntpNode.select_nodes("server[not(@inactive='inactive')]")) {
+         ntpNode.select_nodes(nmdu::xpathQuery("server[not(@inactive='inactive')]"))) {
       const pugi::xml_node ntpServerNode{ntpServerMatch.node()};
       nmdo::IpAddress ntpServerIpAddr{
-        ntpServerNode.select_node("name").node().text().as_string()
+        ntpServerNode.select_node(nmdu::xpathQuery("name")).node().text().as_string()
       };
       auto ntpService{nmdu::ServiceFactory::makeNtp()};
       ntpService.setDstAddress(ntpServerIpAddr);
       if (ntpSrcAddrMatch) {
         const pugi::xml_node ntpSrcAddrNode{ntpSrcAddrMatch.node()};
         nmdo::IpAddress ntpSrcIpAddr{
-          ntpSrcAddrNode.select_node("name").node().text().as_string()
+          ntpSrcAddrNode.select_node(nmdu::xpathQuery("name")).node().text().as_string()
         };
         ntpService.setSrcAddress(ntpSrcIpAddr);
       }
@@ -164,7 +165,7 @@ Parser::parseConfig(const pugi::xml_node& configNode)
   // Parse networking settings:
   logicalSystem.ifaces["_self_"].setName("_self_");
   for (const auto& interfacesMatch :
-       configNode.select_nodes("interfaces[not(@inactive='inactive')]")) {
+       configNode.select_nodes(nmdu::xpathQuery("interfaces[not(@inactive='inactive')]"))) {
     const pugi::xml_node interfacesNode{interfacesMatch.node()};
     auto parsedIfacesTuple{parseConfigInterfaces(interfacesNode)};
     auto parsedIfaces{std::get<0>(parsedIfacesTuple)};
@@ -179,7 +180,7 @@ Parser::parseConfig(const pugi::xml_node& configNode)
   }
 
   for (const auto& routingInstancesMatch :
-       configNode.select_nodes("routing-instances[not(@inactive='inactive')]")) {
+       configNode.select_nodes(nmdu::xpathQuery("routing-instances[not(@inactive='inactive')]"))) {
     const pugi::xml_node routingInstancesNode{routingInstancesMatch.node()};
     auto parsedVrfs{parseConfigRoutingInstances(routingInstancesNode, logicalSystem.ifaces)};
     logicalSystem.vrfs.merge(parsedVrfs);
@@ -189,7 +190,7 @@ Parser::parseConfig(const pugi::xml_node& configNode)
   }
 
   for (const auto& routingOptionsMatch :
-       configNode.select_nodes("routing-options[not(@inactive='inactive')]")) {
+       configNode.select_nodes(nmdu::xpathQuery("routing-options[not(@inactive='inactive')]"))) {
     const pugi::xml_node routingOptionsNode{routingOptionsMatch.node()};
     for (const auto& route : parseConfigRoutingOptions(routingOptionsNode)) {
       logicalSystem.vrfs[""].addRoute(route);
@@ -198,7 +199,7 @@ Parser::parseConfig(const pugi::xml_node& configNode)
 
   // Parse firewall settings:
   for (const auto& zonesMatch :
-       configNode.select_nodes("security/zones[not(@inactive='inactive')]")) {
+       configNode.select_nodes(nmdu::xpathQuery("security/zones[not(@inactive='inactive')]"))) {
     const pugi::xml_node zonesNode{zonesMatch.node()};
     auto parsedAclZones{parseConfigZones(zonesNode)};
     logicalSystem.aclZones.merge(parsedAclZones);
@@ -217,8 +218,8 @@ Parser::parseConfig(const pugi::xml_node& configNode)
 
   for (const auto& addressBookMatch :
        configNode.select_nodes
-       ("(security/address-book[not(@inactive='inactive')])|"
-        "(security/zones[not(@inactive='inactive')]/security-zone[not(@inactive='inactive')]/address-book[not(@inactive='inactive')])")) {
+       (nmdu::xpathQuery("(security/address-book[not(@inactive='inactive')])|"
+        "(security/zones[not(@inactive='inactive')]/security-zone[not(@inactive='inactive')]/address-book[not(@inactive='inactive')])"))) {
     const pugi::xml_node addressBookNode{addressBookMatch.node()};
     auto parsedAclIpNetSets{parseConfigAddressBook(addressBookNode)};
     logicalSystem.aclIpNetSets.merge(parsedAclIpNetSets);
@@ -238,7 +239,7 @@ Parser::parseConfig(const pugi::xml_node& configNode)
   }
 
   for (const auto& applicationsMatch :
-       configNode.select_nodes("applications[not(@inactive='inactive')]")) {
+       configNode.select_nodes(nmdu::xpathQuery("applications[not(@inactive='inactive')]"))) {
     const pugi::xml_node applicationsNode{applicationsMatch.node()};
     for (const auto& aclService :
          parseConfigApplications(applicationsNode)) {
@@ -247,7 +248,7 @@ Parser::parseConfig(const pugi::xml_node& configNode)
   }
 
   for (const auto& policiesMatch :
-       configNode.select_nodes("security/policies[not(@inactive='inactive')]")) {
+       configNode.select_nodes(nmdu::xpathQuery("security/policies[not(@inactive='inactive')]"))) {
     const pugi::xml_node policiesNode{policiesMatch.node()};
     for (const auto& aclRule : parseConfigPolicies(policiesNode)) {
       logicalSystem.aclRules.emplace_back(aclRule);
@@ -256,7 +257,7 @@ Parser::parseConfig(const pugi::xml_node& configNode)
 
   // Parse logical-systems:
   for (const auto& logicalSystemMatch :
-       configNode.select_nodes("logical-systems[not(@inactive='inactive')]")) {
+       configNode.select_nodes(nmdu::xpathQuery("logical-systems[not(@inactive='inactive')]"))) {
     const pugi::xml_node logicalSystemNode{logicalSystemMatch.node()};
     parseConfig(logicalSystemNode);
   }
@@ -274,16 +275,16 @@ Parser::parseConfigInterfaces(const pugi::xml_node& interfacesNode)
   std::smatch mediaTypeMatch;
 
   for (const auto& interfaceRangeMatch :
-       interfacesNode.select_nodes("interface-range[not(@inactive='inactive')]")) {
+       interfacesNode.select_nodes(nmdu::xpathQuery("interface-range[not(@inactive='inactive')]"))) {
     const pugi::xml_node ifaceRangeNode{interfaceRangeMatch.node()};
     const std::string ifaceRangeName{
-      ifaceRangeNode.select_node("name").node().text().as_string()
+      ifaceRangeNode.select_node(nmdu::xpathQuery("name")).node().text().as_string()
     };
     for (const auto& memberMatch :
-         ifaceRangeNode.select_nodes("member[not(@inactive='inactive')]")) {
+         ifaceRangeNode.select_nodes(nmdu::xpathQuery("member[not(@inactive='inactive')]"))) {
       const pugi::xml_node memberNode{memberMatch.node()};
       const std::string ifaceName{
-        memberNode.select_node("name").node().text().as_string()
+        memberNode.select_node(nmdu::xpathQuery("name")).node().text().as_string()
       };
       ifaces[ifaceName].setName(ifaceName);
       ifaces[ifaceName].setDescription(ifaceRangeName);
@@ -292,12 +293,12 @@ Parser::parseConfigInterfaces(const pugi::xml_node& interfacesNode)
       }
 
       for (const auto optionsMatch : memberNode.select_nodes(
-             "(../gigether-options[not(@inactive='inactive')])|"
-             "(../ether-options[not(@inactive='inactive')])")) {
+             nmdu::xpathQuery("(../gigether-options[not(@inactive='inactive')])|"
+             "(../ether-options[not(@inactive='inactive')])"))) {
         const pugi::xml_node optionsNode{optionsMatch.node()};
         for (const auto virtualIfaceMatch : optionsNode.select_nodes(
-               "(redundant-parent[not(@inactive='inactive')]/parent[not(@inactive='inactive')])|"
-               "(ieee-802.3ad[not(@inactive='inactive')]/bundle[not(@inactive='inactive')])")) {
+               nmdu::xpathQuery("(redundant-parent[not(@inactive='inactive')]/parent[not(@inactive='inactive')])|"
+               "(ieee-802.3ad[not(@inactive='inactive')]/bundle[not(@inactive='inactive')])"))) {
           const std::string virtualIfaceName{
             virtualIfaceMatch.node().text().as_string()
           };
@@ -309,10 +310,10 @@ Parser::parseConfigInterfaces(const pugi::xml_node& interfacesNode)
   }
 
   for (const auto& interfaceMatch :
-       interfacesNode.select_nodes("interface[not(@inactive='inactive')]")) {
+       interfacesNode.select_nodes(nmdu::xpathQuery("interface[not(@inactive='inactive')]"))) {
     const pugi::xml_node ifaceNode{interfaceMatch.node()};
     const std::string ifaceName{
-      ifaceNode.select_node("name").node().text().as_string()
+      ifaceNode.select_node(nmdu::xpathQuery("name")).node().text().as_string()
     };
 
     // Physical interface
@@ -322,22 +323,22 @@ Parser::parseConfigInterfaces(const pugi::xml_node& interfacesNode)
         ifaces[ifaceName].setMediaType(mediaTypeMatch[1]);
       }
 
-      const auto descriptionMatch{ifaceNode.select_node("description")};
+      const auto descriptionMatch{ifaceNode.select_node(nmdu::xpathQuery("description"))};
       if (descriptionMatch) {
         ifaces[ifaceName].setDescription(descriptionMatch.node().text().as_string());
       }
-      const auto disableMatch{ifaceNode.select_node("disable")};
+      const auto disableMatch{ifaceNode.select_node(nmdu::xpathQuery("disable"))};
       if (disableMatch) {
         ifaces[ifaceName].setState(false);
       }
 
       for (const auto optionsMatch : ifaceNode.select_nodes(
-             "(gigether-options[not(@inactive='inactive')])|"
-             "(ether-options[not(@inactive='inactive')])")) {
+             nmdu::xpathQuery("(gigether-options[not(@inactive='inactive')])|"
+             "(ether-options[not(@inactive='inactive')])"))) {
         const pugi::xml_node optionsNode{optionsMatch.node()};
         for (const auto virtualIfaceMatch : optionsNode.select_nodes(
-               "(redundant-parent[not(@inactive='inactive')]/parent[not(@inactive='inactive')])|"
-               "(ieee-802.3ad[not(@inactive='inactive')]/bundle[not(@inactive='inactive')])")) {
+               nmdu::xpathQuery("(redundant-parent[not(@inactive='inactive')]/parent[not(@inactive='inactive')])|"
+               "(ieee-802.3ad[not(@inactive='inactive')]/bundle[not(@inactive='inactive')])"))) {
           const std::string virtualIfaceName{
             virtualIfaceMatch.node().text().as_string()
           };
@@ -347,10 +348,10 @@ Parser::parseConfigInterfaces(const pugi::xml_node& interfacesNode)
       }
 
       for (const auto optionsMatch : ifaceNode.select_nodes(
-             "fabric-options[not(@inactive='inactive')]")) {
+             nmdu::xpathQuery("fabric-options[not(@inactive='inactive')]"))) {
         const pugi::xml_node optionsNode{optionsMatch.node()};
         for (const auto underlyingIfaceMatch : optionsNode.select_nodes(
-             "member-interfaces[not(@inactive='inactive')]/name")) {
+             nmdu::xpathQuery("member-interfaces[not(@inactive='inactive')]/name"))) {
           const std::string underlyingIfaceName{
             underlyingIfaceMatch.node().text().as_string()
           };
@@ -362,10 +363,10 @@ Parser::parseConfigInterfaces(const pugi::xml_node& interfacesNode)
 
     // Logical interface units
     for (const auto& unitMatch :
-         ifaceNode.select_nodes("unit[not(@inactive='inactive')]")) {
+         ifaceNode.select_nodes(nmdu::xpathQuery("unit[not(@inactive='inactive')]"))) {
       const pugi::xml_node unitNode{unitMatch.node()};
       const std::string unitName{
-        unitNode.select_node("name").node().text().as_string()
+        unitNode.select_node(nmdu::xpathQuery("name")).node().text().as_string()
       };
       const std::string ifaceUnitId{ifaceName + "." + unitName};
 
@@ -376,15 +377,15 @@ Parser::parseConfigInterfaces(const pugi::xml_node& interfacesNode)
         ifaces[ifaceUnitId].setMediaType(mediaTypeMatch[1]);
       }
 
-      const auto descriptionMatch{unitNode.select_node("description")};
+      const auto descriptionMatch{unitNode.select_node(nmdu::xpathQuery("description"))};
       if (descriptionMatch) {
         ifaces[ifaceUnitId].setDescription(descriptionMatch.node().text().as_string());
       }
-      const auto disableMatch{unitNode.select_node("(disable)|(../disable)")};
+      const auto disableMatch{unitNode.select_node(nmdu::xpathQuery("(disable)|(../disable)"))};
       if (disableMatch) {
         ifaces[ifaceUnitId].setState(false);
       }
-      const auto vlanMatch{unitNode.select_node("vlan-id[not(@inactive='inactive')]")};
+      const auto vlanMatch{unitNode.select_node(nmdu::xpathQuery("vlan-id[not(@inactive='inactive')]"))};
       if (vlanMatch) {
         const uint16_t vlanId{
           static_cast<uint16_t>(vlanMatch.node().text().as_uint())
@@ -394,19 +395,19 @@ Parser::parseConfigInterfaces(const pugi::xml_node& interfacesNode)
 
       for (const auto& addressMatch :
            unitNode.select_nodes(
-             "(family[not(@inactive='inactive')]/inet[not(@inactive='inactive')]/address[not(@inactive='inactive')])|"
-             "(family[not(@inactive='inactive')]/inet6[not(@inactive='inactive')]/address[not(@inactive='inactive')])")) {
+             nmdu::xpathQuery("(family[not(@inactive='inactive')]/inet[not(@inactive='inactive')]/address[not(@inactive='inactive')])|"
+             "(family[not(@inactive='inactive')]/inet6[not(@inactive='inactive')]/address[not(@inactive='inactive')])"))) {
         const pugi::xml_node addressNode{addressMatch.node()};
         nmdo::IpAddress ipAddr{
-          addressNode.select_node("name").node().text().as_string()
+          addressNode.select_node(nmdu::xpathQuery("name")).node().text().as_string()
         };
         ifaces[ifaceUnitId].addIpAddress(ipAddr);
 
         for (const auto& arpMatch :
-             addressNode.select_nodes("arp[not(@inactive='inactive')]")) {
+             addressNode.select_nodes(nmdu::xpathQuery("arp[not(@inactive='inactive')]"))) {
           const pugi::xml_node arpNode{arpMatch.node()};
           const auto peerMacAddrMatch{
-            arpNode.select_node("mac[not(@inactive='inactive')]")
+            arpNode.select_node(nmdu::xpathQuery("mac[not(@inactive='inactive')]"))
           };
           if (peerMacAddrMatch &&
               nmdp::matchString<nmdp::ParserMacAddress, nmdo::MacAddress>
@@ -417,7 +418,7 @@ Parser::parseConfigInterfaces(const pugi::xml_node& interfacesNode)
             peerMacAddr.setResponding(true);
 
             const auto peerIpAddrMatch{
-              arpNode.select_node("name[not(@inactive='inactive')]")
+              arpNode.select_node(nmdu::xpathQuery("name[not(@inactive='inactive')]"))
             };
             if (peerIpAddrMatch &&
                 nmdp::matchString<nmdp::ParserIpAddress, nmdo::IpAddress>
@@ -446,18 +447,18 @@ Parser::parseConfigRoutingInstances(const pugi::xml_node& routingInstancesNode,
   std::map<std::string, nmdo::Vrf> vrfs;
 
   for (const auto& routingInstanceMatch :
-       routingInstancesNode.select_nodes("instance[not(@inactive='inactive')]")) {
+       routingInstancesNode.select_nodes(nmdu::xpathQuery("instance[not(@inactive='inactive')]"))) {
     const pugi::xml_node routingInstanceNode{routingInstanceMatch.node()};
     const std::string vrfId{
-      routingInstanceNode.select_node("name").node().text().as_string()
+      routingInstanceNode.select_node(nmdu::xpathQuery("name")).node().text().as_string()
     };
     vrfs[vrfId].setId(vrfId);
 
     for (const auto& interfaceMatch :
-         routingInstanceNode.select_nodes("interface[not(@inactive='inactive')]")) {
+         routingInstanceNode.select_nodes(nmdu::xpathQuery("interface[not(@inactive='inactive')]"))) {
       const pugi::xml_node interfaceNode{interfaceMatch.node()};
       const std::string ifaceName{
-        interfaceNode.select_node("name").node().text().as_string()
+        interfaceNode.select_node(nmdu::xpathQuery("name")).node().text().as_string()
       };
       if (ifaces.end() != ifaces.find(ifaceName)) {
         vrfs[vrfId].addIface(ifaceName);
@@ -471,7 +472,7 @@ Parser::parseConfigRoutingInstances(const pugi::xml_node& routingInstancesNode,
     }
 
     for (const auto& routingOptionsMatch :
-         routingInstanceNode.select_nodes("routing-options[not(@inactive='inactive')]")) {
+         routingInstanceNode.select_nodes(nmdu::xpathQuery("routing-options[not(@inactive='inactive')]"))) {
       const pugi::xml_node routingOptionsNode{routingOptionsMatch.node()};
       for (auto& route : parseConfigRoutingOptions(routingOptionsNode)) {
         route.setVrfId(vrfId);
@@ -491,31 +492,31 @@ Parser::parseConfigRoutingOptions(const pugi::xml_node& routingOptionsNode)
 
   for (const auto& routeMatch :
        routingOptionsNode.select_nodes(
-         "static[not(@inactive='inactive')]/route[not(@inactive='inactive')]")) {
+         nmdu::xpathQuery("static[not(@inactive='inactive')]/route[not(@inactive='inactive')]"))) {
     const pugi::xml_node routeNode{routeMatch.node()};
     nmdo::Route route;
     route.setProtocol("static");
     route.setAdminDistance(5);  // Default for static routes
 
-    const auto nameMatch{routeNode.select_node("name")};
+    const auto nameMatch{routeNode.select_node(nmdu::xpathQuery("name"))};
     if (nameMatch) {
       const nmdo::IpAddress dstIpNet{nameMatch.node().text().as_string()};
       route.setDstIpNet(dstIpNet);
     }
 
-    const auto discardMatch{routeNode.select_node("discard[not(@inactive='inactive')]")};
+    const auto discardMatch{routeNode.select_node(nmdu::xpathQuery("discard[not(@inactive='inactive')]"))};
     if (discardMatch) {
       const std::string outgoingIfaceName{discardMatch.node().name()};
       route.setIfaceName(outgoingIfaceName);
     }
 
-    const auto nextHopMatch{routeNode.select_node("next-hop[not(@inactive='inactive')]")};
+    const auto nextHopMatch{routeNode.select_node(nmdu::xpathQuery("next-hop[not(@inactive='inactive')]"))};
     if (nextHopMatch) {
       const nmdo::IpAddress nextHopIpAddr{nextHopMatch.node().text().as_string()};
       route.setNextHopIpAddr(nextHopIpAddr);
     }
 
-    const auto nextTableMatch{routeNode.select_node("next-table[not(@inactive='inactive')]")};
+    const auto nextTableMatch{routeNode.select_node(nmdu::xpathQuery("next-table[not(@inactive='inactive')]"))};
     if (nextTableMatch) {
       const std::string nextRouteTableName{
         nextTableMatch.node().text().as_string()
@@ -547,18 +548,18 @@ Parser::parseConfigZones(const pugi::xml_node& zonesNode)
   std::map<std::string, nmdo::AclZone> aclZones;
 
   for (const auto& zoneMatch :
-       zonesNode.select_nodes("security-zone[not(@inactive='inactive')]")) {
+       zonesNode.select_nodes(nmdu::xpathQuery("security-zone[not(@inactive='inactive')]"))) {
     const pugi::xml_node zoneNode{zoneMatch.node()};
     const std::string zoneName{
-      zoneNode.select_node("name").node().text().as_string()
+      zoneNode.select_node(nmdu::xpathQuery("name")).node().text().as_string()
     };
     aclZones[zoneName].setId(zoneName);
 
     for (const auto& interfacesMatch :
-         zoneNode.select_nodes("interfaces[not(@inactive='inactive')]")) {
+         zoneNode.select_nodes(nmdu::xpathQuery("interfaces[not(@inactive='inactive')]"))) {
       const pugi::xml_node interfacesNode{interfacesMatch.node()};
       const std::string ifaceName{
-        interfacesNode.select_node("name").node().text().as_string()
+        interfacesNode.select_node(nmdu::xpathQuery("name")).node().text().as_string()
       };
       aclZones[zoneName].addIface(ifaceName);
     }
@@ -575,36 +576,36 @@ Parser::parseConfigAddressBook(const pugi::xml_node& addressBookNode)
 
   std::string addressBookNamespace;
   const auto& securityZoneMatch{
-    addressBookNode.select_node("parent::security-zone[not(@inactive='inactive')]")
+    addressBookNode.select_node(nmdu::xpathQuery("parent::security-zone[not(@inactive='inactive')]"))
   };
   if (securityZoneMatch) {
     const pugi::xml_node securityZoneNode{securityZoneMatch.node()};
-    addressBookNamespace = securityZoneNode.select_node("name").node().text().as_string();
+    addressBookNamespace = securityZoneNode.select_node(nmdu::xpathQuery("name")).node().text().as_string();
   }
   else {
-    addressBookNamespace = addressBookNode.select_node("name").node().text().as_string();
+    addressBookNamespace = addressBookNode.select_node(nmdu::xpathQuery("name")).node().text().as_string();
   }
   aclIpNetSets[addressBookNamespace];
 
   for (const auto& addressMatch :
-       addressBookNode.select_nodes("address[not(@inactive='inactive')]")) {
+       addressBookNode.select_nodes(nmdu::xpathQuery("address[not(@inactive='inactive')]"))) {
     const pugi::xml_node addressNode{addressMatch.node()};
     const std::string ipNetName{
-      addressNode.select_node("name").node().text().as_string()
+      addressNode.select_node(nmdu::xpathQuery("name")).node().text().as_string()
     };
     aclIpNetSets[addressBookNamespace][ipNetName].setId(ipNetName, addressBookNamespace);
 
     for (const auto& ipPrefixMatch :
-         addressNode.select_nodes("ip-prefix[not(@inactive='inactive')]")) {
+         addressNode.select_nodes(nmdu::xpathQuery("ip-prefix[not(@inactive='inactive')]"))) {
       const nmdo::IpNetwork ipNet{ipPrefixMatch.node().text().as_string()};
       aclIpNetSets[addressBookNamespace][ipNetName].addIpNet(ipNet);
     }
 
     for (const auto& dnsNameMatch :
-         addressNode.select_nodes("dns-name[not(@inactive='inactive')]")) {
+         addressNode.select_nodes(nmdu::xpathQuery("dns-name[not(@inactive='inactive')]"))) {
       const pugi::xml_node dnsNameNode{dnsNameMatch.node()};
       const std::string dnsName{
-        dnsNameNode.select_node("name").node().text().as_string()
+        dnsNameNode.select_node(nmdu::xpathQuery("name")).node().text().as_string()
       };
       data.observations.addNotable("FQDNs are used that must be resolved");
       aclIpNetSets[addressBookNamespace][ipNetName].addHostname(dnsName);
@@ -612,18 +613,18 @@ Parser::parseConfigAddressBook(const pugi::xml_node& addressBookNode)
   }
 
   for (const auto& addressSetMatch :
-       addressBookNode.select_nodes("address-set[not(@inactive='inactive')]")) {
+       addressBookNode.select_nodes(nmdu::xpathQuery("address-set[not(@inactive='inactive')]"))) {
     const pugi::xml_node addressSetNode{addressSetMatch.node()};
     const std::string ipNetSetName{
-      addressSetNode.select_node("name").node().text().as_string()
+      addressSetNode.select_node(nmdu::xpathQuery("name")).node().text().as_string()
     };
     aclIpNetSets[addressBookNamespace][ipNetSetName].setId(ipNetSetName, addressBookNamespace);
 
     for (const auto& addressMatch :
-         addressSetNode.select_nodes("address[not(@inactive='inactive')]")) {
+         addressSetNode.select_nodes(nmdu::xpathQuery("address[not(@inactive='inactive')]"))) {
       const pugi::xml_node addressNode{addressMatch.node()};
       const std::string ipNetName{
-        addressNode.select_node("name").node().text().as_string()
+        addressNode.select_node(nmdu::xpathQuery("name")).node().text().as_string()
       };
       aclIpNetSets[addressBookNamespace][ipNetSetName].addIncludedId(ipNetName);
     }
@@ -639,7 +640,7 @@ Parser::parseConfigApplications(const pugi::xml_node& applicationsNode)
   std::vector<nmdo::AclService> aclServices;
 
   for (const auto& applicationMatch :
-       applicationsNode.select_nodes("application[not(@inactive='inactive')]")) {
+       applicationsNode.select_nodes(nmdu::xpathQuery("application[not(@inactive='inactive')]"))) {
     const pugi::xml_node applicationNode{applicationMatch.node()};
 
     auto aclServicesToAdd =
@@ -652,20 +653,20 @@ Parser::parseConfigApplications(const pugi::xml_node& applicationsNode)
   }
 
   for (const auto& applicationSetMatch :
-       applicationsNode.select_nodes("application-set[not(@inactive='inactive')]")) {
+       applicationsNode.select_nodes(nmdu::xpathQuery("application-set[not(@inactive='inactive')]"))) {
     const pugi::xml_node applicationSetNode{applicationSetMatch.node()};
     nmdo::AclService aclService;
 
     const std::string applicationSetName{
-      applicationSetNode.select_node("name").node().text().as_string()
+      applicationSetNode.select_node(nmdu::xpathQuery("name")).node().text().as_string()
     };
     aclService.setId(applicationSetName);
 
     for (const auto& applicationMatch :
-         applicationSetNode.select_nodes("application[not(@inactive='inactive')]")) {
+         applicationSetNode.select_nodes(nmdu::xpathQuery("application[not(@inactive='inactive')]"))) {
       const pugi::xml_node applicationNode{applicationMatch.node()};
       const std::string applicationName{
-        applicationNode.select_node("name").node().text().as_string()
+        applicationNode.select_node(nmdu::xpathQuery("name")).node().text().as_string()
       };
       aclService.addIncludedId(applicationName);
     }
@@ -683,11 +684,11 @@ Parser::parseConfigApplicationOrTerm(const pugi::xml_node& applicationNode)
   std::vector<nmdo::AclService> aclServices;
 
   const std::string applicationName{
-    applicationNode.select_node("name").node().text().as_string()
+    applicationNode.select_node(nmdu::xpathQuery("name")).node().text().as_string()
   };
 
   const auto protocolMatch{
-    applicationNode.select_node("protocol[not(@inactive='inactive')]")
+    applicationNode.select_node(nmdu::xpathQuery("protocol[not(@inactive='inactive')]"))
   };
   if (protocolMatch) {
     nmdo::AclService aclService;
@@ -712,7 +713,7 @@ Parser::parseConfigApplicationOrTerm(const pugi::xml_node& applicationNode)
     aclService.setProtocol(protocol);
 
     const auto srcPortMatch{
-      applicationNode.select_node("source-port[not(@inactive='inactive')]")
+      applicationNode.select_node(nmdu::xpathQuery("source-port[not(@inactive='inactive')]"))
     };
     if (srcPortMatch) {
       const nmdo::PortRange srcPortRange{
@@ -727,7 +728,7 @@ Parser::parseConfigApplicationOrTerm(const pugi::xml_node& applicationNode)
     }
 
     const auto dstPortMatch{
-      applicationNode.select_node("destination-port[not(@inactive='inactive')]")
+      applicationNode.select_node(nmdu::xpathQuery("destination-port[not(@inactive='inactive')]"))
     };
     if (dstPortMatch) {
       const nmdo::PortRange dstPortRange{
@@ -745,7 +746,7 @@ Parser::parseConfigApplicationOrTerm(const pugi::xml_node& applicationNode)
   }
 
   for (const auto& termMatch :
-       applicationNode.select_nodes("term[not(@inactive='inactive')]")) {
+       applicationNode.select_nodes(nmdu::xpathQuery("term[not(@inactive='inactive')]"))) {
     const pugi::xml_node termNode{termMatch.node()};
     for (auto& aclService : parseConfigApplicationOrTerm(termNode)) {
       aclService.setId(applicationName);
@@ -766,7 +767,7 @@ Parser::parseConfigPolicies(const pugi::xml_node& policiesNode)
   ruleId = 0;
   for (const auto& policyMatch :
        policiesNode.select_nodes(
-         "policy[not(@inactive='inactive')]/policy[not(@inactive='inactive')]")) {
+         nmdu::xpathQuery("policy[not(@inactive='inactive')]/policy[not(@inactive='inactive')]"))) {
     const pugi::xml_node policyNode{policyMatch.node()};
     auto aclRulesToAdd = parseConfigPolicy(policyNode, ruleId);
     std::copy(
@@ -779,7 +780,7 @@ Parser::parseConfigPolicies(const pugi::xml_node& policiesNode)
 
   ruleId = 0;
   for (const auto& policyMatch :
-       policiesNode.select_nodes("global/policy[not(@inactive='inactive')]")) {
+       policiesNode.select_nodes(nmdu::xpathQuery("global/policy[not(@inactive='inactive')]"))) {
     const pugi::xml_node policyNode{policyMatch.node()};
     auto aclRulesToAdd = parseConfigPolicy(policyNode, ruleId);
     std::copy(
@@ -800,14 +801,14 @@ Parser::parseConfigPolicy(const pugi::xml_node& policyNode, const size_t ruleId)
   std::vector<nmdo::AclRuleService> aclRules;
 
   const std::string description{
-    policyNode.select_node("name").node().text().as_string()
+    policyNode.select_node(nmdu::xpathQuery("name")).node().text().as_string()
   };
 
   std::vector<std::string> incomingZoneIds;
 
   const auto &incomingZoneNodes = policyNode.select_nodes
-       ("(../from-zone-name[not(@inactive='inactive')])|"
-        "(match[not(@inactive='inactive')]/from-zone[not(@inactive='inactive')])");
+       (nmdu::xpathQuery("(../from-zone-name[not(@inactive='inactive')])|"
+        "(match[not(@inactive='inactive')]/from-zone[not(@inactive='inactive')])"));
   std::transform(incomingZoneNodes.begin(), incomingZoneNodes.end(),
       std::back_inserter(incomingZoneIds),
       [](auto& incomingZoneMatch){return incomingZoneMatch.node().text().as_string();});
@@ -817,8 +818,8 @@ Parser::parseConfigPolicy(const pugi::xml_node& policyNode, const size_t ruleId)
 
   std::vector<std::string> outgoingZoneIds;
   const auto &outgoingZoneNodes = policyNode.select_nodes
-       ("(../to-zone-name[not(@inactive='inactive')])|"
-        "(match[not(@inactive='inactive')]/to-zone[not(@inactive='inactive')])");
+       (nmdu::xpathQuery("(../to-zone-name[not(@inactive='inactive')])|"
+        "(match[not(@inactive='inactive')]/to-zone[not(@inactive='inactive')])"));
   std::transform(outgoingZoneNodes.begin(), outgoingZoneNodes.end(),
       std::back_inserter(outgoingZoneIds),
       [](auto& outgoingZoneMatch){return outgoingZoneMatch.node().text().as_string();});
@@ -828,7 +829,7 @@ Parser::parseConfigPolicy(const pugi::xml_node& policyNode, const size_t ruleId)
 
   std::vector<std::string> srcIpNetSetIds;
   const auto &srcAddressNodes = policyNode.select_nodes(
-      "match[not(@inactive='inactive')]/source-address[not(@inactive='inactive')]");
+      nmdu::xpathQuery("match[not(@inactive='inactive')]/source-address[not(@inactive='inactive')]"));
   std::transform(srcAddressNodes.begin(), srcAddressNodes.end(),
       std::back_inserter(srcIpNetSetIds),
       [](auto& srcAddressMatch){return srcAddressMatch.node().text().as_string();});
@@ -838,7 +839,7 @@ Parser::parseConfigPolicy(const pugi::xml_node& policyNode, const size_t ruleId)
 
   std::vector<std::string> dstIpNetSetIds;
   const auto &dstAddressNodes = policyNode.select_nodes(
-         "match[not(@inactive='inactive')]/destination-address[not(@inactive='inactive')]");
+         nmdu::xpathQuery("match[not(@inactive='inactive')]/destination-address[not(@inactive='inactive')]"));
   std::transform(dstAddressNodes.begin(), dstAddressNodes.end(),
       std::back_inserter(dstIpNetSetIds),
       [](auto& dstAddressMatch){return dstAddressMatch.node().text().as_string();});
@@ -848,7 +849,7 @@ Parser::parseConfigPolicy(const pugi::xml_node& policyNode, const size_t ruleId)
 
   std::vector<std::string> serviceIds;
   const auto &serviceIdNodes = policyNode.select_nodes(
-         "match[not(@inactive='inactive')]/application[not(@inactive='inactive')]");
+         nmdu::xpathQuery("match[not(@inactive='inactive')]/application[not(@inactive='inactive')]"));
   std::transform(serviceIdNodes.begin(), serviceIdNodes.end(),
       std::back_inserter(serviceIds),
       [](auto& serviceIdMatch){return serviceIdMatch.node().text().as_string();});
@@ -859,12 +860,12 @@ Parser::parseConfigPolicy(const pugi::xml_node& policyNode, const size_t ruleId)
 
   std::string action;
   if (policyNode.select_node(
-        "then[not(@inactive='inactive')]/permit[not(@inactive='inactive')]")) {
+        nmdu::xpathQuery("then[not(@inactive='inactive')]/permit[not(@inactive='inactive')]"))) {
     action = "allow";
   }
   else if (policyNode.select_node(
-        "(then[not(@inactive='inactive')]/deny[not(@inactive='inactive')])|"
-        "(then[not(@inactive='inactive')]/reject[not(@inactive='inactive')])")) {
+        nmdu::xpathQuery("(then[not(@inactive='inactive')]/deny[not(@inactive='inactive')])|"
+        "(then[not(@inactive='inactive')]/reject[not(@inactive='inactive')])"))) {
     action = "block";
   }
 
@@ -873,7 +874,7 @@ Parser::parseConfigPolicy(const pugi::xml_node& policyNode, const size_t ruleId)
       // Initially default to global address-book.
       std::string srcIpNetSetNamespace{"global"};
       std::string dstIpNetSetNamespace{"global"};
-      if (policyNode.select_node("../../../zones/security-zone/address-book")) {
+      if (policyNode.select_node(nmdu::xpathQuery("../../../zones/security-zone/address-book"))) {
         // Use per-zone address-books instead of global address-book.
         // However, leave "any" zones on the global address-book.
         if ("any" != incomingZoneId) {
@@ -888,7 +889,7 @@ Parser::parseConfigPolicy(const pugi::xml_node& policyNode, const size_t ruleId)
       if (false) {
         ruleIdBase = 5000000;  // Default Policies
       }
-      else if (policyNode.select_node("parent::global")) {
+      else if (policyNode.select_node(nmdu::xpathQuery("parent::global"))) {
         ruleIdBase = 4000000;  // Global Policies
       }
       else if (incomingZoneId != outgoingZoneId) {
@@ -933,7 +934,7 @@ Parser::parseRouteInfo(const pugi::xml_node& routeInfoNode)
   auto& logicalSystem{data.logicalSystems[logicalSystemName]};
 
   for (const auto& routeTableMatch :
-       routeInfoNode.select_nodes("route-table[not(@inactive='inactive')]")) {
+       routeInfoNode.select_nodes(nmdu::xpathQuery("route-table[not(@inactive='inactive')]"))) {
     const pugi::xml_node routeTableNode{routeTableMatch.node()};
     auto parsedVrfs{parseRouteTable(routeTableNode)};
     logicalSystem.vrfs.merge(parsedVrfs);
@@ -966,7 +967,7 @@ std::map<std::string, nmdo::Vrf>
 Parser::parseRouteTable(const pugi::xml_node& routeTableNode)
 {
   const std::string routeTableName{
-    routeTableNode.select_node("table-name").node().text().as_string()
+    routeTableNode.select_node(nmdu::xpathQuery("table-name")).node().text().as_string()
   };
   const auto [vrfId, tableId]{
     extractVrfIdTableId(routeTableName)
@@ -987,7 +988,7 @@ Parser::parseRouteTable(const pugi::xml_node& routeTableNode)
 
   vrfs[vrfId].setId(vrfId);
 
-  for (const auto& routeMatch : routeTableNode.select_nodes("rt[not(@inactive='inactive')]")) {
+  for (const auto& routeMatch : routeTableNode.select_nodes(nmdu::xpathQuery("rt[not(@inactive='inactive')]"))) {
     const pugi::xml_node routeNode{routeMatch.node()};
     for (auto& route : parseRoute(routeNode)) {
       route.setVrfId(vrfId);
@@ -1007,10 +1008,10 @@ Parser::parseRoute(const pugi::xml_node& routeNode)
   bool ignoreRoute{false};
 
   const std::string dstIpString{
-    routeNode.select_node("rt-destination").node().text().as_string()
+    routeNode.select_node(nmdu::xpathQuery("rt-destination")).node().text().as_string()
   };
   const std::string prefixString{
-    routeNode.select_node("rt-prefix-length").node().text().as_string()
+    routeNode.select_node(nmdu::xpathQuery("rt-prefix-length")).node().text().as_string()
   };
 
   // Ignore ephemeral multicast routes where the destination
@@ -1031,21 +1032,21 @@ Parser::parseRoute(const pugi::xml_node& routeNode)
   };
 
   for (const auto& routeEntryMatch :
-       routeNode.select_nodes("rt-entry[not(@inactive='inactive')]")) {
+       routeNode.select_nodes(nmdu::xpathQuery("rt-entry[not(@inactive='inactive')]"))) {
     const pugi::xml_node routeEntryNode{routeEntryMatch.node()};
 
     nmdo::Route route;
     route.setDstIpNet(dstIpNet);
 
     const std::string activeTag{
-      routeEntryNode.select_node("active-tag").node().text().as_string()
+      routeEntryNode.select_node(nmdu::xpathQuery("active-tag")).node().text().as_string()
     };
     if ("*" != activeTag) {
       route.setActive(false);
     }
 
     const auto protocolMatch{
-      routeEntryNode.select_node("protocol-name[not(@inactive='inactive')]")
+      routeEntryNode.select_node(nmdu::xpathQuery("protocol-name[not(@inactive='inactive')]"))
     };
     if (protocolMatch) {
       const std::string protocol{
@@ -1055,7 +1056,7 @@ Parser::parseRoute(const pugi::xml_node& routeNode)
     }
 
     const auto preferenceMatch{
-      routeEntryNode.select_node("preference[not(@inactive='inactive')]")
+      routeEntryNode.select_node(nmdu::xpathQuery("preference[not(@inactive='inactive')]"))
     };
     if (preferenceMatch) {
       const size_t adminDistance{
@@ -1065,7 +1066,7 @@ Parser::parseRoute(const pugi::xml_node& routeNode)
     }
 
     const auto metricMatch{
-      routeEntryNode.select_node("metric[not(@inactive='inactive')]")
+      routeEntryNode.select_node(nmdu::xpathQuery("metric[not(@inactive='inactive')]"))
     };
     if (metricMatch) {
       const size_t metric{
@@ -1075,7 +1076,7 @@ Parser::parseRoute(const pugi::xml_node& routeNode)
     }
 
     const auto nhTypeMatch{
-      routeEntryNode.select_node("nh-type[not(@inactive='inactive')]")
+      routeEntryNode.select_node(nmdu::xpathQuery("nh-type[not(@inactive='inactive')]"))
     };
     if (nhTypeMatch) {
       const std::string nhType{
@@ -1088,7 +1089,7 @@ Parser::parseRoute(const pugi::xml_node& routeNode)
 
     const auto nextHopTableMatch{
       routeEntryNode.select_node(
-          "nh[not(@inactive='inactive')]/nh-table[not(@inactive='inactive')]")
+          nmdu::xpathQuery("nh[not(@inactive='inactive')]/nh-table[not(@inactive='inactive')]"))
     };
     if (nextHopTableMatch) {
       const std::string nextRouteTableName{
@@ -1103,7 +1104,7 @@ Parser::parseRoute(const pugi::xml_node& routeNode)
 
     const auto nextHopRtrMatch{
       routeEntryNode.select_node(
-          "nh[not(@inactive='inactive')]/to[not(@inactive='inactive')]")
+          nmdu::xpathQuery("nh[not(@inactive='inactive')]/to[not(@inactive='inactive')]"))
     };
     if (nextHopRtrMatch) {
       const nmdo::IpAddress nextHopIpAddr{
@@ -1114,8 +1115,8 @@ Parser::parseRoute(const pugi::xml_node& routeNode)
 
     const auto nextHopViaMatch{
       routeEntryNode.select_node
-        ("(nh[not(@inactive='inactive')]/via[not(@inactive='inactive')])|"
-         "(nh[not(@inactive='inactive')]/nh-local-interface[not(@inactive='inactive')])")
+        (nmdu::xpathQuery("(nh[not(@inactive='inactive')]/via[not(@inactive='inactive')])|"
+         "(nh[not(@inactive='inactive')]/nh-local-interface[not(@inactive='inactive')])"))
     };
     if (nextHopViaMatch) {
       const std::string ifaceName{
@@ -1138,11 +1139,11 @@ Parser::parseArpTableInfo(const pugi::xml_node& arpTableInfoNode)
   auto& ifaces{data.logicalSystems[logicalSystemId].ifaces};
 
   for (const auto& arpTableEntryMatch :
-       arpTableInfoNode.select_nodes("arp-table-entry")) {
+       arpTableInfoNode.select_nodes(nmdu::xpathQuery("arp-table-entry"))) {
     const pugi::xml_node arpTableEntryNode{arpTableEntryMatch.node()};
 
     const auto ifaceNameMatch{
-      arpTableEntryNode.select_node("interface-name")
+      arpTableEntryNode.select_node(nmdu::xpathQuery("interface-name"))
     };
     if (ifaceNameMatch) {
       std::string ifaceName{
@@ -1152,7 +1153,7 @@ Parser::parseArpTableInfo(const pugi::xml_node& arpTableInfoNode)
       ifaces[ifaceName].setName(ifaceName);
 
       const auto peerMacAddrMatch{
-        arpTableEntryNode.select_node("mac-address")
+        arpTableEntryNode.select_node(nmdu::xpathQuery("mac-address"))
       };
       if (peerMacAddrMatch &&
           nmdp::matchString<nmdp::ParserMacAddress, nmdo::MacAddress>
@@ -1163,7 +1164,7 @@ Parser::parseArpTableInfo(const pugi::xml_node& arpTableInfoNode)
         peerMacAddr.setResponding(true);
 
         const auto peerIpAddrMatch{
-          arpTableEntryNode.select_node("ip-address")
+          arpTableEntryNode.select_node(nmdu::xpathQuery("ip-address"))
         };
         if (peerIpAddrMatch &&
             nmdp::matchString<nmdp::ParserIpAddress, nmdo::IpAddress>
@@ -1188,11 +1189,11 @@ Parser::parseIpv6NeighborInfo(const pugi::xml_node& ipv6NeighborInfoNode)
   auto& ifaces{data.logicalSystems[logicalSystemId].ifaces};
 
   for (const auto& ipv6NdEntryMatch :
-       ipv6NeighborInfoNode.select_nodes("ipv6-nd-entry")) {
+       ipv6NeighborInfoNode.select_nodes(nmdu::xpathQuery("ipv6-nd-entry"))) {
     const pugi::xml_node ipv6NdEntryNode{ipv6NdEntryMatch.node()};
 
     const auto ifaceNameMatch{
-      ipv6NdEntryNode.select_node("ipv6-nd-interface-name")
+      ipv6NdEntryNode.select_node(nmdu::xpathQuery("ipv6-nd-interface-name"))
     };
     if (ifaceNameMatch) {
       std::string ifaceName{
@@ -1202,7 +1203,7 @@ Parser::parseIpv6NeighborInfo(const pugi::xml_node& ipv6NeighborInfoNode)
       ifaces[ifaceName].setName(ifaceName);
 
       const auto peerMacAddrMatch{
-        ipv6NdEntryNode.select_node("ipv6-nd-neighbor-l2-address")
+        ipv6NdEntryNode.select_node(nmdu::xpathQuery("ipv6-nd-neighbor-l2-address"))
       };
       if (peerMacAddrMatch &&
           nmdp::matchString<nmdp::ParserMacAddress, nmdo::MacAddress>
@@ -1213,7 +1214,7 @@ Parser::parseIpv6NeighborInfo(const pugi::xml_node& ipv6NeighborInfoNode)
         peerMacAddr.setResponding(true);
 
         const auto peerIpAddrMatch{
-          ipv6NdEntryNode.select_node("ipv6-nd-neighbor-address")
+          ipv6NdEntryNode.select_node(nmdu::xpathQuery("ipv6-nd-neighbor-address"))
         };
         if (peerIpAddrMatch &&
             nmdp::matchString<nmdp::ParserIpAddress, nmdo::IpAddress>
@@ -1238,11 +1239,11 @@ Parser::parseLldpNeighborInfo(const pugi::xml_node& lldpNeighborInfoNode)
   auto& ifaces{data.logicalSystems[logicalSystemId].ifaces};
 
   for (const auto& infoMatch :
-       lldpNeighborInfoNode.select_nodes("lldp-neighbor-information[not(@inactive='inactive')]")) {
+       lldpNeighborInfoNode.select_nodes(nmdu::xpathQuery("lldp-neighbor-information[not(@inactive='inactive')]"))) {
     const pugi::xml_node infoNode{infoMatch.node()};
 
     const auto localPortIdMatch{
-      infoNode.select_node("lldp-local-port-id")
+      infoNode.select_node(nmdu::xpathQuery("lldp-local-port-id"))
     };
     std::string localIfaceName;
     if (localPortIdMatch) {
@@ -1256,7 +1257,7 @@ Parser::parseLldpNeighborInfo(const pugi::xml_node& lldpNeighborInfoNode)
     }
 
     const auto localParentIfaceMatch{
-      infoNode.select_node("lldp-local-parent-interface-name")
+      infoNode.select_node(nmdu::xpathQuery("lldp-local-parent-interface-name"))
     };
     std::string localParentIfaceName;
     if (localParentIfaceMatch) {
@@ -1270,14 +1271,14 @@ Parser::parseLldpNeighborInfo(const pugi::xml_node& lldpNeighborInfoNode)
     }
 
     const auto remoteChassisIdSubtypeMatch{
-      infoNode.select_node("lldp-remote-chassis-id-subtype")
+      infoNode.select_node(nmdu::xpathQuery("lldp-remote-chassis-id-subtype"))
     };
     if (remoteChassisIdSubtypeMatch) {
       const std::string remoteChassisIdSubtype{
         remoteChassisIdSubtypeMatch.node().text().as_string()
       };
       const std::string remoteChassisId{
-        infoNode.select_node("lldp-remote-chassis-id").node().text().as_string()
+        infoNode.select_node(nmdu::xpathQuery("lldp-remote-chassis-id")).node().text().as_string()
       };
       if (("Mac address" == remoteChassisIdSubtype) &&
           nmdp::matchString<nmdp::ParserMacAddress, nmdo::MacAddress>
@@ -1293,14 +1294,14 @@ Parser::parseLldpNeighborInfo(const pugi::xml_node& lldpNeighborInfoNode)
     }
 
     const auto remotePortIdSubtypeMatch{
-      infoNode.select_node("lldp-remote-port-id-subtype")
+      infoNode.select_node(nmdu::xpathQuery("lldp-remote-port-id-subtype"))
     };
     if (remotePortIdSubtypeMatch) {
       const std::string remotePortIdSubtype{
         remotePortIdSubtypeMatch.node().text().as_string()
       };
       const std::string remotePortId{
-        infoNode.select_node("lldp-remote-port-id").node().text().as_string()
+        infoNode.select_node(nmdu::xpathQuery("lldp-remote-port-id")).node().text().as_string()
       };
       if (("Mac address" == remotePortIdSubtype) &&
           nmdp::matchString<nmdp::ParserMacAddress, nmdo::MacAddress>
@@ -1326,14 +1327,14 @@ Parser::parseEthernetSwitching(const pugi::xml_node& l2ngNode)
 
   for (const auto& l2ngEntryMatch :
        l2ngNode.select_nodes(
-         "l2ng-l2rtb-evpn-arp-entry|"
+         nmdu::xpathQuery("l2ng-l2rtb-evpn-arp-entry|"
          "l2ng-l2rtb-evpn-nd-entry|"
          "l2ng-l2ald-mac-entry-vlan|"
-         "l2ng-l2ald-mac-ip-entry")) {
+         "l2ng-l2ald-mac-ip-entry"))) {
     const pugi::xml_node l2ngEntryNode{l2ngEntryMatch.node()};
 
     const auto ifaceMatch{
-      l2ngEntryNode.select_node("l2ng-l2-mac-logical-interface")
+      l2ngEntryNode.select_node(nmdu::xpathQuery("l2ng-l2-mac-logical-interface"))
     };
     const std::string ifaceName{
       ifaceMatch.node().text().as_string()
@@ -1342,7 +1343,7 @@ Parser::parseEthernetSwitching(const pugi::xml_node& l2ngNode)
       ifaces[ifaceName].setName(ifaceName);
 
       const auto vlanMatch{
-        l2ngEntryNode.select_node("l2ng-l2-vlan-id")
+        l2ngEntryNode.select_node(nmdu::xpathQuery("l2ng-l2-vlan-id"))
       };
       if (vlanMatch &&
           (std::string("none") != vlanMatch.node().text().as_string())) {
@@ -1353,7 +1354,7 @@ Parser::parseEthernetSwitching(const pugi::xml_node& l2ngNode)
       }
 
       const auto macAddrMatch{
-        l2ngEntryNode.select_node("l2ng-l2-mac-address")
+        l2ngEntryNode.select_node(nmdu::xpathQuery("l2ng-l2-mac-address"))
       };
       if (macAddrMatch &&
           nmdp::matchString<nmdp::ParserMacAddress, nmdo::MacAddress>
@@ -1364,9 +1365,9 @@ Parser::parseEthernetSwitching(const pugi::xml_node& l2ngNode)
 
         const auto ipAddrMatch{
           l2ngEntryNode.select_node(
-              "l2ng-l2-ip-address|"
+              nmdu::xpathQuery("l2ng-l2-ip-address|"
               "l2ng-l2-evpn-arp-inet-address|"
-              "l2ng-l2-evpn-nd-inet6-address")
+              "l2ng-l2-evpn-nd-inet6-address"))
         };
         if (ipAddrMatch &&
             nmdp::matchString<nmdp::ParserIpAddress, nmdo::IpAddress>
@@ -1388,7 +1389,7 @@ void
 Parser::parseError(const pugi::xml_node& errorNode)
 {
   const std::string message{
-    errorNode.select_node("message").node().text().as_string()
+    errorNode.select_node(nmdu::xpathQuery("message")).node().text().as_string()
   };
   data.observations.addNotable(message);
 }
@@ -1398,7 +1399,7 @@ void
 Parser::parseWarning(const pugi::xml_node& warningNode)
 {
   const std::string message{
-    warningNode.select_node("message").node().text().as_string()
+    warningNode.select_node(nmdu::xpathQuery("message")).node().text().as_string()
   };
   data.observations.addNotable(message);
 }
@@ -44,7 +44,7 @@ MetasploitModule::save(pqxx::transaction_base& t,
 
   port.save(t, toolRunId, deviceId);
 
-  t.exec_prepared("insert_raw_nessus_result_metasploit_module",
+  nmdu::execPrepared(t, "insert_raw_nessus_result_metasploit_module",
       toolRunId,
       port.getIpAddress().toString(),
       port.getProtocol(),
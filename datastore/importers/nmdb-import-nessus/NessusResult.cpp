@@ -45,7 +45,7 @@ NessusResult::save(pqxx::transaction_base& t,
 
   port.save(t, toolRunId, deviceId);
 
-  t.exec_prepared("insert_raw_nessus_result",
+  nmdu::execPrepared(t, "insert_raw_nessus_result",
       toolRunId,
       port.getIpAddress().toString(),
       port.getProtocol(),
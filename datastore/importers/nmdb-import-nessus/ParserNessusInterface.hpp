@@ -42,7 +42,7 @@ typedef std::vector<nmdo::Interface>       ResultPni;
 namespace netmeld::datastore::parsers {
 
   class ParserNessusInterface :
-    public qi::grammar<IstreamIter, ResultPni()>
+    public qi::grammar<ConstIter, ResultPni()>
   {
     public:
       ParserNessusInterface() : ParserNessusInterface::base_type(start)
@@ -92,14 +92,14 @@ namespace netmeld::datastore::parsers {
             );
       }
 
-      qi::rule<IstreamIter, ResultPni()>
+      qi::rule<ConstIter, ResultPni()>
         start;
 
-      qi::rule<IstreamIter, nmdo::Interface()>
+      qi::rule<ConstIter, nmdo::Interface()>
         macAddrLine,
         ipAddrLine;
 
-      qi::rule<IstreamIter, std::string()>
+      qi::rule<ConstIter, std::string()>
         ifaceName,
         token;
 
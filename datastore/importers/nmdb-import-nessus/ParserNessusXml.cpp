@@ -0,0 +1,329 @@
+// =============================================================================
+// Copyright 2023 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+// =============================================================================
+
+#include <boost/tokenizer.hpp>
+
+#include <netmeld/core/utils/LoggerSingleton.hpp>
+#include <netmeld/datastore/parsers/ParserIpAddress.hpp>
+
+#include "ParserNessusInterface.hpp"
+#include "ParserNessusXml.hpp"
+
+
+// =============================================================================
+// Parser logic
+// =============================================================================
+static constexpr const char* TIME_FORMAT {"%a %b %d %H:%M:%S %Y"};
+
+const nmco::Time&
+ParserNessusXml::getExecutionStart() const
+{
+  return executionStart;
+}
+
+const nmco::Time&
+ParserNessusXml::getExecutionStop() const
+{
+  return executionStop;
+}
+
+void
+ParserNessusXml::parseReportHost(pugi::xml_node const& reportHostNode,
+                                 Data& data)
+{
+  bool const isResponding = true;
+
+  const auto& props {indexHostProperties(reportHostNode)};
+
+  // Extract Ip Address
+  nmdo::IpAddress ipAddr;
+  for (const auto& tagNode : props.ipAddrs) {
+    std::string ipAddrStr = tagNode.text().as_string();
+    if (ipAddrStr.empty()) {
+      continue;
+    }
+    ipAddr.setAddress(ipAddrStr);
+    ipAddr.setResponding(isResponding);
+
+    // Extract host FQND
+    for (const auto& fqdnTag : props.fqdns) {
+      ipAddr.addAlias(fqdnTag.text().as_string(), "nessus scan");
+    }
+
+    // Extract hostname
+    for (const auto& hostTag : props.hostnames) {
+      ipAddr.addAlias(hostTag.text().as_string(), "nessus scan");
+    }
+
+    data.ipAddrs.push_back(ipAddr);
+  }
+
+  // Extract Mac Address
+  for (const auto& tagNode : props.macAddrs) {
+    std::string macAddrs {tagNode.text().as_string()};
+    if (!macAddrs.empty()) {
+      // Nessus puts multiple MACs under one tag, so split and iterate
+      boost::char_separator<char> sep("\n");
+      boost::tokenizer<boost::char_separator<char>> tokens(macAddrs, sep);
+
+      size_t macCount {0};
+      for (auto it = tokens.begin(); it != tokens.end(); ++it, ++macCount) {
+        nmdo::MacAddress macAddr(*it);
+        macAddr.setResponding(isResponding);
+        data.macAddrs.push_back(macAddr);
+      }
+
+      if (1 == macCount) { // If only one found, associate MAC-to-IP
+        data.macAddrs.back().addIpAddress(ipAddr);
+      }
+    }
+  }
+
+  // Extract Operating System
+  for (const auto& tagNode : props.cpes) {
+    std::string cpe {tagNode.text().as_string()};
+
+    std::string prefix {"cpe:/o:"};
+    if (0 == cpe.compare(0, prefix.size(), prefix)) {
+      nmdo::OperatingSystem os(ipAddr);
+      os.setCpe(cpe);
+      os.setAccuracy(1.0);
+
+      data.oses.push_back(os);
+    }
+  }
+
+  // Extract traceroute hops
+  for (const auto& tagNode : props.tracerouteHops) {
+    const std::string hopIpAddrStr{tagNode.text().as_string()};
+
+    if (nmdp::matchString<nmdp::ParserIpAddress, nmdo::IpAddress>(hopIpAddrStr)) {
+      nmdo::TracerouteHop tracerouteHop;
+      tracerouteHop.setDstIp(ipAddr);
+      tracerouteHop.setHopIp(nmdo::IpAddress{hopIpAddrStr});
+      tracerouteHop.setHopCount(static_cast<uint32_t>(std::stoul(
+          std::string{tagNode.attribute("name").as_string()}.substr(15)
+        )));
+
+      data.tracerouteHops.emplace_back(tracerouteHop);
+    }
+  }
+
+  // Get first hostname to pass down for creating Interfaces
+  std::string hostname;
+  if (!props.hostnames.empty()) {
+    hostname = props.hostnames.front().text().as_string();
+  }
+
+  // Extract ReportItem elements
+  for (const auto& reportItemNode : reportHostNode.children("ReportItem")) {
+    parseReportItem(reportItemNode, ipAddr, hostname, data);
+  }
+}
+
+void
+ParserNessusXml::parseReportItem(pugi::xml_node const& reportItemNode,
+    nmdo::IpAddress ipAddr, std::string hostname, Data& data)
+{
+  // Extact Port and Nessus results
+  std::string   protocol =
+    reportItemNode.attribute("protocol").as_string();
+  int           portNum =
+    reportItemNode.attribute("port").as_int();
+  std::string   portState =
+    (portNum ? "open" : "none");
+  std::string   portReason =
+    "nessus scan";
+  //std::string   serviceName =
+  //  reportItemNode.attribute("svc_name").as_string();
+  unsigned int  severity =
+    reportItemNode.attribute("severity").as_uint();
+  unsigned int  pluginId =
+    reportItemNode.attribute("pluginID").as_uint();
+  std::string   pluginName =
+    reportItemNode.attribute("pluginName").as_string();
+  std::string   pluginFamily =
+    reportItemNode.attribute("pluginFamily").as_string();
+
+  // Single pass over the children; first occurrence wins for text fields
+  pugi::xml_node pluginTypeNode;
+  pugi::xml_node pluginOutputNode;
+  pugi::xml_node descriptionNode;
+  pugi::xml_node solutionNode;
+  std::vector<pugi::xml_node> cveNodes;
+  std::vector<pugi::xml_node> msfNameNodes;
+  for (const auto& childNode : reportItemNode.children()) {
+    const std::string_view name {childNode.name()};
+
+    if ("plugin_type" == name && !pluginTypeNode) {
+      pluginTypeNode = childNode;
+    } else if ("plugin_output" == name && !pluginOutputNode) {
+      pluginOutputNode = childNode;
+    } else if ("description" == name && !descriptionNode) {
+      descriptionNode = childNode;
+    } else if ("solution" == name && !solutionNode) {
+      solutionNode = childNode;
+    } else if ("cve" == name) {
+      cveNodes.push_back(childNode);
+    } else if ("metasploit_name" == name) {
+      msfNameNodes.push_back(childNode);
+    }
+  }
+
+  std::string   pluginType =
+    pluginTypeNode.text().as_string();
+  std::string   pluginOutput =
+    pluginOutputNode.text().as_string();
+  std::string   description =
+    descriptionNode.text().as_string();
+  std::string   solution =
+    solutionNode.text().as_string();
+
+  nmdo::Port port(ipAddr);
+  port.setProtocol(protocol);
+  port.setPort(portNum);
+  port.setState(portState);
+  port.setReason(portReason);
+
+  data.ports.push_back(port);
+
+  NessusResult nr;
+  nr.port = port;
+  nr.pluginId = pluginId;
+  nr.pluginName = pluginName;
+  nr.pluginFamily = pluginFamily;
+  nr.pluginType = pluginType;
+  nr.pluginOutput = pluginOutput;
+  nr.severity = severity;
+  nr.description = description;
+  nr.solution = solution;
+
+  data.nessusResults.push_back(nr);
+
+  // Extract CVE identifiers
+  for (const auto& cveNode : cveNodes) {
+    nmdo::Cve cve(cveNode.text().as_string());
+    cve.setPort(port);
+    cve.setPluginId(pluginId);
+    data.cves.push_back(cve);
+  }
+
+  // Extract Metasploit modules
+  for (const auto& msfNameNode : msfNameNodes) {
+    std::string name = msfNameNode.text().as_string();
+
+    MetasploitModule mm;
+    mm.port = port;
+    mm.pluginId = pluginId;
+    mm.name = name;
+
+    data.metasploitModules.push_back(mm);
+  }
+
+  // Extract Interface mappings from 3 different plugins
+  enum pluginIds { IPv6 = 25202, IPv4 = 25203, Mac = 33276 };
+  if (pluginId == IPv6 || pluginId == IPv4 || pluginId == Mac) {
+    auto parsedInterfaces = nmdp::fromString<nmdp::ParserNessusInterface,
+                                            std::vector<nmdo::Interface>>
+                                           (pluginOutput);
+
+    auto it = data.interfaces.find(ipAddr);
+    if (it == data.interfaces.end()) {
+      // Create new
+      data.interfaces.emplace(ipAddr, InterfaceHelper{});
+      it = data.interfaces.find(ipAddr);
+    }
+
+    // Update existing
+    for (auto& iface : parsedInterfaces) {
+      it->second.add(iface, hostname);
+    }
+  }
+
+}
+
+ParserNessusXml::HostProperties
+ParserNessusXml::indexHostProperties(pugi::xml_node const& reportHostNode)
+{
+  HostProperties props;
+
+  const auto& propertiesNode {reportHostNode.child("HostProperties")};
+  for (const auto& tagNode : propertiesNode.children("tag")) {
+    const std::string_view name {tagNode.attribute("name").as_string()};
+
+    if ("host-ip" == name || "container-host" == name) {
+      props.ipAddrs.push_back(tagNode);
+    } else if ("host-fqdn" == name) {
+      props.fqdns.push_back(tagNode);
+    } else if ("hostname" == name) {
+      props.hostnames.push_back(tagNode);
+    } else if ("mac-address" == name) {
+      props.macAddrs.push_back(tagNode);
+    } else if (name.starts_with("cpe")) {
+      props.cpes.push_back(tagNode);
+    } else if (name.starts_with("traceroute-hop-")) {
+      props.tracerouteHops.push_back(tagNode);
+    } else if ("HOST_START" == name) {
+      extractExecutionStart(tagNode);
+    } else if ("HOST_END" == name) {
+      extractExecutionStop(tagNode);
+    }
+  }
+
+  return props;
+}
+
+void
+ParserNessusXml::extractExecutionStart(pugi::xml_node const& timeLowerNode)
+{
+  LOG_DEBUG << "[str] Start: " << timeLowerNode.text().as_string() << std::endl;
+
+  nmco::Time tempLower;
+  tempLower.readFormatted(timeLowerNode.text().as_string(), TIME_FORMAT);
+
+  LOG_DEBUG << "[tmp] Start: " << tempLower << std::endl;
+
+  // Keep earliest start time
+  if ((executionStart.isNull()) || (tempLower < executionStart)) {
+    executionStart = tempLower;
+  }
+}
+
+void
+ParserNessusXml::extractExecutionStop(pugi::xml_node const& timeUpperNode)
+{
+  LOG_DEBUG << "[str] Stop : " << timeUpperNode.text().as_string() << std::endl;
+
+  nmco::Time tempUpper;
+  tempUpper.readFormatted(timeUpperNode.text().as_string(), TIME_FORMAT);
+
+  LOG_DEBUG << "[tmp] Stop : " << tempUpper << std::endl;
+
+  // Keep latest end time
+  if ((executionStop.isNull()) || (executionStop < tempUpper)) {
+    executionStop = tempUpper;
+  }
+}
@@ -0,0 +1,104 @@
+// =============================================================================
+// Copyright 2023 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+// =============================================================================
+
+#ifndef PARSER_NESSUS_XML
+#define PARSER_NESSUS_XML
+
+#include <map>
+#include <vector>
+
+#include <pugixml.hpp>
+
+#include <netmeld/core/objects/Time.hpp>
+#include <netmeld/datastore/objects/Cve.hpp>
+#include <netmeld/datastore/objects/IpAddress.hpp>
+#include <netmeld/datastore/objects/MacAddress.hpp>
+#include <netmeld/datastore/objects/OperatingSystem.hpp>
+#include <netmeld/datastore/objects/Port.hpp>
+#include <netmeld/datastore/objects/TracerouteHop.hpp>
+
+#include "InterfaceHelper.hpp"
+#include "MetasploitModule.hpp"
+#include "NessusResult.hpp"
+
+namespace nmco = netmeld::core::objects;
+namespace nmdo = netmeld::datastore::objects;
+
+
+struct Data
+{
+  std::vector<nmdo::MacAddress>        macAddrs;
+  std::vector<nmdo::IpAddress>         ipAddrs;
+  std::vector<nmdo::OperatingSystem>   oses;
+  std::vector<nmdo::Port>              ports;
+  std::vector<nmdo::TracerouteHop>     tracerouteHops;
+  std::vector<NessusResult>            nessusResults;
+  std::vector<nmdo::Cve>               cves;
+  std::vector<MetasploitModule>        metasploitModules;
+  std::map<nmdo::IpAddress, InterfaceHelper>     interfaces;
+};
+typedef std::vector<Data>             Results;
+
+
+/* Parses the ReportHost elements of a Nessus XML (.nessus) file.  A host
+   parses the same whether its node comes from the whole document or, with
+   --stream, from a document holding just that ReportHost.  The execution
+   times span the HOST_START and HOST_END of all hosts parsed.
+*/
+class ParserNessusXml
+{
+  private:
+    nmco::Time  executionStart {"infinity"};
+    nmco::Time  executionStop  {"-infinity"};
+
+    /* HostProperties tags of interest, gathered in one pass over the
+       children of a ReportHost instead of one XPath query per tag name. */
+    struct HostProperties
+    {
+      std::vector<pugi::xml_node> ipAddrs;
+      std::vector<pugi::xml_node> fqdns;
+      std::vector<pugi::xml_node> hostnames;
+      std::vector<pugi::xml_node> macAddrs;
+      std::vector<pugi::xml_node> cpes;
+      std::vector<pugi::xml_node> tracerouteHops;
+    };
+
+  public:
+    void parseReportHost(pugi::xml_node const&, Data&);
+
+    const nmco::Time& getExecutionStart() const;
+    const nmco::Time& getExecutionStop() const;
+
+  private:
+    void parseReportItem(pugi::xml_node const&, nmdo::IpAddress,
+                         std::string, Data&);
+
+    HostProperties indexHostProperties(pugi::xml_node const&);
+    void extractExecutionStart(pugi::xml_node const&);
+    void extractExecutionStop(pugi::xml_node const&);
+};
+
+#endif //PARSER_NESSUS_XML
@@ -0,0 +1,219 @@
+// =============================================================================
+// Copyright 2023 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+// =============================================================================
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+#include <boost/test/unit_test.hpp>
+
+#include <sstream>
+
+#include <netmeld/datastore/utils/XmlElementReader.hpp>
+
+#include "ParserNessusXml.hpp"
+
+namespace nmdu = netmeld::datastore::utils;
+
+
+template<typename T>
+std::vector<std::string>
+toDebugStrings(const std::vector<T>& objects)
+{
+  std::vector<std::string> strings;
+  for (const auto& object : objects) {
+    strings.push_back(object.toDebugString());
+  }
+  return strings;
+}
+
+template<typename T>
+std::vector<std::string>
+toStrings(const std::vector<T>& objects)
+{
+  std::vector<std::string> strings;
+  for (const auto& object : objects) {
+    strings.push_back(object.toString());
+  }
+  return strings;
+}
+
+std::vector<std::string>
+toStrings(const std::map<nmdo::IpAddress, InterfaceHelper>& interfaces)
+{
+  std::vector<std::string> strings;
+  for (const auto& [ipAddr, helper] : interfaces) {
+    for (const auto& [name, wrapper] : helper.interfaces) {
+      strings.push_back(ipAddr.toString() + " " + name + " "
+                        + wrapper.deviceId + " "
+                        + wrapper.interface.toDebugString());
+    }
+  }
+  return strings;
+}
+
+BOOST_AUTO_TEST_CASE(testReportHostStream)
+{
+  const std::string nessus {
+    R"STR(<?xml version="1.0" ?>
+    <NessusClientData_v2>
+    <Policy><policyName>test</policyName></Policy>
+    <Report name="test">
+    <ReportHost name="10.0.0.1"><HostProperties>
+    <tag name="HOST_END">Tue Jan 02 10:30:00 2018</tag>
+    <tag name="mac-address">00:11:22:33:44:55</tag>
+    <tag name="traceroute-hop-0">10.0.0.254</tag>
+    <tag name="cpe-0">cpe:/o:linux:linux_kernel</tag>
+    <tag name="host-ip">10.0.0.1</tag>
+    <tag name="host-fqdn">one.example.com</tag>
+    <tag name="hostname">one</tag>
+    <tag name="HOST_START">Tue Jan 02 10:00:00 2018</tag>
+    </HostProperties>
+    <ReportItem port="22" svc_name="ssh" protocol="tcp" severity="2"
+      pluginID="10881" pluginName="SSH Protocol Versions Supported"
+      pluginFamily="General">
+    <description>SSH versions.</description>
+    <plugin_type>remote</plugin_type>
+    <solution>n/a</solution>
+    <cve>CVE-2018-0001</cve>
+    <cve>CVE-2018-0002</cve>
+    <metasploit_name>SSH Module</metasploit_name>
+    <plugin_output>SSHv2</plugin_output>
+    </ReportItem>
+    <ReportItem port="0" svc_name="general" protocol="tcp" severity="0"
+      pluginID="25203" pluginName="Enumerate IPv4 Interfaces"
+      pluginFamily="General">
+    <plugin_output>
+The following IPv4 addresses are set on the remote host :
+
+ - 10.0.0.1 (on interface eth0)
+</plugin_output>
+    </ReportItem>
+    </ReportHost>
+    <!-- <ReportHost name="10.0.0.9"></ReportHost> -->
+    <ReportHost name="10.0.0.2"><HostProperties>
+    <tag name="HOST_START">Mon Jan 01 09:00:00 2018</tag>
+    <tag name="host-ip">10.0.0.2</tag>
+    <tag name="mac-address">00:11:22:33:44:66
+00:11:22:33:44:77</tag>
+    <tag name="HOST_END">Wed Jan 03 09:00:00 2018</tag>
+    </HostProperties>
+    <ReportItem port="80" svc_name="www" protocol="tcp" severity="1"
+      pluginID="10107" pluginName="HTTP Server Type and Version"
+      pluginFamily="Web Servers">
+    <plugin_output><![CDATA[Server: test]]></plugin_output>
+    </ReportItem>
+    </ReportHost>
+    </Report>
+    </NessusClientData_v2>
+    )STR"};
+
+  // Whole document
+  pugi::xml_document doc;
+  BOOST_REQUIRE(doc.load_string(nessus.c_str()));
+  const auto& reportNode {
+      doc.select_node("/NessusClientData_v2/Report").node()
+    };
+  BOOST_REQUIRE(reportNode);
+
+  ParserNessusXml domParser;
+  Data whole;
+  for (const auto& reportHostNode : reportNode.children("ReportHost")) {
+    domParser.parseReportHost(reportHostNode, whole);
+  }
+  BOOST_TEST(2 == whole.ipAddrs.size());
+  BOOST_TEST(3 == whole.macAddrs.size());
+  BOOST_TEST(1 == whole.oses.size());
+  BOOST_TEST(1 == whole.tracerouteHops.size());
+  BOOST_TEST(3 == whole.ports.size());
+  BOOST_TEST(3 == whole.nessusResults.size());
+  BOOST_TEST(2 == whole.cves.size());
+  BOOST_TEST(1 == whole.metasploitModules.size());
+  BOOST_TEST(1 == toStrings(whole.interfaces).size());
+  BOOST_TEST(nmco::Time("2018-01-01 09:00:00")
+             == domParser.getExecutionStart());
+  BOOST_TEST(nmco::Time("2018-01-03 09:00:00")
+             == domParser.getExecutionStop());
+
+  // Streamed, one document per ReportHost as with --stream
+  std::istringstream iss {nessus};
+  nmdu::XmlElementReader reader {iss, {"ReportHost"}};
+  BOOST_TEST(reader.readRootElement().starts_with("<NessusClientData_v2"));
+
+  ParserNessusXml streamParser;
+  std::vector<Data> hosts;
+  std::string name, xml;
+  while (reader.next(name, xml)) {
+    BOOST_TEST("ReportHost" == name);
+    pugi::xml_document hostDoc;
+    BOOST_REQUIRE(hostDoc.load_buffer(xml.data(), xml.size()));
+
+    Data data;
+    streamParser.parseReportHost(hostDoc.document_element(), data);
+    hosts.push_back(std::move(data));
+  }
+  BOOST_TEST(2 == hosts.size());
+  BOOST_TEST(domParser.getExecutionStart()
+             == streamParser.getExecutionStart());
+  BOOST_TEST(domParser.getExecutionStop()
+             == streamParser.getExecutionStop());
+
+  // Per host results, in order, match those from the whole document
+  Data streamed;
+  for (const auto& data : hosts) {
+    auto append = [](auto& _to, const auto& _from) {
+        for (const auto& object : _from) {
+          _to.push_back(object);
+        }
+      };
+    append(streamed.macAddrs, data.macAddrs);
+    append(streamed.ipAddrs, data.ipAddrs);
+    append(streamed.oses, data.oses);
+    append(streamed.ports, data.ports);
+    append(streamed.tracerouteHops, data.tracerouteHops);
+    append(streamed.nessusResults, data.nessusResults);
+    append(streamed.cves, data.cves);
+    append(streamed.metasploitModules, data.metasploitModules);
+    streamed.interfaces.insert(data.interfaces.cbegin(),
+                               data.interfaces.cend());
+  }
+  BOOST_TEST(toDebugStrings(whole.macAddrs)
+             == toDebugStrings(streamed.macAddrs));
+  BOOST_TEST(toDebugStrings(whole.ipAddrs)
+             == toDebugStrings(streamed.ipAddrs));
+  BOOST_TEST(toDebugStrings(whole.oses)
+             == toDebugStrings(streamed.oses));
+  BOOST_TEST(toDebugStrings(whole.ports)
+             == toDebugStrings(streamed.ports));
+  BOOST_TEST(toDebugStrings(whole.tracerouteHops)
+             == toDebugStrings(streamed.tracerouteHops));
+  BOOST_TEST(toStrings(whole.nessusResults)
+             == toStrings(streamed.nessusResults));
+  BOOST_TEST(toDebugStrings(whole.cves)
+             == toDebugStrings(streamed.cves));
+  BOOST_TEST(toStrings(whole.metasploitModules)
+             == toStrings(streamed.metasploitModules));
+  BOOST_TEST(toStrings(whole.interfaces)
+             == toStrings(streamed.interfaces));
+}
@@ -24,48 +24,38 @@
 // Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
 // =============================================================================
 
+#include <fstream>
+#include <future>
+#include <optional>
+
 #include <pugixml.hpp>
 
-#include <netmeld/datastore/objects/Cve.hpp>
+#include <netmeld/core/utils/ThreadSafeQueue.hpp>
+
 #include <netmeld/datastore/objects/DeviceInformation.hpp>
-#include <netmeld/datastore/objects/Interface.hpp>
-#include <netmeld/datastore/objects/IpAddress.hpp>
-#include <netmeld/datastore/objects/MacAddress.hpp>
-#include <netmeld/datastore/objects/OperatingSystem.hpp>
-#include <netmeld/datastore/objects/Port.hpp>
-#include <netmeld/datastore/objects/TracerouteHop.hpp>
 #include <netmeld/datastore/parsers/ParserHelper.hpp>
-#include <netmeld/datastore/parsers/ParserIpAddress.hpp>
 #include <netmeld/datastore/tools/AbstractImportTool.hpp>
+#include <netmeld/datastore/utils/XPathQueries.hpp>
+#include <netmeld/datastore/utils/XmlElementReader.hpp>
 
-#include "InterfaceHelper.hpp"
-#include "MetasploitModule.hpp"
-#include "NessusResult.hpp"
-#include "ParserNessusInterface.hpp"
+#include "ParserNessusXml.hpp"
 
+namespace nmcu = netmeld::core::utils;
 namespace nmdo = netmeld::datastore::objects;
 namespace nmdp = netmeld::datastore::parsers;
 namespace nmdt = netmeld::datastore::tools;
 namespace nmdu = netmeld::datastore::utils;
 
-struct Data
-{
-  std::vector<nmdo::MacAddress>        macAddrs;
-  std::vector<nmdo::IpAddress>         ipAddrs;
-  std::vector<nmdo::OperatingSystem>   oses;
-  std::vector<nmdo::Port>              ports;
-  std::vector<nmdo::TracerouteHop>     tracerouteHops;
-  std::vector<NessusResult>            nessusResults;
-  std::vector<nmdo::Cve>               cves;
-  std::vector<MetasploitModule>        metasploitModules;
-  std::map<nmdo::IpAddress, InterfaceHelper>     interfaces;
-};
-typedef std::vector<Data>             Results;
-
 
 template<typename P, typename R>
 class Tool : public nmdt::AbstractImportTool<P,R>
 {
+  private:
+    // Used with --stream, hosts are saved while the rest are parsed
+    std::ifstream                          streamFile;
+    std::optional<nmdu::XmlElementReader>  reader;
+    nmcu::ThreadSafeQueue<Data>            hosts;
+
   public:
     Tool() : nmdt::AbstractImportTool<P,R>
       ("Nessus's XML output (.nessus file)", PROGRAM_NAME, PROGRAM_VERSION)
@@ -82,11 +72,29 @@ class Tool : public nmdt::AbstractImportTool<P,R>
           );
 
       this->opts.removeOptionalOption("device-type");
+
+      this->opts.addOptionalOption("stream", std::make_tuple(
+            "stream",
+            NULL_SEMANTIC,
+            "Parse and save one ReportHost at a time; for files too large to"
+            " load whole.")
+          );
+      this->opts.addAdvancedOption("queue-size", std::make_tuple(
+            "queue-size",
+            po::value<size_t>()->default_value(1000),
+            "Maximum parsed hosts awaiting save before parsing blocks, with"
+            " --stream; 0 is unbounded.")
+          );
     }
 
     void
     parseData() override
     {
+      if (this->opts.exists("stream")) {
+        openStream();
+        return;
+      }
+
       pugi::xml_document doc;
       if (!doc.load_file(this->getDataPath().string().c_str())) {
         LOG_ERROR << "Could not open XML: "
@@ -96,372 +104,203 @@ class Tool : public nmdt::AbstractImportTool<P,R>
       }
 
       pugi::xml_node reportNode =
-        doc.select_node("/NessusClientData_v2/Report").node();
+        doc.select_node(nmdu::xpathQuery("/NessusClientData_v2/Report"))
+           .node();
       if (!reportNode) {
         LOG_ERROR << "Could not find XML element: /NessusClientData_v2/Report"
                   << std::endl;
         std::exit(nmcu::Exit::FAILURE);
       }
 
-      extractExecutionTiming(reportNode);
-
+      ParserNessusXml nxp;
       Data data;
 
-      for (const auto& reportHost : reportNode.select_nodes("ReportHost")) {
-        pugi::xml_node reportHostNode = reportHost.node();
-        parseReportHost(reportHostNode, data);
+      for (const auto& reportHostNode : reportNode.children("ReportHost")) {
+        nxp.parseReportHost(reportHostNode, data);
       }
 
+      this->executionStart = nxp.getExecutionStart();
+      this->executionStop  = nxp.getExecutionStop();
+
+      LOG_DEBUG << "[nmdo] Start: " << this->executionStart << std::endl;
+      LOG_DEBUG << "[nmdo] Stop : " << this->executionStop << std::endl;
+
       this->tResults.push_back(data);
     }
 
     void
     specificInserts(pqxx::transaction_base& t) override
     {
-      const auto& toolRunId {this->getToolRunId()};
+      if (reader) {
+        saveStream(t);
+        return;
+      }
 
       for (auto& results : this->tResults) {
-        for (auto& result : results.macAddrs) {
-          result.save(t, toolRunId, "");
-          LOG_DEBUG << result.toDebugString() << std::endl;
-        }
-
-        for (auto& result : results.ipAddrs) {
-          result.save(t, toolRunId, "");
-          LOG_DEBUG << result.toDebugString() << std::endl;
-        }
-
-        for (auto& result : results.oses) {
-          result.save(t, toolRunId, "");
-          LOG_DEBUG << result.toDebugString() << std::endl;
-        }
-
-        for (auto& result : results.ports) {
-          result.save(t, toolRunId, "");
-          LOG_DEBUG << result.toDebugString() << std::endl;
-        }
-
-        for (auto& result : results.tracerouteHops) {
-          result.save(t, toolRunId, "");
-          LOG_DEBUG << result.toDebugString() << std::endl;
-        }
-
-        for (auto& result : results.nessusResults) {
-          result.save(t, toolRunId, "");
-          LOG_DEBUG << result.toDebugString() << std::endl;
-        }
-
-        for (auto& result : results.cves) {
-          result.save(t, toolRunId, "");
-          LOG_DEBUG << result.toDebugString() << std::endl;
-        }
-
-        for (auto& result : results.metasploitModules) {
-          result.save(t, toolRunId, "");
-          LOG_DEBUG << result.toDebugString() << std::endl;
-        }
-
-        for (auto& helper : results.interfaces) {
-          for (auto& wrapMap : std::get<1>(helper).interfaces) {
-            nmdo::DeviceInformation devInfo;
-            devInfo.setDeviceId(std::get<1>(wrapMap).deviceId);
-            if (this->opts.exists("device-color")) {
-              devInfo.setDeviceColor(this->opts.getValue("device-color"));
-            }
-            auto& result = std::get<1>(wrapMap).interface;
-
-            // save the raw_device here so an Interface can be saved.
-            if (devInfo.isValid()) {
-              devInfo.save(t, toolRunId);
-              const auto& deviceId {devInfo.getDeviceId()};
-              // check validity to prevent verbose warnings
-              if (result.getMacAddress().isValid()) {
-                result.save(t, toolRunId, deviceId);
-              }
-              LOG_DEBUG << result.toDebugString() << std::endl;
-            } else {
-              // Save just MacAddress and associated IpAddress in the case that
-              // there is no deviceId and cannot save a full Interface
-              auto mac = result.getMacAddress();
-              mac.save(t, toolRunId, "");
-              LOG_DEBUG << mac.toDebugString() << std::endl;
-            }
-          }
-        }
+        saveData(t, results);
       }
     }
 
   private:
-    // =========================================================================
-    // Supporting Functions
-    // =========================================================================
     void
-    extractExecutionTiming(pugi::xml_node const& reportNode)
+    saveData(pqxx::transaction_base& t, Data& results)
     {
-      std::string const formatString = "%a %b %d %H:%M:%S %Y";
-
-      // Find earliest start time
-
-      auto hostStarts = reportNode
-        .select_nodes("ReportHost/HostProperties/tag[@name='HOST_START']");
-
-      nmco::Time executeTimeLower("infinity");
-      for (const auto& timeLower : hostStarts) {
-        pugi::xml_node timeLowerNode = timeLower.node();
-
-        LOG_DEBUG << "[str] Start: " << timeLowerNode.text().as_string() << std::endl;
-
-        nmco::Time tempLower;
-        tempLower.readFormatted(timeLowerNode.text().as_string(), formatString);
+      const auto& toolRunId {this->getToolRunId()};
 
-        LOG_DEBUG << "[tmp] Start: " << tempLower << std::endl;
+      for (auto& result : results.macAddrs) {
+        result.save(t, toolRunId, "");
+        LOG_DEBUG << result.toDebugString() << std::endl;
+      }
 
-        if ((executeTimeLower.isNull()) || (tempLower < executeTimeLower)) {
-          executeTimeLower = tempLower;
-        }
+      for (auto& result : results.ipAddrs) {
+        result.save(t, toolRunId, "");
+        LOG_DEBUG << result.toDebugString() << std::endl;
       }
-      this->executionStart = executeTimeLower;
 
-      // Find latest end time
+      for (auto& result : results.oses) {
+        result.save(t, toolRunId, "");
+        LOG_DEBUG << result.toDebugString() << std::endl;
+      }
 
-      auto hostEnds = reportNode
-        .select_nodes("ReportHost/HostProperties/tag[@name='HOST_END']");
+      for (auto& result : results.ports) {
+        result.save(t, toolRunId, "");
+        LOG_DEBUG << result.toDebugString() << std::endl;
+      }
 
-      nmco::Time executeTimeUpper("-infinity");
-      for (const auto& timeUpper : hostEnds) {
-        pugi::xml_node timeUpperNode = timeUpper.node();
+      for (auto& result : results.tracerouteHops) {
+        result.save(t, toolRunId, "");
+        LOG_DEBUG << result.toDebugString() << std::endl;
+      }
 
-        LOG_DEBUG << "[str] Stop : " << timeUpperNode.text().as_string() << std::endl;
+      for (auto& result : results.nessusResults) {
+        result.save(t, toolRunId, "");
+        LOG_DEBUG << result.toDebugString() << std::endl;
+      }
 
-        nmco::Time tempUpper;
-        tempUpper.readFormatted(timeUpperNode.text().as_string(), formatString);
+      for (auto& result : results.cves) {
+        result.save(t, toolRunId, "");
+        LOG_DEBUG << result.toDebugString() << std::endl;
+      }
 
-        LOG_DEBUG << "[tmp] Stop : " << tempUpper << std::endl;
+      for (auto& result : results.metasploitModules) {
+        result.save(t, toolRunId, "");
+        LOG_DEBUG << result.toDebugString() << std::endl;
+      }
 
-        if ((executeTimeUpper.isNull()) || (executeTimeUpper < tempUpper)) {
-          executeTimeUpper = tempUpper;
+      for (auto& helper : results.interfaces) {
+        for (auto& wrapMap : std::get<1>(helper).interfaces) {
+          nmdo::DeviceInformation devInfo;
+          devInfo.setDeviceId(std::get<1>(wrapMap).deviceId);
+          if (this->opts.exists("device-color")) {
+            devInfo.setDeviceColor(this->opts.getValue("device-color"));
+          }
+          auto& result = std::get<1>(wrapMap).interface;
+
+          // save the raw_device here so an Interface can be saved.
+          if (devInfo.isValid()) {
+            devInfo.save(t, toolRunId);
+            const auto& deviceId {devInfo.getDeviceId()};
+            // check validity to prevent verbose warnings
+            if (result.getMacAddress().isValid()) {
+              result.save(t, toolRunId, deviceId);
+            }
+            LOG_DEBUG << result.toDebugString() << std::endl;
+          } else {
+            // Save just MacAddress and associated IpAddress in the case that
+            // there is no deviceId and cannot save a full Interface
+            auto mac = result.getMacAddress();
+            mac.save(t, toolRunId, "");
+            LOG_DEBUG << mac.toDebugString() << std::endl;
+          }
         }
       }
-      this->executionStop = executeTimeUpper;
-
-      LOG_DEBUG << "[nmdo] Start: " << this->executionStart << std::endl;
-      LOG_DEBUG << "[nmdo] Stop : " << this->executionStop << std::endl;
     }
 
-
     // =========================================================================
-    // XML Parsing Functions
+    // Streaming Functions
     // =========================================================================
     void
-    parseReportItem(pugi::xml_node const& reportItemNode, nmdo::IpAddress ipAddr,
-                    std::string hostname, Data& data)
+    openStream()
     {
-      // Extact Port and Nessus results
-      std::string   protocol =
-        reportItemNode.attribute("protocol").as_string();
-      int           portNum =
-        reportItemNode.attribute("port").as_int();
-      std::string   portState =
-        (portNum ? "open" : "none");
-      std::string   portReason =
-        "nessus scan";
-      //std::string   serviceName =
-      //  reportItemNode.attribute("svc_name").as_string();
-      unsigned int  severity =
-        reportItemNode.attribute("severity").as_uint();
-      unsigned int  pluginId =
-        reportItemNode.attribute("pluginID").as_uint();
-      std::string   pluginName =
-        reportItemNode.attribute("pluginName").as_string();
-      std::string   pluginFamily =
-        reportItemNode.attribute("pluginFamily").as_string();
-      std::string   pluginType =
-        reportItemNode.select_node("plugin_type").node().text().as_string();
-      std::string   pluginOutput =
-        reportItemNode.select_node("plugin_output").node().text().as_string();
-      std::string   description =
-        reportItemNode.select_node("description").node().text().as_string();
-      std::string   solution =
-        reportItemNode.select_node("solution").node().text().as_string();
-
-      nmdo::Port port(ipAddr);
-      port.setProtocol(protocol);
-      port.setPort(portNum);
-      port.setState(portState);
-      port.setReason(portReason);
-
-      data.ports.push_back(port);
-
-      NessusResult nr;
-      nr.port = port;
-      nr.pluginId = pluginId;
-      nr.pluginName = pluginName;
-      nr.pluginFamily = pluginFamily;
-      nr.pluginType = pluginType;
-      nr.pluginOutput = pluginOutput;
-      nr.severity = severity;
-      nr.description = description;
-      nr.solution = solution;
-
-      data.nessusResults.push_back(nr);
-
-      // Extract CVE identifiers
-      for (const auto& cveItem : reportItemNode.select_nodes("cve")) {
-        pugi::xml_node cveNode = cveItem.node();
-
-        nmdo::Cve cve(cveNode.text().as_string());
-        cve.setPort(port);
-        cve.setPluginId(pluginId);
-        data.cves.push_back(cve);
+      const auto& dataPath {this->getDataPath().string()};
+      streamFile.open(dataPath, std::ios::binary);
+      if (!streamFile) {
+        LOG_ERROR << "Could not open XML: " << dataPath << std::endl;
+        std::exit(nmcu::Exit::FAILURE);
       }
 
-      // Extract Metasploit modules
-      for (const auto& msfn : reportItemNode.select_nodes("metasploit_name")) {
-        pugi::xml_node msfNameNode = msfn.node();
-
-        std::string name = msfNameNode.text().as_string();
-
-        MetasploitModule mm;
-        mm.port = port;
-        mm.pluginId = pluginId;
-        mm.name = name;
-
-        data.metasploitModules.push_back(mm);
+      reader.emplace(streamFile, std::set<std::string> {"ReportHost"});
+      if (!reader->readRootElement().starts_with("<NessusClientData_v2")) {
+        LOG_ERROR << "Could not find XML element: /NessusClientData_v2"
+                  << std::endl;
+        std::exit(nmcu::Exit::FAILURE);
       }
 
-      // Extract Interface mappings from 3 different plugins
-      enum pluginIds { IPv6 = 25202, IPv4 = 25203, Mac = 33276 };
-      if (pluginId == IPv6 || pluginId == IPv4 || pluginId == Mac) {
-        auto parsedInterfaces = nmdp::fromString<nmdp::ParserNessusInterface,
-                                                std::vector<nmdo::Interface>>
-                                               (pluginOutput);
-
-        auto it = data.interfaces.find(ipAddr);
-        if (it == data.interfaces.end()) {
-          // Create new
-          data.interfaces.emplace(ipAddr, InterfaceHelper{});
-          it = data.interfaces.find(ipAddr);
-        }
-
-        // Update existing
-        for (auto& iface : parsedInterfaces) {
-          it->second.add(iface, hostname);
-        }
-      }
+      // Host times are only known once parsed, see saveStream
+      this->executionStart = nmco::Time();
+      this->executionStop  = this->executionStart;
 
+      hosts.setCapacity(this->opts.template getValueAs<size_t>("queue-size"));
     }
 
     void
-    parseReportHost(pugi::xml_node const& reportHostNode, Data& data)
+    saveStream(pqxx::transaction_base& t)
     {
-      bool const isResponding = true;
-
-      // Extract Ip Address
-      nmdo::IpAddress ipAddr;
-      auto tags = reportHostNode.select_nodes
-        ("HostProperties/tag[@name='host-ip' or @name='container-host']");
-
-      for (const auto& tag : tags) {
-        pugi::xml_node tagNode = tag.node();
-
-        std::string ipAddrStr = tagNode.text().as_string();
-        if (ipAddrStr.empty()) {
-          continue;
-        }
-        ipAddr.setAddress(ipAddrStr);
-        ipAddr.setResponding(isResponding);
-
-        // Extract host FQND
-        auto fqdnTags = reportHostNode.select_nodes
-          ("HostProperties/tag[@name='host-fqdn']");
-        for (const auto& fqdnTag : fqdnTags) {
-          ipAddr.addAlias(fqdnTag.node().text().as_string(), "nessus scan");
-        }
-
-        // Extract hostname
-        auto hostTags = reportHostNode.select_nodes
-          ("HostProperties/tag[@name='hostname']");
-        for (const auto& hostTag : hostTags) {
-          ipAddr.addAlias(hostTag.node().text().as_string(), "nessus scan");
-        }
-
-        data.ipAddrs.push_back(ipAddr);
-      }
-
-      // Extract Mac Address
-      tags = reportHostNode.select_nodes
-        ("HostProperties/tag[@name='mac-address']");
-
-      for (const auto& tag : tags) {
-        pugi::xml_node tagNode = tag.node();
-
-        std::string macAddrs {tagNode.text().as_string()};
-        if (!macAddrs.empty()) {
-          // Nessus puts multiple MACs under one tag, so split and iterate
-          boost::char_separator<char> sep("\n");
-          boost::tokenizer<boost::char_separator<char>> tokens(macAddrs, sep);
-
-          size_t macCount {0};
-          for (auto it = tokens.begin(); it != tokens.end(); ++it, ++macCount) {
-            nmdo::MacAddress macAddr(*it);
-            macAddr.setResponding(isResponding);
-            data.macAddrs.push_back(macAddr);
-          }
-
-          if (1 == macCount) { // If only one found, associate MAC-to-IP
-            data.macAddrs.back().addIpAddress(ipAddr);
+      ParserNessusXml nxp;
+
+      auto parser = std::async(
+          std::launch::async,
+          [this, &nxp]()
+          {
+            try {
+              std::string name, xml;
+              while (reader->next(name, xml)) {
+                pugi::xml_document hostDoc;
+                if (!hostDoc.load_buffer(xml.data(), xml.size())) {
+                  throw std::runtime_error(
+                      "Could not parse XML element: ReportHost");
+                }
+
+                Data data;
+                nxp.parseReportHost(hostDoc.document_element(), data);
+                if (!hosts.push(std::move(data))) {
+                  throw std::runtime_error("Parsing stopped, save failed");
+                }
+              }
+            } catch (...) {
+              hosts.close();
+              throw;
+            }
+            hosts.close();
           }
-        }
-      }
-
-      // Extract Operating System
-      tags = reportHostNode.select_nodes
-        ("HostProperties/tag[starts-with(@name, 'cpe')]");
-
-      for (const auto& tag : tags) {
-        pugi::xml_node tagNode = tag.node();
-        std::string cpe {tagNode.text().as_string()};
-
-        std::string prefix {"cpe:/o:"};
-        if (0 == cpe.compare(0, prefix.size(), prefix)) {
-          nmdo::OperatingSystem os(ipAddr);
-          os.setCpe(cpe);
-          os.setAccuracy(1.0);
+          );
 
-          data.oses.push_back(os);
+      try {
+        Data data;
+        while (hosts.waitPop(data)) {
+          saveData(t, data);
         }
+      } catch (...) {
+        hosts.close(); // release a parser blocked on a full queue
+        throw;
       }
+      parser.get(); // rethrows any parse failure, so nothing is committed
 
-      // Extract traceroute hops
-      auto tracerouteHopTags = reportHostNode.select_nodes
-        ("HostProperties/tag[starts-with(@name, 'traceroute-hop-')]");
-      for (const auto& tracerouteHopTag : tracerouteHopTags) {
-        const pugi::xml_node tagNode{tracerouteHopTag.node()};
-        const std::string hopIpAddrStr{tagNode.text().as_string()};
-
-        if (nmdp::matchString<nmdp::ParserIpAddress, nmdo::IpAddress>(hopIpAddrStr)) {
-          nmdo::TracerouteHop tracerouteHop;
-          tracerouteHop.setDstIp(ipAddr);
-          tracerouteHop.setHopIp(nmdo::IpAddress{hopIpAddrStr});
-          tracerouteHop.setHopCount(static_cast<uint32_t>(std::stoul(
-              std::string{tagNode.attribute("name").as_string()}.substr(15)
-            )));
-
-          data.tracerouteHops.emplace_back(tracerouteHop);
-        }
+      // Otherwise no host times, keep those set when opened
+      if (!(nxp.getExecutionStop() < nxp.getExecutionStart())) {
+        this->executionStart = nxp.getExecutionStart();
+        this->executionStop  = nxp.getExecutionStop();
       }
 
-      // Get first hostname to pass down for creating Interfaces
-      auto hostTag = reportHostNode.select_node
-        ("HostProperties/tag[@name='hostname']");
-      std::string hostname = hostTag.node().text().as_string();
+      LOG_DEBUG << "[nmdo] Start: " << this->executionStart << std::endl;
+      LOG_DEBUG << "[nmdo] Stop : " << this->executionStop << std::endl;
 
-      // Extract ReportItem elements
-      for (const auto& reportItem : reportHostNode.select_nodes("ReportItem")) {
-        pugi::xml_node reportItemNode = reportItem.node();
-        parseReportItem(reportItemNode, ipAddr, hostname, data);
-      }
+      nmdu::execPrepared(t, "update_tool_run",
+          this->getToolRunId(),
+          this->executionStart,
+          this->executionStop);
     }
+
 };
 
 int
@@ -0,0 +1,210 @@
+// =============================================================================
+// Copyright 2023 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+// =============================================================================
+
+#include "Importer.hpp"
+
+
+namespace netmeld::datastore::importers::nmap {
+
+  Result
+  parseFile(const std::string& dataPath,
+            nmco::Time& executionStart, nmco::Time& executionStop)
+  {
+    pugi::xml_document doc;
+    if (!doc.load_file(dataPath.c_str())) {
+      throw nmdp::ParseFailure("Could not open XML: " + dataPath);
+    }
+
+    pugi::xml_node const nmapNode = doc.select_node("/nmaprun").node();
+    if (!nmapNode) {
+      throw nmdp::ParseFailure("Could not find XML element: /nmaprun");
+    }
+
+    ParserNmapXml nxp;
+
+    auto t {nxp.extractExecutionTiming(nmapNode)};
+
+    executionStart.readUnixTimestamp(std::get<0>(t));
+    executionStop.readUnixTimestamp(std::get<1>(t));
+
+    LOG_DEBUG << "[nmco] Start: " << executionStart << std::endl;
+    LOG_DEBUG << "[nmco] Stop : " << executionStop << std::endl;
+
+    Data data;
+
+    nxp.extractHosts(nmapNode, data);
+
+    return Result {data};
+  }
+
+  void
+  save(pqxx::transaction_base& t, Result& results,
+       const nmco::Uuid& toolRunId, const nmdo::IpAddress& scanOriginIp)
+  {
+    for (auto& data : results) {
+      save(t, data, toolRunId, scanOriginIp);
+    }
+  }
+
+  void
+  save(pqxx::transaction_base& t, Data& data,
+       const nmco::Uuid& toolRunId, const nmdo::IpAddress& scanOriginIp)
+  {
+    LOG_DEBUG << "Iterating over macAddrs\n";
+    for (auto& result : data.macAddrs) {
+      result.save(t, toolRunId, "");
+      LOG_DEBUG << result.toDebugString() << std::endl;
+    }
+
+    LOG_DEBUG << "Iterating over ipAddrs\n";
+    for (auto& result : data.ipAddrs) {
+      result.save(t, toolRunId, "");
+      LOG_DEBUG << result.toDebugString() << std::endl;
+    }
+
+    LOG_DEBUG << "Iterating over oses\n";
+    for (auto& result : data.oses) {
+      result.save(t, toolRunId, "");
+      LOG_DEBUG << result.toDebugString() << std::endl;
+    }
+
+    LOG_DEBUG << "Iterating over tracerouteHops\n";
+    for (auto& result : data.tracerouteHops) {
+      result.save(t, toolRunId, "");
+      LOG_DEBUG << result.toDebugString() << std::endl;
+    }
+
+    LOG_DEBUG << "Iterating over ports\n";
+    for (auto& result : data.ports) {
+      result.save(t, toolRunId, "");
+      LOG_DEBUG << result.toDebugString() << std::endl;
+    }
+
+    LOG_DEBUG << "Iterating over services\n";
+    for (auto& result : data.services) {
+      if (scanOriginIp.isValid()) {
+        result.setSrcAddress(scanOriginIp);
+      }
+      LOG_DEBUG << result.toDebugString() << std::endl;
+      result.save(t, toolRunId, "");
+    }
+
+    LOG_DEBUG << "Iterating over nseResults\n";
+    for (auto& result : data.nseResults) {
+      result.save(t, toolRunId, "");
+      LOG_DEBUG << result.toString() << std::endl;
+    }
+
+    LOG_DEBUG << "Iterating over sshKeys\n";
+    for (auto& result : data.sshKeys) {
+      result.save(t, toolRunId, "");
+      LOG_DEBUG << result.toString() << std::endl;
+    }
+
+    LOG_DEBUG << "Iterating over sshAlgorithms\n";
+    for (auto& result : data.sshAlgorithms) {
+      result.save(t, toolRunId, "");
+      LOG_DEBUG << result.toString() << std::endl;
+    }
+
+    LOG_DEBUG << "Iterating over Observations\n";
+    data.observations.save(t, toolRunId, "");
+    LOG_DEBUG << data.observations.toDebugString() << '\n';
+  }
+
+
+  // ===========================================================================
+  // HostStream
+  // ===========================================================================
+  HostStream::HostStream(const std::string& dataPath) :
+    file(dataPath, std::ios::binary),
+    reader(file, {"host", "scaninfo", "runstats"})
+  {
+    if (!file) {
+      throw nmdp::ParseFailure("Could not open XML: " + dataPath);
+    }
+
+    const auto& root {reader.readRootElement()};
+    if (  !skeleton.load_buffer(root.data(), root.size())
+       || std::string_view("nmaprun") != skeleton.document_element().name())
+    {
+      throw nmdp::ParseFailure("Could not find XML element: /nmaprun");
+    }
+
+    executionStart.readUnixTimestamp(
+        skeleton.document_element().attribute("start").as_string());
+    LOG_DEBUG << "[nmco] Start: " << executionStart << std::endl;
+  }
+
+  const nmco::Time&
+  HostStream::getExecutionStart() const
+  {
+    return executionStart;
+  }
+
+  const nmco::Time&
+  HostStream::getExecutionStop() const
+  {
+    return executionStop;
+  }
+
+  void
+  HostStream::parse(const std::function<void(Data&&)>& handler)
+  {
+    pugi::xml_node nmapNode {skeleton.document_element()};
+
+    bool scanInfoChanged {true};
+    std::string name, xml;
+    while (reader.next(name, xml)) {
+      if ("host" != name) {
+        if (!nmapNode.append_buffer(xml.data(), xml.size())) {
+          throw nmdp::ParseFailure("Could not parse XML element: " + name);
+        }
+        scanInfoChanged = scanInfoChanged || ("scaninfo" == name);
+        continue;
+      }
+
+      // Nmap writes scaninfo before any host
+      if (scanInfoChanged) {
+        nxp.extractScanInfo(nmapNode);
+        scanInfoChanged = false;
+      }
+
+      pugi::xml_document hostDoc;
+      if (!hostDoc.load_buffer(xml.data(), xml.size())) {
+        throw nmdp::ParseFailure("Could not parse XML element: host");
+      }
+
+      Data data;
+      nxp.extractHost(hostDoc.document_element(), data);
+      handler(std::move(data));
+    }
+
+    auto t {nxp.extractExecutionTiming(nmapNode)};
+    executionStop.readUnixTimestamp(std::get<1>(t));
+    LOG_DEBUG << "[nmco] Stop : " << executionStop << std::endl;
+  }
+}
@@ -0,0 +1,90 @@
+// =============================================================================
+// Copyright 2023 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+// =============================================================================
+
+#ifndef NMAP_IMPORTER_HPP
+#define NMAP_IMPORTER_HPP
+
+#include <fstream>
+#include <functional>
+
+#include <netmeld/core/objects/Time.hpp>
+#include <netmeld/core/objects/Uuid.hpp>
+#include <netmeld/datastore/utils/XmlElementReader.hpp>
+
+#include "ParserNmapXml.hpp"
+
+namespace nmco = netmeld::core::objects;
+
+
+namespace netmeld::datastore::importers::nmap {
+
+  // ===========================================================================
+  // Library entry point, for importing in-process (e.g., nmdb-import-clw)
+  // ===========================================================================
+  // Sets the start and stop times to the scan's; throws nmdp::ParseFailure
+  // if the file is not Nmap XML
+  Result parseFile(const std::string&, nmco::Time&, nmco::Time&);
+
+  // Service results are attributed to the scan origin, if valid
+  void save(pqxx::transaction_base&, Result&,
+            const nmco::Uuid&, const nmdo::IpAddress&);
+  void save(pqxx::transaction_base&, Data&,
+            const nmco::Uuid&, const nmdo::IpAddress&);
+
+
+  // ===========================================================================
+  // Streaming entry point, for files too large to load whole
+  // ===========================================================================
+  /* Parses one host element at a time, so memory use is bounded by the
+     largest host instead of the whole file.  The scan start time is known
+     once opened, the stop time only after all hosts have been parsed.
+  */
+  class HostStream
+  {
+    private:
+      std::ifstream           file;
+      nmdu::XmlElementReader  reader;
+
+      ParserNmapXml           nxp;
+      // Document element plus its non-host children (scaninfo, runstats)
+      pugi::xml_document      skeleton;
+
+      nmco::Time              executionStart;
+      nmco::Time              executionStop;
+
+    public:
+      // Throws nmdp::ParseFailure if the file is not Nmap XML
+      explicit HostStream(const std::string&);
+
+      const nmco::Time& getExecutionStart() const;
+      const nmco::Time& getExecutionStop() const;
+
+      // Passes each host's results, in document order, to the function.
+      // Throws std::runtime_error (or nmdp::ParseFailure) on malformed XML
+      void parse(const std::function<void(Data&&)>&);
+  };
+}
+#endif // NMAP_IMPORTER_HPP
@@ -0,0 +1,156 @@
+// =============================================================================
+// Copyright 2023 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+// =============================================================================
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+#include <boost/test/unit_test.hpp>
+
+#include <fstream>
+
+#include "Importer.hpp"
+
+namespace nmdsin = netmeld::datastore::importers::nmap;
+
+
+sfs::path
+writeTempFile(const std::string& name, const std::string& contents)
+{
+  const auto path {sfs::temp_directory_path() / name};
+  std::ofstream f {path, std::ios::binary};
+  f << contents;
+  return path;
+}
+
+template<typename T>
+std::vector<std::string>
+toDebugStrings(const std::vector<T>& objects)
+{
+  std::vector<std::string> strings;
+  for (const auto& object : objects) {
+    strings.push_back(object.toDebugString());
+  }
+  return strings;
+}
+
+BOOST_AUTO_TEST_CASE(testHostStream)
+{
+  const auto path {writeTempFile("nmdsin-test-stream",
+    R"STR(<?xml version="1.0" encoding="UTF-8"?>
+    <!DOCTYPE nmaprun>
+    <nmaprun scanner="nmap" start="1500000000" version="7.80">
+    <scaninfo type="syn" protocol="tcp" numservices="2" services="22,80"/>
+    <host><status state="up" reason="arp-response"/>
+    <address addr="10.0.0.1" addrtype="ipv4"/>
+    <address addr="00:11:22:33:44:55" addrtype="mac"/>
+    <hostnames><hostname name="one" type="PTR"/></hostnames>
+    <ports>
+    <port protocol="tcp" portid="22"><state state="open" reason="syn-ack"/>
+    <service name="ssh" method="probed"/></port>
+    </ports>
+    <os><osmatch><osclass vendor="Linux" osfamily="Linux" accuracy="95"/>
+    </osmatch></os>
+    </host>
+    <!-- <host><address addr="10.0.0.9" addrtype="ipv4"/></host> -->
+    <host><status state="up" reason="echo-reply"/>
+    <address addr="10.0.0.2" addrtype="ipv4"/>
+    <ports><extraports state="closed"><extrareasons reason="resets"/>
+    </extraports></ports>
+    <trace><hop ttl="1" ipaddr="10.0.0.254"/></trace>
+    </host>
+    <runstats><finished time="1500000100"/></runstats>
+    </nmaprun>
+    )STR")};
+
+  nmco::Time start, stop;
+  auto results {nmdsin::parseFile(path.string(), start, stop)};
+  BOOST_TEST(1 == results.size());
+  const auto& whole {results.at(0)};
+
+  nmdsin::HostStream stream {path.string()};
+  BOOST_TEST(start == stream.getExecutionStart());
+
+  std::vector<nmdsin::Data> hosts;
+  stream.parse([&hosts](nmdsin::Data&& data) {
+      hosts.push_back(std::move(data));
+    });
+  BOOST_TEST(stop == stream.getExecutionStop());
+  BOOST_TEST(2 == hosts.size());
+
+  // Per host results, in order, match those from the whole document
+  nmdsin::Data streamed;
+  for (const auto& data : hosts) {
+    auto append = [](auto& _to, const auto& _from) {
+        for (const auto& object : _from) {
+          _to.push_back(object);
+        }
+      };
+    append(streamed.macAddrs, data.macAddrs);
+    append(streamed.ipAddrs, data.ipAddrs);
+    append(streamed.oses, data.oses);
+    append(streamed.tracerouteHops, data.tracerouteHops);
+    append(streamed.ports, data.ports);
+    append(streamed.services, data.services);
+  }
+  BOOST_TEST(2 == streamed.macAddrs.size());
+  BOOST_TEST(1 == streamed.ipAddrs.size()); // only hosts with hostnames
+  BOOST_TEST(2 == streamed.ports.size());
+  BOOST_TEST(toDebugStrings(whole.macAddrs)
+             == toDebugStrings(streamed.macAddrs));
+  BOOST_TEST(toDebugStrings(whole.ipAddrs)
+             == toDebugStrings(streamed.ipAddrs));
+  BOOST_TEST(toDebugStrings(whole.oses)
+             == toDebugStrings(streamed.oses));
+  BOOST_TEST(toDebugStrings(whole.tracerouteHops)
+             == toDebugStrings(streamed.tracerouteHops));
+  BOOST_TEST(toDebugStrings(whole.ports)
+             == toDebugStrings(streamed.ports));
+  BOOST_TEST(toDebugStrings(whole.services)
+             == toDebugStrings(streamed.services));
+
+  sfs::remove(path);
+}
+
+BOOST_AUTO_TEST_CASE(testHostStreamFailures)
+{
+  BOOST_CHECK_THROW(nmdsin::HostStream("/nonexistent/nmdsin-test"),
+                    nmdp::ParseFailure);
+
+  {
+    const auto path {writeTempFile("nmdsin-test-not-nmap",
+                                   "<NessusClientData_v2/>")};
+    BOOST_CHECK_THROW(nmdsin::HostStream(path.string()), nmdp::ParseFailure);
+    sfs::remove(path);
+  }
+
+  {
+    const auto path {writeTempFile("nmdsin-test-truncated",
+        R"(<nmaprun start="1"><host><address addr="10.0.0.1")")};
+    nmdsin::HostStream stream {path.string()};
+    BOOST_CHECK_THROW(stream.parse([](nmdsin::Data&&) {}),
+                      std::runtime_error);
+    sfs::remove(path);
+  }
+}
@@ -44,7 +44,7 @@ NseResult::save(pqxx::transaction_base& t,
 
   port.save(t, toolRunId, deviceId);
 
-  t.exec_prepared("insert_raw_nse_result",
+  nmdu::execPrepared(t, "insert_raw_nse_result",
       toolRunId,
       port.getIpAddress().toString(),
       port.getProtocol(),
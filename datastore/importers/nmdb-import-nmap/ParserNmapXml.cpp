@@ -27,123 +27,276 @@
 #include "ParserNmapXml.hpp"
 #include <regex>
 
-ParserNmapXml::ParserNmapXml()
-{}
+namespace {
+  nmdo::IpAddress
+  toIpAddr(const pugi::xml_node& nodeIpAddr)
+  {
+    nmdo::IpAddress ipAddr;
+
+    std::string ipString {nodeIpAddr.attribute("addr").as_string()};
+    if (!ipString.empty()) {
+      ipAddr.setAddress(ipString);
+    }
+
+    return ipAddr;
+  }
+}
 
-std::tuple<std::string, std::string>
-ParserNmapXml::extractExecutionTiming(pugi::xml_node const& nmapNode)
-{
-  std::string start {nmapNode.attribute("start").as_string()};
-  std::string stop  {nmapNode.select_node("runstats/finished")
-                     .node().attribute("time").as_string()};
+namespace netmeld::datastore::importers::nmap {
+  ParserNmapXml::ParserNmapXml()
+  {}
 
-  LOG_DEBUG << "[str] Start: " << start << std::endl;
-  LOG_DEBUG << "[str] Stop : " << stop << std::endl;
+  std::tuple<std::string, std::string>
+  ParserNmapXml::extractExecutionTiming(pugi::xml_node const& nmapNode)
+  {
+    std::string start {nmapNode.attribute("start").as_string()};
+    std::string stop  {
+        nmapNode.select_node(nmdu::xpathQuery("runstats/finished"))
+                .node().attribute("time").as_string()
+      };
 
-  return std::make_tuple(start, stop);
-}
+    LOG_DEBUG << "[str] Start: " << start << std::endl;
+    LOG_DEBUG << "[str] Stop : " << stop << std::endl;
 
-bool
-ParserNmapXml::extractHostIsResponding(const pugi::xml_node& nodeHost) const
-{
-  bool isResponding {false};
+    return std::make_tuple(start, stop);
+  }
 
-  pugi::xml_node const nodeStatus {nodeHost.child("status")};
+  void
+  ParserNmapXml::extractScanInfo(pugi::xml_node const& nmapNode)
+  {
+    scanProtocol.reset();
 
-  if (std::string("up") == nodeStatus.attribute("state").as_string()) {
-    if (std::string("user-set") !=
-        nodeStatus.attribute("reason").as_string()) {
-      // Any "up" reason other than "user-set" indicates
-      // that the host (or something else) responded.
-      isResponding = true;
+    size_t count {0};
+    for (const auto& nodeScaninfo : nmapNode.children("scaninfo")) {
+      scanProtocol = nodeScaninfo.attribute("protocol").as_string();
+      ++count;
     }
-    else {  // "user-set" hosts:
-      if (0 < (nodeHost.select_nodes("ports/port/state"
-                           "[@state='open' or @state='closed']").size())) {
-        // The presence of "open" or "closed" ports indicates
+
+    if (1 != count) {
+      scanProtocol.reset();
+    }
+  }
+
+  bool
+  ParserNmapXml::extractHostIsResponding(const pugi::xml_node& nodeHost) const
+  {
+    bool isResponding {false};
+
+    pugi::xml_node const nodeStatus {nodeHost.child("status")};
+
+    if (std::string("up") == nodeStatus.attribute("state").as_string()) {
+      if (std::string("user-set") !=
+          nodeStatus.attribute("reason").as_string()) {
+        // Any "up" reason other than "user-set" indicates
         // that the host (or something else) responded.
         isResponding = true;
       }
+      else {  // "user-set" hosts:
+        if (nodeHost.select_node(nmdu::xpathQuery("ports/port/state"
+                             "[@state='open' or @state='closed']"))) {
+          // The presence of "open" or "closed" ports indicates
+          // that the host (or something else) responded.
+          isResponding = true;
+        }
+      }
     }
+
+    return isResponding;
   }
 
-  return isResponding;
-}
+  nmdo::MacAddress
+  ParserNmapXml::extractHostMacAddr(const pugi::xml_node& nodeHost) const
+  {
+    pugi::xml_node const nodeMacAddr {
+      nodeHost.select_node(nmdu::xpathQuery("address[@addrtype='mac']"))
+              .node()
+    };
 
-nmdo::MacAddress
-ParserNmapXml::extractHostMacAddr(const pugi::xml_node& nodeHost) const
-{
-  pugi::xml_node const nodeMacAddr {
-    nodeHost.select_node("address[@addrtype='mac']").node()
-  };
+    std::string macString {nodeMacAddr.attribute("addr").as_string()};
 
-  std::string macString {nodeMacAddr.attribute("addr").as_string()};
+    if (macString.empty()) {
+      return nmdo::MacAddress();
+    }
 
-  if (macString.empty()) {
-    return nmdo::MacAddress();
+    return nmdo::MacAddress(macString);
   }
 
-  return nmdo::MacAddress(macString);
-}
+  nmdo::IpAddress
+  ParserNmapXml::extractHostIpAddr(const pugi::xml_node& nodeHost) const
+  {
+    return toIpAddr(nodeHost.select_node(nmdu::xpathQuery(
+        "address[@addrtype='ipv4' or @addrtype='ipv6']")).node());
+  }
 
-nmdo::IpAddress
-ParserNmapXml::extractHostIpAddr(const pugi::xml_node& nodeHost) const
-{
-  pugi::xml_node const nodeIpAddr {
-    nodeHost.select_node("address[@addrtype='ipv4' or @addrtype='ipv6']").node()
-  };
+  ParserNmapXml::Host
+  ParserNmapXml::indexHost(const pugi::xml_node& nodeHost) const
+  {
+    Host host;
+    host.node = nodeHost;
+
+    pugi::xml_node nodeIpAddr;
+    for (const auto& nodeChild : nodeHost.children()) {
+      const std::string_view name {nodeChild.name()};
+      if ("address" == name) {
+        const std::string_view type {
+            nodeChild.attribute("addrtype").as_string()
+          };
+        if (!nodeIpAddr && ("ipv4" == type || "ipv6" == type)) {
+          nodeIpAddr = nodeChild;
+        }
+      }
+      else if ("hostnames" == name) {
+        host.hostnames.push_back(nodeChild);
+      }
+      else if ("ports" == name) {
+        host.ports.push_back(nodeChild);
+      }
+      else if ("os" == name) {
+        host.oses.push_back(nodeChild);
+      }
+      else if ("hostscript" == name) {
+        host.hostscripts.push_back(nodeChild);
+      }
+      else if ("trace" == name) {
+        host.traces.push_back(nodeChild);
+      }
+    }
+    host.ipAddr = toIpAddr(nodeIpAddr);
 
-  nmdo::IpAddress ipAddr;
+    return host;
+  }
 
-  std::string ipString {nodeIpAddr.attribute("addr").as_string()};
-  if (!ipString.empty()) {
-    ipAddr.setAddress(ipString);
+  template<typename Function>
+  void
+  ParserNmapXml::forEachHost(const pugi::xml_node& nmapNode, Function function)
+  {
+    for (const auto& nodeHost : nmapNode.children("host")) {
+      function(indexHost(nodeHost));
+    }
   }
 
-  return ipAddr;
-}
 
+  // =======================================================================
+  // XML Parsing Functions
+  // =======================================================================
+  void
+  ParserNmapXml::extractHosts(const pugi::xml_node& nmapNode, Data& data)
+  {
+    extractScanInfo(nmapNode);
+
+    for (const auto& nodeHost : nmapNode.children("host")) {
+      extractHost(nodeHost, data);
+    }
+  }
+
+  void
+  ParserNmapXml::extractHost(const pugi::xml_node& nodeHost, Data& data)
+  {
+    const auto& host {indexHost(nodeHost)};
+
+    extractMacAndIpAddrs(host, data);
+    extractHostnames(host, data);
+    extractOperatingSystems(host, data);
+    extractTraceRoutes(host, data);
+    extractPortsAndServices(host, data);
+    extractNseAndSsh(host, data);
+  }
 
-// =========================================================================
-// XML Parsing Functions
-// =========================================================================
-void
-ParserNmapXml::extractMacAndIpAddrs(const pugi::xml_node& nmapNode, Data& data)
-{ // This code block ensures that all of the ip_addrs and mac_addrs
-  // from the scan are present for the other table's foreign keys.
-  for (const auto& xHost : nmapNode.select_nodes("host")) {
-    pugi::xml_node nodeHost {xHost.node()};
+  void
+  ParserNmapXml::extractMacAndIpAddrs(const pugi::xml_node& nmapNode,
+                                      Data& data)
+  {
+    forEachHost(nmapNode, [&](const Host& host) {
+        extractMacAndIpAddrs(host, data);
+      });
+  }
 
-    bool const isResponding {extractHostIsResponding(nodeHost)};
+  void
+  ParserNmapXml::extractMacAndIpAddrs(const Host& host, Data& data)
+  { // This code block ensures that all of the ip_addrs and mac_addrs
+    // from the scan are present for the other table's foreign keys.
+    bool const isResponding {extractHostIsResponding(host.node)};
 
-    nmdo::MacAddress macAddr {extractHostMacAddr(nodeHost)};
+    nmdo::MacAddress macAddr {extractHostMacAddr(host.node)};
     macAddr.setResponding(isResponding);
-    auto ipAddr {extractHostIpAddr(nodeHost)};
-    macAddr.addIpAddress(ipAddr);
+    macAddr.addIpAddress(host.ipAddr);
 
     data.macAddrs.push_back(macAddr);
   }
-}
 
-void
-ParserNmapXml::extractHostnames(const pugi::xml_node& nmapNode, Data& data)
-{
-  for (const auto& xHostname :
-        nmapNode.select_nodes("host/hostnames/hostname")) {
-    pugi::xml_node nodeHostname {xHostname.node()};
-    pugi::xml_node nodeHost     {nodeHostname.parent().parent()};
+  void
+  ParserNmapXml::extractHostnames(const pugi::xml_node& nmapNode, Data& data)
+  {
+    forEachHost(nmapNode, [&](const Host& host) {
+        extractHostnames(host, data);
+      });
+  }
 
-    nmdo::IpAddress ipAddr {extractHostIpAddr(nodeHost)};
+  void
+  ParserNmapXml::extractHostnames(const Host& host, Data& data)
+  {
+    for (const auto& nodeHostnames : host.hostnames) {
+      for (const auto& nodeHostname : nodeHostnames.children("hostname")) {
+        nmdo::IpAddress ipAddr {host.ipAddr};
 
-    std::string reason {"nmap "};
-    reason.append(nodeHostname.attribute("type").as_string());
-    ipAddr.addAlias(nodeHostname.attribute("name").as_string(), reason);
+        std::string reason {"nmap "};
+        reason.append(nodeHostname.attribute("type").as_string());
+        ipAddr.addAlias(nodeHostname.attribute("name").as_string(), reason);
 
-    data.ipAddrs.push_back(ipAddr);
+        data.ipAddrs.push_back(ipAddr);
+      }
+    }
+
+    for (const auto& nodeHostscript : host.hostscripts) {
+      for (const auto& nodeScript : nodeHostscript.children("script")) {
+        addScriptHostnames(nodeScript, host.ipAddr, data);
+      }
+    }
+    for (const auto& nodePorts : host.ports) {
+      for (const auto& nodePort : nodePorts.children("port")) {
+        for (const auto& nodeScript : nodePort.children("script")) {
+          addScriptHostnames(nodeScript, host.ipAddr, data);
+        }
+      }
+    }
+
+    for (const auto& nodePorts : host.ports) {
+      for (const auto& nodePort : nodePorts.children("port")) {
+        for (const auto& nodeService : nodePort.children("service")) {
+          nmdo::IpAddress ipAddr {host.ipAddr};
+
+          std::string idValue  {nodeService.attribute("name").value()};
+          std::string reason   {"nmap " + idValue};
+          std::string hostname {nodeService.attribute("hostname").value()};
+
+          if (!hostname.empty()) {
+            std::ostringstream oss;
+            oss << hostname << '/'
+                << static_cast<uint16_t>(ipAddr.getPrefix());
+            if (oss.str() != ipAddr.toString()) {
+              ipAddr.addAlias(hostname, reason);
+              data.ipAddrs.push_back(ipAddr);
+            } else {
+              std::string note {
+                "Nmap service scan: " + idValue
+                + "\n  From IP: " + ipAddr.toString()
+                + "\n  Potential alias: " + hostname
+              };
+              data.observations.addNotable(note);
+            }
+          }
+        }
+      }
+    }
   }
 
+  void
+  ParserNmapXml::addScriptHostnames(const pugi::xml_node& nodeScript,
+                                    const nmdo::IpAddress& hostIpAddr,
+                                    Data& data) const
+  {
+    nmdo::IpAddress ipAddr {hostIpAddr};
 
-  auto scriptHostnameLambda = [&](const auto& nodeScript, auto& ipAddr){
     std::string idValue {nodeScript.attribute("id").value()};
     std::string reason  {"nmap " + idValue};
     std::string line    {nodeScript.attribute("output").value()};
@@ -169,242 +322,218 @@ ParserNmapXml::extractHostnames(const pugi::xml_node& nmapNode, Data& data)
     if (foundMatch) {
       data.ipAddrs.push_back(ipAddr);
     }
-  };
-
-  for (const auto& xScript :
-        nmapNode.select_nodes("host/hostscript/script")) {
-    pugi::xml_node nodeScript {xScript.node()};
-    pugi::xml_node nodeHost   {nodeScript.parent().parent()};
-
-    nmdo::IpAddress ipAddr {extractHostIpAddr(nodeHost)};
-
-    scriptHostnameLambda(nodeScript, ipAddr);
   }
-  for (const auto& xScript :
-        nmapNode.select_nodes("host/ports/port/script")) {
-    pugi::xml_node nodeScript {xScript.node()};
-    pugi::xml_node nodeHost   {nodeScript.parent().parent().parent()};
-
-    nmdo::IpAddress ipAddr {extractHostIpAddr(nodeHost)};
 
-    scriptHostnameLambda(nodeScript, ipAddr);
+  void
+  ParserNmapXml::extractOperatingSystems(const pugi::xml_node& nmapNode,
+                                         Data& data)
+  {
+    forEachHost(nmapNode, [&](const Host& host) {
+        extractOperatingSystems(host, data);
+      });
   }
 
-  for (const auto& xScript :
-        nmapNode.select_nodes("host/ports/port/service")) {
-    pugi::xml_node nodeService {xScript.node()};
-    pugi::xml_node nodeHost    {nodeService.parent().parent().parent()};
-
-    nmdo::IpAddress ipAddr {extractHostIpAddr(nodeHost)};
-
-    std::string idValue  {nodeService.attribute("name").value()};
-    std::string reason   {"nmap " + idValue};
-    std::string hostname {nodeService.attribute("hostname").value()};
-
-    if (!hostname.empty()) {
-      std::ostringstream oss;
-      oss << hostname << '/' << static_cast<uint16_t>(ipAddr.getPrefix());
-      if (oss.str() != ipAddr.toString()) {
-        ipAddr.addAlias(hostname, reason);
-        data.ipAddrs.push_back(ipAddr);
-      } else {
-        std::string note {
-          "Nmap service scan: " + idValue
-          + "\n  From IP: " + ipAddr.toString()
-          + "\n  Potential alias: " + hostname
-        };
-        data.observations.addNotable(note);
+  void
+  ParserNmapXml::extractOperatingSystems(const Host& host, Data& data)
+  {
+    for (const auto& nodeOses : host.oses) {
+      for (const auto& nodeOsmatch : nodeOses.children("osmatch")) {
+        for (const auto& nodeOs : nodeOsmatch.children("osclass")) {
+          nmdo::OperatingSystem os(host.ipAddr);
+          os.setVendorName(nodeOs.attribute("vendor").as_string());
+          os.setProductName(nodeOs.attribute("osfamily").as_string());
+          os.setProductVersion(nodeOs.attribute("osgen").as_string());
+          os.setAccuracy(nodeOs.attribute("accuracy").as_double() / 100.0);
+          os.setCpe(nodeOs.child("cpe").text().as_string());
+
+          data.oses.push_back(os);
+        }
       }
     }
   }
-}
 
-void
-ParserNmapXml::extractOperatingSystems(const pugi::xml_node& nmapNode, Data& data)
-{
-  for (const auto& xOsclass :
-         nmapNode.select_nodes("host/os/osmatch/osclass")) {
-    pugi::xml_node nodeOs   {xOsclass.node()};
-    pugi::xml_node nodeHost {nodeOs.parent().parent().parent()};
-
-    nmdo::IpAddress ipAddr {extractHostIpAddr(nodeHost)};
-    nmdo::OperatingSystem os(ipAddr);
-    os.setVendorName(nodeOs.attribute("vendor").as_string());
-    os.setProductName(nodeOs.attribute("osfamily").as_string());
-    os.setProductVersion(nodeOs.attribute("osgen").as_string());
-    os.setAccuracy(nodeOs.attribute("accuracy").as_double() / 100.0);
-    os.setCpe(nodeOs.select_node("cpe").node().text().as_string());
-
-    data.oses.push_back(os);
+  void
+  ParserNmapXml::extractTraceRoutes(const pugi::xml_node& nmapNode, Data& data)
+  {
+    forEachHost(nmapNode, [&](const Host& host) {
+        extractTraceRoutes(host, data);
+      });
   }
-}
 
-void
-ParserNmapXml::extractTraceRoutes(const pugi::xml_node& nmapNode, Data& data)
-{ // This code block identifies ip_addrs of routers along a route.
-  // The routers may or may not be in the target address space,
-  // so might need to be inserted into the ip_addrs table.
-  const std::string nmapTraceReason {"nmap trace"};
-  for (const auto& xHop : nmapNode.select_nodes("host/trace/hop")) {
-    pugi::xml_node nodeHop {xHop.node()};
-
-    nmdo::IpAddress nextHop {nodeHop.attribute("ipaddr").as_string()};
-    nextHop.setResponding(true);
-    nextHop.addAlias(nodeHop.attribute("host").as_string(), nmapTraceReason);
-
-    nmdo::TracerouteHop hop;
-    hop.setHopCount(nodeHop.attribute("ttl").as_uint());
-    hop.setHopIp(nextHop);
-    hop.setDstIp(extractHostIpAddr(nodeHop.parent().parent()));
-
-    data.tracerouteHops.push_back(hop);
-  }
-}
-
-void
-ParserNmapXml::extractPortsAndServices(const pugi::xml_node& nmapNode, Data& data)
-{
-  for (const auto& xExtrareasons :
-         nmapNode.select_nodes("host/ports/extraports/extrareasons")) {
-    pugi::xml_node nodeExtrareasons {xExtrareasons.node()};
-    pugi::xml_node nodeExtraports   {nodeExtrareasons.parent()};
-    pugi::xml_node nodeHost         {nodeExtraports.parent().parent()};
-
-    nmdo::IpAddress ipAddr {extractHostIpAddr(nodeHost)};
-    nmdo::Port port(ipAddr);
-    port.setPort(-1);
-    port.setState(nodeExtraports.attribute("state").as_string());
-
-    std::string portReason {nodeExtrareasons.attribute("reason").as_string()};
-    port.setReason(portReason);
-
-    std::string protocol;
-    if (1 == nmapNode.select_nodes("scaninfo").size()) {
-      // If there is only a single scaninfo element,
-      // all extraports protocols must be the scaninfo's protocol.
-      protocol = nmapNode.select_node("scaninfo")
-                  .node().attribute("protocol").as_string();
-    }
-    else if (  (portReason == "tcp-response")
-            || (portReason == "tcp-responses")
-            || (portReason == "syn-ack")
-            || (portReason == "syn-acks")
-            || (portReason == "reset")
-            || (portReason == "resets")) {
-      // If there are multiple scaninfo elements
-      // (meaning the scan was a multi-protocol scan),
-      // certain port_reason values indicate or imply TCP.
-      protocol = "tcp";
-    }
-    else if (  (portReason == "udp-response")
-            || (portReason == "udp-responses")
-            || (portReason == "port-unreach")
-            || (portReason == "port-unreaches")) {
-      // If there are multiple scaninfo elements
-      // (meaning the scan was a multi-protocol scan),
-      // certain port_reason values indicate or imply UDP.
-      protocol = "udp";
+  void
+  ParserNmapXml::extractTraceRoutes(const Host& host, Data& data)
+  { // This code block identifies ip_addrs of routers along a route.
+    // The routers may or may not be in the target address space,
+    // so might need to be inserted into the ip_addrs table.
+    const std::string nmapTraceReason {"nmap trace"};
+    for (const auto& nodeTrace : host.traces) {
+      for (const auto& nodeHop : nodeTrace.children("hop")) {
+        nmdo::IpAddress nextHop {nodeHop.attribute("ipaddr").as_string()};
+        nextHop.setResponding(true);
+        nextHop.addAlias(nodeHop.attribute("host").as_string(),
+                         nmapTraceReason);
+
+        nmdo::TracerouteHop hop;
+        hop.setHopCount(nodeHop.attribute("ttl").as_uint());
+        hop.setHopIp(nextHop);
+        hop.setDstIp(host.ipAddr);
+
+        data.tracerouteHops.push_back(hop);
+      }
     }
-
-    port.setProtocol(protocol);
-
-    data.ports.push_back(port);
   }
 
-  for (const auto& xPort : nmapNode.select_nodes("host/ports/port")) {
-    pugi::xml_node nodePort      {xPort.node()};
-    pugi::xml_node nodePortState {nodePort.child("state")};
-    pugi::xml_node nodeHost      {nodePort.parent().parent()};
-
-    nmdo::IpAddress ipAddr {extractHostIpAddr(nodeHost)};
-    nmdo::Port port(ipAddr);
-
-    std::string protocol {nodePort.attribute("protocol").as_string()};
-    port.setProtocol(protocol);
-
-    int portNum {nodePort.attribute("portid").as_int()};
-    port.setPort(portNum);
-
-    port.setState(nodePortState.attribute("state").as_string());
-    port.setReason(nodePortState.attribute("reason").as_string());
-
-    data.ports.push_back(port);
-
-    pugi::xml_node nodeService {nodePort.child("service")};
-    if (nodeService) {
-      std::string serviceName {nodeService.attribute("name").as_string()};
-
-      nmdo::Service service(serviceName, ipAddr);
-      service.setProtocol(protocol);
+  void
+  ParserNmapXml::extractPortsAndServices(const pugi::xml_node& nmapNode,
+                                         Data& data)
+  {
+    extractScanInfo(nmapNode);
 
-      std::string portStr {std::to_string(portNum)};
-      service.addDstPort(portStr);
-
-      service.setServiceDescription(
-          nodeService.attribute("product").as_string());
-      service.setServiceReason(nodeService.attribute("method").as_string());
+    forEachHost(nmapNode, [&](const Host& host) {
+        extractPortsAndServices(host, data);
+      });
+  }
 
-      data.services.push_back(service);
+  void
+  ParserNmapXml::extractPortsAndServices(const Host& host, Data& data)
+  {
+    for (const auto& nodePorts : host.ports) {
+      for (const auto& nodeExtraports : nodePorts.children("extraports")) {
+        for (const auto& nodeExtrareasons :
+               nodeExtraports.children("extrareasons")) {
+          nmdo::Port port(host.ipAddr);
+          port.setPort(-1);
+          port.setState(nodeExtraports.attribute("state").as_string());
+
+          std::string portReason {
+              nodeExtrareasons.attribute("reason").as_string()
+            };
+          port.setReason(portReason);
+
+          std::string protocol;
+          if (scanProtocol) {
+            // If there is only a single scaninfo element,
+            // all extraports protocols must be the scaninfo's protocol.
+            protocol = *scanProtocol;
+          }
+          else if (  (portReason == "tcp-response")
+                  || (portReason == "tcp-responses")
+                  || (portReason == "syn-ack")
+                  || (portReason == "syn-acks")
+                  || (portReason == "reset")
+                  || (portReason == "resets")) {
+            // If there are multiple scaninfo elements
+            // (meaning the scan was a multi-protocol scan),
+            // certain port_reason values indicate or imply TCP.
+            protocol = "tcp";
+          }
+          else if (  (portReason == "udp-response")
+                  || (portReason == "udp-responses")
+                  || (portReason == "port-unreach")
+                  || (portReason == "port-unreaches")) {
+            // If there are multiple scaninfo elements
+            // (meaning the scan was a multi-protocol scan),
+            // certain port_reason values indicate or imply UDP.
+            protocol = "udp";
+          }
+
+          port.setProtocol(protocol);
+
+          data.ports.push_back(port);
+        }
+      }
     }
-  }
-}
 
-void
-ParserNmapXml::extractNseAndSsh(const pugi::xml_node& nmapNode, Data& data)
-{
-  for (const auto& xScript :
-         nmapNode.select_nodes("host/ports/port/script")) {
-    pugi::xml_node nodeScript {xScript.node()};
-    pugi::xml_node nodePort   {nodeScript.parent()};
-    pugi::xml_node nodeHost   {nodePort.parent().parent()};
+    for (const auto& nodePorts : host.ports) {
+      for (const auto& nodePort : nodePorts.children("port")) {
+        pugi::xml_node nodePortState {nodePort.child("state")};
 
-    nmdo::IpAddress ipAddr {extractHostIpAddr(nodeHost)};
+        nmdo::Port port(host.ipAddr);
 
-    NseResult nse;
-    nse.port = nmdo::Port(ipAddr);
-    nse.port.setProtocol(nodePort.attribute("protocol").as_string());
-    nse.port.setPort(nodePort.attribute("portid").as_int());
-    nse.scriptId = nodeScript.attribute("id").as_string();
-    nse.scriptOutput = nodeScript.attribute("output").as_string();
+        std::string protocol {nodePort.attribute("protocol").as_string()};
+        port.setProtocol(protocol);
 
-    data.nseResults.push_back(nse);
+        int portNum {nodePort.attribute("portid").as_int()};
+        port.setPort(portNum);
 
-    if (nse.scriptId == "ssh-hostkey") {
-      for (const auto& xTable : nodeScript.select_nodes("table")) {
-        pugi::xml_node nodeTable {xTable.node()};
+        port.setState(nodePortState.attribute("state").as_string());
+        port.setReason(nodePortState.attribute("reason").as_string());
 
-        SshPublicKey key;
-        key.port = nse.port;
+        data.ports.push_back(port);
 
-        key.type = nodeTable.select_node("elem[@key='type']")
-          .node().text().as_string();
+        pugi::xml_node nodeService {nodePort.child("service")};
+        if (nodeService) {
+          std::string serviceName {nodeService.attribute("name").as_string()};
 
-        key.bits = nodeTable.select_node("elem[@key='bits']")
-          .node().text().as_int();
+          nmdo::Service service(serviceName, host.ipAddr);
+          service.setProtocol(protocol);
 
-        key.fingerprint =
-          nodeTable.select_node("elem[@key='fingerprint']")
-            .node().text().as_string();
+          std::string portStr {std::to_string(portNum)};
+          service.addDstPort(portStr);
 
-        key.key = nodeTable.select_node("elem[@key='key']")
-          .node().text().as_string();
+          service.setServiceDescription(
+              nodeService.attribute("product").as_string());
+          service.setServiceReason(
+              nodeService.attribute("method").as_string());
 
-        data.sshKeys.push_back(key);
+          data.services.push_back(service);
+        }
       }
     }
-    else if (nse.scriptId == "ssh2-enum-algos") {
-      for (const auto& xTable : nodeScript.select_nodes("table")) {
-        pugi::xml_node nodeTable {xTable.node()};
-
-        for (const auto& xElem : nodeTable.select_nodes("elem")) {
-          pugi::xml_node nodeElem {xElem.node()};
+  }
 
-          SshAlgorithm algo;
-          algo.port = nse.port;
-          algo.type = nodeTable.attribute("key").as_string();
-          algo.name = nodeElem.text().as_string();
+  void
+  ParserNmapXml::extractNseAndSsh(const pugi::xml_node& nmapNode, Data& data)
+  {
+    forEachHost(nmapNode, [&](const Host& host) {
+        extractNseAndSsh(host, data);
+      });
+  }
 
-          data.sshAlgorithms.push_back(algo);
+  void
+  ParserNmapXml::extractNseAndSsh(const Host& host, Data& data)
+  {
+    for (const auto& nodePorts : host.ports) {
+      for (const auto& nodePort : nodePorts.children("port")) {
+        for (const auto& nodeScript : nodePort.children("script")) {
+          NseResult nse;
+          nse.port = nmdo::Port(host.ipAddr);
+          nse.port.setProtocol(nodePort.attribute("protocol").as_string());
+          nse.port.setPort(nodePort.attribute("portid").as_int());
+          nse.scriptId = nodeScript.attribute("id").as_string();
+          nse.scriptOutput = nodeScript.attribute("output").as_string();
+
+          data.nseResults.push_back(nse);
+
+          if (nse.scriptId == "ssh-hostkey") {
+            for (const auto& nodeTable : nodeScript.children("table")) {
+              auto elemText = [&nodeTable](const char* elemKey) {
+                  return nodeTable.find_child_by_attribute("elem", "key",
+                                                           elemKey).text();
+                };
+
+              SshPublicKey key;
+              key.port        = nse.port;
+              key.type        = elemText("type").as_string();
+              key.bits        = elemText("bits").as_int();
+              key.fingerprint = elemText("fingerprint").as_string();
+              key.key         = elemText("key").as_string();
+
+              data.sshKeys.push_back(key);
+            }
+          }
+          else if (nse.scriptId == "ssh2-enum-algos") {
+            for (const auto& nodeTable : nodeScript.children("table")) {
+              for (const auto& nodeElem : nodeTable.children("elem")) {
+                SshAlgorithm algo;
+                algo.port = nse.port;
+                algo.type = nodeTable.attribute("key").as_string();
+                algo.name = nodeElem.text().as_string();
+
+                data.sshAlgorithms.push_back(algo);
+              }
+            }
+          }
         }
       }
     }
@@ -27,6 +27,8 @@
 #ifndef NMAP_XML_PARSER_HPP
 #define NMAP_XML_PARSER_HPP
 
+#include <optional>
+
 #include <pugixml.hpp>
 
 #include <netmeld/datastore/objects/IpAddress.hpp>
@@ -38,6 +40,7 @@
 #include <netmeld/datastore/objects/TracerouteHop.hpp>
 #include <netmeld/datastore/parsers/ParserHelper.hpp>
 #include <netmeld/datastore/tools/AbstractImportTool.hpp>
+#include <netmeld/datastore/utils/XPathQueries.hpp>
 
 #include "NseResult.hpp"
 #include "SshAlgorithm.hpp"
@@ -48,65 +51,104 @@ namespace nmdp = netmeld::datastore::parsers;
 namespace nmdt = netmeld::datastore::tools;
 namespace nmdu = netmeld::datastore::utils;
 
-// =============================================================================
-// Data containers
-// =============================================================================
-struct Data
-{
-  std::vector<nmdo::MacAddress>       macAddrs;
-  std::vector<nmdo::IpAddress>        ipAddrs;
-  std::vector<nmdo::OperatingSystem>  oses;
-  std::vector<nmdo::TracerouteHop>    tracerouteHops;
-  std::vector<nmdo::Port>             ports;
-  std::vector<nmdo::Service>          services;
-  std::vector<NseResult>              nseResults;
-  std::vector<SshPublicKey>           sshKeys;
-  std::vector<SshAlgorithm>           sshAlgorithms;
-
-  nmdo::ToolObservations              observations;
-};
-typedef std::vector<Data>  Result;
+namespace netmeld::datastore::importers::nmap {
 
-
-// =============================================================================
-// Parser definition
-// =============================================================================
-class ParserNmapXml
-{
   // ===========================================================================
-  // Variables
+  // Data containers
   // ===========================================================================
-  private:
-  protected:
-  public:
+  struct Data
+  {
+    std::vector<nmdo::MacAddress>       macAddrs;
+    std::vector<nmdo::IpAddress>        ipAddrs;
+    std::vector<nmdo::OperatingSystem>  oses;
+    std::vector<nmdo::TracerouteHop>    tracerouteHops;
+    std::vector<nmdo::Port>             ports;
+    std::vector<nmdo::Service>          services;
+    std::vector<NseResult>              nseResults;
+    std::vector<SshPublicKey>           sshKeys;
+    std::vector<SshAlgorithm>           sshAlgorithms;
+
+    nmdo::ToolObservations              observations;
+  };
+  typedef std::vector<Data>  Result;
 
-  // ===========================================================================
-  // Constructors
-  // ===========================================================================
-  private:
-  protected:
-  public:
-    ParserNmapXml();
 
   // ===========================================================================
-  // Methods
+  // Parser definition
   // ===========================================================================
-  private:
-  protected:
-    bool extractHostIsResponding(const pugi::xml_node&) const;
-    nmdo::MacAddress extractHostMacAddr(const pugi::xml_node&) const;
-    nmdo::IpAddress extractHostIpAddr(const pugi::xml_node&) const;
-
-  public:
-    std::tuple<std::string, std::string>
-      extractExecutionTiming(const pugi::xml_node&);
-
-    void extractMacAndIpAddrs(const pugi::xml_node&, Data&);
-    void extractHostnames(const pugi::xml_node&, Data&);
-    void extractOperatingSystems(const pugi::xml_node&, Data&);
-    void extractTraceRoutes(const pugi::xml_node&, Data&);
-    void extractPortsAndServices(const pugi::xml_node&, Data&);
-    void extractNseAndSsh(const pugi::xml_node&, Data&);
-};
+  class ParserNmapXml
+  {
+    // =========================================================================
+    // Variables
+    // =========================================================================
+    private:
+      // Protocol of all extraports, when the scan had a single scaninfo
+      std::optional<std::string> scanProtocol;
+
+    protected:
+      // A host element's children, found in one pass over them
+      struct Host
+      {
+        pugi::xml_node              node;
+        nmdo::IpAddress             ipAddr;
+        std::vector<pugi::xml_node> hostnames;
+        std::vector<pugi::xml_node> ports;
+        std::vector<pugi::xml_node> oses;
+        std::vector<pugi::xml_node> hostscripts;
+        std::vector<pugi::xml_node> traces;
+      };
+
+    public:
+
+    // =========================================================================
+    // Constructors
+    // =========================================================================
+    private:
+    protected:
+    public:
+      ParserNmapXml();
+
+    // =========================================================================
+    // Methods
+    // =========================================================================
+    private:
+      template<typename Function>
+      void forEachHost(const pugi::xml_node&, Function);
+
+      void addScriptHostnames(const pugi::xml_node&, const nmdo::IpAddress&,
+                              Data&) const;
+
+    protected:
+      bool extractHostIsResponding(const pugi::xml_node&) const;
+      nmdo::MacAddress extractHostMacAddr(const pugi::xml_node&) const;
+      nmdo::IpAddress extractHostIpAddr(const pugi::xml_node&) const;
+
+      Host indexHost(const pugi::xml_node&) const;
+
+      void extractMacAndIpAddrs(const Host&, Data&);
+      void extractHostnames(const Host&, Data&);
+      void extractOperatingSystems(const Host&, Data&);
+      void extractTraceRoutes(const Host&, Data&);
+      void extractPortsAndServices(const Host&, Data&);
+      void extractNseAndSsh(const Host&, Data&);
+
+    public:
+      std::tuple<std::string, std::string>
+        extractExecutionTiming(const pugi::xml_node&);
+      void extractScanInfo(const pugi::xml_node&);
+
+      // Everything from one host element, in a single pass over it; this
+      // is what the importer uses
+      void extractHost(const pugi::xml_node&, Data&);
+      void extractHosts(const pugi::xml_node&, Data&);
 
+      // One kind of data from every host element
+      void extractMacAndIpAddrs(const pugi::xml_node&, Data&);
+      void extractHostnames(const pugi::xml_node&, Data&);
+      void extractOperatingSystems(const pugi::xml_node&, Data&);
+      void extractTraceRoutes(const pugi::xml_node&, Data&);
+      void extractPortsAndServices(const pugi::xml_node&, Data&);
+      void extractNseAndSsh(const pugi::xml_node&, Data&);
+  };
+}
 #endif //NMAP_XML_PARSER_HPP
@@ -34,7 +34,9 @@
 
 #include "ParserNmapXml.hpp"
 
-class TestParserNmapXml : public ParserNmapXml
+namespace nmdsin = netmeld::datastore::importers::nmap;
+
+class TestParserNmapXml : public nmdsin::ParserNmapXml
 {
   public:
     using ParserNmapXml::extractHostIsResponding;
@@ -189,7 +191,7 @@ BOOST_AUTO_TEST_CASE(testExtractMacAndIpAddrs)
       )STR");
     const pugi::xml_node testNode {doc.document_element().root()};
 
-    Data d;
+    nmdsin::Data d;
     tnxp.extractMacAndIpAddrs(testNode, d);
 
     const auto mac {d.macAddrs.at(0)};
@@ -209,7 +211,7 @@ BOOST_AUTO_TEST_CASE(testExtractMacAndIpAddrs)
       )STR");
     const pugi::xml_node testNode {doc.document_element().root()};
 
-    Data d;
+    nmdsin::Data d;
     tnxp.extractMacAndIpAddrs(testNode, d);
 
     const auto mac {d.macAddrs.at(0)};
@@ -235,7 +237,7 @@ BOOST_AUTO_TEST_CASE(testExtractHostnames)
       )STR");
     const pugi::xml_node testNode {doc.document_element().root()};
 
-    Data d;
+    nmdsin::Data d;
     tnxp.extractHostnames(testNode, d);
 
     BOOST_TEST(2 == d.ipAddrs.size());
@@ -264,7 +266,7 @@ BOOST_AUTO_TEST_CASE(testExtractHostnames)
       )STR");
     const pugi::xml_node testNode {doc.document_element().root()};
 
-    Data d;
+    nmdsin::Data d;
     tnxp.extractHostnames(testNode, d);
 
     BOOST_TEST(1 == d.ipAddrs.size());
@@ -281,7 +283,7 @@ BOOST_AUTO_TEST_CASE(testExtractHostnames)
   {
     pugi::xml_document doc;
 
-    Data d;
+    nmdsin::Data d;
     doc.load_string(
       R"STR(
       <host> <address addr="1.2.3.4" addrtype="ipv4"/>
@@ -321,7 +323,7 @@ BOOST_AUTO_TEST_CASE(testExtractHostnames)
         )STR");
       const pugi::xml_node testNode {doc.document_element().root()};
 
-      Data d;
+      nmdsin::Data d;
       tnxp.extractHostnames(testNode, d);
 
       BOOST_TEST(1 == d.ipAddrs.size());
@@ -346,7 +348,7 @@ BOOST_AUTO_TEST_CASE(testExtractHostnames)
         )STR");
       const pugi::xml_node testNode {doc.document_element().root()};
 
-      Data d;
+      nmdsin::Data d;
       tnxp.extractHostnames(testNode, d);
 
       BOOST_TEST(0 == d.ipAddrs.size());
@@ -388,7 +390,7 @@ BOOST_AUTO_TEST_CASE(testExtractHostnames)
       )STR");
     const pugi::xml_node testNode {doc.document_element().root()};
 
-    Data d;
+    nmdsin::Data d;
     tnxp.extractHostnames(testNode, d);
 
     BOOST_TEST(2 == d.ipAddrs.size());
@@ -425,7 +427,7 @@ BOOST_AUTO_TEST_CASE(testExtractOperatingSystems)
       )STR");
     const pugi::xml_node testNode {doc.document_element().root()};
 
-    Data d;
+    nmdsin::Data d;
     tnxp.extractOperatingSystems(testNode, d);
 
     const auto os {d.oses.at(0)};
@@ -453,7 +455,7 @@ BOOST_AUTO_TEST_CASE(testExtractTraceRoutes)
       )STR");
     const pugi::xml_node testNode {doc.document_element().root()};
 
-    Data d;
+    nmdsin::Data d;
     tnxp.extractTraceRoutes(testNode, d);
 
     BOOST_TEST(2 == d.tracerouteHops.size());
@@ -486,7 +488,7 @@ BOOST_AUTO_TEST_CASE(testExtractPortsAndServices)
       )STR");
     const pugi::xml_node testNode {doc.document_element().root()};
 
-    Data d;
+    nmdsin::Data d;
     tnxp.extractPortsAndServices(testNode, d);
 
     const auto port = d.ports.at(0);
@@ -509,7 +511,7 @@ BOOST_AUTO_TEST_CASE(testExtractPortsAndServices)
       )STR");
     const pugi::xml_node testNode {doc.document_element().root()};
 
-    Data d;
+    nmdsin::Data d;
     tnxp.extractPortsAndServices(testNode, d);
 
     const auto port = d.ports.at(0);
@@ -532,7 +534,7 @@ BOOST_AUTO_TEST_CASE(testExtractPortsAndServices)
       )STR");
     const pugi::xml_node testNode {doc.document_element().root()};
 
-    Data d;
+    nmdsin::Data d;
     tnxp.extractPortsAndServices(testNode, d);
 
     const auto port = d.ports.at(0);
@@ -557,7 +559,7 @@ BOOST_AUTO_TEST_CASE(testExtractPortsAndServices)
       )STR");
     const pugi::xml_node testNode {doc.document_element().root()};
 
-    Data d;
+    nmdsin::Data d;
     tnxp.extractPortsAndServices(testNode, d);
 
     const auto port = d.ports.at(0);
@@ -592,7 +594,7 @@ BOOST_AUTO_TEST_CASE(testExtractNseAndSsh)
       )STR");
     const pugi::xml_node testNode {doc.document_element().root()};
 
-    Data d;
+    nmdsin::Data d;
     tnxp.extractNseAndSsh(testNode, d);
 
     const auto nseResult = d.nseResults.at(0);
@@ -624,7 +626,7 @@ BOOST_AUTO_TEST_CASE(testExtractNseAndSsh)
       )STR");
     const pugi::xml_node testNode {doc.document_element().root()};
 
-    Data d;
+    nmdsin::Data d;
     tnxp.extractNseAndSsh(testNode, d);
 
     const auto sshKey = d.sshKeys.at(0);
@@ -655,7 +657,7 @@ BOOST_AUTO_TEST_CASE(testExtractNseAndSsh)
       )STR");
     const pugi::xml_node testNode {doc.document_element().root()};
 
-    Data d;
+    nmdsin::Data d;
     tnxp.extractNseAndSsh(testNode, d);
 
     const auto sshAlgo = d.sshAlgorithms.at(0);
@@ -666,3 +668,88 @@ BOOST_AUTO_TEST_CASE(testExtractNseAndSsh)
     BOOST_TEST("AAABBBCCC" == sshAlgo.name);
   }
 }
+
+BOOST_AUTO_TEST_CASE(testExtractHost)
+{
+  TestParserNmapXml tnxp;
+
+  {
+    pugi::xml_document doc;
+    doc.load_string(
+      R"STR(
+      <nmaprun>
+      <scaninfo protocol="tcp"/>
+      <host> <status state="up" reason="arp-response"/>
+      <address addr="1.2.3.4" addrtype="ipv4"/>
+      <address addr="00:11:22:33:44:55" addrtype="mac"/>
+      <hostnames> <hostname name="some_host" type="PTR"/> </hostnames>
+      <ports>
+      <extraports state="filtered">
+      <extrareasons reason="no-responses"/>
+      </extraports>
+      <port protocol="tcp" portid="22">
+      <state state="open" reason="syn-ack"/>
+      <service name="ssh" product="OpenSSH" method="probed"/>
+      <script id="ssh-hostkey" output="2048 aa:bb::cc::dd (RSA)">
+      <table>
+      <elem key="type">ssh-rsa</elem>
+      <elem key="bits">2048</elem>
+      </table>
+      </script>
+      </port>
+      </ports>
+      <os> <osmatch>
+      <osclass vendor="some_vendor" osfamily="some_osfamily" accuracy="90"/>
+      </osmatch> </os>
+      <trace> <hop ttl="1" ipaddr="4.3.2.1"/> </trace>
+      </host>
+      </nmaprun>
+      )STR");
+    const pugi::xml_node nmapNode {doc.document_element()};
+
+    nmdsin::Data single;
+    tnxp.extractHosts(nmapNode, single);
+
+    nmdsin::Data perKind;
+    tnxp.extractMacAndIpAddrs(nmapNode, perKind);
+    tnxp.extractHostnames(nmapNode, perKind);
+    tnxp.extractOperatingSystems(nmapNode, perKind);
+    tnxp.extractTraceRoutes(nmapNode, perKind);
+    tnxp.extractPortsAndServices(nmapNode, perKind);
+    tnxp.extractNseAndSsh(nmapNode, perKind);
+
+    BOOST_TEST(1 == single.macAddrs.size());
+    BOOST_TEST(1 == single.ipAddrs.size());
+    BOOST_TEST(1 == single.oses.size());
+    BOOST_TEST(1 == single.tracerouteHops.size());
+    BOOST_TEST(2 == single.ports.size());
+    BOOST_TEST(1 == single.services.size());
+    BOOST_TEST(1 == single.nseResults.size());
+    BOOST_TEST(1 == single.sshKeys.size());
+
+    BOOST_TEST(single.ports.at(0).toDebugString() ==
+        "[-1, tcp, [1.2.3.4/32, 0, , 0, []], filtered, no-responses]"
+        );
+    BOOST_TEST("ssh-rsa" == single.sshKeys.at(0).type);
+    BOOST_TEST(2048 == single.sshKeys.at(0).bits);
+
+    // One pass per host yields what one pass per kind of data does
+    auto sameAs = [](const auto& _lhs, const auto& _rhs) {
+        if (_lhs.size() != _rhs.size()) {
+          return false;
+        }
+        for (size_t i {0}; i < _lhs.size(); ++i) {
+          if (_lhs[i].toDebugString() != _rhs[i].toDebugString()) {
+            return false;
+          }
+        }
+        return true;
+      };
+    BOOST_TEST(sameAs(single.macAddrs, perKind.macAddrs));
+    BOOST_TEST(sameAs(single.ipAddrs, perKind.ipAddrs));
+    BOOST_TEST(sameAs(single.oses, perKind.oses));
+    BOOST_TEST(sameAs(single.tracerouteHops, perKind.tracerouteHops));
+    BOOST_TEST(sameAs(single.ports, perKind.ports));
+    BOOST_TEST(sameAs(single.services, perKind.services));
+  }
+}
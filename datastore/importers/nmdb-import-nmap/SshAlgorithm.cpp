@@ -44,7 +44,7 @@ SshAlgorithm::save(pqxx::transaction_base& t,
 
   port.save(t, toolRunId, deviceId);
 
-  t.exec_prepared("insert_raw_ssh_host_algorithm",
+  nmdu::execPrepared(t, "insert_raw_ssh_host_algorithm",
       toolRunId,
       port.getIpAddress().toString(),
       port.getProtocol(),
@@ -24,25 +24,37 @@
 // Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
 // =============================================================================
 
+#include <future>
+#include <optional>
 #include <regex>
 
 #include <pugixml.hpp>
 
+#include <netmeld/core/utils/ThreadSafeQueue.hpp>
+
 #include <netmeld/datastore/objects/IpAddress.hpp>
 #include <netmeld/datastore/parsers/ParserHelper.hpp>
 #include <netmeld/datastore/tools/AbstractImportTool.hpp>
 
-#include "ParserNmapXml.hpp"
+#include "Importer.hpp"
 
+namespace nmcu = netmeld::core::utils;
 namespace nmdo = netmeld::datastore::objects;
 namespace nmdp = netmeld::datastore::parsers;
 namespace nmdt = netmeld::datastore::tools;
 namespace nmdu = netmeld::datastore::utils;
+namespace nmdsin = netmeld::datastore::importers::nmap;
 
 
 template<typename P, typename R>
 class Tool : public nmdt::AbstractImportTool<P,R>
 {
+  private:
+    // Used with --stream, hosts are saved while the rest are parsed
+    std::optional<nmdsin::HostStream>  stream;
+    // Recreated per file, as a closed queue cannot be reused
+    std::optional<nmcu::ThreadSafeQueue<nmdsin::Data>> hosts;
+
   public:
     Tool() : nmdt::AbstractImportTool<P,R>
       ("Nmap's XML output (.xml files)", PROGRAM_NAME, PROGRAM_VERSION)
@@ -66,129 +78,118 @@ class Tool : public nmdt::AbstractImportTool<P,R>
           po::value<std::string>(),
           "IP address of device where Nmap scan originated")
         );
+
+      this->opts.addOptionalOption("stream", std::make_tuple(
+          "stream",
+          NULL_SEMANTIC,
+          "Parse and save one host at a time; for files too large to load"
+          " whole.")
+        );
+      this->opts.addAdvancedOption("queue-size", std::make_tuple(
+          "queue-size",
+          po::value<size_t>()->default_value(1000),
+          "Maximum parsed hosts awaiting save before parsing blocks, with"
+          " --stream; 0 is unbounded.")
+        );
     }
 
     void
     parseData() override
     {
-      pugi::xml_document doc;
-      if (!doc.load_file(this->getDataPath().string().c_str())) {
-        LOG_ERROR << "Could not open XML: "
-                  << this->getDataPath().string()
-                  << std::endl;
-        std::exit(nmcu::Exit::FAILURE);
+      if (this->opts.exists("stream")) {
+        openStream();
+        return;
       }
 
-      pugi::xml_node const nmapNode = doc.select_node("/nmaprun").node();
-      if (!nmapNode) {
-        LOG_ERROR << "Could not find XML element: /nmaprun"
-                  << std::endl;
+      try {
+        this->tResults = nmdsin::parseFile(this->getDataPath().string(),
+                                           this->executionStart,
+                                           this->executionStop);
+      } catch (const nmdp::ParseFailure& e) {
+        LOG_ERROR << e.what() << std::endl;
         std::exit(nmcu::Exit::FAILURE);
       }
-
-      ParserNmapXml nxp;
-
-      auto t {nxp.extractExecutionTiming(nmapNode)};
-
-      this->executionStart.readUnixTimestamp(std::get<0>(t));
-      this->executionStop.readUnixTimestamp(std::get<1>(t));
-
-      LOG_DEBUG << "[nmco] Start: " << this->executionStart << std::endl;
-      LOG_DEBUG << "[nmco] Stop : " << this->executionStop << std::endl;
-
-      Data data;
-
-      nxp.extractMacAndIpAddrs(nmapNode, data);
-      nxp.extractHostnames(nmapNode, data);
-      nxp.extractOperatingSystems(nmapNode, data);
-      nxp.extractTraceRoutes(nmapNode, data);
-      nxp.extractPortsAndServices(nmapNode, data);
-      nxp.extractNseAndSsh(nmapNode, data);
-
-      this->tResults.push_back(data);
     }
 
     void
     specificInserts(pqxx::transaction_base& t) override
     {
-      const auto& toolRunId {this->getToolRunId()};
-
-      for (auto& results : this->tResults) {
-        LOG_DEBUG << "Iterating over macAddrs\n";
-        for (auto& result : results.macAddrs) {
-          result.save(t, toolRunId, "");
-          LOG_DEBUG << result.toDebugString() << std::endl;
-        }
+      const auto& scanOriginIp {
+        this->opts.exists("scan-origin-ip")
+          ? this->opts.template getValueAs<nmdo::IpAddress>("scan-origin-ip")
+          : nmdo::IpAddress::getIpv4Default()
+      };
+      if (stream) {
+        saveStream(t, scanOriginIp);
+        return;
+      }
+      nmdsin::save(t, this->tResults, this->getToolRunId(), scanOriginIp);
+    }
 
-        LOG_DEBUG << "Iterating over ipAddrs\n";
-        for (auto& result : results.ipAddrs) {
-          result.save(t, toolRunId, "");
-          LOG_DEBUG << result.toDebugString() << std::endl;
-        }
+  private:
+    void
+    openStream()
+    {
+      try {
+        stream.emplace(this->getDataPath().string());
+      } catch (const std::runtime_error& e) {
+        LOG_ERROR << e.what() << std::endl;
+        std::exit(nmcu::Exit::FAILURE);
+      }
 
-        LOG_DEBUG << "Iterating over oses\n";
-        for (auto& result : results.oses) {
-          result.save(t, toolRunId, "");
-          LOG_DEBUG << result.toDebugString() << std::endl;
-        }
+      // Stop time is only known once parsed, see saveStream
+      this->executionStart = stream->getExecutionStart();
+      this->executionStop  = stream->getExecutionStart();
 
-        LOG_DEBUG << "Iterating over tracerouteHops\n";
-        for (auto& result : results.tracerouteHops) {
-          result.save(t, toolRunId, "");
-          LOG_DEBUG << result.toDebugString() << std::endl;
-        }
+      hosts.emplace(this->opts.template getValueAs<size_t>("queue-size"));
+    }
 
-        LOG_DEBUG << "Iterating over ports\n";
-        for (auto& result : results.ports) {
-          result.save(t, toolRunId, "");
-          LOG_DEBUG << result.toDebugString() << std::endl;
-        }
+    void
+    saveStream(pqxx::transaction_base& t, const nmdo::IpAddress& scanOriginIp)
+    {
+      const auto& toolRunId {this->getToolRunId()};
 
-        LOG_DEBUG << "Iterating over services\n";
-        const auto& scanOriginIp {
-          this->opts.exists("scan-origin-ip")
-            ? this->opts.template getValueAs<nmdo::IpAddress>("scan-origin-ip")
-            : nmdo::IpAddress::getIpv4Default()
-        };
-        for (auto& result : results.services) {
-          if (scanOriginIp.isValid()) {
-            result.setSrcAddress(scanOriginIp);
+      auto parser = std::async(
+          std::launch::async,
+          [this]()
+          {
+            try {
+              stream->parse([this](nmdsin::Data&& data) {
+                  if (!hosts->push(std::move(data))) {
+                    throw std::runtime_error("Parsing stopped, save failed");
+                  }
+                });
+            } catch (...) {
+              hosts->close();
+              throw;
+            }
+            hosts->close();
           }
-          LOG_DEBUG << result.toDebugString() << std::endl;
-          result.save(t, toolRunId, "");
-        }
-
-        LOG_DEBUG << "Iterating over nseResults\n";
-        for (auto& result : results.nseResults) {
-          result.save(t, toolRunId, "");
-          LOG_DEBUG << result.toString() << std::endl;
-        }
-
-        LOG_DEBUG << "Iterating over sshKeys\n";
-        for (auto& result : results.sshKeys) {
-          result.save(t, toolRunId, "");
-          LOG_DEBUG << result.toString() << std::endl;
-        }
+          );
 
-        LOG_DEBUG << "Iterating over sshAlgorithms\n";
-        for (auto& result : results.sshAlgorithms) {
-          result.save(t, toolRunId, "");
-          LOG_DEBUG << result.toString() << std::endl;
+      try {
+        nmdsin::Data data;
+        while (hosts->waitPop(data)) {
+          nmdsin::save(t, data, toolRunId, scanOriginIp);
         }
-
-        LOG_DEBUG << "Iterating over Observations\n";
-        results.observations.save(t, toolRunId, "");
-        LOG_DEBUG << results.observations.toDebugString() << '\n';
+      } catch (...) {
+        hosts->close(); // release a parser blocked on a full queue
+        throw;
       }
-    }
+      parser.get(); // rethrows any parse failure, so nothing is committed
 
-  private:
+      this->executionStop = stream->getExecutionStop();
+      nmdu::execPrepared(t, "update_tool_run",
+          toolRunId,
+          this->executionStart,
+          this->executionStop);
+    }
 };
 
 
 int
 main(int argc, char** argv)
 {
-  Tool<nmdp::DummyParser, Result> tool;
+  Tool<nmdp::DummyParser, nmdsin::Result> tool;
   return tool.start(argc, argv);
 }
@@ -31,6 +31,7 @@
 #include <netmeld/datastore/parsers/ParserHelper.hpp>
 #include <netmeld/datastore/parsers/ParserIpAddress.hpp>
 #include <netmeld/datastore/utils/ServiceFactory.hpp>
+#include <netmeld/datastore/utils/XPathQueries.hpp>
 
 #include <algorithm>
 #include <regex>
@@ -57,20 +58,20 @@ Parser::parseConfig(const pugi::xml_node& configNode)
   logicalSystem.name = vsysName;
 
   for (const auto& devicesEntryMatch :
-       configNode.select_nodes("devices/entry")) {
+       configNode.select_nodes(nmdu::xpathQuery("devices/entry"))) {
     const pugi::xml_node devicesEntryNode{devicesEntryMatch.node()};
     //const std::string deviceName {
     //  devicesEntryNode.attribute("name").value()
     //};
 
     for (const auto& deviceconfigMatch :
-         devicesEntryNode.select_nodes("deviceconfig")) {
+         devicesEntryNode.select_nodes(nmdu::xpathQuery("deviceconfig"))) {
       const pugi::xml_node deviceconfigNode{deviceconfigMatch.node()};
       parseConfigDeviceconfig(deviceconfigNode, logicalSystem);
     }
 
     for (const auto& interfaceMatch :
-         devicesEntryNode.select_nodes("network/interface")) {
+         devicesEntryNode.select_nodes(nmdu::xpathQuery("network/interface"))) {
       const pugi::xml_node interfaceNode{interfaceMatch.node()};
       auto parsedIfaces{parseConfigInterface(interfaceNode)};
       logicalSystem.ifaces.merge(parsedIfaces);
@@ -80,7 +81,7 @@ Parser::parseConfig(const pugi::xml_node& configNode)
     }
 
     for (const auto& virtualRouterMatch :
-         devicesEntryNode.select_nodes("network/virtual-router")) {
+         devicesEntryNode.select_nodes(nmdu::xpathQuery("network/virtual-router"))) {
       const pugi::xml_node virtualRouterNode{virtualRouterMatch.node()};
       auto parsedVrfs{parseConfigVirtualRouter(virtualRouterNode)};
       logicalSystem.vrfs.merge(parsedVrfs);
@@ -90,7 +91,7 @@ Parser::parseConfig(const pugi::xml_node& configNode)
     }
 
     for (const auto& vsysMatch :
-         devicesEntryNode.select_nodes("vsys")) {
+         devicesEntryNode.select_nodes(nmdu::xpathQuery("vsys"))) {
       const pugi::xml_node vsysNode{vsysMatch.node()};
       parseConfigVsys(vsysNode);
     }
@@ -103,7 +104,7 @@ Parser::parseConfigDeviceconfig(const pugi::xml_node& deviceconfigNode,
                                 LogicalSystem& logicalSystem)
 {
   for (const auto& dnsServerMatch :
-       deviceconfigNode.select_nodes("system/dns-setting/servers/*")) {
+       deviceconfigNode.select_nodes(nmdu::xpathQuery("system/dns-setting/servers/*"))) {
     const pugi::xml_node dnsServerNode{dnsServerMatch.node()};
     nmdo::IpAddress dnsServerIpAddr{dnsServerNode.text().as_string()};
     // Service version
@@ -116,17 +117,17 @@ Parser::parseConfigDeviceconfig(const pugi::xml_node& deviceconfigNode,
     logicalSystem.dnsResolvers.emplace_back(dnsResolver);
   }
   for (const auto& dnsDomainMatch :
-       deviceconfigNode.select_nodes("system/domain")) {
+       deviceconfigNode.select_nodes(nmdu::xpathQuery("system/domain"))) {
     const pugi::xml_node dnsDomainNode{dnsDomainMatch.node()};
     const std::string dnsSearchDomain{dnsDomainNode.text().as_string()};
     logicalSystem.dnsSearchDomains.emplace_back(dnsSearchDomain);
   }
 
   for (const auto& ntpServerMatch :
-       deviceconfigNode.select_nodes("system/ntp-servers/*")) {
+       deviceconfigNode.select_nodes(nmdu::xpathQuery("system/ntp-servers/*"))) {
     const pugi::xml_node ntpServerNode{ntpServerMatch.node()};
     for (const auto& ntpServerAddrMatch :
-         ntpServerNode.select_nodes("ntp-server-address")) {
+         ntpServerNode.select_nodes(nmdu::xpathQuery("ntp-server-address"))) {
       const pugi::xml_node ntpServerAddrNode{ntpServerAddrMatch.node()};
       nmdo::IpAddress ntpServerIpAddr{ntpServerAddrNode.text().as_string()};
       nmdo::Service ntpService{nmdu::ServiceFactory::makeNtp()};
@@ -140,7 +141,7 @@ Parser::parseConfigDeviceconfig(const pugi::xml_node& deviceconfigNode,
 void
 Parser::parseConfigVsys(const pugi::xml_node& vsysNode)
 {
-  for (const auto& entryMatch : vsysNode.select_nodes("entry")) {
+  for (const auto& entryMatch : vsysNode.select_nodes(nmdu::xpathQuery("entry"))) {
     const pugi::xml_node entryNode{entryMatch.node()};
     const std::string vsysName{
       entryNode.attribute("name").value()
@@ -151,7 +152,7 @@ Parser::parseConfigVsys(const pugi::xml_node& vsysNode)
 
     // Pull in the parent device config.
     for (const auto& deviceconfigMatch :
-         entryNode.select_nodes("../../deviceconfig")) {
+         entryNode.select_nodes(nmdu::xpathQuery("../../deviceconfig"))) {
       const pugi::xml_node deviceconfigNode{deviceconfigMatch.node()};
       parseConfigDeviceconfig(deviceconfigNode, logicalSystem);
     }
@@ -161,7 +162,7 @@ Parser::parseConfigVsys(const pugi::xml_node& vsysNode)
 
     for (const auto& importInterfaceMatch :
          entryNode.select_nodes(
-           "(import/network/interface/member)|(/config/shared/import/network/interface/member)")) {
+           nmdu::xpathQuery("(import/network/interface/member)|(/config/shared/import/network/interface/member)"))) {
       const std::string ifaceName{
         importInterfaceMatch.node().text().as_string()
       };
@@ -170,7 +171,7 @@ Parser::parseConfigVsys(const pugi::xml_node& vsysNode)
     }
 
     for (const auto& zoneMatch :
-         entryNode.select_nodes("(zone)|(/config/shared/zone)")) {
+         entryNode.select_nodes(nmdu::xpathQuery("(zone)|(/config/shared/zone)"))) {
       const pugi::xml_node zoneNode{zoneMatch.node()};
       auto parsedZones{parseConfigZone(zoneNode)};
       logicalSystem.aclZones.merge(parsedZones);
@@ -183,7 +184,7 @@ Parser::parseConfigVsys(const pugi::xml_node& vsysNode)
     // So don't create an "any" zone in aclZones.
 
     for (const auto& addressMatch :
-         entryNode.select_nodes("(address)|(/config/shared/address)")) {
+         entryNode.select_nodes(nmdu::xpathQuery("(address)|(/config/shared/address)"))) {
       const pugi::xml_node addressNode{addressMatch.node()};
       auto parsedAclIpNetSets{parseConfigAddress(addressNode)};
       logicalSystem.aclIpNetSets.merge(parsedAclIpNetSets);
@@ -192,7 +193,7 @@ Parser::parseConfigVsys(const pugi::xml_node& vsysNode)
       }
     }
     for (const auto& addressGroupMatch :
-         entryNode.select_nodes("(address-group)|(/config/shared/address-group)")) {
+         entryNode.select_nodes(nmdu::xpathQuery("(address-group)|(/config/shared/address-group)"))) {
       const pugi::xml_node addressGroupNode{addressGroupMatch.node()};
       auto parsedAclIpNetSets{parseConfigAddressGroup(addressGroupNode)};
       logicalSystem.aclIpNetSets.merge(parsedAclIpNetSets);
@@ -205,14 +206,14 @@ Parser::parseConfigVsys(const pugi::xml_node& vsysNode)
     logicalSystem.aclIpNetSets["any"].addIpNet(nmdo::IpNetwork("::/0"));
 
     for (const auto& serviceMatch :
-         entryNode.select_nodes("(service)|(/config/shared/service)")) {
+         entryNode.select_nodes(nmdu::xpathQuery("(service)|(/config/shared/service)"))) {
       const pugi::xml_node serviceNode{serviceMatch.node()};
       for (const auto& aclService : parseConfigService(serviceNode)) {
         logicalSystem.aclServices.emplace_back(aclService);
       }
     }
     for (const auto& serviceGroupMatch :
-         entryNode.select_nodes("(service-group)|(/config/shared/service-group)")) {
+         entryNode.select_nodes(nmdu::xpathQuery("(service-group)|(/config/shared/service-group)"))) {
       const pugi::xml_node serviceGroupNode{serviceGroupMatch.node()};
       for (const auto& aclService : parseConfigServiceGroup(serviceGroupNode)) {
         logicalSystem.aclServices.emplace_back(aclService);
@@ -220,7 +221,7 @@ Parser::parseConfigVsys(const pugi::xml_node& vsysNode)
     }
 
     for (const auto& rulebaseMatch :
-         entryNode.select_nodes("(rulebase)|(/config/shared/rulebase)")) {
+         entryNode.select_nodes(nmdu::xpathQuery("(rulebase)|(/config/shared/rulebase)"))) {
       const pugi::xml_node rulebaseNode{rulebaseMatch.node()};
       for (const auto& aclRuleService : parseConfigRulebase(rulebaseNode, logicalSystem)) {
         logicalSystem.aclRules.emplace_back(aclRuleService);
@@ -236,7 +237,7 @@ Parser::parseConfigInterface(const pugi::xml_node& interfaceNode)
   std::map<std::string, nmdo::InterfaceNetwork> ifaces;
 
   for (const auto& entryMatch :
-       interfaceNode.select_nodes("loopback")) {
+       interfaceNode.select_nodes(nmdu::xpathQuery("loopback"))) {
     const pugi::xml_node entryNode{entryMatch.node()};
     nmdo::InterfaceNetwork iface{parseConfigInterfaceEntry(entryNode)};
     iface.setMediaType("loopback");
@@ -244,20 +245,20 @@ Parser::parseConfigInterface(const pugi::xml_node& interfaceNode)
   }
 
   for (const auto& entryMatch :
-       interfaceNode.select_nodes("ethernet/entry")) {
+       interfaceNode.select_nodes(nmdu::xpathQuery("ethernet/entry"))) {
     const pugi::xml_node entryNode{entryMatch.node()};
     nmdo::InterfaceNetwork iface{parseConfigInterfaceEntry(entryNode)};
     ifaces[iface.getName()] = iface;
   }
   for (const auto& entryMatch :
-       interfaceNode.select_nodes("ethernet/entry/layer3/units/entry")) {
+       interfaceNode.select_nodes(nmdu::xpathQuery("ethernet/entry/layer3/units/entry"))) {
     const pugi::xml_node entryNode{entryMatch.node()};
     nmdo::InterfaceNetwork iface{parseConfigInterfaceEntry(entryNode)};
     ifaces[iface.getName()] = iface;
   }
 
   for (const auto& entryMatch :
-       interfaceNode.select_nodes("tunnel/units/entry")) {
+       interfaceNode.select_nodes(nmdu::xpathQuery("tunnel/units/entry"))) {
     const pugi::xml_node entryNode{entryMatch.node()};
     nmdo::InterfaceNetwork iface{parseConfigInterfaceEntry(entryNode)};
     iface.setMediaType("tunnel");
@@ -283,8 +284,8 @@ Parser::parseConfigInterfaceEntry(const pugi::xml_node& ifaceEntryNode)
 
   for (const auto& ipEntryMatch :
        ifaceEntryNode.select_nodes(
-         "(ip/entry)|"
-         "(ipv6/entry)")) {
+         nmdu::xpathQuery("(ip/entry)|"
+         "(ipv6/entry)"))) {
     std::string ipName{
       ipEntryMatch.node().attribute("name").value()
     };
@@ -318,7 +319,7 @@ Parser::parseConfigVirtualRouter(const pugi::xml_node& virtualRouterNode)
   std::map<std::string, nmdo::Vrf> vrfs;
 
   for (const auto& virtualRouterEntryMatch :
-       virtualRouterNode.select_nodes("entry")) {
+       virtualRouterNode.select_nodes(nmdu::xpathQuery("entry"))) {
     const pugi::xml_node virtualRouterEntryNode{virtualRouterEntryMatch.node()};
     const std::string vrfName{
       virtualRouterEntryNode.attribute("name").value()
@@ -326,7 +327,7 @@ Parser::parseConfigVirtualRouter(const pugi::xml_node& virtualRouterNode)
     vrfs[vrfName].setId(vrfName);
 
     for (const auto& interfaceMemberMatch :
-         virtualRouterEntryNode.select_nodes("interface/member")) {
+         virtualRouterEntryNode.select_nodes(nmdu::xpathQuery("interface/member"))) {
       const pugi::xml_node interfaceMemberNode{interfaceMemberMatch.node()};
       const std::string ifaceName{
         interfaceMemberNode.text().as_string()
@@ -336,8 +337,8 @@ Parser::parseConfigVirtualRouter(const pugi::xml_node& virtualRouterNode)
 
     for (const auto& staticRouteEntryMatch :
          virtualRouterEntryNode.select_nodes(
-           "(routing-table/ip/static-route/entry)|"
-           "(routing-table/ipv6/static-route/entry)")) {
+           nmdu::xpathQuery("(routing-table/ip/static-route/entry)|"
+           "(routing-table/ipv6/static-route/entry)"))) {
       const pugi::xml_node staticRouteEntryNode{staticRouteEntryMatch.node()};
       const std::string staticRouteName{
         staticRouteEntryNode.attribute("name").value()
@@ -349,7 +350,7 @@ Parser::parseConfigVirtualRouter(const pugi::xml_node& virtualRouterNode)
       route.setDescription(staticRouteName);
 
       const auto destinationMatch{
-        staticRouteEntryNode.select_node("destination")
+        staticRouteEntryNode.select_node(nmdu::xpathQuery("destination"))
       };
       if (destinationMatch) {
         const nmdo::IpAddress dstIpNet{destinationMatch.node().text().as_string()};
@@ -358,8 +359,8 @@ Parser::parseConfigVirtualRouter(const pugi::xml_node& virtualRouterNode)
 
       const auto nextHopIpMatch{
         staticRouteEntryNode.select_node(
-            "(nexthop/ip-address)|"
-            "(nexthop/ipv6-address)")
+            nmdu::xpathQuery("(nexthop/ip-address)|"
+            "(nexthop/ipv6-address)"))
       };
       if (nextHopIpMatch) {
         const nmdo::IpAddress rtrIpAddr{nextHopIpMatch.node().text().as_string()};
@@ -367,14 +368,14 @@ Parser::parseConfigVirtualRouter(const pugi::xml_node& virtualRouterNode)
       }
 
       const auto interfaceMatch{
-        staticRouteEntryNode.select_node("interface")
+        staticRouteEntryNode.select_node(nmdu::xpathQuery("interface"))
       };
       if (interfaceMatch) {
         route.setIfaceName(interfaceMatch.node().text().as_string());
       }
 
       const auto metricMatch{
-        staticRouteEntryNode.select_node("metric")
+        staticRouteEntryNode.select_node(nmdu::xpathQuery("metric"))
       };
       if (metricMatch) {
         route.setMetric(metricMatch.node().text().as_uint());
@@ -394,7 +395,7 @@ Parser::parseConfigZone(const pugi::xml_node& zoneNode)
   std::map<std::string, nmdo::AclZone> aclZones;
 
   for (const auto& zoneEntryMatch :
-       zoneNode.select_nodes("entry")) {
+       zoneNode.select_nodes(nmdu::xpathQuery("entry"))) {
     const pugi::xml_node zoneEntryNode{zoneEntryMatch.node()};
     const std::string zoneName{
       zoneEntryNode.attribute("name").value()
@@ -402,7 +403,7 @@ Parser::parseConfigZone(const pugi::xml_node& zoneNode)
     aclZones[zoneName].setId(zoneName);
 
     for (const auto& memberMatch :
-         zoneEntryNode.select_nodes("network/layer3/member")) {
+         zoneEntryNode.select_nodes(nmdu::xpathQuery("network/layer3/member"))) {
       const pugi::xml_node memberNode{memberMatch.node()};
       const std::string ifaceName{
         memberNode.text().as_string()
@@ -420,19 +421,19 @@ Parser::parseConfigAddress(const pugi::xml_node& addressNode)
 {
   std::map<std::string, nmdo::AclIpNetSet> aclIpNetSets;
 
-  for (const auto& entryMatch : addressNode.select_nodes("entry")) {
+  for (const auto& entryMatch : addressNode.select_nodes(nmdu::xpathQuery("entry"))) {
     const pugi::xml_node entryNode{entryMatch.node()};
     const std::string ipNetSetName{
       entryNode.attribute("name").value()
     };
     aclIpNetSets[ipNetSetName].setId(ipNetSetName);
 
-    for (const auto& ipNetmaskMatch : entryNode.select_nodes("ip-netmask")) {
+    for (const auto& ipNetmaskMatch : entryNode.select_nodes(nmdu::xpathQuery("ip-netmask"))) {
       const nmdo::IpNetwork ipNet{ipNetmaskMatch.node().text().as_string()};
       aclIpNetSets[ipNetSetName].addIpNet(ipNet);
     }
 
-    for (const auto& fqdnMatch : entryNode.select_nodes("fqdn")) {
+    for (const auto& fqdnMatch : entryNode.select_nodes(nmdu::xpathQuery("fqdn"))) {
       const pugi::xml_node fqdnNode{fqdnMatch.node()};
       const std::string dnsName{fqdnNode.text().as_string()};
       data.observations.addNotable("FQDNs are used that must be resolved");
@@ -449,14 +450,14 @@ Parser::parseConfigAddressGroup(const pugi::xml_node& addressGroupNode)
 {
   std::map<std::string, nmdo::AclIpNetSet> aclIpNetSets;
 
-  for (const auto& entryMatch : addressGroupNode.select_nodes("entry")) {
+  for (const auto& entryMatch : addressGroupNode.select_nodes(nmdu::xpathQuery("entry"))) {
     const pugi::xml_node entryNode{entryMatch.node()};
     const std::string ipNetSetName{
       entryNode.attribute("name").value()
     };
     aclIpNetSets[ipNetSetName].setId(ipNetSetName);
 
-    for (const auto& memberMatch : entryNode.select_nodes("static/member")) {
+    for (const auto& memberMatch : entryNode.select_nodes(nmdu::xpathQuery("static/member"))) {
       const std::string ipNetName{
         memberMatch.node().text().as_string()
       };
@@ -487,7 +488,7 @@ Parser::parseConfigService(const pugi::xml_node& serviceNode)
   }
 
   for (const auto& serviceEntryMatch :
-       serviceNode.select_nodes("entry")) {
+       serviceNode.select_nodes(nmdu::xpathQuery("entry"))) {
     const pugi::xml_node serviceEntryNode{serviceEntryMatch.node()};
     nmdo::AclService aclService;
 
@@ -497,7 +498,7 @@ Parser::parseConfigService(const pugi::xml_node& serviceNode)
     aclService.setId(serviceName);
 
     for (const auto& protocolMatch :
-         serviceEntryNode.select_nodes("protocol/child::*")) {
+         serviceEntryNode.select_nodes(nmdu::xpathQuery("protocol/child::*"))) {
       const pugi::xml_node protocolNode{protocolMatch.node()};
       const std::string protocol{protocolNode.name()};
       aclService.setProtocol(protocol);
@@ -508,7 +509,7 @@ Parser::parseConfigService(const pugi::xml_node& serviceNode)
         aclService.addSrcPortRange(srcPortRange);
       }
 
-      const auto portMatch{protocolNode.select_node("port")};
+      const auto portMatch{protocolNode.select_node(nmdu::xpathQuery("port"))};
       if (portMatch) {
         const nmdo::PortRange dstPortRange{
           portMatch.node().text().as_string()
@@ -535,7 +536,7 @@ Parser::parseConfigServiceGroup(const pugi::xml_node& serviceGroupNode)
   std::vector<nmdo::AclService> aclServices;
 
   for (const auto& serviceGroupEntryMatch :
-       serviceGroupNode.select_nodes("entry")) {
+       serviceGroupNode.select_nodes(nmdu::xpathQuery("entry"))) {
     const pugi::xml_node serviceGroupEntryNode{serviceGroupEntryMatch.node()};
     nmdo::AclService aclService;
 
@@ -545,7 +546,7 @@ Parser::parseConfigServiceGroup(const pugi::xml_node& serviceGroupNode)
     aclService.setId(serviceGroupName);
 
     for (const auto& memberMatch :
-         serviceGroupEntryNode.select_nodes("members/member")) {
+         serviceGroupEntryNode.select_nodes(nmdu::xpathQuery("members/member"))) {
       const std::string memberName{
         memberMatch.node().text().as_string()
       };
@@ -565,7 +566,7 @@ Parser::parseConfigRulebase(const pugi::xml_node& rulebaseNode,
 {
   std::vector<nmdo::AclRuleService> aclRules;
 
-  for (const auto& rulesMatch : rulebaseNode.select_nodes("security/rules")) {
+  for (const auto& rulesMatch : rulebaseNode.select_nodes(nmdu::xpathQuery("security/rules"))) {
     const pugi::xml_node rulesNode{rulesMatch.node()};
     auto aclRulesToAdd = parseConfigRules(rulesNode, 1000000, logicalSystem);
     std::copy(
@@ -575,7 +576,7 @@ Parser::parseConfigRulebase(const pugi::xml_node& rulebaseNode,
         );
   }
 
-  for (const auto& rulesMatch : rulebaseNode.select_nodes("default-security-rules/rules")) {
+  for (const auto& rulesMatch : rulebaseNode.select_nodes(nmdu::xpathQuery("default-security-rules/rules"))) {
     const pugi::xml_node rulesNode{rulesMatch.node()};
     auto aclRulesToAdd = parseConfigRules(rulesNode, 2000000, logicalSystem);
     std::copy(
@@ -585,14 +586,14 @@ Parser::parseConfigRulebase(const pugi::xml_node& rulebaseNode,
         );
   }
 
-  //for (const auto& rulesMatch : rulebaseNode.select_nodes("pbf/rules")) {
+  //for (const auto& rulesMatch : rulebaseNode.select_nodes(nmdu::xpathQuery("pbf/rules"))) {
   //  const pugi::xml_node rulesNode{rulesMatch.node()};
   //  for (const auto& aclRule : parseConfigRules(rulesNode, ?000000, logicalSystem)) {
   //    aclRules.emplace_back(aclRule);
   //  }
   //}
 
-  //for (const auto& rulesMatch : rulebaseNode.select_nodes("nat/rules")) {
+  //for (const auto& rulesMatch : rulebaseNode.select_nodes(nmdu::xpathQuery("nat/rules"))) {
   //  const pugi::xml_node rulesNode{rulesMatch.node()};
   //  for (const auto& aclRule : parseConfigRules(rulesNode, ?000000, logicalSystem)) {
   //    aclRules.emplace_back(aclRule);
@@ -610,7 +611,7 @@ Parser::parseConfigRules(const pugi::xml_node& rulesNode, const size_t ruleIdBas
   std::vector<nmdo::AclRuleService> aclRules;
 
   size_t ruleId{ruleIdBase};
-  for (const auto& rulesEntryMatch : rulesNode.select_nodes("entry")) {
+  for (const auto& rulesEntryMatch : rulesNode.select_nodes(nmdu::xpathQuery("entry"))) {
     const pugi::xml_node rulesEntryNode{rulesEntryMatch.node()};
 
     const std::string description{
@@ -619,7 +620,7 @@ Parser::parseConfigRules(const pugi::xml_node& rulesNode, const size_t ruleIdBas
 
     std::vector<std::string> ruleTypes;
     for (const auto& ruleTypeMatch :
-         rulesEntryNode.select_nodes("rule-type")) {
+         rulesEntryNode.select_nodes(nmdu::xpathQuery("rule-type"))) {
       const std::string ruleType{
         ruleTypeMatch.node().text().as_string()
       };
@@ -639,7 +640,7 @@ Parser::parseConfigRules(const pugi::xml_node& rulesNode, const size_t ruleIdBas
 
     std::vector<std::string> incomingZoneIds;
     for (const auto& incomingZoneMatch :
-         rulesEntryNode.select_nodes("from/member")) {
+         rulesEntryNode.select_nodes(nmdu::xpathQuery("from/member"))) {
       const std::string incomingZoneId{
         incomingZoneMatch.node().text().as_string()
       };
@@ -662,7 +663,7 @@ Parser::parseConfigRules(const pugi::xml_node& rulesNode, const size_t ruleIdBas
 
     std::vector<std::string> outgoingZoneIds;
     for (const auto& outgoingZoneMatch :
-         rulesEntryNode.select_nodes("to/member")) {
+         rulesEntryNode.select_nodes(nmdu::xpathQuery("to/member"))) {
       const std::string outgoingZoneId {
         outgoingZoneMatch.node().text().as_string()
       };
@@ -684,7 +685,7 @@ Parser::parseConfigRules(const pugi::xml_node& rulesNode, const size_t ruleIdBas
     }
 
     std::vector<std::string> srcIpNetSetIds;
-    const auto sourceMatches = rulesEntryNode.select_nodes("source/member");
+    const auto sourceMatches = rulesEntryNode.select_nodes(nmdu::xpathQuery("source/member"));
     std::transform(sourceMatches.begin(), sourceMatches.end(),
         std::back_inserter(srcIpNetSetIds),
         [](const auto& sourceMatch){return sourceMatch.node().text().as_string();}
@@ -695,7 +696,7 @@ Parser::parseConfigRules(const pugi::xml_node& rulesNode, const size_t ruleIdBas
     }
 
     std::vector<std::string> dstIpNetSetIds;
-    const auto&destinationMatches = rulesEntryNode.select_nodes("destination/member");
+    const auto&destinationMatches = rulesEntryNode.select_nodes(nmdu::xpathQuery("destination/member"));
     std::transform(destinationMatches.begin(), destinationMatches.end(),
         std::back_inserter(dstIpNetSetIds),
         [](const auto& destinationMatch){return destinationMatch.node().text().as_string();}
@@ -705,7 +706,7 @@ Parser::parseConfigRules(const pugi::xml_node& rulesNode, const size_t ruleIdBas
     }
 
     std::vector<std::string> serviceIds;
-    const auto& serviceMatches = rulesEntryNode.select_nodes("service/member");
+    const auto& serviceMatches = rulesEntryNode.select_nodes(nmdu::xpathQuery("service/member"));
     std::transform(serviceMatches.begin(), serviceMatches.end(),
         std::back_inserter(serviceIds),
         [](const auto& serviceMatch){return serviceMatch.node().text().as_string();}
@@ -715,7 +716,7 @@ Parser::parseConfigRules(const pugi::xml_node& rulesNode, const size_t ruleIdBas
     }
 
     std::string action;
-    auto actionMatch{rulesEntryNode.select_node("action")};
+    auto actionMatch{rulesEntryNode.select_node(nmdu::xpathQuery("action"))};
     if (actionMatch) {
       const std::string actionValue{actionMatch.node().text().as_string()};
       // Normalize Palo Alto actions to Netmeld actions.
@@ -122,7 +122,7 @@ class Tool : public nmdt::AbstractImportTool<P,R>
           LOG_DEBUG << "Iterating over DNS search domains:" << std::endl;
           for (auto& dnsSearchDomain : logicalSystem.dnsSearchDomains) {
             LOG_DEBUG << dnsSearchDomain << std::endl;
-            t.exec_prepared("insert_raw_device_dns_search_domain",
+            nmdu::execPrepared(t, "insert_raw_device_dns_search_domain",
                 toolRunId,
                 deviceId,
                 dnsSearchDomain
@@ -49,19 +49,15 @@ PacketHelper::getPayloadProtocol(const EthernetHeader* ph)
 {
   return ntohs(ph->payloadProtocol);
 }
-nmdo::MacAddress
-PacketHelper::getSrcMacAddr(const EthernetHeader* ph)
+nmdu::MacKey
+PacketHelper::getSrcMacKey(const EthernetHeader* ph)
 {
-  std::vector<uint8_t> macAddr(std::begin(ph->srcMacAddr),
-                               std::end(ph->srcMacAddr));
-  return nmdo::MacAddress(macAddr);
+  return nmdu::MacKey::fromBytes(ph->srcMacAddr);
 }
-nmdo::MacAddress
-PacketHelper::getDstMacAddr(const EthernetHeader* ph)
+nmdu::MacKey
+PacketHelper::getDstMacKey(const EthernetHeader* ph)
 {
-  std::vector<uint8_t> macAddr(std::begin(ph->dstMacAddr),
-                               std::end(ph->dstMacAddr));
-  return nmdo::MacAddress(macAddr);
+  return nmdu::MacKey::fromBytes(ph->dstMacAddr);
 }
 
 
@@ -71,13 +67,14 @@ PacketHelper::getPayloadProtocol(const LinuxCookedHeader* ph)
 {
   return ntohs(ph->payloadProtocol);
 }
-nmdo::MacAddress
-PacketHelper::getSrcMacAddr(const LinuxCookedHeader* ph)
+bool
+PacketHelper::getSrcMacKey(const LinuxCookedHeader* ph, nmdu::MacKey& key)
 {
-  std::vector<uint8_t> macAddr(std::begin(ph->srcMacAddr),
-                               std::end(ph->srcMacAddr));
-  macAddr.resize(ntohs(ph->llAddrLength));
-  return nmdo::MacAddress(macAddr);
+  if (6 != ntohs(ph->llAddrLength)) {
+    return false;
+  }
+  key = nmdu::MacKey::fromBytes(ph->srcMacAddr);
+  return true;
 }
 
 
@@ -87,28 +84,23 @@ PacketHelper::getPayloadProtocol(const VlanHeader* ph)
 {
   return ntohs(ph->payloadProtocol);
 }
-nmdo::Vlan
-PacketHelper::getVlan(const VlanHeader* ph)
+uint16_t
+PacketHelper::getVlanId(const VlanHeader* ph)
 {
-  uint16_t vlanId = ntohs(ph->tagControl) & 0x0FFF;
-  return nmdo::Vlan(vlanId);
+  return static_cast<uint16_t>(ntohs(ph->tagControl) & 0x0FFF);
 }
 
 
 // ARP
-nmdo::MacAddress
-PacketHelper::getSrcMacAddr(const ArpHeader* ph)
+nmdu::MacKey
+PacketHelper::getSrcMacKey(const ArpHeader* ph)
 {
-  std::vector<uint8_t> macAddr(std::begin(ph->srcMacAddr),
-                               std::end(ph->srcMacAddr));
-  return nmdo::MacAddress(macAddr);
+  return nmdu::MacKey::fromBytes(ph->srcMacAddr);
 }
-nmdo::IpAddress
-PacketHelper::getSrcIpAddr(const ArpHeader* ph)
+nmdu::IpKey
+PacketHelper::getSrcIpKey(const ArpHeader* ph)
 {
-  std::vector<uint8_t> ipAddr(std::begin(ph->srcIpAddr),
-                              std::end(ph->srcIpAddr));
-  return nmdo::IpAddress(ipAddr);
+  return nmdu::IpKey::fromBytes(ph->srcIpAddr, sizeof(ph->srcIpAddr));
 }
 
 
@@ -123,20 +115,16 @@ PacketHelper::getPayloadProtocol(const Ipv6Header* ph)
 {
   return static_cast<uint8_t>(ntohs(ph->payloadProtocol) >> 8);
 }
-nmdo::IpAddress
-PacketHelper::getSrcIpAddr(const Ipv4Header* ph)
+nmdu::IpKey
+PacketHelper::getSrcIpKey(const Ipv4Header* ph)
 {
-  std::vector<uint8_t> ipAddr(std::begin(ph->srcIpAddr),
-                              std::end(ph->srcIpAddr));
-  return nmdo::IpAddress(ipAddr);
+  return nmdu::IpKey::fromBytes(ph->srcIpAddr, sizeof(ph->srcIpAddr));
 }
 
-nmdo::IpAddress
-PacketHelper::getSrcIpAddr(const Ipv6Header* ph)
+nmdu::IpKey
+PacketHelper::getSrcIpKey(const Ipv6Header* ph)
 {
-  std::vector<uint8_t> ipAddr(std::begin(ph->srcIpAddr),
-                              std::end(ph->srcIpAddr));
-  return nmdo::IpAddress(ipAddr);
+  return nmdu::IpKey::fromBytes(ph->srcIpAddr, sizeof(ph->srcIpAddr));
 }
 
 
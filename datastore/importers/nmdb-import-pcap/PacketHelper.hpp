@@ -27,11 +27,14 @@
 #ifndef PACKET_HELPER
 #define PACKET_HELPER
 
-#include <netmeld/datastore/objects/IpAddress.hpp>
-#include <netmeld/datastore/objects/MacAddress.hpp>
-#include <netmeld/datastore/objects/Vlan.hpp>
+#include <arpa/inet.h>
+#include <sstream>
+#include <tuple>
+#include <vector>
 
-namespace nmdo = netmeld::datastore::objects;
+#include <netmeld/datastore/utils/AddressKeys.hpp>
+
+namespace nmdu = netmeld::datastore::utils;
 
 
 //---------------------------------------------------------------------------
@@ -178,26 +181,27 @@ class PacketHelper {
   public: // Methods part of public API
     // Ethernet
     uint16_t getPayloadProtocol(const EthernetHeader*);
-    nmdo::MacAddress getSrcMacAddr(const EthernetHeader*);
-    nmdo::MacAddress getDstMacAddr(const EthernetHeader*);
+    nmdu::MacKey getSrcMacKey(const EthernetHeader*);
+    nmdu::MacKey getDstMacKey(const EthernetHeader*);
 
     // LinuxCooked
     uint16_t getPayloadProtocol(const LinuxCookedHeader*);
-    nmdo::MacAddress getSrcMacAddr(const LinuxCookedHeader*);
+    // False if the link layer address is not a 6 byte MAC
+    bool getSrcMacKey(const LinuxCookedHeader*, nmdu::MacKey&);
 
     // VLAN
     uint16_t getPayloadProtocol(const VlanHeader*);
-    nmdo::Vlan getVlan(const VlanHeader*);
+    uint16_t getVlanId(const VlanHeader*);
 
     // ARP
-    nmdo::MacAddress getSrcMacAddr(const ArpHeader*);
-    nmdo::IpAddress getSrcIpAddr(const ArpHeader*);
+    nmdu::MacKey getSrcMacKey(const ArpHeader*);
+    nmdu::IpKey getSrcIpKey(const ArpHeader*);
 
     // IP
     uint8_t getPayloadProtocol(const Ipv4Header*);
-    nmdo::IpAddress getSrcIpAddr(const Ipv4Header*);
+    nmdu::IpKey getSrcIpKey(const Ipv4Header*);
     uint8_t getPayloadProtocol(const Ipv6Header*);
-    nmdo::IpAddress getSrcIpAddr(const Ipv6Header*);
+    nmdu::IpKey getSrcIpKey(const Ipv6Header*);
 
     // UDP
     uint16_t getSrcPort(const UdpHeader*);
@@ -24,15 +24,115 @@
 // Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
 // =============================================================================
 
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
 #include <memory>
 #include <pcap/pcap.h>
 
 #include <netmeld/datastore/parsers/ParserHelper.hpp>
 #include <netmeld/core/utils/Exit.hpp>
+#include <netmeld/core/utils/ThreadSafeQueue.hpp>
 
 #include "Parser.hpp"
 
-namespace nmcu = netmeld::core::utils;
+
+// =============================================================================
+// Data
+// =============================================================================
+void
+Data::merge(Data&& other)
+{
+  vlans |= other.vlans;
+
+  // NOTE: tryEmplace only moves from the value when it inserts
+  macAddrs.reserve(macAddrs.size() + other.macAddrs.size());
+  for (auto& [key, facts] : other.macAddrs) {
+    auto [it, inserted] {macAddrs.tryEmplace(key, std::move(facts))};
+    if (!inserted) {
+      auto& entry {it->second};
+      entry.responding = entry.responding || facts.responding;
+      for (const auto& ipKey : facts.ipAddrs) {
+        if (std::find(entry.ipAddrs.cbegin(), entry.ipAddrs.cend(), ipKey)
+            == entry.ipAddrs.cend()) {
+          entry.ipAddrs.push_back(ipKey);
+        }
+      }
+    }
+  }
+  ipAddrs.reserve(ipAddrs.size() + other.ipAddrs.size());
+  for (auto& [key, facts] : other.ipAddrs) {
+    auto [it, inserted] {ipAddrs.tryEmplace(key, std::move(facts))};
+    if (!inserted) {
+      auto& entry {it->second};
+      entry.responding = entry.responding || facts.responding;
+      entry.aliases.merge(facts.aliases);
+    }
+  }
+
+  observations.merge(other.observations);
+}
+
+std::vector<nmdo::Vlan>
+Data::getVlans() const
+{
+  std::vector<nmdo::Vlan> results;
+  for (size_t id {0}; id < vlans.size(); ++id) {
+    if (vlans.test(id)) {
+      results.emplace_back(static_cast<uint16_t>(id), PCAP_REASON);
+    }
+  }
+  return results;
+}
+
+std::vector<nmdo::MacAddress>
+Data::getMacAddrs() const
+{
+  std::vector<nmdu::MacKey> keys;
+  keys.reserve(macAddrs.size());
+  for (const auto& [key, _] : macAddrs) {
+    keys.push_back(key);
+  }
+  std::sort(keys.begin(), keys.end());
+
+  std::vector<nmdo::MacAddress> results;
+  results.reserve(keys.size());
+  for (const auto& key : keys) {
+    const auto& facts {macAddrs.find(key)->second};
+    auto& macAddr {results.emplace_back(key.toMacAddress())};
+    macAddr.setResponding(facts.responding);
+    for (const auto& ipKey : facts.ipAddrs) {
+      auto ipAddr {ipKey.toIpAddress()};
+      ipAddr.setReason(PCAP_REASON);
+      macAddr.addIpAddress(ipAddr);
+    }
+  }
+  return results;
+}
+
+std::vector<nmdo::IpAddress>
+Data::getIpAddrs() const
+{
+  std::vector<nmdu::IpKey> keys;
+  keys.reserve(ipAddrs.size());
+  for (const auto& [key, _] : ipAddrs) {
+    keys.push_back(key);
+  }
+  std::sort(keys.begin(), keys.end());
+
+  std::vector<nmdo::IpAddress> results;
+  results.reserve(keys.size());
+  for (const auto& key : keys) {
+    const auto& facts {ipAddrs.find(key)->second};
+    auto& ipAddr {results.emplace_back(key.toIpAddress())};
+    ipAddr.setResponding(facts.responding);
+    ipAddr.setReason(PCAP_REASON);
+    for (const auto& alias : facts.aliases) {
+      ipAddr.addAlias(alias, PCAP_REASON);
+    }
+  }
+  return results;
+}
 
 
 // =============================================================================
@@ -45,7 +145,7 @@ Parser::Parser()
 // Parser logic
 // =============================================================================
 Result
-Parser::processFile(const std::string& _filePath)
+Parser::processFile(const std::string& _filePath, size_t _threads)
 {
   char pcapErrBuf[PCAP_ERRBUF_SIZE];
   std::shared_ptr<pcap_t> pcapHandle
@@ -56,10 +156,30 @@ Parser::processFile(const std::string& _filePath)
     std::exit(nmcu::Exit::FAILURE);
   }
 
-  processPackets(pcapHandle);
+  if (0 == _threads) {
+    _threads = std::max(1U, std::thread::hardware_concurrency());
+  }
+
+  const auto start {std::chrono::steady_clock::now()};
+  if (1 == _threads) {
+    processPackets(pcapHandle);
+  } else {
+    processPacketsParallel(pcapHandle, _threads);
+  }
+  const std::chrono::duration<double> elapsed {
+    std::chrono::steady_clock::now() - start};
+
+  const auto seconds {std::max(elapsed.count(), 0.001)};
+  LOG_INFO << "Processed " << packetCount << " packets ("
+           << byteCount << " bytes) with " << _threads << " thread(s) in "
+           << elapsed.count() << "s: "
+           << static_cast<size_t>(static_cast<double>(packetCount) / seconds)
+           << " packets/s, "
+           << static_cast<double>(byteCount) / seconds / 1000000.0
+           << " MB/s\n";
 
   Result r;
-  r.push_back(d);
+  r.push_back(std::move(d));
 
   return r;
 }
@@ -70,6 +190,9 @@ Parser::processPackets(std::shared_ptr<pcap_t>& _handle)
   pcap_pkthdr* packetHeader = nullptr;
   uint8_t const* packetData = nullptr;
 
+  // See https://www.tcpdump.org/linktypes.html
+  const int linkType {pcap_datalink(_handle.get())};
+
   //while (1 == pcap_next_ex(_handle.get(), &packetHeader, &packetData)) {
   for (int retVal = pcap_next_ex(_handle.get(), &packetHeader, &packetData);
        -2 != retVal;
@@ -82,97 +205,230 @@ Parser::processPackets(std::shared_ptr<pcap_t>& _handle)
       continue;
     }
 
-    bool done {false}; // for packet process looping
-    packetSizeLeft = (packetHeader->caplen); // caplen <= len
-    offset = packetData;
-
-    // See https://www.tcpdump.org/linktypes.html
-    int linkType {pcap_datalink(_handle.get())};
-    uint16_t payloadType;
-    if (1 == linkType) {
-      const auto* eh {reinterpret_cast<EthernetHeader const*>(packetData)};
-      if (processEthernetHeader(eh)) { // true if no further processing needed
-        continue;
-      }
-      if (!isOffsetOk<EthernetHeader>()) { continue; };
-      payloadType = ph.getPayloadProtocol(eh);
-    } else if (113 == linkType) {
-      const auto* lch {reinterpret_cast<LinuxCookedHeader const*>(packetData)};
-      if (processLinuxCookedHeader(lch)) { // true if no further processing needed
-        continue;
-      }
-      if (!isOffsetOk<LinuxCookedHeader>()) { continue; };
-      payloadType = ph.getPayloadProtocol(lch);
-    } else {
-      LOG_DEBUG << "Unknown link type (" << linkType << "), skipping\n";
+    processPacket(packetData, packetHeader->caplen, linkType); // caplen <= len
+  }
+}
+
+/* Reader (this thread) copies packets into per-worker batches; workers each
+   process into their own Data, which are merged once all are done.  Packets
+   are sharded by their endpoint pair, link layer or (for Linux cooked
+   captures) network layer, so a conversation stays on one worker, keeping
+   the per-worker maps mostly disjoint.
+*/
+void
+Parser::processPacketsParallel(std::shared_ptr<pcap_t>& _handle,
+                               size_t _threads)
+{
+  pcap_pkthdr* packetHeader = nullptr;
+  uint8_t const* packetData = nullptr;
+
+  // See https://www.tcpdump.org/linktypes.html
+  const int linkType {pcap_datalink(_handle.get())};
+
+  std::vector<Parser> workers(_threads);
+  std::vector<std::unique_ptr<nmcu::ThreadSafeQueue<PacketBatch>>> queues;
+  std::vector<std::thread> threads;
+  for (size_t i {0}; i < _threads; ++i) {
+    // Bounded, so the reader can not outrun the workers by much
+    queues.emplace_back(
+        std::make_unique<nmcu::ThreadSafeQueue<PacketBatch>>(4));
+  }
+  for (size_t i {0}; i < _threads; ++i) {
+    threads.emplace_back(
+        [&worker = workers[i], &queue = *queues[i], linkType]()
+        {
+          PacketBatch batch;
+          while (queue.waitPop(batch)) {
+            for (const auto& [start, length] : batch.packets) {
+              worker.processPacket(&batch.bytes[start], length, linkType);
+            }
+          }
+        });
+  }
+
+  std::vector<PacketBatch> pending(_threads);
+  for (int retVal = pcap_next_ex(_handle.get(), &packetHeader, &packetData);
+       -2 != retVal;
+       retVal = pcap_next_ex(_handle.get(), &packetHeader, &packetData)) {
+    if (-1 == retVal) {
+      LOG_DEBUG << pcap_geterr(_handle.get()) << '\n';
+      continue;
+    }
+    if (0 == retVal) {
       continue;
     }
 
-    /********** Payload Processing Notes **********
-       - VLAN packets
-         - VLAN adds another layer to the packet structure so we have to
-           unwrap that and attempt another process pass; since we can have
-           multiple VLAN wrappings, it needs to be nested
-       - IPvX packets
-         - Cannot associate an IP to a MAC as a router will substitute it's
-           MAC for the IPs it routes to and from
-    **********************************************/
-    while (!done) {
-      switch (payloadType) {
-        case 0x8100: // 802.1Q VLAN tag
-          {
-            LOG_DEBUG << "Packet type: VLAN tag\n";
-            const auto* vh {reinterpret_cast<VlanHeader const*>(offset)};
-            processVlanHeader(vh);
-
-            // Update and reset payload processing to handle VLAN payload
-            payloadType = ph.getPayloadProtocol(vh);
-            if (isOffsetOk<VlanHeader>()) {
-              done = false;
-            } else {
-              done = true;
-            }
+    const size_t length {packetHeader->caplen}; // caplen <= len
+    const auto shard {getFlowHash(packetData, length, linkType) % _threads};
+    auto& batch {pending[shard]};
+    batch.packets.emplace_back(batch.bytes.size(), length);
+    batch.bytes.insert(batch.bytes.end(), packetData, packetData + length);
+    if (BATCH_PACKETS <= batch.packets.size()) {
+      queues[shard]->push(std::move(batch));
+      batch = PacketBatch();
+    }
+  }
+  for (size_t i {0}; i < _threads; ++i) {
+    if (!pending[i].packets.empty()) {
+      queues[i]->push(std::move(pending[i]));
+    }
+    queues[i]->close();
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
 
-            break;
-          }
-        case 0x0806: // ARP
-          {
-            LOG_DEBUG << "Packet type: ARP\n";
-            processArpHeader(reinterpret_cast<ArpHeader const*>(offset));
-            done = true;
-            break;
-          }
-        case 0x0800: // IPv4
-          {
-            LOG_DEBUG << "Packet type: IPv4\n";
-            processIpv4Header(reinterpret_cast<Ipv4Header const*>(offset));
-            done = true;
-            break;
-          }
-        case 0x86DD: // IPv6
-          {
-            LOG_DEBUG << "Packet type: IPv6\n";
-            processIpv6Header(reinterpret_cast<Ipv6Header const*>(offset));
+  // Deterministic reduction, always in worker order
+  for (auto& worker : workers) {
+    packetCount += worker.packetCount;
+    byteCount   += worker.byteCount;
+    d.merge(std::move(worker.d));
+  }
+}
+
+size_t
+Parser::getFlowHash(const uint8_t* _packet, size_t _length, int _linkType)
+{
+  // FNV-1a over one address
+  auto fnv = [_packet](size_t _start, size_t _count) {
+      size_t hash {14695981039346656037ULL};
+      for (size_t i {_start}; i < _start + _count; ++i) {
+        hash ^= _packet[i];
+        hash *= 1099511628211ULL;
+      }
+      return hash;
+    };
+  // Both endpoints, combined symmetrically so both directions of a
+  // conversation land on the same worker
+  auto endpoints = [&fnv](size_t _src, size_t _dst, size_t _count) {
+      return fnv(_src, _count) ^ fnv(_dst, _count);
+    };
+
+  if (1 == _linkType && sizeof(EthernetHeader) <= _length) {
+    return endpoints(offsetof(EthernetHeader, srcMacAddr),
+                     offsetof(EthernetHeader, dstMacAddr), 6);
+  }
+  if (113 == _linkType && sizeof(LinuxCookedHeader) <= _length) {
+    // Only the sender's link layer address is captured, so use the
+    // network layer endpoints when there are some
+    const size_t first {sizeof(LinuxCookedHeader)};
+    const size_t protocolAt {offsetof(LinuxCookedHeader, payloadProtocol)};
+    const uint16_t protocol = static_cast<uint16_t>(
+        (_packet[protocolAt] << 8) | _packet[protocolAt + 1]);
+    if (0x0800 == protocol && first + sizeof(Ipv4Header) <= _length) {
+      return endpoints(first + offsetof(Ipv4Header, srcIpAddr),
+                       first + offsetof(Ipv4Header, dstIpAddr), 4);
+    }
+    if (0x86DD == protocol && first + sizeof(Ipv6Header) <= _length) {
+      return endpoints(first + offsetof(Ipv6Header, srcIpAddr),
+                       first + offsetof(Ipv6Header, dstIpAddr), 16);
+    }
+    if (0x0806 == protocol && first + sizeof(ArpHeader) <= _length) {
+      return endpoints(first + offsetof(ArpHeader, srcIpAddr),
+                       first + offsetof(ArpHeader, dstIpAddr), 4);
+    }
+    // Otherwise one sided; any worker yields the same merged results
+    return fnv(offsetof(LinuxCookedHeader, srcMacAddr), 8);
+  }
+
+  return 0;
+}
+
+void
+Parser::processPacket(const uint8_t* _packetData, size_t _length,
+                      int _linkType)
+{
+  ++packetCount;
+  byteCount += _length;
+
+  bool done {false}; // for packet process looping
+  packetSizeLeft = _length;
+  offset = _packetData;
+
+  uint16_t payloadType;
+  if (1 == _linkType) {
+    const auto* eh {reinterpret_cast<EthernetHeader const*>(_packetData)};
+    if (processEthernetHeader(eh)) { // true if no further processing needed
+      return;
+    }
+    if (!isOffsetOk<EthernetHeader>()) { return; };
+    payloadType = ph.getPayloadProtocol(eh);
+  } else if (113 == _linkType) {
+    const auto* lch {reinterpret_cast<LinuxCookedHeader const*>(_packetData)};
+    if (processLinuxCookedHeader(lch)) { // true if no further processing needed
+      return;
+    }
+    if (!isOffsetOk<LinuxCookedHeader>()) { return; };
+    payloadType = ph.getPayloadProtocol(lch);
+  } else {
+    LOG_DEBUG << "Unknown link type (" << _linkType << "), skipping\n";
+    return;
+  }
+
+  /********** Payload Processing Notes **********
+     - VLAN packets
+       - VLAN adds another layer to the packet structure so we have to
+         unwrap that and attempt another process pass; since we can have
+         multiple VLAN wrappings, it needs to be nested
+     - IPvX packets
+       - Cannot associate an IP to a MAC as a router will substitute it's
+         MAC for the IPs it routes to and from
+  **********************************************/
+  while (!done) {
+    switch (payloadType) {
+      case 0x8100: // 802.1Q VLAN tag
+        {
+          LOG_DEBUG << "Packet type: VLAN tag\n";
+          const auto* vh {reinterpret_cast<VlanHeader const*>(offset)};
+          processVlanHeader(vh);
+
+          // Update and reset payload processing to handle VLAN payload
+          payloadType = ph.getPayloadProtocol(vh);
+          if (isOffsetOk<VlanHeader>()) {
+            done = false;
+          } else {
             done = true;
-            break;
           }
-        default:
-          {
-            // EtherType values must be >= 1536
-            // 1500 <= are payload size values (MTU)
-            // 1501-1535 are undefined
-            if (1536 <= payloadType) {
-              LOG_DEBUG << "Packet type: UNK -- "
-                        << "dec: " << payloadType
-                        << ", hex: 0x"
-                        << std::hex << payloadType << std::dec
-                        << std::endl;
-            }
-            done = true;
-            break;
+
+          break;
+        }
+      case 0x0806: // ARP
+        {
+          LOG_DEBUG << "Packet type: ARP\n";
+          processArpHeader(reinterpret_cast<ArpHeader const*>(offset));
+          done = true;
+          break;
+        }
+      case 0x0800: // IPv4
+        {
+          LOG_DEBUG << "Packet type: IPv4\n";
+          processIpv4Header(reinterpret_cast<Ipv4Header const*>(offset));
+          done = true;
+          break;
+        }
+      case 0x86DD: // IPv6
+        {
+          LOG_DEBUG << "Packet type: IPv6\n";
+          processIpv6Header(reinterpret_cast<Ipv6Header const*>(offset));
+          done = true;
+          break;
+        }
+      default:
+        {
+          // EtherType values must be >= 1536
+          // 1500 <= are payload size values (MTU)
+          // 1501-1535 are undefined
+          if (1536 <= payloadType) {
+            LOG_DEBUG << "Packet type: UNK -- "
+                      << "dec: " << payloadType
+                      << ", hex: 0x"
+                      << std::hex << payloadType << std::dec
+                      << std::endl;
           }
-      } // end of switch
-    } // end of while
+          done = true;
+          break;
+        }
+    } // end of switch
   } // end of while
 }
 
@@ -191,14 +447,15 @@ Parser::isOffsetOk(size_t _size)
     return false;
   }
 }
-nmdo::IpAddress&
-Parser::getIpAddrLoc(const nmdo::IpAddress& _ipAddr)
+MacFacts&
+Parser::getMacAddrLoc(const nmdu::MacKey& _macKey)
 {
-  const auto& ipAddrStr {_ipAddr.toString()};
-  if (!d.ipAddrs.count(ipAddrStr)) {
-    d.ipAddrs[ipAddrStr] = _ipAddr;
-  }
-  return (d.ipAddrs[ipAddrStr]);
+  return d.macAddrs[_macKey];
+}
+IpFacts&
+Parser::getIpAddrLoc(const nmdu::IpKey& _ipKey)
+{
+  return d.ipAddrs[_ipKey];
 }
 
 bool
@@ -206,29 +463,28 @@ Parser::processEthernetHeader(const EthernetHeader* _eh)
 {
   bool skip {false};
 
-  auto srcMacAddr {ph.getSrcMacAddr(_eh)};
-  d.macAddrs[srcMacAddr] = srcMacAddr;
-  d.macAddrs[srcMacAddr].setResponding(true);
+  auto srcMacKey {ph.getSrcMacKey(_eh)};
+  getMacAddrLoc(srcMacKey).responding = true;
 
-  auto dstMacAddr {ph.getDstMacAddr(_eh)};
-  const auto& testVal {dstMacAddr.toString()};
+  auto dstMacKey {ph.getDstMacKey(_eh)};
   auto payloadType {ph.getPayloadProtocol(_eh)};
 
-  if (stpMacs.count(testVal)) {
+  if (stpMacs.count(dstMacKey)) {
     std::ostringstream oss;
-    oss << "Probable STP from MAC: " << srcMacAddr.toString();
+    oss << "Probable STP from MAC: " << srcMacKey.toMacAddress().toString();
     addObservation(oss.str());
     skip = true;
   }
 
-  if (discProto.count(testVal) &&
+  if (discProto.count(dstMacKey) &&
       // this mac and size means it was STP, not CDP
-      (0x26 != payloadType && "01:80:c2:00:00:00" != testVal)) {
+      (0x26 != payloadType && stpBridgeMac != dstMacKey)) {
 
     processDiscProtoPacket(_eh);
 
     std::ostringstream oss;
-    oss << "Probable {C|LL}DP from MAC: " << srcMacAddr.toString();
+    oss << "Probable {C|LL}DP from MAC: "
+        << srcMacKey.toMacAddress().toString();
     addObservation(oss.str());
     skip = true;
   }
@@ -241,9 +497,10 @@ Parser::processLinuxCookedHeader(const LinuxCookedHeader* _lch)
 {
   bool skip {false};
 
-  auto srcMacAddr {ph.getSrcMacAddr(_lch)};
-  d.macAddrs[srcMacAddr] = srcMacAddr;
-  d.macAddrs[srcMacAddr].setResponding(true);
+  nmdu::MacKey srcMacKey;
+  if (ph.getSrcMacKey(_lch, srcMacKey)) {
+    getMacAddrLoc(srcMacKey).responding = true;
+  }
 
   return skip;
 }
@@ -259,22 +516,21 @@ Parser::processDiscProtoPacket(const EthernetHeader*)
 void
 Parser::processVlanHeader(const VlanHeader* _vh)
 {
-  auto vlan {ph.getVlan(_vh)};
-  vlan.setDescription(PCAP_REASON);
-  d.vlans[vlan] = vlan;
+  d.vlans.set(ph.getVlanId(_vh));
 }
 
 void
 Parser::processArpHeader(const ArpHeader* _ah)
 {
-  auto macAddr {ph.getSrcMacAddr(_ah)};
-  d.macAddrs[macAddr] = macAddr;
+  auto macKey {ph.getSrcMacKey(_ah)};
+  auto ipKey {ph.getSrcIpKey(_ah)};
 
-  auto ipAddr {ph.getSrcIpAddr(_ah)};
-  ipAddr.setReason(PCAP_REASON);
-
-  d.macAddrs[macAddr].addIpAddress(ipAddr);
-  LOG_DEBUG << macAddr << "--" << ipAddr << std::endl;
+  auto& ipAddrs {getMacAddrLoc(macKey).ipAddrs};
+  if (std::find(ipAddrs.cbegin(), ipAddrs.cend(), ipKey) == ipAddrs.cend()) {
+    ipAddrs.push_back(ipKey);
+  }
+  LOG_DEBUG << macKey.toMacAddress() << "--" << ipKey.toIpAddress()
+            << std::endl;
 }
 
 // TODO Look into adding more IPv4/6 processing (only if useful)
@@ -288,10 +544,7 @@ Parser::processArpHeader(const ArpHeader* _ah)
 void
 Parser::processIpv4Header(const Ipv4Header* _iph)
 {
-  auto ipAddr {ph.getSrcIpAddr(_iph)};
-  auto& ipAddrEntry {getIpAddrLoc(ipAddr)};
-  ipAddrEntry.setResponding(true);
-  ipAddrEntry.setReason(PCAP_REASON);
+  getIpAddrLoc(ph.getSrcIpKey(_iph)).responding = true;
 
   uint8_t protoId {ph.getPayloadProtocol(_iph)};
   if (!isOffsetOk<Ipv4Header>()) { return; }
@@ -327,10 +580,7 @@ Parser::processIpv4Header(const Ipv4Header* _iph)
 void
 Parser::processIpv6Header(const Ipv6Header* _iph)
 {
-  auto ipAddr {ph.getSrcIpAddr(_iph)};
-  auto& ipAddrEntry {getIpAddrLoc(ipAddr)};
-  ipAddrEntry.setResponding(true);
-  ipAddrEntry.setReason(PCAP_REASON);
+  getIpAddrLoc(ph.getSrcIpKey(_iph)).responding = true;
 
   //LOG_DEBUG << "payloadProtocol: " << ntohs(_iph->payloadProtocol) << std::endl;
 }
@@ -398,14 +648,12 @@ Parser::processDnsHeader(const DnsHeader* _dh)
 
   // process answers
   auto ips {ph.getDnsARecords(dnsPacketStart, _dh, offset)};
-  for (auto& ip : ips) {
-    nmdo::IpAddress ipAddr(std::get<0>(ip));
-    auto ipAddrStr {ipAddr.toString()};
-    if (!d.ipAddrs.count(ipAddrStr)) {
-      d.ipAddrs[ipAddrStr] = ipAddr;
-    }
-    d.ipAddrs[ipAddrStr].addAlias(std::get<1>(ip), PCAP_REASON);
-    LOG_DEBUG << "Added: " << d.ipAddrs[ipAddrStr] << std::endl;
+  for (auto& [ipBytes, alias] : ips) {
+    auto ipKey {nmdu::IpKey::fromBytes(ipBytes.data(), ipBytes.size())};
+    if (!ipKey.isValid()) { continue; }
+    getIpAddrLoc(ipKey).aliases.insert(alias);
+    LOG_DEBUG << "Added: " << ipKey.toIpAddress() << " -- " << alias
+              << std::endl;
   }
 }
 
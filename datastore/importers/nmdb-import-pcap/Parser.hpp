@@ -27,38 +27,68 @@
 #ifndef PARSER_HPP
 #define PARSER_HPP
 
+#include <bitset>
 #include <memory>
+#include <set>
+#include <thread>
+#include <vector>
 #include <pcap/pcap.h>
 
+#include <netmeld/core/utils/FlatHashMap.hpp>
 #include <netmeld/datastore/objects/IpAddress.hpp>
 #include <netmeld/datastore/objects/MacAddress.hpp>
 #include <netmeld/datastore/objects/ToolObservations.hpp>
 #include <netmeld/datastore/objects/Vlan.hpp>
 #include <netmeld/datastore/parsers/ParserHelper.hpp>
+#include <netmeld/datastore/utils/AddressKeys.hpp>
 
 #include "PacketHelper.hpp"
 
+namespace nmcu = netmeld::core::utils;
 namespace nmdo = netmeld::datastore::objects;
+namespace nmdu = netmeld::datastore::utils;
 
-// The following map is using the same type of object for the keys and values
-// This is an optimization due to how this data is extracted from packets, it
-// the key is a raw piece of data extracted (e.g. a MacAddress with only the
-// address member set). The value is the object that is modified and eventually
-// saved. This allows us to grab the objects we're modifying easily without
-// needing to cast/convert data around to get a more "normal" key. We cannot
-// use the object being modifed (e.g. in a set) as the key because our compare
-// operator does a deep compare and would not work with the raw objects.
+const std::string PCAP_REASON {"from pcap import"};
+
+// What has been seen of an address while processing packets
+struct MacFacts {
+  bool                     responding {false};
+  std::vector<nmdu::IpKey> ipAddrs; // from ARP, typically very few
+};
+
+struct IpFacts {
+  bool                  responding {false};
+  std::set<std::string> aliases; // from DNS answers
+};
+
+// Packets are aggregated keyed on the raw (fixed size) addresses so the per
+// packet work is hashing a few bytes; the datastore objects are only built
+// once, via the getters, when the results are saved.
 struct Data {
-  std::map<nmdo::Vlan, nmdo::Vlan>              vlans;
+  std::bitset<4096> vlans; // 12 bit VLAN ID
 
-  std::map<nmdo::MacAddress, nmdo::MacAddress>  macAddrs;
-  std::map<std::string, nmdo::IpAddress>    ipAddrs;
+  nmcu::FlatHashMap<nmdu::MacKey, MacFacts>  macAddrs;
+  nmcu::FlatHashMap<nmdu::IpKey, IpFacts>    ipAddrs;
 
   nmdo::ToolObservations observations;
+
+  // Fold in another worker's results; order independent
+  void merge(Data&&);
+
+  // Ordered by address, so output does not depend on the thread count
+  std::vector<nmdo::Vlan> getVlans() const;
+  std::vector<nmdo::MacAddress> getMacAddrs() const;
+  std::vector<nmdo::IpAddress> getIpAddrs() const;
 };
 
 typedef std::vector<Data>  Result;
 
+// Raw packets copied out of libpcap's buffer for hand off to a worker
+struct PacketBatch {
+  std::vector<uint8_t> bytes;
+  std::vector<std::tuple<size_t, size_t>> packets; // offset, captured length
+};
+
 
 // =============================================================================
 // Parser definition
@@ -69,23 +99,29 @@ class Parser
   // Variables
   // ===========================================================================
   private:
-    const std::string PCAP_REASON {"from pcap import"};
-
-    const std::set<std::string> stpMacs {
-      "01:00:0c:cc:cc:cd",
-      "01:80:c2:00:00:00", "01:80:c2:00:00:08"
+    const nmdu::MacKey stpBridgeMac {{0x01, 0x80, 0xc2, 0x00, 0x00, 0x00}};
+    const std::set<nmdu::MacKey> stpMacs {
+      {{0x01, 0x00, 0x0c, 0xcc, 0xcc, 0xcd}},
+      stpBridgeMac, {{0x01, 0x80, 0xc2, 0x00, 0x00, 0x08}}
     };
-    const std::set<std::string> discProto {
-      "01:00:0c:cc:cc:cc",
-      "01:80:c2:00:00:00", "01:80:c2:00:00:03", "01:80:c2:00:00:0e"
+    const std::set<nmdu::MacKey> discProto {
+      {{0x01, 0x00, 0x0c, 0xcc, 0xcc, 0xcc}},
+      stpBridgeMac, {{0x01, 0x80, 0xc2, 0x00, 0x00, 0x03}},
+      {{0x01, 0x80, 0xc2, 0x00, 0x00, 0x0e}}
     };
 
+    // Packets per hand off to a worker thread
+    static constexpr size_t BATCH_PACKETS {512};
+
     PacketHelper ph;
     Data d;
 
     const uint8_t* offset {nullptr};
     size_t packetSizeLeft {0};
 
+    size_t packetCount {0};
+    size_t byteCount {0};
+
   // ===========================================================================
   // Constructors
   // ===========================================================================
@@ -97,6 +133,10 @@ class Parser
   // ===========================================================================
   private:
     void processPackets(std::shared_ptr<pcap_t>&);
+    void processPacketsParallel(std::shared_ptr<pcap_t>&, size_t);
+    void processPacket(const uint8_t*, size_t, int);
+
+    static size_t getFlowHash(const uint8_t*, size_t, int);
 
     bool isOffsetOk(size_t);
     template<typename T>
@@ -105,7 +145,8 @@ class Parser
       size_t size {sizeof(T)};
       return isOffsetOk(size);
     }
-    nmdo::IpAddress& getIpAddrLoc(const nmdo::IpAddress&);
+    MacFacts& getMacAddrLoc(const nmdu::MacKey&);
+    IpFacts& getIpAddrLoc(const nmdu::IpKey&);
 
     bool processEthernetHeader(const EthernetHeader*);
     void processDiscProtoPacket(const EthernetHeader*);
@@ -129,6 +170,7 @@ class Parser
 
   protected:
   public:
-    Result processFile(const std::string&);
+    // Zero threads uses all available cores
+    Result processFile(const std::string&, size_t=1);
 };
 #endif // PARSER_HPP
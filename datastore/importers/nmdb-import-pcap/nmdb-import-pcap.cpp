@@ -53,6 +53,12 @@ class Tool : public nmdt::AbstractImportTool<P,R>
           );
 
       this->opts.removeOptionalOption("device-type");
+
+      this->opts.addOptionalOption("threads", std::make_tuple(
+            "threads",
+            po::value<size_t>()->default_value(1),
+            "Packet processing threads; 0 uses all available cores.")
+          );
     }
 
     void
@@ -62,7 +68,8 @@ class Tool : public nmdt::AbstractImportTool<P,R>
       Parser p;
 
       this->executionStart = nmco::Time();
-      this->tResults = p.processFile(dataFile);
+      this->tResults = p.processFile(dataFile,
+          this->opts.template getValueAs<size_t>("threads"));
       this->executionStop = nmco::Time();
     }
 
@@ -73,15 +80,15 @@ class Tool : public nmdt::AbstractImportTool<P,R>
       const auto& deviceId  {this->getDeviceId()};
 
       for (auto& results : this->tResults) {
-        for (auto& [_, result]: results.macAddrs) {
+        for (auto& result : results.getMacAddrs()) {
           result.save(t, toolRunId, deviceId);
           LOG_DEBUG << result.toDebugString() << std::endl;
         }
-        for (auto& [_, result] : results.ipAddrs) {
+        for (auto& result : results.getIpAddrs()) {
           result.save(t, toolRunId, deviceId);
           LOG_DEBUG << result.toDebugString() << std::endl;
         }
-        for (auto& [_, result] : results.vlans) {
+        for (auto& result : results.getVlans()) {
           result.save(t, toolRunId, deviceId);
           LOG_DEBUG << result.toDebugString() << std::endl;
         }
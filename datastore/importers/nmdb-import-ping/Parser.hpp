@@ -24,8 +24,8 @@
 // Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
 // =============================================================================
 
-#ifndef PARSER_HPP
-#define PARSER_HPP
+#ifndef PING_PARSER_HPP
+#define PING_PARSER_HPP
 
 #include <netmeld/datastore/objects/IpAddress.hpp>
 #include <netmeld/datastore/parsers/ParserDomainName.hpp>
@@ -36,74 +36,76 @@ namespace nmdo = netmeld::datastore::objects;
 namespace nmdp = netmeld::datastore::parsers;
 namespace nmdt = netmeld::datastore::tools;
 
-
-// =============================================================================
-// Data containers
-// =============================================================================
-typedef std::vector<nmdo::IpAddress>  Result;
-
-
-// =============================================================================
-// Parser definition
-// =============================================================================
-class Parser :
-  public qi::grammar<nmdp::IstreamIter, Result(), qi::ascii::blank_type>
-{
-  // ===========================================================================
-  // Variables
-  // ===========================================================================
-  private:
-    Result data;
-
-    const std::string REASON  {"ping"};
-
-    nmdo::IpAddress tgtIp;
-    std::vector<std::string> tgtAliases;
-    bool responsive {false};
-
-  protected:
-    // Rules
-    qi::rule<nmdp::IstreamIter, Result(), qi::ascii::blank_type>
-      start;
-
-    qi::rule<nmdp::IstreamIter, qi::ascii::blank_type>
-      pingLinux, linuxHeader, linuxResponse, linuxFooter,
-      pingWindows, windowsHeader, windowsResponse, windowsFooter,
-      ignoredLine;
-
-    qi::rule<nmdp::IstreamIter>
-      ipValue,
-      hostname,
-      ifaceName,
-      token;
-
-    nmdp::ParserDomainName
-      domainName;
-
-    nmdp::ParserIpAddress
-      ipAddr;
-
-  public:
-
+namespace netmeld::datastore::importers::ping {
 
   // ===========================================================================
-  // Constructors
+  // Data containers
   // ===========================================================================
-  private:
-  protected:
-  public: // Constructor is only default and must be public
-    Parser();
+  typedef std::vector<nmdo::IpAddress>  Result;
 
 
   // ===========================================================================
-  // Methods
+  // Parser definition
   // ===========================================================================
-  private:
-    void finalize();
-
-  protected:
-  public:
-    // Object return
-    Result getData();
-};
-#endif // PARSER_HPP
+  class Parser :
+    public qi::grammar<nmdp::ConstIter, Result(), qi::ascii::blank_type>
+  {
+    // =========================================================================
+    // Variables
+    // =========================================================================
+    private:
+      Result data;
+
+      const std::string REASON  {"ping"};
+
+      nmdo::IpAddress tgtIp;
+      std::vector<std::string> tgtAliases;
+      bool responsive {false};
+
+    protected:
+      // Rules
+      qi::rule<nmdp::ConstIter, Result(), qi::ascii::blank_type>
+        start;
+
+      qi::rule<nmdp::ConstIter, qi::ascii::blank_type>
+        pingLinux, linuxHeader, linuxResponse, linuxFooter,
+        pingWindows, windowsHeader, windowsResponse, windowsFooter,
+        ignoredLine;
+
+      qi::rule<nmdp::ConstIter>
+        ipValue,
+        hostname,
+        ifaceName,
+        token;
+
+      nmdp::ParserDomainName
+        domainName;
+
+      nmdp::ParserIpAddress
+        ipAddr;
+
+    public:
+
+
+    // =========================================================================
+    // Constructors
+    // =========================================================================
+    private:
+    protected:
+    public: // Constructor is only default and must be public
+      Parser();
+
+
+    // =========================================================================
+    // Methods
+    // =========================================================================
+    private:
+      void finalize();
+
+    protected:
+    public:
+      // Object return
+      Result getData();
+  };
+}
+#endif // PING_PARSER_HPP
@@ -33,10 +33,11 @@
 #include "Parser.hpp"
 
 namespace nmdp = netmeld::datastore::parsers;
+namespace nmdsip = netmeld::datastore::importers::ping;
 
 using qi::ascii::blank;
 
-class TestParser : public Parser {
+class TestParser : public nmdsip::Parser {
     public:
       using Parser::linuxHeader;
       using Parser::linuxResponse;
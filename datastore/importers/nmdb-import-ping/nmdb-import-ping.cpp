@@ -26,11 +26,12 @@
 
 #include <netmeld/datastore/tools/AbstractImportTool.hpp>
 
-#include "Parser.hpp"
+#include "Importer.hpp"
 
 namespace nmdo = netmeld::datastore::objects;
 namespace nmdp = netmeld::datastore::parsers;
 namespace nmdt = netmeld::datastore::tools;
+namespace nmdsip = netmeld::datastore::importers::ping;
 
 // =============================================================================
 // Import tool definition
@@ -80,13 +81,8 @@ class Tool : public nmdt::AbstractImportTool<P, R>
     void
     specificInserts(pqxx::transaction_base& t) override
     {
-      const auto& toolRunId {this->getToolRunId()};
-      const auto& deviceId  {this->getDeviceId()};
-
-      for (auto& result : this->tResults) {
-        result.save(t, toolRunId, deviceId);
-        LOG_DEBUG << result.toDebugString() << std::endl;
-      }
+      nmdsip::save(t, this->tResults, this->getToolRunId(),
+                   this->getDeviceId());
     }
 
   protected: // Methods part of subclass API
@@ -97,6 +93,6 @@ class Tool : public nmdt::AbstractImportTool<P, R>
 int
 main(int argc, char** argv)
 {
-  Tool<Parser, Result> tool;
+  Tool<nmdsip::Parser, nmdsip::Result> tool;
   return tool.start(argc, argv);
 }
@@ -58,6 +58,17 @@ Parser::Parser() : Parser::base_type(start)
         qi::eol)
      | ("switchport mode" >> token)
          [(pnx::bind(&Parser::updateIfaceSwitchportMode, this, qi::_1))]
+     | ("switchport access vlan" >> vlanList >> qi::eol)
+         [(pnx::bind(&Parser::setIfaceVlans, this, qi::_1))]
+     | (qi::lit("switchport") >> (qi::lit("trunk") | qi::lit("general")) >>
+        "allowed vlan" >>
+        (  ("remove" >> vlanList)
+             [(pnx::bind(&Parser::removeIfaceVlans, this, qi::_1))]
+         | ("add" >> vlanList)
+             [(pnx::bind(&Parser::addIfaceVlans, this, qi::_1))]
+         | vlanList
+             [(pnx::bind(&Parser::setIfaceVlans, this, qi::_1))]
+        ) >> -token >> qi::eol) // optionally tagged or untagged
      | ("shutdown" >> qi::eol)
          [(pnx::bind(&Parser::disableIface, this))]
      | (ignoredLine - ("exit" > qi::eol))
@@ -71,6 +82,14 @@ Parser::Parser() : Parser::base_type(start)
         [(pnx::bind(&Parser::updateIfaceTypeSlot, this, qi::_1, qi::_2))]
     ;
 
+  vlanList =
+    (  (qi::ushort_ >> qi::lit('-') >> qi::ushort_)
+         [(pnx::bind(&nmdo::VlanSet::addRange, &qi::_val, qi::_1, qi::_2))]
+     | qi::ushort_
+         [(pnx::bind(&nmdo::VlanSet::add, &qi::_val, qi::_1))]
+    ) % qi::lit(',')
+    ;
+
   token =
     +(qi::ascii::graph)
     ;
@@ -85,6 +104,7 @@ Parser::Parser() : Parser::base_type(start)
       //(start)
       (config)
       (hostname)(interface)(typeSlot)
+      //(vlanList)
       //(token)
       //(ignoredLine)
     );
@@ -144,6 +164,27 @@ Parser::updateIfaceSwitchportMode(const std::string& _mode)
   iface.setSwitchportMode("L2 " + _mode);
 }
 
+void
+Parser::addIfaceVlans(const nmdo::VlanSet& _vlans)
+{
+  auto& iface {d.ifaces[tgtIfaceName]};
+  iface.addVlans(_vlans);
+}
+
+void
+Parser::removeIfaceVlans(const nmdo::VlanSet& _vlans)
+{
+  auto& iface {d.ifaces[tgtIfaceName]};
+  iface.removeVlans(_vlans);
+}
+
+void
+Parser::setIfaceVlans(const nmdo::VlanSet& _vlans)
+{
+  auto& iface {d.ifaces[tgtIfaceName]};
+  iface.setVlans(_vlans);
+}
+
 void
 Parser::disableIface()
 {
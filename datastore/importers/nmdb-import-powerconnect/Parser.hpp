@@ -31,6 +31,7 @@
 #include <netmeld/datastore/objects/InterfaceNetwork.hpp>
 #include <netmeld/datastore/objects/IpAddress.hpp>
 #include <netmeld/datastore/objects/Route.hpp>
+#include <netmeld/datastore/objects/VlanSet.hpp>
 #include <netmeld/datastore/parsers/ParserIpAddress.hpp>
 
 namespace nmdo = netmeld::datastore::objects;
@@ -51,27 +52,33 @@ typedef std::vector<Data>    Result;
 // Parser definition
 // =============================================================================
 class Parser :
-  public qi::grammar<nmdp::IstreamIter, Result(), qi::ascii::blank_type>
+  public qi::grammar<nmdp::ConstIter, Result(), qi::ascii::blank_type>
 {
   // ===========================================================================
   // Variables
   // ===========================================================================
   private: // Variables are always private
+
+  protected:
     // Rules
-    qi::rule<nmdp::IstreamIter, Result(), qi::ascii::blank_type>
+    qi::rule<nmdp::ConstIter, Result(), qi::ascii::blank_type>
       start;
 
-    qi::rule<nmdp::IstreamIter, qi::ascii::blank_type>
+    qi::rule<nmdp::ConstIter, qi::ascii::blank_type>
       config,
       hostname,
       interface, typeSlot,
       ignoredLine;
 
-    qi::rule<nmdp::IstreamIter, std::string()>
+    qi::rule<nmdp::ConstIter, nmdo::VlanSet(), qi::ascii::blank_type>
+      vlanList;
+
+    qi::rule<nmdp::ConstIter, std::string()>
       token;
 
     nmdp::ParserIpAddress ipAddr;
 
+  private:
     // Helpers
     Data d;
 
@@ -96,6 +103,9 @@ class Parser :
     void addIfaceIp(nmdo::IpAddress&, const nmdo::IpAddress&);
     void setIfaceGateway(const nmdo::IpAddress&);
     void updateIfaceSwitchportMode(const std::string&);
+    void addIfaceVlans(const nmdo::VlanSet&);
+    void removeIfaceVlans(const nmdo::VlanSet&);
+    void setIfaceVlans(const nmdo::VlanSet&);
     void disableIface();
 
     // Object return
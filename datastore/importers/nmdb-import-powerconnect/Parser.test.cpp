@@ -0,0 +1,140 @@
+// =============================================================================
+// Copyright 2023 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+// =============================================================================
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+#include <boost/test/unit_test.hpp>
+
+#include <netmeld/datastore/parsers/ParserTestHelper.hpp>
+
+#include "Parser.hpp"
+
+namespace nmdp = netmeld::datastore::parsers;
+
+using qi::ascii::blank;
+
+class TestParser : public Parser {
+    public:
+      using Parser::start;
+      using Parser::vlanList;
+};
+
+BOOST_AUTO_TEST_CASE(testParts)
+{
+  TestParser tp;
+
+  { // vlanList
+    const auto &parserRule {tp.vlanList};
+    std::vector<std::tuple<std::string, std::string>> testsOk {
+      {"10", "10"},
+      {"10,20", "10,20"},
+      {"10-12", "10-12"},
+      {"1-3,5,7-9", "1-3,5,7-9"},
+      {"3,1-2", "1-3"},
+    };
+    for (const auto& [test, format] : testsOk) {
+      nmdo::VlanSet out;
+      BOOST_TEST(nmdp::testAttr(test.c_str(), parserRule, out, blank),
+                 "Parse rule 'vlanList': " << test);
+      BOOST_TEST(format == out.toString());
+    }
+
+    std::vector<std::string> testsFail {
+      "",
+      "10-",
+      ",10",
+      "all",
+    };
+    for (const auto& test : testsFail) {
+      nmdo::VlanSet out;
+      BOOST_TEST(!nmdp::testAttr(test.c_str(), parserRule, out, blank),
+                 "Parse rule 'vlanList': " << test);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testWhole)
+{
+  auto vlansOf = [](const std::string& _config)
+    {
+      TestParser tp;
+      Result result;
+      BOOST_TEST(nmdp::testAttr(_config.c_str(), tp.start, result, blank),
+                 "Parse rule 'start': " << _config);
+      BOOST_TEST(1 == result.size());
+
+      std::map<std::string, std::string> vlans;
+      for (const auto& [name, iface] : result.at(0).ifaces) {
+        vlans.emplace(name, iface.getVlans().toString());
+      }
+      return vlans;
+    };
+
+  { // add, remove, and ranges accumulate
+    const auto& vlans {vlansOf(
+      "interface ethernet 1/g1\n"
+      "switchport mode trunk\n"
+      "switchport trunk allowed vlan add 10-20,30\n"
+      "switchport trunk allowed vlan add 40\n"
+      "switchport trunk allowed vlan remove 15-16,30\n"
+      "exit\n"
+      "interface ethernet 1/g2\n"
+      "switchport mode general\n"
+      "switchport general allowed vlan add 5,7-8 tagged\n"
+      "switchport general allowed vlan add 6 untagged\n"
+      "switchport general allowed vlan remove 8\n"
+      "exit\n"
+    )};
+    BOOST_TEST("10-14,17-20,40" == vlans.at("ethernet1/g1"));
+    BOOST_TEST("5-7" == vlans.at("ethernet1/g2"));
+  }
+
+  { // a bare list replaces
+    const auto& vlans {vlansOf(
+      "interface ethernet 1/g1\n"
+      "switchport trunk allowed vlan add 10-20\n"
+      "switchport trunk allowed vlan 30-31,33\n"
+      "exit\n"
+      "interface ethernet 1/g2\n"
+      "switchport general allowed vlan add 5\n"
+      "switchport general allowed vlan 6 tagged\n"
+      "switchport general allowed vlan add 7\n"
+      "exit\n"
+    )};
+    BOOST_TEST("30-31,33" == vlans.at("ethernet1/g1"));
+    BOOST_TEST("6-7" == vlans.at("ethernet1/g2"));
+  }
+
+  { // only the last access VLAN is kept
+    const auto& vlans {vlansOf(
+      "interface ethernet 1/g1\n"
+      "switchport access vlan 10\n"
+      "switchport access vlan 20\n"
+      "exit\n"
+    )};
+    BOOST_TEST("20" == vlans.at("ethernet1/g1"));
+  }
+}
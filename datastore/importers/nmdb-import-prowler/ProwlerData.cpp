@@ -80,7 +80,7 @@ namespace netmeld::datastore::objects {
     //         accountNumber, timestamp, region, level, controlId, service,
     //         resourceId
     //       However, resourceId can be NULL so problematic for the DB
-    t.exec_prepared("insert_raw_prowler_check",
+    nmdu::execPrepared(t, "insert_raw_prowler_check",
           toolRunId
         , accountNumber
         , timestamp
@@ -61,7 +61,7 @@ struct NeighborData {
 // Parser definition
 // =============================================================================
 class Parser :
-  public qi::grammar<nmdp::IstreamIter, Result(), qi::ascii::blank_type>
+  public qi::grammar<nmdp::ConstIter, Result(), qi::ascii::blank_type>
 {
   // ===========================================================================
   // Variables
@@ -72,10 +72,10 @@ class Parser :
 
   protected:
     // Rules
-    qi::rule<nmdp::IstreamIter, Result(), qi::ascii::blank_type>
+    qi::rule<nmdp::ConstIter, Result(), qi::ascii::blank_type>
       start;
 
-    qi::rule<nmdp::IstreamIter, qi::ascii::blank_type>
+    qi::rule<nmdp::ConstIter, qi::ascii::blank_type>
       config,
       header,
       deviceData,
@@ -84,10 +84,10 @@ class Parser :
       interfaceValue,
       ignoredLine;
 
-    qi::rule<nmdp::IstreamIter>
+    qi::rule<nmdp::ConstIter>
       hostnameValue;
 
-    qi::rule<nmdp::IstreamIter, std::string()>
+    qi::rule<nmdp::ConstIter, std::string()>
       token;
 
     nmdp::ParserIpAddress   ipAddr;
@@ -38,7 +38,7 @@ typedef std::vector<DevInfo>     Result;
 
 
 class Parser :
-  public qi::grammar<nmdp::IstreamIter, Result(), qi::ascii::blank_type>
+  public qi::grammar<nmdp::ConstIter, Result(), qi::ascii::blank_type>
 {
   private:
     std::string VENDOR = "Cisco";
@@ -77,13 +77,13 @@ class Parser :
           );
     }
 
-    qi::rule<nmdp::IstreamIter, Result(), qi::ascii::blank_type>
+    qi::rule<nmdp::ConstIter, Result(), qi::ascii::blank_type>
       start;
 
-    qi::rule<nmdp::IstreamIter, DevInfo, qi::ascii::blank_type>
+    qi::rule<nmdp::ConstIter, DevInfo, qi::ascii::blank_type>
       deviceInfo;
 
-    qi::rule<nmdp::IstreamIter, std::string()>
+    qi::rule<nmdp::ConstIter, std::string()>
       token;
 };
 
@@ -44,7 +44,7 @@ typedef std::vector<Data>    Result;
 // Parser definition
 // =============================================================================
 class Parser :
-  public qi::grammar<nmdp::IstreamIter, Result(), qi::ascii::blank_type>
+  public qi::grammar<nmdp::ConstIter, Result(), qi::ascii::blank_type>
 {
   // ===========================================================================
   // Variables
@@ -52,20 +52,20 @@ class Parser :
   private: // Variables are always private
   protected:
     // Rules
-    qi::rule<nmdp::IstreamIter, Result(), qi::ascii::blank_type>
+    qi::rule<nmdp::ConstIter, Result(), qi::ascii::blank_type>
       start;
 
-    qi::rule<nmdp::IstreamIter, Data(), qi::ascii::blank_type>
+    qi::rule<nmdp::ConstIter, Data(), qi::ascii::blank_type>
       link;
 
-    qi::rule<nmdp::IstreamIter, std::string()>
+    qi::rule<nmdp::ConstIter, std::string()>
       portName,
       token;
 
-    qi::rule<nmdp::IstreamIter, unsigned short>
+    qi::rule<nmdp::ConstIter, unsigned short>
       vlanId;
 
-    qi::rule<nmdp::IstreamIter>
+    qi::rule<nmdp::ConstIter>
       typeValue,
       ignoredLine;
 
@@ -46,14 +46,14 @@ typedef std::vector<Data> Result;
 // Parser definition
 // =============================================================================
 class Parser :
-  public qi::grammar<nmdp::IstreamIter, Result(), qi::ascii::blank_type>
+  public qi::grammar<nmdp::ConstIter, Result(), qi::ascii::blank_type>
 {
   // ===========================================================================
   // Variables
   // ===========================================================================
   private: // Variables are always private
     // Rules
-    qi::rule<nmdp::IstreamIter, Result(), qi::ascii::blank_type>
+    qi::rule<nmdp::ConstIter, Result(), qi::ascii::blank_type>
       start,
       arp,
       arpArista,
@@ -65,7 +65,7 @@ class Parser :
       ndpCiscoIos,
       ndpCiscoIosDetail;
 
-    qi::rule<nmdp::IstreamIter, qi::ascii::blank_type>
+    qi::rule<nmdp::ConstIter, qi::ascii::blank_type>
       arpHeaderArista,
       arpHeaderCiscoIos,
       arpHeaderCiscoNxos,
@@ -74,7 +74,7 @@ class Parser :
       ndpHeaderCiscoIos,
       ndpHeaderCiscoIosDetail;
 
-    qi::rule<nmdp::IstreamIter, nmdo::InterfaceNetwork(), qi::ascii::blank_type,
+    qi::rule<nmdp::ConstIter, nmdo::InterfaceNetwork(), qi::ascii::blank_type,
              qi::locals<std::string, nmdo::MacAddress, nmdo::IpAddress>>
       arpEntryArista,
       arpEntryCiscoIos,
@@ -84,11 +84,11 @@ class Parser :
       ndpEntryCiscoIos,
       ndpEntryCiscoIosDetail;
 
-    qi::rule<nmdp::IstreamIter, std::string()>
+    qi::rule<nmdp::ConstIter, std::string()>
       iface,
       token;
 
-    qi::rule<nmdp::IstreamIter>
+    qi::rule<nmdp::ConstIter>
       age,
       errorMessage;
 
@@ -45,7 +45,7 @@ typedef std::vector<Data>    Result;
 // Parser definition
 // =============================================================================
 class Parser :
-  public qi::grammar<nmdp::IstreamIter, Result(), qi::ascii::blank_type>
+  public qi::grammar<nmdp::ConstIter, Result(), qi::ascii::blank_type>
 {
   // ===========================================================================
   // Variables
@@ -59,19 +59,19 @@ class Parser :
 
   protected:
     // Rules
-    qi::rule<nmdp::IstreamIter, Result(), qi::ascii::blank_type>
+    qi::rule<nmdp::ConstIter, Result(), qi::ascii::blank_type>
       start;
 
-    qi::rule<nmdp::IstreamIter>
+    qi::rule<nmdp::ConstIter>
       garbageLine;
 
-    qi::rule<nmdp::IstreamIter, qi::ascii::blank_type>
+    qi::rule<nmdp::ConstIter, qi::ascii::blank_type>
       windowsTrace, windowsHeader, windowsHop, windowsDomainIp;
 
-    qi::rule<nmdp::IstreamIter, qi::ascii::blank_type>
+    qi::rule<nmdp::ConstIter, qi::ascii::blank_type>
       linuxTrace, linuxHeader, linuxHop, linuxDomainIp;
 
-    qi::rule<nmdp::IstreamIter, nmdo::IpAddress()>
+    qi::rule<nmdp::ConstIter, nmdo::IpAddress()>
       linuxIpAddr;
 
     nmdp::ParserDomainName  fqdn;
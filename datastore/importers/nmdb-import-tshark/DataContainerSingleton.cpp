@@ -48,9 +48,29 @@ DataContainerSingleton::getInstance()
 }
 
 void
-DataContainerSingleton::insert(const Data& d)
+DataContainerSingleton::close()
 {
-  data.push(d);
+  data.close();
+}
+
+size_t
+DataContainerSingleton::drainData(Result& r, size_t max)
+{
+  return data.drainTo(r, max);
+}
+
+size_t
+DataContainerSingleton::depth() const
+{
+  return data.size();
+}
+
+void
+DataContainerSingleton::insert(Data&& d)
+{
+  if (!data.push(std::move(d))) {
+    LOG_DEBUG << "Dropping packet data, container closed\n";
+  }
 }
 
 bool
@@ -59,22 +79,51 @@ DataContainerSingleton::hasData() const
   return !data.isEmpty();
 }
 
-Result
-DataContainerSingleton::getData()
+void
+DataContainerSingleton::setCapacity(size_t capacity)
 {
-  Result r;
-  if (data.isEmpty()) {
-    return r;
-  }
+  data.setCapacity(capacity);
+}
 
-  for (size_t cnt {0}, dataCnt{data.size()};
-       hasData() && cnt < dataCnt;
-       ++cnt)
-  {
-    r.push_back(data.front());
-    data.pop();
+bool
+DataContainerSingleton::waitData(Data& d,
+                                 const std::chrono::milliseconds& timeout)
+{
+  return data.waitPop(d, timeout);
+}
+
+
+// =============================================================================
+// Batch
+// =============================================================================
+void
+Batch::add(Data&& d)
+{
+  for (auto& [id, ipAddr] : d.ipAddrs) {
+    ipAddrs.insert(std::move(ipAddr));
   }
-  return r;
+  for (auto& [id, macAddr] : d.macAddrs) {
+    macAddrs.insert(std::move(macAddr));
+  }
+  for (auto& [id, vlan] : d.vlans) {
+    vlans.insert(std::move(vlan));
+  }
+  for (auto& [id, iface] : d.ifaces) {
+    auto key {id + '\n' + iface.toDebugString()};
+    ifaces.try_emplace(std::move(key), id, std::move(iface));
+  }
+  services.merge(d.services);
+  observations.merge(d.observations);
+
+  ++packetCount;
+}
+
+size_t
+Batch::objectCount() const
+{
+  return ipAddrs.size() + macAddrs.size() + vlans.size() + ifaces.size()
+       + services.size() + (observations.isValid() ? 1 : 0)
+       ;
 }
 
 
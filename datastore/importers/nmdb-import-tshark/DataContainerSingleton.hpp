@@ -34,16 +34,21 @@
 #include <netmeld/datastore/objects/Service.hpp>
 #include <netmeld/datastore/objects/Vlan.hpp>
 
+#include <netmeld/datastore/utils/AddressKeys.hpp>
+
 #include <netmeld/core/utils/ThreadSafeQueue.hpp>
 
 namespace nmdo = netmeld::datastore::objects;
+namespace nmdu = netmeld::datastore::utils;
 namespace nmcu = netmeld::core::utils;
 
 
+// Per packet, so only a handful of entries; keyed on the raw address rather
+// than its text to avoid allocating and comparing strings
 struct Data {
-  std::map<std::string, nmdo::IpAddress>         ipAddrs;
-  std::map<std::string, nmdo::MacAddress>        macAddrs;
-  std::map<std::string, nmdo::Vlan>              vlans;
+  std::map<nmdu::IpKey, nmdo::IpAddress>         ipAddrs;
+  std::map<nmdu::MacKey, nmdo::MacAddress>       macAddrs;
+  std::map<uint16_t, nmdo::Vlan>                 vlans;
   std::map<std::string, nmdo::InterfaceNetwork>  ifaces;
 
   nmdo::ToolObservations observations;
@@ -52,6 +57,25 @@ struct Data {
 };
 typedef std::vector<Data> Result;
 
+// Coalesces many packets' Data so each distinct object is saved only once
+struct Batch {
+  std::set<nmdo::IpAddress>   ipAddrs;
+  std::set<nmdo::MacAddress>  macAddrs;
+  std::set<nmdo::Vlan>        vlans;
+  std::set<nmdo::Service>     services;
+
+  // InterfaceNetwork is not ordered, so key on device id and object content
+  std::map<std::string, std::pair<std::string, nmdo::InterfaceNetwork>>
+    ifaces;
+
+  nmdo::ToolObservations observations;
+
+  size_t packetCount {0};
+
+  void add(Data&&);
+  size_t objectCount() const;
+};
+
 class DataContainerSingleton {
   // ===========================================================================
   // Variables
@@ -80,9 +104,15 @@ class DataContainerSingleton {
   public: // Methods part of public API
     static DataContainerSingleton& getInstance();
 
-    void insert(const Data&);
+    void setCapacity(size_t);
+    void close();
+
+    // Blocks while the queue is at capacity (i.e., backpressure)
+    void insert(Data&&);
     bool hasData() const;
+    size_t depth() const;
 
-    Result getData();
+    bool waitData(Data&, const std::chrono::milliseconds&);
+    size_t drainData(Result&, size_t);
 };
 #endif // DATA_CONTAINER_SINGLETON_HPP
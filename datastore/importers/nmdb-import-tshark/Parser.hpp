@@ -167,6 +167,9 @@ class Parser :
     bool processPacket(PacketData&);
 
     nmdo::IpAddress getSrcIp(PacketData&) const;
+    // Nullptr if the address does not parse
+    nmdo::IpAddress* getIpAddrLoc(Data&, const std::string&) const;
+    nmdo::MacAddress* getMacAddrLoc(Data&, const std::string&) const;
 
   public:
 };
@@ -272,12 +272,12 @@ Parser<Iter>::processPacket(PacketData& _pd)
   if (_pd.count(arpSrcHwMac) | _pd.count(arpSrcProtoIpv4)) {
     const auto& macAddrStr {s1(arpSrcHwMac)};
     const auto& ipAddrStr {s1(arpSrcProtoIpv4)};
-    auto& macAddr {d.macAddrs[macAddrStr]};
-    macAddr.setMac(macAddrStr);
-    nmdo::IpAddress ipAddr {ipAddrStr, TSHARK_REASON};
-    ipAddr.setResponding(true);
-    macAddr.addIpAddress(ipAddr);
-    macAddr.setResponding(true);
+    if (auto* macAddr {getMacAddrLoc(d, macAddrStr)}; macAddr) {
+      nmdo::IpAddress ipAddr {ipAddrStr, TSHARK_REASON};
+      ipAddr.setResponding(true);
+      macAddr->addIpAddress(ipAddr);
+      macAddr->setResponding(true);
+    }
     status = true;
   }
 
@@ -302,10 +302,10 @@ Parser<Iter>::processPacket(PacketData& _pd)
     for (const auto& v : v2(dnsA)) {
       const auto& name {std::get<0>(v)};
       const auto& ipStr {std::get<1>(v)};
-      auto& ipAddr {d.ipAddrs[ipStr]};
-      ipAddr.setAddress(ipStr);
-      ipAddr.setReason(TSHARK_REASON);
-      ipAddr.addAlias(name, TSHARK_REASON);
+      if (auto* ipAddr {getIpAddrLoc(d, ipStr)}; ipAddr) {
+        ipAddr->setReason(TSHARK_REASON);
+        ipAddr->addAlias(name, TSHARK_REASON);
+      }
     }
     status = true;
   }
@@ -313,10 +313,10 @@ Parser<Iter>::processPacket(PacketData& _pd)
     for (const auto& v : v2(dnsAaaa)) {
       const auto& name {std::get<0>(v)};
       const auto& ipStr {std::get<1>(v)};
-      auto& ipAddr {d.ipAddrs[ipStr]};
-      ipAddr.setAddress(ipStr);
-      ipAddr.setReason(TSHARK_REASON);
-      ipAddr.addAlias(name, TSHARK_REASON);
+      if (auto* ipAddr {getIpAddrLoc(d, ipStr)}; ipAddr) {
+        ipAddr->setReason(TSHARK_REASON);
+        ipAddr->addAlias(name, TSHARK_REASON);
+      }
     }
     status = true;
   }
@@ -327,13 +327,13 @@ Parser<Iter>::processPacket(PacketData& _pd)
     const auto& ipYour {s1(bootpIpYour)};
 
     if ("0.0.0.0" != ipYour) {
-      auto& ipAddr {d.ipAddrs[ipYour]};
-      ipAddr.setAddress(ipYour);
-      ipAddr.setNetmask(nmdo::IpNetwork(subnetMask));
-      ipAddr.setReason(TSHARK_REASON);
-      ipAddr.setResponding(true);
-      if (_pd.count(bootpOptionHostname)) {
-        ipAddr.addAlias(s1(bootpOptionHostname), TSHARK_REASON);
+      if (auto* ipAddr {getIpAddrLoc(d, ipYour)}; ipAddr) {
+        ipAddr->setNetmask(nmdo::IpNetwork(subnetMask));
+        ipAddr->setReason(TSHARK_REASON);
+        ipAddr->setResponding(true);
+        if (_pd.count(bootpOptionHostname)) {
+          ipAddr->addAlias(s1(bootpOptionHostname), TSHARK_REASON);
+        }
       }
       status = true;
     }
@@ -364,15 +364,15 @@ Parser<Iter>::processPacket(PacketData& _pd)
   }
   if (_pd.count(bootpHwMacAddr)) {
     const auto& macAddrStr {s1(bootpHwMacAddr)};
-    auto& macAddr {d.macAddrs[macAddrStr]};
-    macAddr.setMac(macAddrStr);
-    if (_pd.count(bootpOptionDhcpServerId)) {
-      const auto& ipAddrStr {s1(bootpOptionDhcpServerId)};
-      nmdo::IpAddress ipAddr {ipAddrStr, TSHARK_REASON};
-      ipAddr.setResponding(true);
-      macAddr.addIpAddress(ipAddr);
+    if (auto* macAddr {getMacAddrLoc(d, macAddrStr)}; macAddr) {
+      if (_pd.count(bootpOptionDhcpServerId)) {
+        const auto& ipAddrStr {s1(bootpOptionDhcpServerId)};
+        nmdo::IpAddress ipAddr {ipAddrStr, TSHARK_REASON};
+        ipAddr.setResponding(true);
+        macAddr->addIpAddress(ipAddr);
+      }
+      macAddr->setResponding(true);
     }
-    macAddr.setResponding(true);
     status = true;
   }
 
@@ -435,7 +435,7 @@ Parser<Iter>::processPacket(PacketData& _pd)
   if (_pd.count(vlanId)) {
     for (const auto& vId : std::any_cast<VecStrType>(_pd[vlanId])) {
       auto val {static_cast<uint16_t>(std::stoi(vId))};
-      d.vlans[vId] = nmdo::Vlan(val, TSHARK_REASON);
+      d.vlans.try_emplace(val, val, TSHARK_REASON);
     }
   }
 
@@ -443,9 +443,9 @@ Parser<Iter>::processPacket(PacketData& _pd)
   // ===== Ethernet =====
   if (_pd.count(ethSrc)) {
     const auto& macAddrStr {s1(ethSrc)};
-    auto& macAddr {d.macAddrs[macAddrStr]};
-    macAddr.setMac(macAddrStr);
-    macAddr.setResponding(true);
+    if (auto* macAddr {getMacAddrLoc(d, macAddrStr)}; macAddr) {
+      macAddr->setResponding(true);
+    }
     status = true;
 // NOTE: Below is wrong as ethSrc may be the router not the end point.
 //    // ===== IPv4 =====
@@ -464,7 +464,7 @@ Parser<Iter>::processPacket(PacketData& _pd)
 
   // Put data into container if successful in processing
   if (status) {
-    DataContainerSingleton::getInstance().insert(d);
+    DataContainerSingleton::getInstance().insert(std::move(d));
   }
 
   return status;
@@ -484,3 +484,35 @@ Parser<Iter>::getSrcIp(PacketData& _pd) const
   nmdo::IpAddress value {srcIp};
   return value;
 }
+
+// Entries are keyed on the parsed address, not the text tshark printed, so
+// building the key never allocates; the object is only made on first sight
+template<typename Iter>
+nmdo::IpAddress*
+Parser<Iter>::getIpAddrLoc(Data& _d, const std::string& _ipAddr) const
+{
+  const auto key {nmdu::IpKey::fromString(_ipAddr)};
+  if (!key.isValid()) {
+    return nullptr;
+  }
+  auto [it, inserted] {_d.ipAddrs.try_emplace(key)};
+  if (inserted) {
+    it->second = key.toIpAddress();
+  }
+  return &it->second;
+}
+
+template<typename Iter>
+nmdo::MacAddress*
+Parser<Iter>::getMacAddrLoc(Data& _d, const std::string& _macAddr) const
+{
+  nmdu::MacKey key;
+  if (!nmdu::MacKey::fromString(_macAddr, key)) {
+    return nullptr;
+  }
+  auto [it, inserted] {_d.macAddrs.try_emplace(key)};
+  if (inserted) {
+    it->second = key.toMacAddress();
+  }
+  return &it->second;
+}
@@ -24,8 +24,10 @@
 // Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
 // =============================================================================
 
+#include <chrono>
 #include <csignal>
 #include <future>
+#include <optional>
 
 #include <netmeld/datastore/objects/DeviceInformation.hpp>
 #include <netmeld/datastore/tools/AbstractImportTool.hpp>
@@ -43,6 +45,14 @@ namespace nmdp = netmeld::datastore::parsers;
 void sigIntHandler(int);
 void sigIntHandler(int) { std::signal(SIGINT, SIG_DFL); }
 
+// Closes the data container when it goes out of scope, so a parser blocked
+// on a full container is released however the import ends
+class ContainerCloser
+{
+  public:
+    ~ContainerCloser() { DataContainerSingleton::getInstance().close(); }
+};
+
 // =============================================================================
 // Import tool definition
 // =============================================================================
@@ -78,6 +88,16 @@ class Tool : public nmdt::AbstractImportTool<P,R>
   // Methods
   // ===========================================================================
   private: // Methods part of internal API
+    // Overriden from AbstractImportTool
+    int
+    runTool() override
+    {
+      // Errors (e.g., an unreachable DB) may leave the parser waiting on a
+      // full container, and end the process without destroying this tool
+      ContainerCloser closer;
+      return nmdt::AbstractImportTool<P,R>::runTool();
+    }
+
     // Overriden from AbstractImportTool
     void
     addToolOptions() override
@@ -110,6 +130,23 @@ class Tool : public nmdt::AbstractImportTool<P,R>
             "Suppress observational output."
             )
           );
+
+      this->opts.addAdvancedOption("batch-packets", std::make_tuple(
+            "batch-packets",
+            po::value<size_t>()->default_value(1000),
+            "Maximum packets coalesced into one save transaction.")
+          );
+      this->opts.addAdvancedOption("batch-ms", std::make_tuple(
+            "batch-ms",
+            po::value<size_t>()->default_value(1000),
+            "Maximum milliseconds a packet waits before its batch is saved.")
+          );
+      this->opts.addAdvancedOption("queue-size", std::make_tuple(
+            "queue-size",
+            po::value<size_t>()->default_value(10000),
+            "Maximum parsed packets awaiting save before parsing blocks;"
+            " 0 is unbounded.")
+          );
     }
 
     // Overriden from AbstractImportTool
@@ -117,16 +154,20 @@ class Tool : public nmdt::AbstractImportTool<P,R>
     parseData() override
     {
       this->executionStart = nmco::Time();
+
+      // Parser blocks once this many packets await saving
+      auto& dcs {DataContainerSingleton::getInstance()};
+      dcs.setCapacity(this->opts.template getValueAs<size_t>("queue-size"));
+
       if (this->opts.exists("data-path")) { // file given, normal parse
         const auto dataPath {this->getDataPath()};
         parser = std::async(
             std::launch::async,
-            [&dataPath]()
+            [dataPath]()
             {
               nmdp::fromFilePathMM<Parser<nmdp::ConstIter>,R>(dataPath);
             }
             );
-        parser.get();
       } else { // no file, parse std::cin
         std::signal(SIGINT, sigIntHandler); // temp ignore sigint
         parser = std::async(
@@ -149,95 +190,187 @@ class Tool : public nmdt::AbstractImportTool<P,R>
     void
     specificInserts(pqxx::transaction_base& t) override
     {
-      const auto& toolRunId {this->getToolRunId()};
-      const auto& deviceId  {this->getDeviceId()};
-
-      auto& dcs {DataContainerSingleton::getInstance()};
-
-      auto quiet {this->opts.exists("quiet")};
-
       // Commit transaction, use tool run entry per data set transaction
+      if (auto* sink {nmdu::BulkRowSink::find(t)}; sink) {
+        sink->flush(); // buffered rows must land before the commit below
+      }
       t.commit();
 
       pqxx::connection db {this->getDbConnectString()};
       nmdu::dbPrepareCommon(db);
 
+      consumeData(db);
+    }
+
+    void
+    consumeData(pqxx::connection& db)
+    {
+      const auto& toolRunId {this->getToolRunId()};
+
+      auto& dcs {DataContainerSingleton::getInstance()};
+
+      const auto batchPackets {
+        std::max<size_t>(1, this->opts.template
+                                getValueAs<size_t>("batch-packets"))};
+      const std::chrono::milliseconds batchTime {
+        static_cast<std::chrono::milliseconds::rep>(
+            this->opts.template getValueAs<size_t>("batch-ms"))};
+
       LOG_DEBUG << "Iterating over results\n";
+      const auto consumeStart {std::chrono::steady_clock::now()};
       size_t toolPacketCount {0};
+      size_t toolRowCount {0};
+      size_t maxDepth {0};
+
+      Batch batch;
+      auto batchStart {std::chrono::steady_clock::now()};
       bool parserDone {false};
       while (!parserDone) {
-        if (!dcs.hasData()) {
-          std::this_thread::sleep_for(std::chrono::milliseconds(1000));
-        } else {
-          auto resultsv {dcs.getData()};
-          toolPacketCount += resultsv.size();
-          for (auto& results : resultsv) {
-            pqxx::work pt {db};
-            LOG_DEBUG << "Iterating over VLANs\n";
-            for (auto& [id, result] : results.vlans) {
-              result.save(pt, toolRunId, deviceId);
-              LOG_DEBUG << id << "--" << result.toDebugString() << "\n";
-            }
+        auto elapsed {std::chrono::steady_clock::now() - batchStart};
+        auto remaining {std::chrono::duration_cast<std::chrono::milliseconds>
+                          (batchTime - elapsed)};
 
-            LOG_DEBUG << "Iterating over MACs\n";
-            for (auto& [id, result] : results.macAddrs) {
-              result.save(pt, toolRunId, deviceId);
-              LOG_DEBUG << id << "--" << result.toDebugString() << "\n";
-            }
+        Data d;
+        if (dcs.waitData(d, std::max(remaining, std::chrono::milliseconds(0))))
+        {
+          maxDepth = std::max(maxDepth, dcs.depth() + 1);
+          batch.add(std::move(d));
 
-            LOG_DEBUG << "Iterating over IPs\n";
-            for (auto& [id, result] : results.ipAddrs) {
-              result.save(pt, toolRunId, deviceId);
-              LOG_DEBUG << id << "--" << result.toDebugString() << "\n";
-            }
+          // Take whatever else is ready without waiting again
+          Result ready;
+          dcs.drainData(ready, batchPackets - std::min(batchPackets,
+                                                       batch.packetCount));
+          for (auto& rd : ready) {
+            batch.add(std::move(rd));
+          }
+        }
 
-            LOG_DEBUG << "Iterating over Interfaces\n";
-            for (auto& [id, result] : results.ifaces) {
-              nmdo::DeviceInformation devInfo;
-              devInfo.setDeviceId(id);
-              devInfo.save(pt,toolRunId);
-              const auto& deviceInfoId {devInfo.getDeviceId()};
-              result.save(pt, toolRunId, deviceInfoId);
-              LOG_DEBUG << id << "--" << result.toDebugString() << "\n";
-            }
+        if (parser.valid()
+            && std::future_status::ready ==
+                 parser.wait_for(std::chrono::milliseconds(0)))
+        {
+          this->executionStop = nmco::Time();
+          parser.get(); // invalidate future
+        }
+        parserDone = !parser.valid() && !dcs.hasData();
 
-            LOG_DEBUG << "Iterating over Services\n";
-            for (auto result : results.services) {
-              result.save(pt, toolRunId, "");
-              LOG_DEBUG << result.toDebugString() << "\n";
-            }
+        if (  batch.packetCount >= batchPackets
+           || std::chrono::steady_clock::now() - batchStart >= batchTime
+           || parserDone)
+        {
+          if (0 < batch.packetCount) {
+            const auto saveStart {std::chrono::steady_clock::now()};
+            const auto rowCount {saveBatch(db, batch)};
+            const std::chrono::duration<double> saveTime {
+              std::chrono::steady_clock::now() - saveStart};
 
-            LOG_DEBUG << "Iterating over Observations\n";
-            if (quiet) {
-              results.observations.saveQuiet(pt, toolRunId, deviceId);
-            } else {
-              results.observations.save(pt, toolRunId, deviceId);
-            }
-            LOG_DEBUG << results.observations.toDebugString() << "\n";
+            LOG_DEBUG << "Batch saved: " << batch.packetCount << " packets, "
+                      << batch.objectCount() << " objects, "
+                      << rowCount << " rows in "
+                      << saveTime.count() << "s, queue depth "
+                      << dcs.depth() << '\n';
 
-            pt.commit();
+            toolPacketCount += batch.packetCount;
+            toolRowCount    += rowCount;
+            batch = Batch();
           }
+          batchStart = std::chrono::steady_clock::now();
+          LOG_INFO << std::flush;
         }
-        LOG_INFO << std::flush;
-
-        if (parser.valid()) {
-          auto status {parser.wait_for(std::chrono::milliseconds(100))};
-          if (std::future_status::ready == status) {
-            this->executionStop = nmco::Time();
-            pqxx::work pt {db};
-            pt.exec_prepared("update_tool_run",
-                toolRunId,
-                this->executionStart,
-                this->executionStop);
-            pt.commit();
-            parser.get(); // invalidate future
-          }
-        }
-        if (!parser.valid() && !dcs.hasData()) {
-          parserDone = true;
-        }
       }
-      LOG_INFO << "Tool packets processed: " << toolPacketCount << "\n";
+
+      pqxx::work pt {db};
+      nmdu::execPrepared(pt, "update_tool_run",
+          toolRunId,
+          this->executionStart,
+          this->executionStop);
+      pt.commit();
+
+      const std::chrono::duration<double> consumeTime {
+        std::chrono::steady_clock::now() - consumeStart};
+      const auto seconds {std::max(consumeTime.count(), 0.001)};
+      LOG_INFO << "Tool packets processed: " << toolPacketCount
+               << ", rows saved: " << toolRowCount << "\n";
+      LOG_INFO << "Tool throughput: "
+               << static_cast<size_t>(static_cast<double>(toolPacketCount)
+                                      / seconds)
+               << " packets/s, "
+               << static_cast<size_t>(static_cast<double>(toolRowCount)
+                                      / seconds)
+               << " rows/s, max queue depth " << maxDepth << "\n";
+    }
+
+    // Returns the number of rows inserted or updated
+    size_t
+    saveBatch(pqxx::connection& db, Batch& batch)
+    {
+      const auto& toolRunId {this->getToolRunId()};
+      const auto& deviceId  {this->getDeviceId()};
+
+      const auto quiet {this->opts.exists("quiet")};
+
+      pqxx::work pt {db};
+      std::optional<nmdu::BulkRowSink> sink;
+      if (!this->opts.exists("no-bulk-insert")) {
+        sink.emplace(pt);
+      }
+
+      LOG_DEBUG << "Iterating over VLANs\n";
+      for (auto result : batch.vlans) {
+        result.save(pt, toolRunId, deviceId);
+        LOG_DEBUG << result.toDebugString() << "\n";
+      }
+
+      LOG_DEBUG << "Iterating over MACs\n";
+      for (auto result : batch.macAddrs) {
+        result.save(pt, toolRunId, deviceId);
+        LOG_DEBUG << result.toDebugString() << "\n";
+      }
+
+      LOG_DEBUG << "Iterating over IPs\n";
+      for (auto result : batch.ipAddrs) {
+        result.save(pt, toolRunId, deviceId);
+        LOG_DEBUG << result.toDebugString() << "\n";
+      }
+
+      LOG_DEBUG << "Iterating over Interfaces\n";
+      for (auto& [key, value] : batch.ifaces) {
+        auto& [id, result] {value};
+        nmdo::DeviceInformation devInfo;
+        devInfo.setDeviceId(id);
+        devInfo.save(pt, toolRunId);
+        const auto& deviceInfoId {devInfo.getDeviceId()};
+        result.save(pt, toolRunId, deviceInfoId);
+        LOG_DEBUG << id << "--" << result.toDebugString() << "\n";
+      }
+
+      LOG_DEBUG << "Iterating over Services\n";
+      for (auto result : batch.services) {
+        result.save(pt, toolRunId, "");
+        LOG_DEBUG << result.toDebugString() << "\n";
+      }
+
+      LOG_DEBUG << "Iterating over Observations\n";
+      if (quiet) {
+        batch.observations.saveQuiet(pt, toolRunId, deviceId);
+      } else {
+        batch.observations.save(pt, toolRunId, deviceId);
+      }
+      LOG_DEBUG << batch.observations.toDebugString() << "\n";
+
+      if (sink) {
+        sink->flush();
+      }
+
+      // Counts what was written, not what was sent: rows skipped on
+      // conflict and the bulk staging (temporary) tables are excluded
+      const auto& written {pt.exec(
+          "SELECT COALESCE(SUM(n_tup_ins + n_tup_upd), 0)"
+          " FROM pg_catalog.pg_stat_xact_user_tables"
+          " WHERE (schemaname NOT LIKE 'pg\\_temp\\_%')")};
+      pt.commit();
+
+      return written.at(0).at(0).as<size_t>();
     }
 
   protected: // Methods part of subclass API
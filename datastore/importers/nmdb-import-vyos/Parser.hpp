@@ -67,27 +67,27 @@ typedef std::vector<Data>    Result;
 // Parser definition
 // =============================================================================
 class Parser :
-  public qi::grammar<nmdp::IstreamIter, Result(), qi::ascii::blank_type>
+  public qi::grammar<nmdp::ConstIter, Result(), qi::ascii::blank_type>
 {
   // ===========================================================================
   // Variables
   // ===========================================================================
   private: // Variables are always private
     // Rules
-    qi::rule<nmdp::IstreamIter, Result(), qi::ascii::blank_type>
+    qi::rule<nmdp::ConstIter, Result(), qi::ascii::blank_type>
       start;
 
-    qi::rule<nmdp::IstreamIter, qi::ascii::blank_type>
+    qi::rule<nmdp::ConstIter, qi::ascii::blank_type>
       config,
       system,login,user,
       interfaces, interface, ifaceFirewall,
       firewall, group, addressGroup, ruleSets, rule, destination, source,
       startBlock, stopBlock, ignoredBlock;
 
-    qi::rule<nmdp::IstreamIter, std::string()>
+    qi::rule<nmdp::ConstIter, std::string()>
       token;
 
-    qi::rule<nmdp::IstreamIter>
+    qi::rule<nmdp::ConstIter>
       comment;
 
     nmdp::ParserIpAddress  ipAddr;
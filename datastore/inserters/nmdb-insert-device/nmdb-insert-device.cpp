@@ -26,9 +26,11 @@
 
 #include <netmeld/datastore/objects/Interface.hpp>
 #include <netmeld/datastore/tools/AbstractInsertTool.hpp>
+#include <netmeld/datastore/utils/BulkRowSink.hpp>
 
 namespace nmdo = netmeld::datastore::objects;
 namespace nmdt = netmeld::datastore::tools;
+namespace nmdu = netmeld::datastore::utils;
 
 
 class Tool : public nmdt::AbstractInsertTool
@@ -98,14 +100,14 @@ class Tool : public nmdt::AbstractInsertTool
         hostDevInfo.save(t, toolRunId);
 
         const auto& hostDevId {hostDevInfo.getDeviceId()};
-        t.exec_prepared("insert_raw_device_virtualization",
+        nmdu::execPrepared(t, "insert_raw_device_virtualization",
             toolRunId,
             hostDevId,
             deviceId);
       }
 
       if (opts.exists("low-graph-priority")) {
-        t.exec_prepared("insert_device_extra_weight",
+        nmdu::execPrepared(t, "insert_device_extra_weight",
             deviceId,
             M_PI); // Not arbitrary, but probably high enough
       }
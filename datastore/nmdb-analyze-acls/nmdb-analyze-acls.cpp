@@ -0,0 +1,282 @@
+// =============================================================================
+// Copyright 2023 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+// =============================================================================
+
+#include <pqxx/pqxx>
+
+#include <algorithm>
+#include <chrono>
+#include <mutex>
+#include <sstream>
+#include <thread>
+
+#include <netmeld/core/objects/Time.hpp>
+#include <netmeld/core/objects/Uuid.hpp>
+#include <netmeld/core/utils/ThreadSafeQueue.hpp>
+#include <netmeld/datastore/objects/ToolObservations.hpp>
+#include <netmeld/datastore/tools/AbstractDatastoreTool.hpp>
+#include <netmeld/datastore/utils/AclClassifier.hpp>
+#include <netmeld/datastore/utils/BulkRowSink.hpp>
+#include <netmeld/datastore/utils/QueriesCommon.hpp>
+
+namespace nmco = netmeld::core::objects;
+namespace nmcu = netmeld::core::utils;
+namespace nmdo = netmeld::datastore::objects;
+namespace nmdt = netmeld::datastore::tools;
+namespace nmdu = netmeld::datastore::utils;
+
+
+// =============================================================================
+// Data containers
+// =============================================================================
+struct DeviceFindings
+{
+  std::vector<std::string> observations;
+  size_t rules      {0};
+  size_t redundant  {0};
+  size_t shadowed   {0};
+  size_t correlated {0};
+  double seconds    {0};
+  bool   failed     {false};
+};
+
+
+// =============================================================================
+// Tool definition
+// =============================================================================
+class Tool : public nmdt::AbstractDatastoreTool
+{
+  // ===========================================================================
+  // Variables
+  // ===========================================================================
+  private: // Variables should generally be private
+    std::vector<std::string>    deviceIds;
+    std::vector<DeviceFindings> findings; // parallel to deviceIds
+    nmcu::ThreadSafeQueue<size_t> ready;  // indexes into deviceIds
+
+  protected: // Variables intended for internal/subclass API
+    // Inhertied from AbstractTool at this scope
+      // std::string            helpBlurb;
+      // std::string            programName;
+      // std::string            version;
+      // ProgramOptions         opts;
+  public: // Variables should rarely appear at this scope
+
+
+  // ===========================================================================
+  // Constructors
+  // ===========================================================================
+  private: // Constructors should rarely appear at this scope
+  protected: // Constructors intended for internal/subclass API
+  public: // Constructors should generally be public
+    Tool() : nmdt::AbstractDatastoreTool
+      ("Find shadowed, redundant, and correlated ACL rules",
+       PROGRAM_NAME, PROGRAM_VERSION)
+    {}
+
+
+  // ===========================================================================
+  // Methods
+  // ===========================================================================
+  private: // Methods part of internal API
+    void
+    addToolOptions() override
+    {
+      opts.addOptionalOption("device-id", std::make_tuple(
+          "device-id",
+          po::value<std::vector<std::string>>()->multitoken(),
+          "Device(s) whose ACLs are analyzed; default is all devices with"
+          " ACL rules")
+        );
+      opts.addOptionalOption("jobs", std::make_tuple(
+          "jobs,j",
+          po::value<size_t>()->default_value(0),
+          "Devices to analyze concurrently; 0 uses all available cores.")
+        );
+    }
+
+    // Each worker holds its own connection; devices share nothing else
+    void
+    worker()
+    {
+      pqxx::connection db {getDbConnectString()};
+      nmdu::dbPrepareCommon(db);
+
+      size_t i;
+      while (ready.waitPop(i)) {
+        const auto start {std::chrono::steady_clock::now()};
+        auto& found {findings[i]};
+        try {
+          pqxx::read_transaction t {db};
+          analyzeDevice(nmdu::AclClassifier::fromDatastore(t, deviceIds[i]),
+                        deviceIds[i], found);
+        } catch (const std::exception& e) {
+          LOG_ERROR << deviceIds[i] << ": " << e.what() << '\n';
+          found.failed = true;
+        }
+        found.seconds = std::chrono::duration<double>(
+            std::chrono::steady_clock::now() - start).count();
+      }
+    }
+
+    void
+    analyzeDevice(const nmdu::AclClassifier& _acl,
+                  const std::string& _deviceId, DeviceFindings& _found) const
+    {
+      auto ruleList = [&](const std::set<size_t>& _ruleIds) {
+        std::vector<std::pair<size_t, std::string>> sorted;
+        for (const auto ruleId : _ruleIds) {
+          const auto& rule {_acl.getRule(ruleId)};
+          sorted.emplace_back(rule.priority, rule.action);
+        }
+        std::sort(sorted.begin(), sorted.end());
+
+        std::ostringstream oss;
+        for (size_t i {0}; i < sorted.size(); ++i) {
+          oss << (i ? ", " : "")
+              << sorted[i].first << " (" << sorted[i].second << ')';
+        }
+        return oss.str();
+      };
+
+      _found.rules = _acl.getRuleCount();
+      for (size_t ruleId {0}; ruleId < _acl.getRuleCount(); ++ruleId) {
+        const auto& rule {_acl.getRule(ruleId)};
+        const auto analysis {_acl.analyze(ruleId)};
+
+        std::ostringstream oss;
+        oss << _deviceId << ": ACL rule " << rule.priority
+            << " (" << rule.action << ')';
+        if (analysis.isRedundant) {
+          ++_found.redundant;
+          oss << " is redundant, covered by earlier rule(s) "
+              << ruleList(analysis.coveringRuleIds);
+        } else if (analysis.isCovered) {
+          ++_found.shadowed;
+          oss << " is shadowed by earlier rule(s) "
+              << ruleList(analysis.coveringRuleIds);
+        } else if (!analysis.conflictingRuleIds.empty()) {
+          ++_found.correlated;
+          oss << " is correlated with earlier rule(s) "
+              << ruleList(analysis.conflictingRuleIds);
+        } else {
+          continue;
+        }
+        _found.observations.push_back(oss.str());
+      }
+    }
+
+    int
+    runTool() override
+    {
+      const nmco::Time executionStart;
+
+      {
+        pqxx::connection db {getDbConnectString()};
+        nmdu::dbPrepareCommon(db);
+
+        if (opts.exists("device-id")) {
+          deviceIds = opts.getValues("device-id");
+        } else {
+          pqxx::read_transaction t {db};
+          const auto& rows {nmdu::execPrepared(t, "select_acl_device_ids")};
+          for (const auto& row : rows) {
+            deviceIds.push_back(row.at("device_id").as<std::string>());
+          }
+        }
+      }
+      findings.resize(deviceIds.size());
+
+      auto numJobs {opts.getValueAs<size_t>("jobs")};
+      if (0 == numJobs) {
+        numJobs = std::max(1U, std::thread::hardware_concurrency());
+      }
+      numJobs = std::max(size_t {1}, std::min(numJobs, deviceIds.size()));
+
+      for (size_t i {0}; i < deviceIds.size(); ++i) {
+        ready.push(i);
+      }
+      ready.close();
+
+      std::vector<std::thread> workers;
+      for (size_t i {0}; i < numJobs; ++i) {
+        workers.emplace_back(&Tool::worker, this);
+      }
+      for (auto& worker : workers) {
+        worker.join();
+      }
+
+      const nmco::Time executionStop;
+
+      // Single writer, after all the analysis
+      const nmco::Uuid toolRunId;
+      nmdo::ToolObservations observations;
+      bool failed {false};
+      for (size_t i {0}; i < deviceIds.size(); ++i) {
+        const auto& found {findings[i]};
+        for (const auto& observation : found.observations) {
+          observations.addNotable(observation);
+        }
+        failed = failed || found.failed;
+
+        LOG_INFO << "# " << deviceIds[i] << ": " << found.rules
+                 << " rules, " << found.redundant << " redundant, "
+                 << found.shadowed << " shadowed, "
+                 << found.correlated << " correlated ("
+                 << found.seconds << "s)\n";
+      }
+
+      pqxx::connection db {getDbConnectString()};
+      nmdu::dbPrepareCommon(db);
+      pqxx::work t {db};
+      nmdu::execPrepared(t, "insert_tool_run",
+          toolRunId,
+          programName,
+          helpBlurb, // commandLine
+          "",        // dataPath
+          executionStart,
+          executionStop);
+      observations.save(t, toolRunId, "");
+      t.commit();
+
+      LOG_INFO << "tool-run-id: " << toolRunId << '\n';
+
+      return failed ? nmcu::Exit::FAILURE : nmcu::Exit::SUCCESS;
+    }
+
+  protected: // Methods part of subclass API
+  public: // Methods part of public API
+};
+
+
+// =============================================================================
+// Program entry point
+// =============================================================================
+int
+main(int argc, char** argv)
+{
+  Tool tool;
+  return tool.start(argc, argv);
+}
@@ -31,6 +31,7 @@
 
 #include <netmeld/datastore/objects/PortRange.hpp>
 #include <netmeld/datastore/tools/AbstractDatastoreTool.hpp>
+#include <netmeld/datastore/utils/BulkRowSink.hpp>
 #include <netmeld/datastore/utils/QueriesCommon.hpp>
 
 extern "C" {
@@ -186,7 +187,7 @@ class Tool : public nmdt::AbstractDatastoreTool
       // SELECT DISTINCT queries against existing *_ac_* tables
 
       pqxx::result deviceRows =
-        t.exec_prepared("select_raw_devices");
+        nmdu::execPrepared(t, "select_raw_devices");
       for (const auto& deviceRow : deviceRows) {
         std::string toolRunId;
         deviceRow.at("tool_run_id").to(toolRunId);
@@ -195,20 +196,20 @@ class Tool : public nmdt::AbstractDatastoreTool
         std::string ipNetSetNamespace{"global"};
 
         // Zone: any
-        t.exec_prepared("insert_raw_device_acl_zone_base",
+        nmdu::execPrepared(t, "insert_raw_device_acl_zone_base",
             toolRunId,
             deviceId,
             "any"
         );
 
         // IP net: any-ipv4
-        t.exec_prepared("insert_raw_device_acl_ip_net_base",
+        nmdu::execPrepared(t, "insert_raw_device_acl_ip_net_base",
             toolRunId,
             deviceId,
             ipNetSetNamespace,
             "any-ipv4"
         );
-        t.exec_prepared("insert_raw_device_acl_ip_net_ip_net",
+        nmdu::execPrepared(t, "insert_raw_device_acl_ip_net_ip_net",
             toolRunId,
             deviceId,
             ipNetSetNamespace,
@@ -217,13 +218,13 @@ class Tool : public nmdt::AbstractDatastoreTool
         );
 
         // IP net: any-ipv6
-        t.exec_prepared("insert_raw_device_acl_ip_net_base",
+        nmdu::execPrepared(t, "insert_raw_device_acl_ip_net_base",
             toolRunId,
             deviceId,
             ipNetSetNamespace,
             "any-ipv6"
         );
-        t.exec_prepared("insert_raw_device_acl_ip_net_ip_net",
+        nmdu::execPrepared(t, "insert_raw_device_acl_ip_net_ip_net",
             toolRunId,
             deviceId,
             ipNetSetNamespace,
@@ -232,20 +233,20 @@ class Tool : public nmdt::AbstractDatastoreTool
         );
 
         // IP net: any
-        t.exec_prepared("insert_raw_device_acl_ip_net_base",
+        nmdu::execPrepared(t, "insert_raw_device_acl_ip_net_base",
             toolRunId,
             deviceId,
             ipNetSetNamespace,
             "any"
         );
-        t.exec_prepared("insert_raw_device_acl_ip_net_ip_net",
+        nmdu::execPrepared(t, "insert_raw_device_acl_ip_net_ip_net",
             toolRunId,
             deviceId,
             ipNetSetNamespace,
             "any",
             "0.0.0.0/0"
         );
-        t.exec_prepared("insert_raw_device_acl_ip_net_ip_net",
+        nmdu::execPrepared(t, "insert_raw_device_acl_ip_net_ip_net",
             toolRunId,
             deviceId,
             ipNetSetNamespace,
@@ -254,18 +255,18 @@ class Tool : public nmdt::AbstractDatastoreTool
         );
 
         // service: any-tcp
-        t.exec_prepared("insert_raw_device_acl_service_base",
+        nmdu::execPrepared(t, "insert_raw_device_acl_service_base",
             toolRunId,
             deviceId,
             "any-tcp"
         );
-        t.exec_prepared("insert_raw_device_acl_service_protocol",
+        nmdu::execPrepared(t, "insert_raw_device_acl_service_protocol",
             toolRunId,
             deviceId,
             "any-tcp",
             "tcp"
         );
-        t.exec_prepared("insert_raw_device_acl_service_port",
+        nmdu::execPrepared(t, "insert_raw_device_acl_service_port",
             toolRunId,
             deviceId,
             "any-tcp",
@@ -275,18 +276,18 @@ class Tool : public nmdt::AbstractDatastoreTool
         );
 
         // service: any-udp
-        t.exec_prepared("insert_raw_device_acl_service_base",
+        nmdu::execPrepared(t, "insert_raw_device_acl_service_base",
             toolRunId,
             deviceId,
             "any-udp"
         );
-        t.exec_prepared("insert_raw_device_acl_service_protocol",
+        nmdu::execPrepared(t, "insert_raw_device_acl_service_protocol",
             toolRunId,
             deviceId,
             "any-udp",
             "udp"
         );
-        t.exec_prepared("insert_raw_device_acl_service_port",
+        nmdu::execPrepared(t, "insert_raw_device_acl_service_port",
             toolRunId,
             deviceId,
             "any-udp",
@@ -296,18 +297,18 @@ class Tool : public nmdt::AbstractDatastoreTool
         );
 
         // service: any
-        t.exec_prepared("insert_raw_device_acl_service_base",
+        nmdu::execPrepared(t, "insert_raw_device_acl_service_base",
             toolRunId,
             deviceId,
             "any"
         );
-        t.exec_prepared("insert_raw_device_acl_service_protocol",
+        nmdu::execPrepared(t, "insert_raw_device_acl_service_protocol",
             toolRunId,
             deviceId,
             "any",
             "any"
         );
-        t.exec_prepared("insert_raw_device_acl_service_port",
+        nmdu::execPrepared(t, "insert_raw_device_acl_service_port",
             toolRunId,
             deviceId,
             "any",
@@ -319,7 +320,7 @@ class Tool : public nmdt::AbstractDatastoreTool
 
 
       pqxx::result serviceRows =
-        t.exec_prepared("select_raw_device_ac_services_flattened");
+        nmdu::execPrepared(t, "select_raw_device_ac_services_flattened");
       for (const auto& serviceRow : serviceRows) {
         std::string toolRunId;
         serviceRow.at("tool_run_id").to(toolRunId);
@@ -330,7 +331,7 @@ class Tool : public nmdt::AbstractDatastoreTool
         std::string serviceData;
         serviceRow.at("service_set_data").to(serviceData);
 
-        t.exec_prepared("insert_raw_device_acl_service_base",
+        nmdu::execPrepared(t, "insert_raw_device_acl_service_base",
             toolRunId,
             deviceId,
             serviceId
@@ -387,13 +388,13 @@ class Tool : public nmdt::AbstractDatastoreTool
         auto const dstPortRange = convertToPortRange(dstPortData);
 
         for (const auto& protocol : protocols) {
-          t.exec_prepared("insert_raw_device_acl_service_protocol",
+          nmdu::execPrepared(t, "insert_raw_device_acl_service_protocol",
               toolRunId,
               deviceId,
               serviceId,
               protocol
           );
-          t.exec_prepared("insert_raw_device_acl_service_port",
+          nmdu::execPrepared(t, "insert_raw_device_acl_service_port",
               toolRunId,
               deviceId,
               serviceId,
@@ -406,7 +407,7 @@ class Tool : public nmdt::AbstractDatastoreTool
 
 
       pqxx::result acNetRows =
-        t.exec_prepared("select_raw_device_ac_nets_flattened");
+        nmdu::execPrepared(t, "select_raw_device_ac_nets_flattened");
       for (const auto& acNetRow : acNetRows) {
         std::string toolRunId;
         acNetRow.at("tool_run_id").to(toolRunId);
@@ -419,7 +420,7 @@ class Tool : public nmdt::AbstractDatastoreTool
         std::string ipNet;
         acNetRow.at("net_set_data").to(ipNet);
 
-        t.exec_prepared("insert_raw_device_acl_ip_net_base",
+        nmdu::execPrepared(t, "insert_raw_device_acl_ip_net_base",
             toolRunId,
             deviceId,
             ipNetSetNamespace,
@@ -436,7 +437,7 @@ class Tool : public nmdt::AbstractDatastoreTool
           continue;
         }
 
-        t.exec_prepared("insert_raw_device_acl_ip_net_ip_net",
+        nmdu::execPrepared(t, "insert_raw_device_acl_ip_net_ip_net",
             toolRunId,
             deviceId,
             ipNetSetNamespace,
@@ -447,7 +448,7 @@ class Tool : public nmdt::AbstractDatastoreTool
 
 
       pqxx::result acRuleRows =
-        t.exec_prepared("select_raw_device_ac_rules");
+        nmdu::execPrepared(t, "select_raw_device_ac_rules");
       for (const auto& acRuleRow : acRuleRows) {
         std::string toolRunId;
         acRuleRow.at("tool_run_id").to(toolRunId);
@@ -477,13 +478,13 @@ class Tool : public nmdt::AbstractDatastoreTool
         std::string description;
         acRuleRow.at("description").to(description);
 
-        t.exec_prepared("insert_raw_device_acl_zone_base",
+        nmdu::execPrepared(t, "insert_raw_device_acl_zone_base",
             toolRunId,
             deviceId,
             incomingZoneId
         );
         if (!incomingInterfaceName.empty()) {
-          t.exec_prepared("insert_raw_device_acl_zone_interface",
+          nmdu::execPrepared(t, "insert_raw_device_acl_zone_interface",
               toolRunId,
               deviceId,
               incomingZoneId,
@@ -491,13 +492,13 @@ class Tool : public nmdt::AbstractDatastoreTool
           );
         }
 
-        t.exec_prepared("insert_raw_device_acl_zone_base",
+        nmdu::execPrepared(t, "insert_raw_device_acl_zone_base",
             toolRunId,
             deviceId,
             outgoingZoneId
         );
         if (!outgoingInterfaceName.empty()) {
-          t.exec_prepared("insert_raw_device_acl_zone_interface",
+          nmdu::execPrepared(t, "insert_raw_device_acl_zone_interface",
               toolRunId,
               deviceId,
               outgoingZoneId,
@@ -515,7 +516,7 @@ class Tool : public nmdt::AbstractDatastoreTool
           action = "block";
         }
 
-        t.exec_prepared("insert_raw_device_acl_rule_service",
+        nmdu::execPrepared(t, "insert_raw_device_acl_rule_service",
             toolRunId,
             deviceId,
             priority,
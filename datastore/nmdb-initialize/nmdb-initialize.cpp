@@ -69,6 +69,12 @@ class Tool : public nmdt::AbstractDatastoreTool
             NULL_SEMANTIC,
             "Delete all existing data in DB, not a full drop and recreate")
           );
+      opts.addOptionalOption("partitioned", std::make_tuple(
+            "partitioned",
+            NULL_SEMANTIC,
+            "Partition the large result tables by tool run (PostgreSQL 12+),"
+            " so removing a tool run drops its partitions")
+          );
       opts.addOptionalOption("extra-schema", std::make_tuple(
             "extra-schema",
             po::value<std::vector<std::string>>()->multitoken(),
@@ -92,6 +98,10 @@ class Tool : public nmdt::AbstractDatastoreTool
 
       // Populate target DB with schema(s)
       if (!shouldDelete) {
+        if (opts.exists("partitioned")) {
+          // Session level, as the schema files commit their own transactions
+          work.exec("SET netmeld.partition_by_tool_run = 'on'");
+        }
         loadSchema(work);
       }
 
@@ -135,12 +145,24 @@ class Tool : public nmdt::AbstractDatastoreTool
           pqxx::nontransaction ntWork {db};
 
           LOG_INFO << "Cleaning tool_runs\n";
+          // Drop, rather than empty, the partitions of each tool run
+          const auto& partitioned {ntWork.exec(
+              "SELECT to_regproc('tool_run_partitions_drop') IS NOT NULL")};
+          if (partitioned.at(0).at(0).as<bool>()) {
+            ntWork.exec(
+                "SELECT tool_run_partitions_drop(id) FROM tool_runs");
+          }
           ntWork.exec("DELETE FROM tool_runs");
 
+          // Schema qualified as same named copies may exist in other
+          // schemas; materialized views are rebuilt, not deleted from
           pqxx::result tables = ntWork.exec(
-              "SELECT relname AS populated_table"
+              "SELECT quote_ident(schemaname) || '.' || quote_ident(relname)"
+              "         AS populated_table"
               " FROM pg_catalog.pg_stat_user_tables"
               " WHERE n_live_tup > 0"
+              "   AND relid NOT IN (SELECT oid FROM pg_catalog.pg_class"
+              "                     WHERE relkind = 'm')"
               );
           for (const auto& tableRow : tables) {
             std::string populatedTable;
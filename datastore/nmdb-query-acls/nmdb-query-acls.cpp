@@ -0,0 +1,329 @@
+// =============================================================================
+// Copyright 2023 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+// =============================================================================
+
+#include <pqxx/pqxx>
+
+#include <chrono>
+#include <fstream>
+#include <sstream>
+
+#include <netmeld/datastore/objects/PortRange.hpp>
+#include <netmeld/datastore/tools/AbstractDatastoreTool.hpp>
+#include <netmeld/datastore/utils/AclClassifier.hpp>
+#include <netmeld/datastore/utils/BulkRowSink.hpp>
+#include <netmeld/datastore/utils/QueriesCommon.hpp>
+
+namespace nmcu = netmeld::core::utils;
+namespace nmdo = netmeld::datastore::objects;
+namespace nmdt = netmeld::datastore::tools;
+namespace nmdu = netmeld::datastore::utils;
+
+
+class Tool : public nmdt::AbstractDatastoreTool
+{
+  // ===========================================================================
+  // Variables
+  // ===========================================================================
+  private: // Variables should generally be private
+  protected: // Variables intended for internal/subclass API
+    // Inhertied from AbstractTool at this scope
+      // std::string            helpBlurb;
+      // std::string            programName;
+      // std::string            version;
+      // ProgramOptions         opts;
+  public: // Variables should rarely appear at this scope
+
+
+  // ===========================================================================
+  // Constructors
+  // ===========================================================================
+  private: // Constructors should rarely appear at this scope
+  protected: // Constructors intended for internal/subclass API
+  public: // Constructors should generally be public
+    Tool() : nmdt::AbstractDatastoreTool
+      ("Classify flows against the stored device ACLs",
+       PROGRAM_NAME, PROGRAM_VERSION)
+    {}
+
+
+  // ===========================================================================
+  // Methods
+  // ===========================================================================
+  private: // Methods part of internal API
+    void
+    addToolOptions() override
+    {
+      opts.addOptionalOption("device-id", std::make_tuple(
+          "device-id",
+          po::value<std::vector<std::string>>()->multitoken(),
+          "Device(s) whose ACLs are queried; default is all devices with"
+          " ACL rules")
+        );
+      opts.addOptionalOption("src-ip", std::make_tuple(
+          "src-ip",
+          po::value<std::string>()->default_value("0.0.0.0/0"),
+          "Source IP address or network")
+        );
+      opts.addOptionalOption("dst-ip", std::make_tuple(
+          "dst-ip",
+          po::value<std::string>()->default_value("0.0.0.0/0"),
+          "Destination IP address or network")
+        );
+      opts.addOptionalOption("protocol", std::make_tuple(
+          "protocol",
+          po::value<std::string>()->default_value("any"),
+          "Protocol (e.g., tcp, udp, icmp, any)")
+        );
+      opts.addOptionalOption("src-port", std::make_tuple(
+          "src-port",
+          po::value<std::string>()->default_value("0-65535"),
+          "Source port or port range (e.g., 80 or 1024-65535)")
+        );
+      opts.addOptionalOption("dst-port", std::make_tuple(
+          "dst-port",
+          po::value<std::string>()->default_value("0-65535"),
+          "Destination port or port range (e.g., 80 or 1024-65535)")
+        );
+      opts.addOptionalOption("incoming-interface", std::make_tuple(
+          "incoming-interface",
+          po::value<std::string>()->default_value(""),
+          "Interface the flow enters the device on; default is any")
+        );
+      opts.addOptionalOption("outgoing-interface", std::make_tuple(
+          "outgoing-interface",
+          po::value<std::string>()->default_value(""),
+          "Interface the flow leaves the device on; default is any")
+        );
+      opts.addOptionalOption("batch-file", std::make_tuple(
+          "batch-file",
+          po::value<std::string>(),
+          "File of flows to classify, one per line as: SRC_IP DST_IP PROTOCOL"
+          " SRC_PORT DST_PORT [INCOMING_INTERFACE [OUTGOING_INTERFACE]];"
+          " replaces the single flow options")
+        );
+    }
+
+    int
+    runTool() override
+    {
+      pqxx::connection db {getDbConnectString()};
+      nmdu::dbPrepareCommon(db);
+
+      pqxx::read_transaction t {db};
+
+      std::vector<std::string> deviceIds;
+      if (opts.exists("device-id")) {
+        deviceIds = opts.getValues("device-id");
+      } else {
+        for (const auto& row : nmdu::execPrepared(t, "select_acl_device_ids")) {
+          deviceIds.push_back(row.at("device_id").as<std::string>());
+        }
+      }
+
+      int exitCode {nmcu::Exit::SUCCESS};
+      if (opts.exists("batch-file")) {
+        exitCode = classifyBatch(t, deviceIds);
+      } else {
+        exitCode = classifySingle(t, deviceIds);
+      }
+
+      return exitCode;
+    }
+
+    nmdu::AclClassifier
+    loadDevice(pqxx::read_transaction& t, const std::string& deviceId) const
+    {
+      const auto start {std::chrono::steady_clock::now()};
+      auto acl {nmdu::AclClassifier::fromDatastore(t, deviceId)};
+      LOG_DEBUG << deviceId << ": loaded in " << secondsSince(start) << "s\n";
+
+      return acl;
+    }
+
+    int
+    classifySingle(pqxx::read_transaction& t,
+                   const std::vector<std::string>& deviceIds) const
+    {
+      nmdu::AclFlowRange range;
+      if (!nmdu::AclClassifier::toIpRange(opts.getValue("src-ip"),
+                                          range.srcIpFirst, range.srcIpLast))
+      {
+        LOG_ERROR << "Invalid --src-ip: " << opts.getValue("src-ip") << '\n';
+        return nmcu::Exit::FAILURE;
+      }
+      if (!nmdu::AclClassifier::toIpRange(opts.getValue("dst-ip"),
+                                          range.dstIpFirst, range.dstIpLast))
+      {
+        LOG_ERROR << "Invalid --dst-ip: " << opts.getValue("dst-ip") << '\n';
+        return nmcu::Exit::FAILURE;
+      }
+      if (range.srcIpFirst.family != range.dstIpFirst.family) {
+        LOG_ERROR << "--src-ip and --dst-ip must be the same IP version\n";
+        return nmcu::Exit::FAILURE;
+      }
+
+      const nmdo::PortRange srcPorts {opts.getValue("src-port")};
+      const nmdo::PortRange dstPorts {opts.getValue("dst-port")};
+      range.srcPortFirst  = std::get<0>(srcPorts);
+      range.srcPortLast   = std::get<1>(srcPorts);
+      range.dstPortFirst  = std::get<0>(dstPorts);
+      range.dstPortLast   = std::get<1>(dstPorts);
+      range.protocol      = opts.getValue("protocol");
+      range.incomingIface = opts.getValue("incoming-interface");
+      range.outgoingIface = opts.getValue("outgoing-interface");
+
+      for (const auto& deviceId : deviceIds) {
+        const auto acl {loadDevice(t, deviceId)};
+
+        const auto start {std::chrono::steady_clock::now()};
+        const auto result {acl.classify(range)};
+        const auto elapsed {secondsSince(start)};
+
+        std::string verdict {"block"};
+        if (result.allAllowed) {
+          verdict = "allow";
+        } else if (result.anyAllowed) {
+          verdict = "partial";
+        }
+        LOG_INFO << deviceId << ": " << verdict << '\n';
+        for (const auto ruleId : result.ruleIds) {
+          const auto& rule {acl.getRule(ruleId)};
+          LOG_INFO << "  " << rule.priority << ' ' << rule.action
+                   << (rule.description.empty() ? "" : ": ")
+                   << rule.description << '\n';
+        }
+        if (result.anyNoMatch) {
+          LOG_INFO << "  (no matching rule)\n";
+        }
+        LOG_DEBUG << deviceId << ": classified in " << elapsed << "s\n";
+      }
+
+      return nmcu::Exit::SUCCESS;
+    }
+
+    int
+    classifyBatch(pqxx::read_transaction& t,
+                  const std::vector<std::string>& deviceIds) const
+    {
+      const auto& path {opts.getValue("batch-file")};
+      std::ifstream file {path};
+      if (!file) {
+        LOG_ERROR << "Cannot open batch file: " << path << '\n';
+        return nmcu::Exit::FAILURE;
+      }
+
+      // Parse once, each device then only classifies
+      std::vector<nmdu::AclFlow> flows;
+      std::vector<std::string>   lines;
+      std::string line;
+      for (size_t lineNumber {1}; std::getline(file, line); ++lineNumber) {
+        if (line.empty() || '#' == line[0]) {
+          continue;
+        }
+
+        std::istringstream iss {line};
+        std::string srcIp, dstIp;
+        uint32_t srcPort {UINT32_MAX}, dstPort {UINT32_MAX};
+        nmdu::AclFlow flow;
+        iss >> srcIp >> dstIp >> flow.protocol >> srcPort >> dstPort;
+        if (!iss || srcPort > UINT16_MAX || dstPort > UINT16_MAX) {
+          LOG_WARN << path << ':' << lineNumber << ": skipping malformed flow\n";
+          continue;
+        }
+        iss >> flow.incomingIface >> flow.outgoingIface;
+
+        flow.srcIp   = nmdu::IpKey::fromString(srcIp);
+        flow.dstIp   = nmdu::IpKey::fromString(dstIp);
+        flow.srcPort = static_cast<uint16_t>(srcPort);
+        flow.dstPort = static_cast<uint16_t>(dstPort);
+        if (!flow.srcIp.isValid() || !flow.dstIp.isValid()) {
+          LOG_WARN << path << ':' << lineNumber << ": skipping malformed flow\n";
+          continue;
+        }
+
+        flows.push_back(std::move(flow));
+        lines.push_back(srcIp + ' ' + dstIp + ' ' + flows.back().protocol
+                        + ' ' + std::to_string(srcPort)
+                        + ' ' + std::to_string(dstPort));
+      }
+
+      double totalSeconds {0};
+      for (const auto& deviceId : deviceIds) {
+        const auto acl {loadDevice(t, deviceId)};
+
+        const auto start {std::chrono::steady_clock::now()};
+        std::vector<std::optional<size_t>> matches;
+        matches.reserve(flows.size());
+        for (const auto& flow : flows) {
+          matches.push_back(acl.classify(flow));
+        }
+        const auto elapsed {secondsSince(start)};
+        totalSeconds += elapsed;
+
+        std::ostringstream oss;
+        for (size_t i {0}; i < flows.size(); ++i) {
+          oss << deviceId << ' ' << lines[i] << ' ';
+          if (matches[i]) {
+            const auto& rule {acl.getRule(*matches[i])};
+            oss << rule.action << ' ' << rule.priority << '\n';
+          } else {
+            oss << "none -\n";
+          }
+        }
+        LOG_INFO << oss.str();
+
+        LOG_DEBUG << deviceId << ": classified " << flows.size()
+                  << " flows in " << elapsed << "s\n";
+      }
+
+      const size_t count {flows.size() * deviceIds.size()};
+      const double rate {
+        totalSeconds > 0 ? static_cast<double>(count) / totalSeconds : 0
+      };
+      LOG_INFO << "# Classified " << count << " flows in " << totalSeconds
+               << "s (" << static_cast<size_t>(rate) << " flows/s)\n";
+
+      return nmcu::Exit::SUCCESS;
+    }
+
+    static double
+    secondsSince(const std::chrono::steady_clock::time_point& start)
+    {
+      return std::chrono::duration<double>(
+          std::chrono::steady_clock::now() - start).count();
+    }
+
+  protected: // Methods part of subclass API
+  public: // Methods part of public API
+};
+
+
+int
+main(int argc, char** argv)
+{
+  Tool tool;
+  return tool.start(argc, argv);
+}
@@ -0,0 +1,263 @@
+// =============================================================================
+// Copyright 2023 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+// =============================================================================
+
+#include <pqxx/pqxx>
+
+#include <chrono>
+#include <fstream>
+#include <map>
+#include <sstream>
+
+#include <netmeld/datastore/tools/AbstractDatastoreTool.hpp>
+#include <netmeld/datastore/utils/QueriesCommon.hpp>
+#include <netmeld/datastore/utils/RouteTracer.hpp>
+
+namespace nmcu = netmeld::core::utils;
+namespace nmdt = netmeld::datastore::tools;
+namespace nmdu = netmeld::datastore::utils;
+
+
+class Tool : public nmdt::AbstractDatastoreTool
+{
+  // ===========================================================================
+  // Variables
+  // ===========================================================================
+  private: // Variables should generally be private
+  protected: // Variables intended for internal/subclass API
+    // Inhertied from AbstractTool at this scope
+      // std::string            helpBlurb;
+      // std::string            programName;
+      // std::string            version;
+      // ProgramOptions         opts;
+  public: // Variables should rarely appear at this scope
+
+
+  // ===========================================================================
+  // Constructors
+  // ===========================================================================
+  private: // Constructors should rarely appear at this scope
+  protected: // Constructors intended for internal/subclass API
+  public: // Constructors should generally be public
+    Tool() : nmdt::AbstractDatastoreTool
+      ("Trace flows hop-by-hop through the stored device routing tables",
+       PROGRAM_NAME, PROGRAM_VERSION)
+    {}
+
+
+  // ===========================================================================
+  // Methods
+  // ===========================================================================
+  private: // Methods part of internal API
+    void
+    addToolOptions() override
+    {
+      opts.addOptionalOption("src-ip", std::make_tuple(
+          "src-ip",
+          po::value<std::string>(),
+          "Source IP address")
+        );
+      opts.addOptionalOption("dst-ip", std::make_tuple(
+          "dst-ip",
+          po::value<std::string>(),
+          "Destination IP address")
+        );
+      opts.addOptionalOption("max-hops", std::make_tuple(
+          "max-hops",
+          po::value<size_t>()->default_value(64),
+          "Maximum routes followed per trace")
+        );
+      opts.addOptionalOption("batch-file", std::make_tuple(
+          "batch-file",
+          po::value<std::string>(),
+          "File of flows to trace, one per line as: SRC_IP DST_IP;"
+          " replaces the single flow options")
+        );
+    }
+
+    int
+    runTool() override
+    {
+      pqxx::connection db {getDbConnectString()};
+      nmdu::dbPrepareCommon(db);
+
+      pqxx::read_transaction t {db};
+
+      const auto start {std::chrono::steady_clock::now()};
+      const auto tracer {nmdu::RouteTracer::fromDatastore(t)};
+      LOG_DEBUG << "Loaded " << tracer.getRouteCount() << " routes of "
+                << tracer.getTableCount() << " device VRFs in "
+                << secondsSince(start) << "s\n";
+
+      int exitCode {nmcu::Exit::SUCCESS};
+      if (opts.exists("batch-file")) {
+        exitCode = traceBatch(tracer);
+      } else {
+        exitCode = traceSingle(tracer);
+      }
+
+      return exitCode;
+    }
+
+    int
+    traceSingle(const nmdu::RouteTracer& tracer) const
+    {
+      if (!opts.exists("src-ip") || !opts.exists("dst-ip")) {
+        LOG_ERROR << "Both --src-ip and --dst-ip, or --batch-file, required\n";
+        return nmcu::Exit::FAILURE;
+      }
+
+      const auto srcIp {nmdu::IpKey::fromString(opts.getValue("src-ip"))};
+      if (!srcIp.isValid()) {
+        LOG_ERROR << "Invalid --src-ip: " << opts.getValue("src-ip") << '\n';
+        return nmcu::Exit::FAILURE;
+      }
+      const auto dstIp {nmdu::IpKey::fromString(opts.getValue("dst-ip"))};
+      if (!dstIp.isValid()) {
+        LOG_ERROR << "Invalid --dst-ip: " << opts.getValue("dst-ip") << '\n';
+        return nmcu::Exit::FAILURE;
+      }
+
+      const auto trace {
+        tracer.trace(srcIp, dstIp, opts.getValueAs<size_t>("max-hops"))
+      };
+
+      for (const auto& hop : trace.hops) {
+        std::ostringstream oss;
+        oss << hop.deviceId;
+        if (!hop.vrfId.empty()) {
+          oss << " vrf " << hop.vrfId;
+        }
+        oss << ": " << hop.dstIpNet;
+        if (!hop.nextVrfId.empty()) {
+          oss << " to vrf " << hop.nextVrfId;
+        }
+        if (!hop.nextHopIpAddr.empty()) {
+          oss << " via " << hop.nextHopIpAddr;
+        }
+        if (!hop.outgoingIfaceName.empty()) {
+          oss << " out " << hop.outgoingIfaceName;
+        }
+        if (!hop.protocol.empty()) {
+          oss << " (" << hop.protocol << ')';
+        }
+        LOG_INFO << oss.str() << '\n';
+      }
+      LOG_INFO << nmdu::toString(trace.result) << '\n';
+
+      return nmcu::Exit::SUCCESS;
+    }
+
+    int
+    traceBatch(const nmdu::RouteTracer& tracer) const
+    {
+      const auto& path {opts.getValue("batch-file")};
+      std::ifstream file {path};
+      if (!file) {
+        LOG_ERROR << "Cannot open batch file: " << path << '\n';
+        return nmcu::Exit::FAILURE;
+      }
+
+      // Parse first so only the traces are timed
+      std::vector<std::pair<nmdu::IpKey, nmdu::IpKey>> flows;
+      std::vector<std::string> lines;
+      std::string line;
+      for (size_t lineNumber {1}; std::getline(file, line); ++lineNumber) {
+        if (line.empty() || '#' == line[0]) {
+          continue;
+        }
+
+        std::istringstream iss {line};
+        std::string srcIp, dstIp;
+        iss >> srcIp >> dstIp;
+        const auto src {nmdu::IpKey::fromString(srcIp)};
+        const auto dst {nmdu::IpKey::fromString(dstIp)};
+        if (!iss || !src.isValid() || !dst.isValid()) {
+          LOG_WARN << path << ':' << lineNumber << ": skipping malformed flow\n";
+          continue;
+        }
+
+        flows.emplace_back(src, dst);
+        lines.push_back(srcIp + ' ' + dstIp);
+      }
+
+      const auto maxHops {opts.getValueAs<size_t>("max-hops")};
+      const auto start {std::chrono::steady_clock::now()};
+      std::vector<nmdu::RouteTrace> traces;
+      traces.reserve(flows.size());
+      for (const auto& [src, dst] : flows) {
+        traces.push_back(tracer.trace(src, dst, maxHops));
+      }
+      const auto elapsed {secondsSince(start)};
+
+      std::map<std::string, size_t> counts;
+      std::ostringstream oss;
+      for (size_t i {0}; i < traces.size(); ++i) {
+        const auto result {nmdu::toString(traces[i].result)};
+        ++counts[result];
+
+        oss << lines[i] << ' ' << result << ' ' << traces[i].hops.size();
+        for (const auto& hop : traces[i].hops) {
+          oss << ' ' << hop.deviceId;
+          if (!hop.vrfId.empty()) {
+            oss << ':' << hop.vrfId;
+          }
+        }
+        oss << '\n';
+      }
+      LOG_INFO << oss.str();
+
+      std::ostringstream summary;
+      for (const auto& [result, count] : counts) {
+        summary << ", " << count << ' ' << result;
+      }
+      const double rate {
+        elapsed > 0 ? static_cast<double>(flows.size()) / elapsed : 0
+      };
+      LOG_INFO << "# Traced " << flows.size() << " flows in " << elapsed
+               << "s (" << static_cast<size_t>(rate) << " flows/s)"
+               << summary.str() << '\n';
+
+      return nmcu::Exit::SUCCESS;
+    }
+
+    static double
+    secondsSince(const std::chrono::steady_clock::time_point& start)
+    {
+      return std::chrono::duration<double>(
+          std::chrono::steady_clock::now() - start).count();
+    }
+
+  protected: // Methods part of subclass API
+  public: // Methods part of public API
+};
+
+
+int
+main(int argc, char** argv)
+{
+  Tool tool;
+  return tool.start(argc, argv);
+}
@@ -71,6 +71,15 @@ class Tool : public nmdt::AbstractDatastoreTool
          " WHERE (id = $1)");
 
         pqxx::work t {db};
+        // Partitioned data goes with its partitions, the rest by cascade
+        const auto& partitioned {t.exec(
+            "SELECT to_regproc('tool_run_partitions_drop') IS NOT NULL")};
+        if (partitioned.at(0).at(0).as<bool>()) {
+          db.prepare
+          ("drop_tool_run_partitions",
+           "SELECT tool_run_partitions_drop($1)");
+          t.exec_prepared("drop_tool_run_partitions", toolRunId);
+        }
         auto const& results {t.exec_prepared("delete_tool_run", toolRunId)};
         LOG_INFO << "Removal count: " << results.affected_rows() << '\n';
 
@@ -37,7 +37,7 @@ typedef std::vector<uint8_t>  Result;
 
 
 class Parser :
-  public qi::grammar<nmdp::IstreamIter, Result()>
+  public qi::grammar<nmdp::ConstIter, Result()>
 {
   public:
     Parser() : Parser::base_type(start)
@@ -47,7 +47,7 @@ class Parser :
         ;
     }
 
-    qi::rule<nmdp::IstreamIter, Result()>
+    qi::rule<nmdp::ConstIter, Result()>
       start;
 
     qi::uint_parser<uint8_t, 10, 2, 2> decByte;
@@ -38,7 +38,7 @@ namespace nmdp = netmeld::datastore::parsers;
 typedef std::string  Result;
 
 class Parser :
-  public qi::grammar<nmdp::IstreamIter, Result()>
+  public qi::grammar<nmdp::ConstIter, Result()>
 {
   public:
     Parser() : Parser::base_type(start)
@@ -49,7 +49,7 @@ class Parser :
         ;
     }
 
-    qi::rule<nmdp::IstreamIter, Result()>
+    qi::rule<nmdp::ConstIter, Result()>
       start;
 };
 
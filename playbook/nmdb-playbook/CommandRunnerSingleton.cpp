@@ -72,6 +72,12 @@ namespace netmeld::playbook {
     headless = state;
   }
 
+  CommandScheduler&
+  CommandRunnerSingleton::getScheduler()
+  {
+    return scheduler;
+  }
+
   bool
   CommandRunnerSingleton::isEnabled(size_t const commandId) const
   {
@@ -95,11 +101,13 @@ namespace netmeld::playbook {
     return true;
   }
 
-  void
-  CommandRunnerSingleton::threadExec(
-      std::vector<std::tuple<std::string, std::string>> const& commands)
+  // Commands start as the scheduler admits them; see waitExec()
+  std::vector<size_t>
+  CommandRunnerSingleton::queueExec(
+      std::vector<std::tuple<std::string, std::string>> const& commands,
+      CommandTraits const& traits)
   {
-    std::vector<std::thread> threadVector;
+    std::vector<size_t> commandIds;
 
     for (const auto& [commandTitle, command]: commands) {
       if (isEnabled(++commandIdNumber)) {
@@ -111,13 +119,39 @@ namespace netmeld::playbook {
           if(headless) {
             threadActions = &CommandRunnerSingleton::tmuxThreadActions;
           }
-          threadVector.emplace_back(threadActions, this, commandTitle, command);
+
+          const auto commandId {commandIdNumber};
+          scheduler.enqueue(commandId, commandTitle, traits);
+          commandIds.push_back(commandId);
+
+          std::lock_guard<std::mutex> threadsLock {threadsMutex};
+          commandThreads.emplace(commandId, std::thread(
+              [this, threadActions, commandId, commandTitle, command]() {
+                scheduler.acquire(commandId);
+                (this->*threadActions)(commandId, commandTitle, command);
+                scheduler.release(commandId);
+              }));
         }
       }
     }
 
-    for (auto& tv : threadVector) {
-      tv.join();
+    return commandIds;
+  }
+
+  void
+  CommandRunnerSingleton::waitExec(std::vector<size_t> const& commandIds)
+  {
+    scheduler.waitFor(commandIds);
+
+    for (const auto& commandId : commandIds) {
+      std::thread commandThread;
+      {
+        std::lock_guard<std::mutex> threadsLock {threadsMutex};
+        auto it {commandThreads.find(commandId)};
+        commandThread = std::move(it->second);
+        commandThreads.erase(it);
+      }
+      commandThread.join();
     }
   }
 
@@ -135,8 +169,8 @@ namespace netmeld::playbook {
   }
 
   void
-  CommandRunnerSingleton::xtermThreadActions(std::string const& title,
-      std::string const& command) const
+  CommandRunnerSingleton::xtermThreadActions(size_t const,
+      std::string const& title, std::string const& command) const
   {
     std::vector<std::string> xtermArgs = {
       "lxterm",
@@ -152,8 +186,8 @@ namespace netmeld::playbook {
   }
 
   void
-  CommandRunnerSingleton::tmuxThreadActions(std::string const& title,
-      std::string const& command) const
+  CommandRunnerSingleton::tmuxThreadActions(size_t const commandId,
+      std::string const& title, std::string const& command) const
   {
     std::string tmuxSafeTitle {title};
     std::vector<std::tuple<std::regex, std::string>> substitutions {
@@ -164,11 +198,13 @@ namespace netmeld::playbook {
       tmuxSafeTitle = std::regex_replace(tmuxSafeTitle, find, replace);
     }
 
+    const auto& windowName {"playbook-window" + std::to_string(commandId)};
+
     std::vector<std::string> tmuxCommandArgs = {
       "tmux",
       "new-session", "-d",
       "-s", tmuxSafeTitle + "-session",
-      "-n", "playbook-window" + commandIdNumber,
+      "-n", windowName,
       command
     };
     nmcu::forkExecWait(tmuxCommandArgs);
@@ -177,7 +213,7 @@ namespace netmeld::playbook {
     std::vector<std::string> tmuxStyleArgs = {
       "tmux",
       "set-window",
-      "-t", "playbook-window" + commandIdNumber,
+      "-t", windowName,
       "window-style", "bg=black,fg=red"
     };
     nmcu::forkExecWait(tmuxStyleArgs);
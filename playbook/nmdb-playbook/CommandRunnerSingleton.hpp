@@ -28,11 +28,16 @@
 #define COMMAND_RUNNER_SINGLETON_HPP
 
 #include <cstdint>
+#include <map>
+#include <mutex>
 #include <set>
 #include <string>
+#include <thread>
 #include <tuple>
 #include <vector>
 
+#include "CommandScheduler.hpp"
+
 namespace netmeld::playbook {
 
   class CommandRunnerSingleton {
@@ -47,6 +52,11 @@ namespace netmeld::playbook {
       size_t commandIdNumber {0};
       std::set<size_t> disabledCommands;
 
+      CommandScheduler scheduler;
+
+      std::mutex threadsMutex;
+      std::map<size_t, std::thread> commandThreads; // by command ID
+
     public: // Variables should rarely appear at this scope
 
     // =========================================================================
@@ -64,8 +74,10 @@ namespace netmeld::playbook {
     // =========================================================================
     private: // Methods which should be hidden from API users
     protected: // Methods part of subclass API
-      void xtermThreadActions(std::string const&, std::string const&) const;
-      void tmuxThreadActions(std::string const&, std::string const&) const;
+      void xtermThreadActions(size_t const, std::string const&,
+                              std::string const&) const;
+      void tmuxThreadActions(size_t const, std::string const&,
+                             std::string const&) const;
 
     public: // Methods part of public API
       static CommandRunnerSingleton& getInstance();
@@ -74,10 +86,15 @@ namespace netmeld::playbook {
       void setExecute(bool const);
       void setHeadless(bool const);
 
+      CommandScheduler& getScheduler();
+
       bool isEnabled(size_t const) const;
 
       bool systemExec(std::string const&);
-      void threadExec(std::vector<std::tuple<std::string, std::string>> const&);
+      std::vector<size_t> queueExec(
+          std::vector<std::tuple<std::string, std::string>> const&,
+          CommandTraits const&);
+      void waitExec(std::vector<size_t> const&);
 
       void scheduleSleep(uint64_t const);
 
@@ -0,0 +1,234 @@
+// =============================================================================
+// Copyright 2023 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+// =============================================================================
+
+#include <algorithm>
+#include <sstream>
+
+#include <netmeld/core/utils/LoggerSingleton.hpp>
+
+#include "CommandScheduler.hpp"
+#include "RaiiCommon.hpp"
+
+
+namespace netmeld::playbook {
+
+  // ===========================================================================
+  // Methods
+  // ===========================================================================
+  void
+  CommandScheduler::setLimits(size_t const _maxJobs,
+      size_t const _maxIfaceJobs, size_t const _maxLinkJobs)
+  {
+    std::lock_guard<std::mutex> lock {mutex};
+    maxJobs      = _maxJobs;
+    maxIfaceJobs = _maxIfaceJobs;
+    maxLinkJobs  = _maxLinkJobs;
+    changed.notify_all();
+  }
+
+  void
+  CommandScheduler::setStatusInterval(std::chrono::seconds const _interval)
+  {
+    std::lock_guard<std::mutex> lock {mutex};
+    statusInterval = _interval;
+  }
+
+  void
+  CommandScheduler::enqueue(size_t const id, std::string const& title,
+      CommandTraits const& traits)
+  {
+    std::lock_guard<std::mutex> lock {mutex};
+    auto& job {jobs[id]};
+    job.title  = title;
+    job.traits = traits;
+    job.queued = Clock::now();
+    job.order  = nextOrder++;
+    queue.emplace(traits.priority, job.order, id);
+  }
+
+  // Blocks until the command is admitted, which takes one of each token
+  void
+  CommandScheduler::acquire(size_t const id)
+  {
+    std::unique_lock<std::mutex> lock {mutex};
+    changed.wait(lock, [&]{ return isNext(id); });
+
+    auto& job {jobs.at(id)};
+    queue.erase({job.traits.priority, job.order, id});
+    job.state   = State::RUNNING;
+    job.started = Clock::now();
+
+    ++running;
+    ++ifaceRunning[job.traits.ifaceName];
+    ++linkRunning[job.traits.linkName];
+    ++setRunning[job.traits.commandSet];
+
+    // Admission may leave tokens for lower priority commands
+    changed.notify_all();
+  }
+
+  void
+  CommandScheduler::release(size_t const id)
+  {
+    std::ostringstream oss;
+    {
+      std::lock_guard<std::mutex> lock {mutex};
+      auto& job {jobs.at(id)};
+      job.state    = State::FINISHED;
+      job.finished = Clock::now();
+
+      --running;
+      --ifaceRunning[job.traits.ifaceName];
+      --linkRunning[job.traits.linkName];
+      --setRunning[job.traits.commandSet];
+
+      const auto& seconds {std::chrono::duration_cast<std::chrono::seconds>(
+          job.finished - job.started).count()};
+      oss << "# Finished " << id << " (" << seconds << "s): " << job.title;
+
+      changed.notify_all();
+    }
+
+    std::lock_guard<std::mutex> coutLock {coutMutex};
+    LOG_INFO << oss.str() << std::endl;
+  }
+
+  // Reports status, no more than once per interval across all waiters
+  void
+  CommandScheduler::waitFor(std::vector<size_t> const& ids)
+  {
+    auto isDone = [&]{
+      return std::all_of(ids.cbegin(), ids.cend(), [&](size_t id){
+          return State::FINISHED == jobs.at(id).state;
+        });
+    };
+
+    std::unique_lock<std::mutex> lock {mutex};
+    while (!isDone()) {
+      if (0 == statusInterval.count()) {
+        changed.wait(lock, isDone);
+        break;
+      }
+
+      const auto& now {Clock::now()};
+      if (now - lastStatus >= statusInterval) {
+        lastStatus = now;
+        const auto& status {toStatusStringLocked()};
+        lock.unlock();
+        {
+          std::lock_guard<std::mutex> coutLock {coutMutex};
+          LOG_INFO << status;
+        }
+        lock.lock();
+        continue;
+      }
+
+      changed.wait_until(lock, lastStatus + statusInterval);
+    }
+  }
+
+  std::string
+  CommandScheduler::toStatusString() const
+  {
+    std::lock_guard<std::mutex> lock {mutex};
+    return toStatusStringLocked();
+  }
+
+  bool
+  CommandScheduler::isAdmissible(const Job& job) const
+  {
+    auto hasToken = [](const std::map<std::string, size_t>& counts,
+                       const std::string& key, size_t limit)
+    {
+      if (0 == limit) {
+        return true;
+      }
+      const auto& it {counts.find(key)};
+      return (counts.cend() == it) || (it->second < limit);
+    };
+
+    const auto& traits {job.traits};
+    return (0 == maxJobs || running < maxJobs)
+        && hasToken(ifaceRunning, traits.ifaceName, maxIfaceJobs)
+        && hasToken(linkRunning, traits.linkName, maxLinkJobs)
+        && hasToken(setRunning, traits.commandSet, traits.maxSetJobs)
+        ;
+  }
+
+  // A command is next if no queued command ahead of it could run now
+  bool
+  CommandScheduler::isNext(size_t const id) const
+  {
+    for (const auto& entry : queue) {
+      const auto& queuedId {std::get<2>(entry)};
+      if (isAdmissible(jobs.at(queuedId))) {
+        return queuedId == id;
+      }
+    }
+    return false;
+  }
+
+  std::string
+  CommandScheduler::toStatusStringLocked() const
+  {
+    size_t numQueued {0}, numRunning {0}, numFinished {0};
+    std::ostringstream details;
+    const auto& now {Clock::now()};
+    for (const auto& [id, job] : jobs) {
+      switch (job.state) {
+        case State::QUEUED:
+        {
+          ++numQueued;
+          details << "#   " << id << " queued "
+                  << std::chrono::duration_cast<std::chrono::seconds>(
+                       now - job.queued).count()
+                  << "s: " << job.title << '\n';
+          break;
+        }
+        case State::RUNNING:
+        {
+          ++numRunning;
+          details << "#   " << id << " running "
+                  << std::chrono::duration_cast<std::chrono::seconds>(
+                       now - job.started).count()
+                  << "s: " << job.title << '\n';
+          break;
+        }
+        case State::FINISHED:
+        {
+          ++numFinished;
+          break;
+        }
+      }
+    }
+
+    std::ostringstream oss;
+    oss << "# Commands: " << numQueued << " queued, " << numRunning
+        << " running, " << numFinished << " finished\n"
+        << details.str();
+    return oss.str();
+  }
+}
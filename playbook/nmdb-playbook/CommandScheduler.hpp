@@ -0,0 +1,133 @@
+// =============================================================================
+// Copyright 2023 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+// =============================================================================
+
+#ifndef COMMAND_SCHEDULER_HPP
+#define COMMAND_SCHEDULER_HPP
+
+#include <chrono>
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <set>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace netmeld::playbook {
+
+  // ===========================================================================
+  // Scheduling constraints for a command; a zero limit is unbounded
+  // ===========================================================================
+  struct CommandTraits
+  {
+    std::string commandSet  {""}; // plays file command set name
+    std::string ifaceName   {""}; // physical interface
+    std::string linkName    {""}; // VLAN (or physical) link sourcing traffic
+    int         priority    {0};  // lower values are admitted first
+    size_t      maxSetJobs  {0};  // running commands from this command set
+  };
+
+
+  // ===========================================================================
+  // Admits queued commands, in priority order, once the running command,
+  // per-interface, per-link, and per-command-set tokens allow
+  // ===========================================================================
+  class CommandScheduler {
+    // =========================================================================
+    // Variables
+    // =========================================================================
+    private: // Variables will probably rarely appear at this scope
+      using Clock = std::chrono::steady_clock;
+
+      enum class State { QUEUED, RUNNING, FINISHED };
+
+      struct Job
+      {
+        std::string       title;
+        CommandTraits     traits;
+        State             state {State::QUEUED};
+        size_t            order {0};
+        Clock::time_point queued;
+        Clock::time_point started;
+        Clock::time_point finished;
+      };
+
+      mutable std::mutex      mutex;
+      std::condition_variable changed;
+
+      std::map<size_t, Job> jobs; // by command ID
+      // (priority, order, command ID); order keeps submission order
+      std::set<std::tuple<int, size_t, size_t>> queue;
+      size_t nextOrder {0};
+
+      size_t maxJobs      {0};
+      size_t maxIfaceJobs {0};
+      size_t maxLinkJobs  {0};
+
+      size_t running {0};
+      std::map<std::string, size_t> ifaceRunning;
+      std::map<std::string, size_t> linkRunning;
+      std::map<std::string, size_t> setRunning;
+
+      std::chrono::seconds statusInterval {60};
+      Clock::time_point    lastStatus     {Clock::now()};
+
+    protected: // Variables intended for internal/subclass API
+    public: // Variables should rarely appear at this scope
+
+    // =========================================================================
+    // Constructors
+    // =========================================================================
+    private: // Constructors which should be hidden from API users
+    protected: // Constructors part of subclass API
+    public: // Constructors part of public API
+      CommandScheduler() = default;
+      CommandScheduler(CommandScheduler const&) = delete;
+
+    // =========================================================================
+    // Methods
+    // =========================================================================
+    private: // Methods which should be hidden from API users
+      bool isAdmissible(const Job&) const;
+      bool isNext(size_t) const;
+      std::string toStatusStringLocked() const;
+
+    protected: // Methods part of subclass API
+    public: // Methods part of public API
+      void setLimits(size_t, size_t, size_t);
+      void setStatusInterval(std::chrono::seconds);
+
+      void enqueue(size_t, std::string const&, CommandTraits const&);
+      void acquire(size_t);
+      void release(size_t);
+      void waitFor(std::vector<size_t> const&);
+
+      std::string toStatusString() const;
+
+      void operator=(CommandScheduler const&) = delete;
+  };
+}
+#endif // COMMAND_SCHEDULER_HPP
@@ -51,6 +51,7 @@ namespace nmpbu = netmeld::playbook::utils;
 
 // Start of OLD PLAYBOOK DATA
 
+#include <chrono>
 #include <map>
 #include <mutex>
 #include <thread>
@@ -91,6 +92,7 @@ struct PhaseConfig
   std::string target            {""};
 
   std::string srcIpAddr         {""};
+  std::string ifaceName         {""};
   std::string linkName          {""};
   std::string ipNet             {""};
   std::string ipNetBcast        {""};
@@ -108,6 +110,7 @@ struct PhaseConfig
         << "\"playbookSourceId\": \"" << pbSourceId
         << "\", \"target\": \"" << target
         << "\", \"srcIpAddr\": \"" << srcIpAddr
+        << "\", \"ifaceName\": \"" << ifaceName
         << "\", \"linkName\": \"" << linkName
         << "\", \"ipNet\": \"" << ipNet
         << "\", \"ipNetBcast\": \"" << ipNetBcast
@@ -309,6 +312,31 @@ class Tool : public nmdt::AbstractDatastoreTool
           "; Space separated list"
           "; This can break expected logic in some cases")
         );
+      opts.addAdvancedOption("max-jobs", std::make_tuple(
+          "max-jobs",
+          po::value<size_t>()->default_value(
+            std::max(1U, std::thread::hardware_concurrency())),
+          "Maximum parallel commands running at once; 0 is unbounded"
+          "; Defaults to the number of CPUs")
+        );
+      opts.addAdvancedOption("max-iface-jobs", std::make_tuple(
+          "max-iface-jobs",
+          po::value<size_t>()->default_value(0),
+          "Maximum parallel commands running per physical interface"
+          "; 0 is unbounded")
+        );
+      opts.addAdvancedOption("max-link-jobs", std::make_tuple(
+          "max-link-jobs",
+          po::value<size_t>()->default_value(0),
+          "Maximum parallel commands running per VLAN (or physical) link"
+          "; 0 is unbounded")
+        );
+      opts.addAdvancedOption("status-interval", std::make_tuple(
+          "status-interval",
+          po::value<size_t>()->default_value(60),
+          "Seconds between status reports of queued and running commands"
+          "; 0 disables them")
+        );
       opts.addAdvancedOption("queries-file", std::make_tuple(
           "queries-file",
           po::value<std::string>()->required()
@@ -341,6 +369,14 @@ class Tool : public nmdt::AbstractDatastoreTool
       // Prompt, or not
       noPrompt = opts.exists("no-prompt");
 
+      // Bound parallel commands, as they are scheduled across links
+      auto& scheduler {cmdRunner.getScheduler()};
+      scheduler.setLimits(opts.getValueAs<size_t>("max-jobs"),
+                          opts.getValueAs<size_t>("max-iface-jobs"),
+                          opts.getValueAs<size_t>("max-link-jobs"));
+      scheduler.setStatusInterval(std::chrono::seconds(
+          opts.getValueAs<size_t>("status-interval")));
+
       // Create directory for meta-data about and results from this tool run
       pbRootSavePath = opts.getValue("save-path");
 
@@ -847,6 +883,7 @@ class Tool : public nmdt::AbstractDatastoreTool
           PhaseConfig pc;
           pc.family           = std::to_string(srcConf.addrFamily);
           pc.pbSourceId       = srcConf.playbookSourceId.toString();
+          pc.ifaceName        = physIfaceName;
           pc.linkName         = linkName;
           pc.srcIpAddr        = srcIpAddr;
           pc.dbConnectString  = dbConnectString;
@@ -982,7 +1019,7 @@ class Tool : public nmdt::AbstractDatastoreTool
           addPhaseCommands(commands, yCmdSet["always"], phaseConf);
           addPhaseCommands(commands, yCmdSet[addrFamily], phaseConf);
 
-          stageEnabled = runPhaseCommands(commands, yCmdSet);
+          stageEnabled = runPhaseCommands(commands, yCmdSet, phaseConf);
         }
 
         // update in case of alternate logic
@@ -1018,7 +1055,7 @@ class Tool : public nmdt::AbstractDatastoreTool
     bool
     runPhaseCommands(
       const std::vector<std::tuple<std::string, std::string>>& commands,
-      const YAML::Node& yCmdSet)
+      const YAML::Node& yCmdSet, const PhaseConfig& phaseConf)
     {
       bool stageEnabled       {true};
       const auto& cmdSetName  {yCmdSet["name"].as<std::string>()};
@@ -1050,12 +1087,29 @@ class Tool : public nmdt::AbstractDatastoreTool
         }
       }
       else
-      { // Add commands to phase in parallel
-        std::lock_guard<std::mutex> coutLock {nmpb::coutMutex};
-        LOG_DEBUG << "# Ran in parallel";
-        LOG_INFO << "\n## " << cmdSetName
-                 << std::endl;
-        cmdRunner.threadExec(commands);
+      { // Add commands to phase in parallel, as the scheduler admits them
+        nmpb::CommandTraits traits;
+        traits.commandSet = cmdSetName;
+        traits.ifaceName  = phaseConf.ifaceName;
+        traits.linkName   = phaseConf.linkName;
+        if (yCmdSet["priority"].IsDefined()) {
+          traits.priority = yCmdSet["priority"].as<int>();
+        }
+        if (yCmdSet["max-jobs"].IsDefined()) {
+          traits.maxSetJobs = yCmdSet["max-jobs"].as<size_t>();
+        }
+
+        std::vector<size_t> commandIds;
+        {
+          std::lock_guard<std::mutex> coutLock {nmpb::coutMutex};
+          LOG_DEBUG << "# Ran in parallel";
+          LOG_INFO << "\n## " << cmdSetName
+                   << std::endl;
+          commandIds = cmdRunner.queueExec(commands, traits);
+        }
+
+        // Output lock released so other links can queue while these run
+        cmdRunner.waitExec(commandIds);
       }
 
       return stageEnabled;